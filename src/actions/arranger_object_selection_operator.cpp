@@ -817,6 +817,33 @@ ArrangerObjectSelectionOperator::setStretchAlgorithm (
   return true;
 }
 
+bool
+ArrangerObjectSelectionOperator::applyAudioFunction (
+  AudioFunctionBatchExecutor * executor,
+  int                          type,
+  double                       amount)
+{
+  z_return_val_if_fail (executor != nullptr, false);
+
+  std::vector<structure::arrangement::AudioClip *> targets;
+  for (const auto &obj_ref : extractSelectedObjects ())
+    {
+      auto * clip = obj_ref.get_object_as<structure::arrangement::AudioClip> ();
+      if (clip != nullptr)
+        targets.push_back (clip);
+    }
+
+  if (targets.empty ())
+    {
+      z_debug ("No audio clips selected");
+      return false;
+    }
+
+  return executor->apply (
+    targets, static_cast<structure::arrangement::AudioFunctionType> (type),
+    structure::arrangement::AudioFunctionOpts{ .amount_ = amount });
+}
+
 bool
 ArrangerObjectSelectionOperator::setTimebaseOverride (dsp::Timebase timebase)
 {
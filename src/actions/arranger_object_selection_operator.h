@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "actions/audio_function_batch_executor.h"
 #include "commands/change_qobject_property_command.h"
 #include "commands/resize_arranger_objects_command.h"
 #include "structure/arrangement/arranger_object_factory.h"
@@ -145,6 +146,20 @@ public:
   /// clip).
   Q_INVOKABLE bool selectionHasTimebaseProviders () const;
 
+  /**
+   * @brief Applies an audio function to all selected AudioClips in the
+   * background.
+   *
+   * @param type An AudioFunctionType value.
+   * @param amount See AudioFunctionOpts::amount_.
+   * @return false if no audio clips are selected or @p executor couldn't
+   * start the batch.
+   */
+  Q_INVOKABLE bool applyAudioFunction (
+    AudioFunctionBatchExecutor * executor,
+    int                          type,
+    double                       amount);
+
 private:
   auto extractSelectedObjects () const -> SelectedObjectsVector;
 
@@ -0,0 +1,318 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include "actions/audio_function_batch_executor.h"
+#include "commands/add_arranger_object_command.h"
+#include "commands/remove_arranger_object_command.h"
+#include "utils/logger.h"
+#include "utils/registry_utils.h"
+
+#include <QtConcurrentMap>
+
+namespace zrythm::actions
+{
+
+using namespace structure::arrangement;
+
+struct AudioFunctionBatchExecutor::Job
+{
+  /** Clips using the source (each shared source is processed once). */
+  std::vector<ArrangerObjectUuidReference> clips;
+
+  utils::audio::AudioBuffer samples;
+  units::sample_rate_t      sample_rate;
+  units::bpm_t              bpm;
+  utils::Utf8String         name;
+
+  /** Set in start_writing(). */
+  std::optional<dsp::FileAudioSourceUuidReference> result;
+  const dsp::FileAudioSource *                     result_source{};
+};
+
+/**
+ * @brief State shared with the workers.
+ *
+ * Workers only touch their own Job, the cancelled flag and the error.
+ */
+struct AudioFunctionBatchExecutor::Batch
+{
+  AudioFunctionType type{};
+  AudioFunctionOpts opts;
+  std::vector<Job>  jobs;
+
+  std::atomic<bool> cancelled{ false };
+
+  std::mutex  error_mutex;
+  std::string error;
+
+  void fail (std::string_view message)
+  {
+    {
+      std::scoped_lock lock (error_mutex);
+      if (error.empty ())
+        error = message;
+    }
+    cancelled = true;
+  }
+
+  /**
+   * Drops the registry references held by the jobs.
+   *
+   * Must be called on the main thread: workers may hold on to the batch for a
+   * little while after they finish, and the registry is not thread-safe.
+   */
+  void release_references ()
+  {
+    for (auto &job : jobs)
+      {
+        job.clips.clear ();
+        job.result.reset ();
+        job.result_source = nullptr;
+      }
+  }
+};
+
+AudioFunctionBatchExecutor::AudioFunctionBatchExecutor (
+  undo::UndoStack       &undoStack,
+  ArrangerObjectFactory &objectFactory,
+  PoolWriter             poolWriter,
+  QObject *              parent)
+    : QObject (parent), undo_stack_ (undoStack),
+      object_factory_ (objectFactory), pool_writer_ (std::move (poolWriter))
+{
+  QObject::connect (
+    &watcher_, &QFutureWatcher<void>::progressValueChanged, this,
+    [this] (int value) {
+      progress_value_ = progress_offset_ + value;
+      Q_EMIT progressChanged ();
+    });
+}
+
+AudioFunctionBatchExecutor::~AudioFunctionBatchExecutor ()
+{
+  // Workers hold a reference to the batch, but the pool writer may refer to
+  // objects that are about to be destroyed
+  if (batch_)
+    {
+      batch_->cancelled = true;
+      watcher_.waitForFinished ();
+      batch_->release_references ();
+    }
+}
+
+bool
+AudioFunctionBatchExecutor::apply (
+  const std::vector<AudioClip *> &clips,
+  AudioFunctionType               type,
+  AudioFunctionOpts               opts)
+{
+  if (batch_)
+    {
+      z_warning ("An audio function batch is already running");
+      return false;
+    }
+  if (!audio_function_is_batchable (type))
+    {
+      z_warning ("Audio function {} can't be applied in batch", type);
+      return false;
+    }
+
+  auto batch = std::make_shared<Batch> ();
+  batch->type = type;
+  batch->opts = opts;
+
+  // Snapshot the audio on this thread, since the sources may be edited while
+  // the workers run
+  std::unordered_map<dsp::FileAudioSource::Uuid, size_t> job_indices;
+  for (auto * clip : clips)
+    {
+      const auto &children = clip->get_children_vector ();
+      if (children.empty ())
+        continue;
+
+      const auto &source =
+        children.front ()
+          .get_object_as<AudioSourceObject> ()
+          ->file_audio_source ();
+      const auto [it, inserted] =
+        job_indices.try_emplace (source.get_uuid (), batch->jobs.size ());
+      if (inserted)
+        {
+          batch->jobs.push_back (
+            Job{
+              .samples = source.get_samples (),
+              .sample_rate = source.get_samplerate (),
+              .bpm = source.source_bpm (),
+              .name = source.get_name (),
+            });
+        }
+      batch->jobs[it->second].clips.emplace_back (
+        clip->get_uuid (), object_factory_.registry ());
+    }
+
+  if (batch->jobs.empty ())
+    {
+      z_debug ("No audio clips to apply {} to", type);
+      return false;
+    }
+
+  z_debug (
+    "Applying {} to {} source(s) used by {} clip(s)", type, batch->jobs.size (),
+    clips.size ());
+
+  batch_ = batch;
+  progress_maximum_ = static_cast<int> (batch->jobs.size ()) * 2;
+  progress_value_ = 0;
+  Q_EMIT runningChanged (true);
+  Q_EMIT progressChanged ();
+
+  // The functor holds a reference to the batch so the jobs outlive the map
+  // even if this executor is destroyed mid-run
+  auto future = QtConcurrent::map (batch->jobs, [batch] (Job &job) {
+    if (batch->cancelled)
+      return;
+    try
+      {
+        audio_function_process (
+          batch->type, batch->opts, job.samples, job.sample_rate);
+      }
+    catch (const std::exception &e)
+      {
+        batch->fail (
+          fmt::format ("Failed to process {}: {}", job.name, e.what ()));
+      }
+  });
+  watch (future, 0);
+  future.then (this, [this] () { start_writing (); });
+
+  return true;
+}
+
+void
+AudioFunctionBatchExecutor::start_writing ()
+{
+  if (batch_->cancelled)
+    {
+      finish (false);
+      return;
+    }
+
+  for (auto &job : batch_->jobs)
+    {
+      job.result = utils::create_object<dsp::FileAudioSource> (
+        object_factory_.registry (), job.samples,
+        utils::audio::BitDepth::BIT_DEPTH_32, job.sample_rate, job.bpm,
+        job.name);
+      job.result_source = job.result->get_object_as<dsp::FileAudioSource> ();
+
+      // The source keeps its own copy
+      job.samples = {};
+    }
+
+  auto future = QtConcurrent::map (
+    batch_->jobs, [batch = batch_, writer = pool_writer_] (Job &job) {
+      if (batch->cancelled)
+        return;
+      try
+        {
+          writer (*job.result_source);
+        }
+      catch (const std::exception &e)
+        {
+          batch->fail (
+            fmt::format ("Failed to write {}: {}", job.name, e.what ()));
+        }
+    });
+  watch (future, static_cast<int> (batch_->jobs.size ()));
+  future.then (this, [this] () { commit (); });
+}
+
+void
+AudioFunctionBatchExecutor::commit ()
+{
+  if (batch_->cancelled)
+    {
+      finish (false);
+      return;
+    }
+
+  size_t num_clips = 0;
+  for (const auto &job : batch_->jobs)
+    num_clips += job.clips.size ();
+
+  {
+    undo::UndoStack::ScopedMacro macro (
+      undo_stack_,
+      QObject::tr ("Apply %1 to %2 Clip(s)")
+        .arg (AudioFunctionType_to_string (batch_->type, true).to_qstring ())
+        .arg (num_clips));
+    for (const auto &job : batch_->jobs)
+      {
+        for (const auto &clip_ref : job.clips)
+          {
+            auto * clip = clip_ref.get_object_as<AudioClip> ();
+            const auto &children = clip->get_children_vector ();
+            if (children.empty ())
+              continue;
+
+            const auto old_source_ref = children.front ();
+            auto new_source_ref =
+              object_factory_.create_audio_source_object (*job.result);
+            new_source_ref.get ()->position ()->setTicks (
+              old_source_ref.get ()->position ()->ticks ());
+
+            undo_stack_.push (
+              new commands::RemoveArrangerObjectCommand<AudioSourceObject> (
+                *clip, old_source_ref));
+            undo_stack_.push (
+              new commands::AddArrangerObjectCommand<AudioSourceObject> (
+                *clip, new_source_ref));
+          }
+      }
+  }
+
+  finish (true);
+}
+
+void
+AudioFunctionBatchExecutor::cancel ()
+{
+  if (batch_)
+    batch_->cancelled = true;
+}
+
+void
+AudioFunctionBatchExecutor::finish (bool committed)
+{
+  {
+    std::scoped_lock lock (batch_->error_mutex);
+    if (!batch_->error.empty ())
+      z_warning ("{}", batch_->error);
+  }
+  z_debug ("Audio function batch finished (committed: {})", committed);
+
+  // Sources of a cancelled batch are no longer referenced and get deleted here
+  batch_->release_references ();
+  batch_.reset ();
+  progress_value_ = 0;
+  progress_maximum_ = 0;
+  Q_EMIT progressChanged ();
+  Q_EMIT runningChanged (false);
+  Q_EMIT finished (committed);
+}
+
+void
+AudioFunctionBatchExecutor::watch (
+  const QFuture<void> &future,
+  int                  progress_offset)
+{
+  progress_offset_ = progress_offset;
+  watcher_.setFuture (future);
+}
+
+} // namespace zrythm::actions
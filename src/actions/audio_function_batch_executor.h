@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "structure/arrangement/arranger_object_factory.h"
+#include "structure/arrangement/audio_clip.h"
+#include "structure/arrangement/audio_function.h"
+#include "undo/undo_stack.h"
+
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QtQmlIntegration/qqmlintegration.h>
+
+namespace zrythm::actions
+{
+
+/**
+ * @brief Applies an audio function to many audio clips without blocking the
+ * UI.
+ *
+ * A batch runs in 3 steps:
+ * 1. The DSP is applied to a copy of each clip's audio on the global thread
+ *    pool. Clips that share a FileAudioSource are processed once.
+ * 2. The results become new FileAudioSource's, which are written to the pool
+ *    in parallel.
+ * 3. Each clip's AudioSourceObject is swapped for one pointing to the new
+ *    source, all in a single undo macro.
+ *
+ * Nothing is committed until step 3, so cancelling (or a failure in any clip)
+ * leaves the project untouched. Files already written by a cancelled batch
+ * are left in the pool and get cleaned up with other unused pool files.
+ *
+ * Only one batch can run at a time.
+ */
+class AudioFunctionBatchExecutor : public QObject
+{
+  Q_OBJECT
+  Q_PROPERTY (bool running READ running NOTIFY runningChanged)
+  Q_PROPERTY (int progressValue READ progressValue NOTIFY progressChanged)
+  Q_PROPERTY (int progressMaximum READ progressMaximum NOTIFY progressChanged)
+  QML_ELEMENT
+  QML_UNCREATABLE ("One instance per project")
+
+public:
+  /**
+   * @brief Writes a newly created source to the pool.
+   *
+   * Called from worker threads, concurrently for different sources.
+   *
+   * @throw ZrythmException on error.
+   */
+  using PoolWriter = std::function<void (const dsp::FileAudioSource &source)>;
+
+  AudioFunctionBatchExecutor (
+    undo::UndoStack                               &undoStack,
+    structure::arrangement::ArrangerObjectFactory &objectFactory,
+    PoolWriter                                     poolWriter,
+    QObject *                                      parent = nullptr);
+  ~AudioFunctionBatchExecutor () override;
+
+  bool running () const { return batch_ != nullptr; }
+  int  progressValue () const { return progress_value_; }
+  int  progressMaximum () const { return progress_maximum_; }
+
+  /**
+   * @brief Starts applying @p type to @p clips.
+   *
+   * Clips without audio are skipped.
+   *
+   * @return False if nothing was started (a batch is already running, no
+   * clip has audio or @p type is not batchable). Otherwise, finished() is
+   * emitted once the batch is done.
+   */
+  bool apply (
+    const std::vector<structure::arrangement::AudioClip *> &clips,
+    structure::arrangement::AudioFunctionType               type,
+    structure::arrangement::AudioFunctionOpts               opts);
+
+  /**
+   * @brief Cancels the running batch, if any.
+   *
+   * finished(false) is emitted once the workers have stopped.
+   */
+  Q_INVOKABLE void cancel ();
+
+Q_SIGNALS:
+  void runningChanged (bool running);
+  void progressChanged ();
+
+  /**
+   * @param committed Whether the changes were pushed to the undo stack.
+   */
+  void finished (bool committed);
+
+private:
+  struct Job;
+  struct Batch;
+
+  void start_writing ();
+  void commit ();
+  void finish (bool committed);
+
+  /** Reports the progress of @p future, offset by @p progress_offset. */
+  void watch (const QFuture<void> &future, int progress_offset);
+
+  undo::UndoStack                               &undo_stack_;
+  structure::arrangement::ArrangerObjectFactory &object_factory_;
+  PoolWriter                                     pool_writer_;
+
+  std::shared_ptr<Batch> batch_;
+  QFutureWatcher<void>   watcher_;
+  int                    progress_offset_ = 0;
+  int                    progress_value_ = 0;
+  int                    progress_maximum_ = 0;
+};
+
+} // namespace zrythm::actions
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <utility>
+
+#include "structure/tracks/track.h"
+
+#include <QUndoCommand>
+
+namespace zrythm::commands
+{
+/**
+ * @brief Command that freezes a track with rendered audio, or unfreezes it.
+ *
+ * The graph must be recalculated after this command (see
+ * UndoStack::command_or_children_require_graph_recalculation()).
+ */
+class FreezeTrackCommand : public QUndoCommand
+{
+public:
+  static constexpr auto CommandId = 1792741356;
+
+  /**
+   * @param frozen_audio Pool file to freeze the track with, or nullopt to
+   * unfreeze it.
+   */
+  FreezeTrackCommand (
+    structure::tracks::Track                        &track,
+    std::optional<dsp::FileAudioSourceUuidReference> frozen_audio)
+      : QUndoCommand (
+          frozen_audio.has_value ()
+            ? QObject::tr ("Freeze Track")
+            : QObject::tr ("Unfreeze Track")),
+        track_ (track), frozen_audio_after_ (std::move (frozen_audio))
+  {
+  }
+
+  int id () const override { return CommandId; }
+
+  void undo () override { track_.set_frozen_audio (frozen_audio_before_); }
+  void redo () override
+  {
+    // keeping the previous frozen audio referenced here keeps it in the pool
+    // for as long as the command can be undone
+    frozen_audio_before_ = track_.frozen_audio ();
+    track_.set_frozen_audio (frozen_audio_after_);
+  }
+
+private:
+  structure::tracks::Track                        &track_;
+  std::optional<dsp::FileAudioSourceUuidReference> frozen_audio_before_;
+  std::optional<dsp::FileAudioSourceUuidReference> frozen_audio_after_;
+};
+
+} // namespace zrythm::commands
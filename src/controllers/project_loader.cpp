@@ -7,6 +7,7 @@
 #include "controllers/project_loader.h"
 #include "controllers/project_saver.h"
 #include "plugins/plugin.h"
+#include "structure/project/project.h"
 #include "structure/project/project_path_provider.h"
 #include "structure/project/project_ui_state.h"
 #include "undo/undo_stack.h"
@@ -121,14 +122,17 @@ ProjectLoader::deserialize (
 {
   ProjectJsonSerializer::deserialize (j, project, ui_state, undo_stack);
 
-  // Load audio files for each FileAudioSource
-  project.pool_->init_loaded ();
+  // Decode the pool files on worker threads while the plugins instantiate
+  auto pool_future = project.pool_->init_loaded_async ();
 
   // Wait for all asynchronously-instantiating plugins to finish.
   // JUCE (VST3/AU) plugins instantiate asynchronously — deserialization
   // triggers the init but returns before it completes. If we don't wait,
   // the engine can start processing before buffers are allocated.
   wait_for_plugin_instantiations (project);
+
+  pool_future.waitForFinished ();
+  project.pool_->finish_init_loaded ();
 }
 
 void
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include "utils/format_qt.h"
+
+#include "commands/freeze_track_command.h"
+#include "controllers/track_freezer.h"
+#include "dsp/graph_pruner.h"
+#include "dsp/graph_renderer.h"
+#include "structure/project/project.h"
+#include "structure/project/project_graph_builder.h"
+#include "undo/undo_stack.h"
+#include "utils/registry_utils.h"
+
+#include <QPointer>
+
+namespace zrythm::controllers
+{
+
+TrackFreezer::TrackFreezer (
+  structure::project::Project &project,
+  undo::UndoStack             &undo_stack,
+  QObject *                    parent)
+    : QObject (parent), project_ (project), undo_stack_ (undo_stack)
+{
+}
+
+QFuture<utils::audio::AudioBuffer>
+TrackFreezer::render_pre_fader (
+  structure::project::Project &project,
+  structure::tracks::Track    &track)
+{
+  auto * channel = track.channel ();
+  if (channel == nullptr || !channel->is_audio ())
+    {
+      throw ZrythmException (
+        fmt::format ("Track '{}' has no audio to render", track.get_name ()));
+    }
+
+  const auto * marker_track =
+    project.tracklist ()->singletonTracks ()->markerTrack ();
+  const auto range = std::make_pair (
+    units::samples (static_cast<int64_t> (0)),
+    project.tempo_map ().tick_to_samples_rounded (
+      marker_track->get_end_marker ()->position ()->asTick ()));
+  if (range.second <= range.first)
+    {
+      throw ZrythmException (
+        fmt::format (
+          "Nothing to render for track '{}' before the end marker",
+          track.get_name ()));
+    }
+
+  auto * engine = project.engine ();
+  dsp::GraphRenderer::RenderOptions options{
+    .sample_rate_ = engine->sample_rate (),
+    .block_length_ = engine->block_length (),
+  };
+  dsp::AudioEngine::EngineState state{};
+  engine->wait_for_pause (state, false, true);
+
+  // Rendering prepares the project's processors for the renderer's own
+  // graph, so the live graph is rebuilt before the engine resumes
+  const auto resume_engine = [engine, state] () {
+    engine->graph_dispatcher ().recalc_graph (false);
+    engine->resume (state);
+  };
+
+  // Prune graph to the track's pre-fader output, leaving the fader and sends
+  // (and the rest of the project) out of the render
+  dsp::graph::Graph graph;
+  try
+    {
+      structure::project::ProjectGraphBuilder builder (
+        project, project.metronome (), project.monitor_fader ());
+      builder.build_graph (graph);
+
+      auto * node = graph.get_nodes ().find_node_for_processable (
+        channel->get_audio_pre_fader ().get_audio_out_port ());
+      if (node == nullptr)
+        {
+          throw ZrythmException (
+            fmt::format (
+              "Pre-fader of track '{}' is not part of the graph",
+              track.get_name ()));
+        }
+      std::vector<std::reference_wrapper<dsp::graph::GraphNode>> terminals;
+      terminals.emplace_back (*node);
+      dsp::graph::GraphPruner::prune_graph_to_terminals (graph, terminals);
+    }
+  catch (const ZrythmException &)
+    {
+      resume_engine ();
+      throw;
+    }
+
+  z_info ("Rendering track '{}' (range {})", track.get_name (), range);
+  auto render_future = dsp::GraphRenderer::render_async (
+    options, graph.steal_nodes (),
+    [context = &project] (std::function<void ()> func) {
+      QMetaObject::invokeMethod (context, func, Qt::BlockingQueuedConnection);
+    },
+    range, project.tempo_map ());
+
+  // Continuations taking the future run on cancellation and failure as well,
+  // so the engine is always resumed
+  const auto num_frames = (range.second - range.first).in<int> (units::samples);
+  return render_future.then (
+    engine,
+    [resume_engine, num_frames] (QFuture<juce::AudioSampleBuffer> result) {
+      resume_engine ();
+
+      // Rethrows the render's exception, if any
+      result.waitForFinished ();
+      if (result.resultCount () == 0)
+        {
+          throw ZrythmException ("Rendering was cancelled");
+        }
+
+      // The render starts with the graph's latency preroll
+      const auto &rendered = result.result ();
+      const auto  preroll = rendered.getNumSamples () - num_frames;
+      assert (preroll >= 0);
+      utils::audio::AudioBuffer frames (rendered.getNumChannels (), num_frames);
+      for (int ch = 0; ch < rendered.getNumChannels (); ++ch)
+        {
+          frames.copyFrom (ch, 0, rendered, ch, preroll, num_frames);
+        }
+      return frames;
+    });
+}
+
+QFuture<void>
+TrackFreezer::freeze (structure::tracks::Track &track)
+{
+  if (track.frozen () || !track.can_freeze ())
+    {
+      throw ZrythmException (
+        fmt::format ("Track '{}' cannot be frozen", track.get_name ()));
+    }
+
+  return render_pre_fader (project_, track)
+    .then (
+      this,
+      [this, track_ptr = QPointer<structure::tracks::Track> (&track)] (
+        const utils::audio::AudioBuffer &frames) {
+        // The track may have been deleted or frozen meanwhile
+        if (track_ptr == nullptr || track_ptr->frozen ())
+          return;
+
+        auto source = utils::create_object<dsp::FileAudioSource> (
+          project_.get_registry (), frames,
+          utils::audio::BitDepth::BIT_DEPTH_32,
+          project_.engine ()->sample_rate (),
+          project_.tempo_map ().tempo_at_tick (units::ticks (0)),
+          track_ptr->get_name () + u8" (Frozen)");
+        undo_stack_.push (
+          new commands::FreezeTrackCommand (*track_ptr, std::move (source)));
+        z_info ("Froze track '{}'", track_ptr->get_name ());
+      });
+}
+
+void
+TrackFreezer::freezeTrack (structure::tracks::Track * track)
+{
+  if (track == nullptr)
+    return;
+
+  try
+    {
+      freeze (*track).onFailed (this, [name = track->get_name ()] () {
+        z_warning ("Failed to freeze track '{}'", name);
+      });
+    }
+  catch (const ZrythmException &e)
+    {
+      z_warning ("{}", e.what ());
+    }
+}
+
+void
+TrackFreezer::unfreezeTrack (structure::tracks::Track * track)
+{
+  if (track == nullptr || !track->frozen ())
+    return;
+
+  undo_stack_.push (new commands::FreezeTrackCommand (*track, std::nullopt));
+  z_info ("Unfroze track '{}'", track->get_name ());
+}
+
+} // namespace zrythm::controllers
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include "utils/audio.h"
+
+#include <QFuture>
+#include <QObject>
+#include <QtQmlIntegration/qqmlintegration.h>
+
+namespace zrythm::structure::project
+{
+class Project;
+}
+
+namespace zrythm::structure::tracks
+{
+class Track;
+}
+
+namespace zrythm::undo
+{
+class UndoStack;
+}
+
+namespace zrythm::controllers
+{
+
+/**
+ * @brief Freezes and unfreezes tracks.
+ *
+ * Freezing renders a track's processing chain (its clips and plugins, up to
+ * the channel's pre-fader) offline into a pool file, then plays that file in
+ * place of the chain so that its plugins no longer run in the live graph. The
+ * fader, sends and routing stay live.
+ *
+ * Both freezing and unfreezing go through the undo stack.
+ */
+class TrackFreezer : public QObject
+{
+  Q_OBJECT
+  QML_ELEMENT
+  QML_UNCREATABLE ("")
+
+public:
+  TrackFreezer (
+    structure::project::Project &project,
+    undo::UndoStack             &undo_stack,
+    QObject *                    parent = nullptr);
+
+  /**
+   * @brief Renders the output of @p track's pre-fader from the start of the
+   * timeline to the end marker.
+   *
+   * The render runs on a background thread (as fast as the plugins allow)
+   * while the engine is paused, and the engine is resumed before the returned
+   * future finishes, whether the render succeeded, failed or was cancelled.
+   *
+   * @throw ZrythmException if there is nothing to render.
+   *
+   * @warning The returned QFuture uses continuations that run on the main
+   *          thread. Do NOT call waitForFinished() on the main thread.
+   */
+  [[nodiscard]] static QFuture<utils::audio::AudioBuffer> render_pre_fader (
+    structure::project::Project &project,
+    structure::tracks::Track    &track);
+
+  /**
+   * @brief Renders @p track (see render_pre_fader()) and pushes an undoable
+   * command that freezes it with the result.
+   *
+   * @throw ZrythmException if the track cannot be frozen.
+   *
+   * @warning See render_pre_fader().
+   */
+  [[nodiscard]] QFuture<void> freeze (structure::tracks::Track &track);
+
+  /**
+   * @brief Freezes @p track in the background, logging failures.
+   */
+  Q_INVOKABLE void freezeTrack (structure::tracks::Track * track);
+
+  /**
+   * @brief Pushes an undoable command that restores @p track's processing
+   * chain in the graph.
+   */
+  Q_INVOKABLE void unfreezeTrack (structure::tracks::Track * track);
+
+private:
+  structure::project::Project &project_;
+  undo::UndoStack             &undo_stack_;
+};
+
+} // namespace zrythm::controllers
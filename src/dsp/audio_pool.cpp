@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: © 2019-2026 Alexandros Theodotou <alex@zrythm.org>
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
+#include <algorithm>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
@@ -18,6 +19,8 @@
 #include "utils/utf8_string.h"
 #include "utils/uuid_identifiable_object.h"
 
+#include <QtConcurrentMap>
+
 using zrythm::utils::exceptions::ZrythmException;
 
 namespace zrythm::dsp
@@ -39,16 +42,132 @@ AudioPool::for_each_clip (
   registry_.for_each_matching<dsp::FileAudioSource> (std::move (visitor));
 }
 
+QFuture<LoudnessMeasurement>
+AudioPool::analyze_loudness (const FileAudioSource::Uuid &clip_id)
+{
+  auto * clip = qobject_cast<FileAudioSource *> (
+    registry_.find_by_raw_uuid (clip_id.value_));
+  if (clip == nullptr)
+    {
+      throw ZrythmException (
+        fmt::format ("Clip {} not found in the pool", clip_id));
+    }
+
+  std::optional<utils::hash::HashT> file_hash;
+  last_known_file_hashes_.cvisit (clip_id, [&file_hash] (const auto &entry) {
+    file_hash = entry.second;
+  });
+  if (file_hash.has_value ())
+    return loudness_analysis_.analyze (*clip, *file_hash);
+
+  return loudness_analysis_.analyze (*clip);
+}
+
+void
+AudioPool::forget_file_hash_on_edit (const FileAudioSource &clip)
+{
+  QObject::connect (
+    &clip, &FileAudioSource::samplesChanged, &file_hash_watch_context_,
+    [this, clip_id = clip.get_uuid ()] () {
+      last_known_file_hashes_.erase (clip_id);
+    },
+    Qt::SingleShotConnection);
+}
+
+struct AudioPool::PendingLoad
+{
+  FileAudioSource *           clip{};
+  std::filesystem::path       path;
+  units::sample_rate_t        sample_rate;
+  std::optional<units::bpm_t> bpm_to_set;
+
+  /** Name to restore after loading (the file name is used otherwise). */
+  std::optional<utils::Utf8String> name_to_restore;
+
+  /** Set by the worker. */
+  std::optional<FileAudioSource::DecodedFile> decoded;
+  std::string                                 error;
+};
+
 void
 AudioPool::init_loaded ()
 {
+  init_loaded_async ().waitForFinished ();
+  finish_init_loaded ();
+}
+
+QFuture<void>
+AudioPool::init_loaded_async ()
+{
+  auto loads = std::make_shared<PendingLoads> ();
   for_each_clip ([&] (dsp::FileAudioSource &clip) {
-    const auto name = clip.get_name ();
-    clip.init_from_file (
-      get_clip_path (clip.get_uuid (), false), sample_rate_getter_ (),
-      clip.source_bpm ());
-    clip.set_name (name);
+    loads->push_back (
+      PendingLoad{
+        .clip = &clip,
+        .path = get_clip_path (clip.get_uuid (), false),
+        .sample_rate = sample_rate_getter_ (),
+        .bpm_to_set = clip.source_bpm (),
+        .name_to_restore = clip.get_name (),
+      });
   });
+
+  z_debug ("decoding {} pool clips...", loads->size ());
+  pending_loads_ = loads;
+  return decode_async (std::move (loads));
+}
+
+void
+AudioPool::finish_init_loaded ()
+{
+  if (!pending_loads_)
+    return;
+
+  auto loads = std::move (pending_loads_);
+  apply_decoded (*loads);
+}
+
+QFuture<void>
+AudioPool::decode_async (std::shared_ptr<PendingLoads> loads) const
+{
+  // The functor keeps the loads and the cache alive until the workers finish
+  return QtConcurrent::map (
+    *loads, [loads, cache = decoded_audio_cache_] (PendingLoad &load) {
+      try
+        {
+          load.decoded = FileAudioSource::decode_file (
+            load.path, load.sample_rate, cache.get ());
+        }
+      catch (const ZrythmException &e)
+        {
+          load.error = e.what ();
+        }
+    });
+}
+
+void
+AudioPool::apply_decoded (PendingLoads &loads)
+{
+  std::string first_error;
+  for (auto &load : loads)
+    {
+      if (!load.decoded.has_value ())
+        {
+          z_warning ("{}", load.error);
+          if (first_error.empty ())
+            first_error = load.error;
+          continue;
+        }
+
+      load.clip->init_from_decoded (
+        load.path, load.sample_rate, std::move (*load.decoded),
+        load.bpm_to_set);
+      if (load.name_to_restore.has_value ())
+        load.clip->set_name (*load.name_to_restore);
+      forget_file_hash_on_edit (*load.clip);
+    }
+
+  if (!first_error.empty ())
+    throw ZrythmException (first_error);
 }
 
 void
@@ -147,8 +266,9 @@ AudioPool::write_clip (const FileAudioSource * clip, bool parts, bool backup)
   if (!parts)
     {
       /* store file hash */
-      last_known_file_hashes_.emplace (
+      last_known_file_hashes_.insert_or_assign (
         clip_id, utils::hash::get_file_hash (new_path));
+      forget_file_hash_on_edit (*clip);
     }
 }
 
@@ -206,14 +326,23 @@ AudioPool::remove_unused (bool backup)
 void
 AudioPool::reload_clip_frame_bufs ()
 {
+  auto loads = std::make_shared<PendingLoads> ();
   for_each_clip ([&] (dsp::FileAudioSource &clip) {
     if (clip.get_num_frames () == 0)
       {
-        clip.init_from_file (
-          get_clip_path (clip.get_uuid (), false), sample_rate_getter_ (),
-          std::nullopt);
+        loads->push_back (
+          PendingLoad{
+            .clip = &clip,
+            .path = get_clip_path (clip.get_uuid (), false),
+            .sample_rate = sample_rate_getter_ (),
+          });
       }
   });
+  if (loads->empty ())
+    return;
+
+  decode_async (loads).waitForFinished ();
+  apply_decoded (*loads);
 }
 
 struct WriteClipData
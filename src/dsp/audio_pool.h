@@ -4,9 +4,13 @@
 #pragma once
 
 #include "dsp/file_audio_source.h"
+#include "dsp/loudness_analysis_service.h"
 #include "utils/hash.h"
 #include "utils/units.h"
 
+#include <QFuture>
+#include <QObject>
+
 #include <boost/unordered/concurrent_flat_map.hpp>
 
 namespace zrythm::dsp
@@ -44,10 +48,40 @@ public:
   /**
    * Initializes the audio pool after deserialization.
    *
+   * Blocking version of init_loaded_async() + finish_init_loaded().
+   *
    * @throw ZrythmException if an error occurred.
    */
   void init_loaded ();
 
+  /**
+   * @brief Starts decoding the files of all clips on the global thread pool,
+   * after deserialization.
+   *
+   * The clips themselves are only updated in finish_init_loaded(), which must
+   * be called on the pool's thread once the returned future finishes.
+   */
+  QFuture<void> init_loaded_async ();
+
+  /**
+   * @brief Passes the files decoded by init_loaded_async() to their clips.
+   *
+   * @throw ZrythmException if any file could not be read (after passing the
+   * others).
+   */
+  void finish_init_loaded ();
+
+  /**
+   * @brief Sets the cache to map decoded clip frames from when loading clips.
+   *
+   * Used by init_loaded() and reload_clip_frame_bufs().
+   */
+  void set_decoded_audio_cache (
+    std::shared_ptr<utils::audio::DecodedAudioCache> cache)
+  {
+    decoded_audio_cache_ = std::move (cache);
+  }
+
   /**
    * Duplicates the clip with the given ID and returns the duplicate.
    *
@@ -112,7 +146,40 @@ public:
   void
   for_each_clip (std::function<void (dsp::FileAudioSource &)> visitor) const;
 
+  /**
+   * @brief Measures the loudness and true peak of the clip with the given ID
+   * on the thread pool.
+   *
+   * Measurements are cached by audio content, so repeated requests for an
+   * unchanged clip (or for clips with identical audio) return immediately.
+   * Clips whose pool file is up to date are keyed on the file's hash, so
+   * their samples are not rehashed.
+   *
+   * @throw ZrythmException If the clip is not in the pool.
+   */
+  QFuture<LoudnessMeasurement>
+  analyze_loudness (const FileAudioSource::Uuid &clip_id);
+
 private:
+  struct PendingLoad;
+  using PendingLoads = std::vector<PendingLoad>;
+
+  /** Decodes @p loads on the global thread pool, in order. */
+  QFuture<void> decode_async (std::shared_ptr<PendingLoads> loads) const;
+
+  /**
+   * Passes the decoded files to their clips.
+   *
+   * @throw ZrythmException if any file could not be read.
+   */
+  void apply_decoded (PendingLoads &loads);
+
+  /**
+   * @brief Forgets the last known file hash of @p clip the next time its
+   * samples change, since its pool file no longer matches them then.
+   */
+  void forget_file_hash_on_edit (const FileAudioSource &clip);
+
   friend void init_from (
     AudioPool             &obj,
     const AudioPool       &other,
@@ -134,6 +201,17 @@ private:
    * we can save time by skipping overwriting it. */
   boost::unordered::concurrent_flat_map<FileAudioSource::Uuid, utils::hash::HashT>
     last_known_file_hashes_;
+
+  /** Context of the connections made by forget_file_hash_on_edit(). */
+  QObject file_hash_watch_context_;
+
+  LoudnessAnalysisService loudness_analysis_;
+
+  /** Optional decoded frame cache shared between projects. */
+  std::shared_ptr<utils::audio::DecodedAudioCache> decoded_audio_cache_;
+
+  /** Loads started by init_loaded_async(). */
+  std::shared_ptr<PendingLoads> pending_loads_;
 };
 } // namespace zrythm::dsp
 
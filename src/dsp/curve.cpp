@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: © 2020-2021, 2023-2026 Alexandros Theodotou <alex@zrythm.org>
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
+#include <algorithm>
 #include <cmath>
+#include <utility>
 
 #include "dsp/curve.h"
 #include "utils/debug.h"
@@ -179,6 +181,180 @@ CurveOptions::get_normalized_y (double x, bool start_higher) const noexcept
   return std::clamp (val, 0.0, 1.0);
 }
 
+namespace
+{
+
+/**
+ * @brief Shared loop for the batch curve kernels.
+ *
+ * Each output value is computed as:
+ * out = clamp (out_offset + out_scale * shape (in_offset + in_scale * x), 0, 1)
+ * where x = clamp (x_start + i * x_step, 0, 1).
+ *
+ * The direction flips of the scalar implementation are folded into the
+ * offset/scale pairs so that @p shape is the only per-algorithm code in the
+ * loop body.
+ */
+template <typename ShapeFunc>
+[[gnu::always_inline]] inline void
+fill_curve (
+  double           x_start,
+  double           x_step,
+  float            in_offset,
+  float            in_scale,
+  float            out_offset,
+  float            out_scale,
+  std::span<float> out,
+  ShapeFunc      &&shape) noexcept
+{
+  const auto x0 = static_cast<float> (x_start);
+  const auto step = static_cast<float> (x_step);
+  float *    dest = out.data ();
+  const auto size = out.size ();
+  for (size_t i = 0; i < size; ++i)
+    {
+      const float x = std::clamp (x0 + static_cast<float> (i) * step, 0.f, 1.f);
+      const float y = shape (in_offset + in_scale * x);
+      dest[i] = std::clamp (out_offset + out_scale * y, 0.f, 1.f);
+    }
+}
+
+/// Offset/scale pair for `flip ? 1 - v : v`.
+constexpr std::pair<float, float>
+flip_coeffs (bool flip)
+{
+  return flip ? std::make_pair (1.f, -1.f) : std::make_pair (0.f, 1.f);
+}
+
+} // namespace
+
+void
+CurveOptions::get_normalized_y_range (
+  double           x_start,
+  double           x_step,
+  bool             start_higher,
+  std::span<float> out) const noexcept
+{
+  if (out.empty ())
+    return;
+
+  const bool curve_up = curviness_ >= 0;
+
+  switch (algo_)
+    {
+    case CurveOptions::Algorithm::Exponent:
+      {
+        const auto c = static_cast<float> (
+          1.0 - std::fabs (curviness_ * EXPONENT_CURVINESS_BOUND));
+        const auto [in_off, in_scale] = flip_coeffs (!start_higher != curve_up);
+        const auto [out_off, out_scale] = flip_coeffs (!curve_up);
+        if (utils::math::floats_equal (c, 0.f))
+          {
+            fill_curve (
+              x_start, x_step, in_off, in_scale, out_off, out_scale, out,
+              [] (float u) { return u; });
+          }
+        else
+          {
+            fill_curve (
+              x_start, x_step, in_off, in_scale, out_off, out_scale, out,
+              [c] (float u) { return std::pow (u, c); });
+          }
+      }
+      break;
+    case CurveOptions::Algorithm::SuperEllipse:
+      {
+        const auto c = static_cast<float> (
+          1.0 - std::fabs (curviness_ * SUPERELLIPSE_CURVINESS_BOUND));
+        const auto [in_off, in_scale] = flip_coeffs (!start_higher != curve_up);
+        const auto [out_off, out_scale] = flip_coeffs (curve_up);
+        if (utils::math::floats_equal (c, 0.f))
+          {
+            fill_curve (
+              x_start, x_step, in_off, in_scale, out_off, out_scale, out,
+              [] (float u) { return u; });
+          }
+        else
+          {
+            const float inv_c = 1.f / c;
+            fill_curve (
+              x_start, x_step, in_off, in_scale, out_off, out_scale, out,
+              [c, inv_c] (float u) {
+                return std::pow (1.f - std::pow (u, c), inv_c);
+              });
+          }
+      }
+      break;
+    case CurveOptions::Algorithm::Vital:
+      {
+        const auto c =
+          static_cast<float> (-curviness_ * VITAL_CURVINESS_BOUND * 10.0);
+        const auto [in_off, in_scale] = flip_coeffs (start_higher);
+        if (utils::math::floats_equal (c, 0.f))
+          {
+            fill_curve (
+              x_start, x_step, in_off, in_scale, 0.f, 1.f, out,
+              [] (float u) { return u; });
+          }
+        else
+          {
+            const float inv_denominator = 1.f / std::expm1 (c);
+            fill_curve (
+              x_start, x_step, in_off, in_scale, 0.f, 1.f, out,
+              [c, inv_denominator] (float u) {
+                return std::expm1 (c * u) * inv_denominator;
+              });
+          }
+      }
+      break;
+    case CurveOptions::Algorithm::Pulse:
+      {
+        const auto threshold = static_cast<float> ((1.0 + curviness_) / 2.0);
+        const auto [out_off, out_scale] = flip_coeffs (start_higher);
+        fill_curve (
+          x_start, x_step, 0.f, 1.f, out_off, out_scale, out,
+          [threshold] (float u) { return threshold > u ? 0.f : 1.f; });
+      }
+      break;
+    case CurveOptions::Algorithm::Logarithmic:
+      {
+        // Same parameter derivation as get_normalized_y()
+        constexpr float bound = 1e-12f;
+        const float     s =
+          std::clamp (
+            static_cast<float> (std::fabs (curviness_)), 0.01f, 1.f - bound)
+          * 10.f;
+        const float c =
+          std::clamp ((10.f - s) / (std::pow (s, s)), bound, 10.f);
+        const auto [in_off, in_scale] = flip_coeffs (!start_higher != curve_up);
+
+        // curve_up: (log (u + c) - a) * b
+        // otherwise: (a - log (u + c)) * b + 1
+        const float out_off = curve_up ? 0.f : 1.f;
+        const float out_scale = curve_up ? 1.f : -1.f;
+        if (c >= 0.02f)
+          {
+            const float a = std::log (c);
+            const float b = 1.f / std::log (1.f + (1.f / c));
+            fill_curve (
+              x_start, x_step, in_off, in_scale, out_off, out_scale, out,
+              [a, b, c] (float u) { return (std::log (u + c) - a) * b; });
+          }
+        else
+          {
+            const float a = utils::math::fast_log (c);
+            const float b = 1.f / utils::math::fast_log (1.f + (1.f / c));
+            fill_curve (
+              x_start, x_step, in_off, in_scale, out_off, out_scale, out,
+              [a, b, c] (float u) {
+                return (utils::math::fast_log (u + c) - a) * b;
+              });
+          }
+      }
+      break;
+    }
+}
+
 bool
 operator== (const CurveOptions &a, const CurveOptions &b)
 {
@@ -244,4 +420,32 @@ evaluate_curve (
            : value_a + std::abs (diff) * static_cast<float> (curve_val);
 }
 
+void
+evaluate_curve_range (
+  float                   value_a,
+  float                   value_b,
+  CurveOptions::Algorithm algo,
+  float                   curviness,
+  double                  ratio_start,
+  double                  ratio_step,
+  std::span<float>        out) noexcept
+{
+  const float diff = value_b - value_a;
+  if (std::abs (diff) < 1e-5f)
+    {
+      // flat segment — no curve needed
+      std::ranges::fill (out, value_a);
+      return;
+    }
+
+  const bool         start_higher = diff < 0.0f;
+  const CurveOptions opts (curviness, algo);
+  opts.get_normalized_y_range (ratio_start, ratio_step, start_higher, out);
+
+  const float base = start_higher ? value_b : value_a;
+  const float range = std::abs (diff);
+  for (auto &val : out)
+    val = base + range * val;
+}
+
 } // namespace zrythm::dsp
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <span>
+
 #include <QObject>
 #include <QtQmlIntegration/qqmlintegration.h>
 
@@ -105,6 +107,27 @@ public:
   [[gnu::hot]] double
   get_normalized_y (double x, bool start_higher) const noexcept;
 
+  /**
+   * Batch version of get_normalized_y().
+   *
+   * Fills @p out with the Y values for X = x_start + i * x_step. Per-curve
+   * parameters are computed once and each algorithm runs in its own
+   * branch-free loop so the compiler can vectorize it.
+   *
+   * Unlike get_normalized_y(), X values outside [0, 1] are clamped instead of
+   * rejected. Results match get_normalized_y() within float precision.
+   *
+   * @param x_start Normalized X of the first output value.
+   * @param x_step Normalized X increment between output values.
+   * @param start_higher Start at higher point.
+   * @param out Output buffer.
+   */
+  [[gnu::hot]] void get_normalized_y_range (
+    double           x_start,
+    double           x_step,
+    bool             start_higher,
+    std::span<float> out) const noexcept [[clang::nonblocking]];
+
   friend bool operator== (const CurveOptions &a, const CurveOptions &b);
 
 private:
@@ -193,6 +216,24 @@ evaluate_curve (
   float                   curviness,
   double                  ratio) noexcept [[clang::nonblocking]];
 
+/**
+ * @brief Batch version of evaluate_curve().
+ *
+ * Fills @p out with the automation values at ratios
+ * ratio_start + i * ratio_step.
+ *
+ * @see CurveOptions::get_normalized_y_range().
+ */
+void
+evaluate_curve_range (
+  float                   value_a,
+  float                   value_b,
+  CurveOptions::Algorithm algo,
+  float                   curviness,
+  double                  ratio_start,
+  double                  ratio_step,
+  std::span<float>        out) noexcept [[clang::nonblocking]];
+
 } // namespace zrythm::dsp
 
 // These may be used in the UI eventually, but it's probably better to have a
@@ -51,6 +51,12 @@ AudioEngine::blockLength () const
   return block_length ().in<int> (units::samples);
 }
 
+int
+AudioEngine::activeDspThreadCount () const
+{
+  return graph_dispatcher_.active_thread_count ();
+}
+
 units::sample_rate_t
 AudioEngine::sample_rate () const
 {
@@ -255,6 +261,10 @@ AudioEngine::
         current_transport_state, playhead_processing_guard, units::samples (0),
         units::samples (1));
     }
+
+  // Only now that the graph is no longer processed, since suspending detaches
+  // the lookahead processors. Balanced in resume().
+  graph_dispatcher_.suspend_lookahead ();
 }
 
 void
@@ -267,6 +277,7 @@ AudioEngine::resume (const EngineState &state)
       z_debug ("engine was not running - won't resume");
       return;
     }
+  graph_dispatcher_.resume_lookahead ();
   transport_.setLoopEnabled (state.looping_);
   if (state.playing_)
     {
@@ -344,6 +355,11 @@ AudioEngine::activate_impl (const bool activate)
       wait_for_pause (state, true, true);
 
       hw_interface_.remove_audio_callback (audio_callback_.get ());
+
+      // The graph (including the lookahead graph) is released with the audio
+      // callback, so only balance the suspension from wait_for_pause()
+      if (state.running_)
+        graph_dispatcher_.resume_lookahead ();
     }
 
   state_ = new_state;
@@ -417,6 +433,7 @@ AudioEngine::process (
   for (const auto &mip : midi_input_processors_ | std::views::values)
     {
       mip->set_block_start_time (block_start_time_);
+      mip->clear_received_events ();
     }
 
   // We create a temporary ITransport snapshot and inject it here (graph
@@ -595,6 +612,15 @@ AudioEngine::process (
     current_transport_state, playhead_guard, total_frames_remaining,
     total_frames_to_process);
 
+  if (midi_input_observer_.has_value ())
+    {
+      for (const auto &[ident, mip] : midi_input_processors_)
+        {
+          if (!mip->received_events ().empty ())
+            (*midi_input_observer_) (ident, mip->received_events ());
+        }
+    }
+
   cycle_.fetch_add (1);
 
   return ProcessReturnStatus::ProcessCompleted;
@@ -634,6 +660,14 @@ AudioEngine::execute_function_with_paused_processing_synchronously (
   resume (state);
 }
 
+void
+AudioEngine::set_midi_input_observer (std::optional<MidiInputObserver> observer)
+{
+  execute_function_with_paused_processing_synchronously (
+    [this, &observer] () { midi_input_observer_ = std::move (observer); },
+    false);
+}
+
 void
 AudioEngine::panic_all ()
 {
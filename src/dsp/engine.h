@@ -80,6 +80,11 @@ public:
     return load_measurer_.getLoadAsPercentage ();
   }
 
+  /**
+   * @brief Number of threads currently processing the DSP graph.
+   */
+  Q_INVOKABLE int activeDspThreadCount () const;
+
   /**
    * @brief Current sample rate from the hardware interface (QML-friendly).
    */
@@ -198,6 +203,23 @@ public:
 
   const auto &midi_input_processors () const { return midi_input_processors_; }
 
+  /**
+   * @brief Receives the events that arrived from a MIDI input device during
+   * a processing cycle.
+   *
+   * Called on the audio thread after the graph has run, once per device and
+   * cycle (never concurrently).
+   */
+  using MidiInputObserver = std::function<void (
+    const utils::Utf8String    &device_id,
+    const dsp::MidiEventBuffer &events)>;
+
+  /**
+   * @brief Sets the observer of incoming MIDI events (e.g., for MIDI
+   * mappings), or removes it if nullopt is passed.
+   */
+  void set_midi_input_observer (std::optional<MidiInputObserver> observer);
+
   /**
    * Queues MIDI note off to event queues.
    */
@@ -329,6 +351,9 @@ private:
   std::map<utils::Utf8String, utils::QObjectUniquePtr<MidiInputProcessor>>
     midi_input_processors_;
 
+  /** Only accessed on the audio thread while processing is running. */
+  std::optional<MidiInputObserver> midi_input_observer_;
+
   /**
    * @brief Current hardware audio input channels, updated each audio callback.
    *
@@ -0,0 +1,332 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <condition_variable>
+#include <deque>
+#include <stdexcept>
+#include <thread>
+
+#include <fmt/std.h>
+
+#include "dsp/ditherer.h"
+#include "dsp/export_pipeline.h"
+#include "utils/audio_file_writer.h"
+#include "utils/logger.h"
+#include "utils/qt.h"
+
+#include <QObject>
+
+namespace zrythm::dsp
+{
+
+/**
+ * Bounded FIFO of audio blocks between two stages.
+ *
+ * close() lets the consumer drain what's left, abort() makes both sides give up
+ * immediately.
+ */
+class ExportPipeline::BlockQueue
+{
+public:
+  /** @return False if the queue was aborted. */
+  bool push (utils::audio::AudioBuffer &&block)
+  {
+    std::unique_lock lock (mutex_);
+    not_full_.wait (lock, [this] {
+      return aborted_ || blocks_.size () < kQueueCapacity;
+    });
+    if (aborted_)
+      return false;
+
+    blocks_.push_back (std::move (block));
+    not_empty_.notify_one ();
+    return true;
+  }
+
+  /**
+   * @return The next block, or nullopt once the queue is closed and drained
+   * or was aborted.
+   */
+  std::optional<utils::audio::AudioBuffer> pop ()
+  {
+    std::unique_lock lock (mutex_);
+    not_empty_.wait (lock, [this] {
+      return aborted_ || closed_ || !blocks_.empty ();
+    });
+    if (aborted_ || blocks_.empty ())
+      return std::nullopt;
+
+    auto block = std::move (blocks_.front ());
+    blocks_.pop_front ();
+    not_full_.notify_one ();
+    return block;
+  }
+
+  void close ()
+  {
+    std::scoped_lock lock (mutex_);
+    closed_ = true;
+    not_empty_.notify_all ();
+  }
+
+  void abort ()
+  {
+    std::scoped_lock lock (mutex_);
+    aborted_ = true;
+    not_empty_.notify_all ();
+    not_full_.notify_all ();
+  }
+
+  bool aborted () const
+  {
+    std::scoped_lock lock (mutex_);
+    return aborted_;
+  }
+
+private:
+  mutable std::mutex                    mutex_;
+  std::condition_variable               not_empty_;
+  std::condition_variable               not_full_;
+  std::deque<utils::audio::AudioBuffer> blocks_;
+  bool                                  closed_ = false;
+  bool                                  aborted_ = false;
+};
+
+struct ExportPipeline::Output
+{
+  OutputOptions                            options;
+  std::unique_ptr<StreamingResampler>      resampler;
+  std::unique_ptr<juce::AudioFormatWriter> writer;
+
+  /** Input queue of each stage, in stage order. */
+  std::vector<std::unique_ptr<BlockQueue>> queues;
+
+  std::vector<std::jthread> stages;
+};
+
+ExportPipeline::ExportPipeline (
+  units::sample_rate_t       render_sample_rate,
+  int                        num_channels,
+  std::vector<OutputOptions> outputs)
+    : num_channels_ (num_channels)
+{
+  // Create everything that can fail before starting any thread
+  for (auto &options : outputs)
+    {
+      auto       output = std::make_unique<Output> ();
+      const auto sample_rate =
+        options.sample_rate_.value_or (render_sample_rate);
+      if (sample_rate != render_sample_rate)
+        {
+          output->resampler = std::make_unique<StreamingResampler> (
+            num_channels, render_sample_rate.in<double> (units::sample_rate),
+            sample_rate.in<double> (units::sample_rate),
+            options.resample_quality_);
+        }
+
+      auto writer_options =
+        juce::AudioFormatWriterOptions{}
+          .withSampleRate (sample_rate.in<double> (units::sample_rate))
+          .withNumChannels (num_channels)
+          .withBitsPerSample (
+            utils::audio::bit_depth_enum_to_int (options.bit_depth_))
+          .withMetadataValues (options.metadata_)
+          .withQualityOptionIndex (options.quality_option_index_);
+      output->writer =
+        utils::AudioFileWriter::create_writer (writer_options, options.path_);
+
+      output->options = std::move (options);
+      outputs_.push_back (std::move (output));
+    }
+
+  for (auto &output : outputs_)
+    start_stages (*output);
+}
+
+ExportPipeline::~ExportPipeline ()
+{
+  if (!finished_)
+    cancel ();
+}
+
+void
+ExportPipeline::start_stages (Output &output)
+{
+  const bool dither =
+    output.options.dither_
+    && output.options.bit_depth_ != utils::audio::BitDepth::BIT_DEPTH_32;
+
+  using StageFunc = void (ExportPipeline::*) (Output &, size_t);
+  std::vector<StageFunc> stage_funcs;
+  if (output.resampler)
+    stage_funcs.push_back (&ExportPipeline::run_resample_stage);
+  if (dither)
+    stage_funcs.push_back (&ExportPipeline::run_dither_stage);
+  stage_funcs.push_back (&ExportPipeline::run_encode_stage);
+
+  for (size_t i = 0; i < stage_funcs.size (); ++i)
+    output.queues.push_back (std::make_unique<BlockQueue> ());
+  for (size_t i = 0; i < stage_funcs.size (); ++i)
+    {
+      output.stages.emplace_back ([this, &output, i, func = stage_funcs[i]] {
+        try
+          {
+            (this->*func) (output, i);
+          }
+        catch (const std::exception &e)
+          {
+            z_warning (
+              "Export to {} failed: {}", output.options.path_, e.what ());
+            fail (std::current_exception ());
+          }
+      });
+    }
+}
+
+void
+ExportPipeline::run_resample_stage (Output &output, size_t stage)
+{
+  auto &in = *output.queues[stage];
+  auto &out = *output.queues[stage + 1];
+
+  utils::audio::AudioBuffer resampled;
+  while (auto block = in.pop ())
+    {
+      output.resampler->process (*block, block->getNumSamples (), resampled);
+      if (resampled.getNumSamples () > 0 && !out.push (std::move (resampled)))
+        return;
+    }
+  if (in.aborted ())
+    return;
+
+  output.resampler->flush (resampled);
+  if (resampled.getNumSamples () > 0)
+    out.push (std::move (resampled));
+  out.close ();
+}
+
+void
+ExportPipeline::run_dither_stage (Output &output, size_t stage)
+{
+  auto &in = *output.queues[stage];
+  auto &out = *output.queues[stage + 1];
+
+  std::vector<Ditherer> ditherers (static_cast<size_t> (num_channels_));
+  for (auto &ditherer : ditherers)
+    {
+      ditherer.reset (
+        utils::audio::bit_depth_enum_to_int (output.options.bit_depth_));
+    }
+
+  while (auto block = in.pop ())
+    {
+      for (int ch = 0; ch < block->getNumChannels (); ++ch)
+        {
+          ditherers[static_cast<size_t> (ch)].process (
+            block->getWritePointer (ch), block->getNumSamples ());
+        }
+      if (!out.push (std::move (*block)))
+        return;
+    }
+  out.close ();
+}
+
+void
+ExportPipeline::run_encode_stage (Output &output, size_t stage)
+{
+  auto &in = *output.queues[stage];
+
+  while (auto block = in.pop ())
+    {
+      if (!output.writer->writeFromAudioSampleBuffer (
+            *block, 0, block->getNumSamples ()))
+        {
+          throw std::runtime_error (utils::to_std_string (
+            QObject::tr ("Failed to write audio data to %1")
+              .arg (output.options.path_.string ())));
+        }
+    }
+  if (in.aborted ())
+    return;
+
+  // Destroying the writer finalizes the file (headers, encoder flush)
+  output.writer.reset ();
+  z_debug ("Finished writing {}", output.options.path_);
+}
+
+bool
+ExportPipeline::push (const juce::AudioSampleBuffer &block, int num_frames)
+{
+  for (auto &output : outputs_)
+    {
+      utils::audio::AudioBuffer copy (num_channels_, num_frames);
+      for (int ch = 0; ch < num_channels_; ++ch)
+        {
+          if (ch < block.getNumChannels ())
+            copy.copyFrom (ch, 0, block, ch, 0, num_frames);
+          else
+            copy.clear (ch, 0, num_frames);
+        }
+      if (!output->queues.front ()->push (std::move (copy)))
+        return false;
+    }
+  return true;
+}
+
+void
+ExportPipeline::finish ()
+{
+  for (auto &output : outputs_)
+    output->queues.front ()->close ();
+  join_all ();
+  finished_ = true;
+
+  std::scoped_lock lock (error_mutex_);
+  if (error_)
+    std::rethrow_exception (error_);
+}
+
+void
+ExportPipeline::cancel ()
+{
+  abort_all ();
+  join_all ();
+  finished_ = true;
+}
+
+std::exception_ptr
+ExportPipeline::error () const
+{
+  std::scoped_lock lock (error_mutex_);
+  return error_;
+}
+
+void
+ExportPipeline::fail (std::exception_ptr error)
+{
+  {
+    std::scoped_lock lock (error_mutex_);
+    if (!error_)
+      error_ = std::move (error);
+  }
+  abort_all ();
+}
+
+void
+ExportPipeline::abort_all ()
+{
+  for (auto &output : outputs_)
+    {
+      for (auto &queue : output->queues)
+        queue->abort ();
+    }
+}
+
+void
+ExportPipeline::join_all ()
+{
+  for (auto &output : outputs_)
+    output->stages.clear ();
+}
+
+} // namespace zrythm::dsp
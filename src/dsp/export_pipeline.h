@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/audio.h"
+#include "utils/resampler.h"
+#include "utils/units.h"
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+namespace zrythm::dsp
+{
+
+/**
+ * @brief Turns rendered audio into one or more audio files.
+ *
+ * Each output runs its own chain of stages: resample (if the output rate
+ * differs from the render rate), dither (if enabled) and encode. Every stage
+ * runs on a dedicated thread and passes blocks to the next one through a
+ * bounded queue, so a slow encoder throttles the render instead of letting
+ * rendered audio pile up in memory.
+ *
+ * All outputs are fed from the same pushed blocks, so several formats can be
+ * produced from a single render.
+ */
+class ExportPipeline
+{
+public:
+  struct OutputOptions
+  {
+    /** Output file. The format is picked from the extension. */
+    std::filesystem::path path_;
+
+    /** Output sample rate, or the render rate if unset. */
+    std::optional<units::sample_rate_t> sample_rate_;
+
+    utils::audio::BitDepth bit_depth_ = utils::audio::BitDepth::BIT_DEPTH_16;
+
+    /** Whether to dither before quantizing to bit_depth_. */
+    bool dither_ = true;
+
+    Resampler::Quality resample_quality_ = Resampler::Quality::VeryHigh;
+
+    /**
+     * @brief Format-specific quality (e.g., Vorbis bitrate).
+     *
+     * @see juce::AudioFormat::getQualityOptions().
+     */
+    int quality_option_index_ = 0;
+
+    std::unordered_map<juce::String, juce::String> metadata_;
+  };
+
+  /** Maximum number of blocks waiting between two stages. */
+  static constexpr size_t kQueueCapacity = 32;
+
+  /**
+   * @brief Creates the output files and starts the stage threads.
+   *
+   * @throw std::runtime_error if an output can't be created.
+   */
+  ExportPipeline (
+    units::sample_rate_t       render_sample_rate,
+    int                        num_channels,
+    std::vector<OutputOptions> outputs);
+
+  /** Cancels the pipeline unless finish() was called. */
+  ~ExportPipeline ();
+
+  ExportPipeline (const ExportPipeline &) = delete;
+  ExportPipeline &operator= (const ExportPipeline &) = delete;
+  ExportPipeline (ExportPipeline &&) = delete;
+  ExportPipeline &operator= (ExportPipeline &&) = delete;
+
+  /**
+   * @brief Feeds the first @p num_frames frames of @p block to all outputs.
+   *
+   * Blocks while the first stage of any output is full.
+   *
+   * @return Whether the pipeline is still running. False means it failed or
+   * was cancelled, and the caller should stop rendering.
+   */
+  bool push (const juce::AudioSampleBuffer &block, int num_frames);
+
+  /**
+   * @brief Signals the end of the input and waits for all outputs to be
+   * written.
+   *
+   * @throw std::exception The first error raised by any stage.
+   */
+  void finish ();
+
+  /**
+   * @brief Stops all stages and waits for them to exit.
+   *
+   * Partially written files are left as they are.
+   */
+  void cancel ();
+
+  /**
+   * @brief Returns the first error raised by any stage, or nullptr.
+   *
+   * Useful to tell a failure apart from a cancellation once push() returns
+   * false.
+   */
+  std::exception_ptr error () const;
+
+private:
+  class BlockQueue;
+  struct Output;
+
+  void start_stages (Output &output);
+  void run_resample_stage (Output &output, size_t stage);
+  void run_dither_stage (Output &output, size_t stage);
+  void run_encode_stage (Output &output, size_t stage);
+
+  /** Records @p error (if it's the first one) and aborts all queues. */
+  void fail (std::exception_ptr error);
+
+  void abort_all ();
+  void join_all ();
+
+  int  num_channels_;
+  bool finished_ = false;
+
+  mutable std::mutex error_mutex_;
+  std::exception_ptr error_;
+
+  // Declared last so that stage threads are joined (by the destructor) before
+  // the rest of the members are destroyed
+  std::vector<std::unique_ptr<Output>> outputs_;
+};
+
+} // namespace zrythm::dsp
@@ -14,6 +14,7 @@
 #include "utils/audio.h"
 #include "utils/audio_file.h"
 #include "utils/debug.h"
+#include "utils/decoded_audio_cache.h"
 #include "utils/exceptions.h"
 #include "utils/float_ranges.h"
 #include "utils/io_utils.h"
@@ -60,18 +61,17 @@ FileAudioSource::FileAudioSource (
   name_ = name;
   bit_depth_ = bit_depth;
   ch_frames_ = buf;
-  convert_mono_to_stereo ();
+  convert_mono_to_stereo (ch_frames_);
   bpm_ = source_bpm;
 }
 
-void
-FileAudioSource::init_from_file (
-  const std::filesystem::path &full_path,
-  units::sample_rate_t         project_sample_rate,
-  std::optional<units::bpm_t>  bpm_to_set)
+auto
+FileAudioSource::decode_file (
+  const std::filesystem::path      &full_path,
+  units::sample_rate_t              project_sample_rate,
+  utils::audio::DecodedAudioCache * decoded_cache) -> DecodedFile
 {
-  samplerate_ = project_sample_rate;
-  assert (samplerate_ > units::sample_rate (0));
+  assert (project_sample_rate > units::sample_rate (0));
 
   /* read metadata */
   AudioFile                       file (full_path);
@@ -85,14 +85,40 @@ FileAudioSource::init_from_file (
       throw ZrythmException (
         fmt::format ("Failed to read metadata from file '{}'", full_path));
     }
-  bit_depth_ = utils::audio::bit_depth_int_to_enum (md.bit_depth);
-  bpm_ = units::bpm (md.bpm);
+
+  DecodedFile decoded{
+    .bit_depth = utils::audio::bit_depth_int_to_enum (md.bit_depth),
+    .bpm = units::bpm (md.bpm),
+  };
+
+  std::optional<utils::audio::DecodedAudioCache::Key> cache_key;
+  if (decoded_cache != nullptr)
+    {
+      try
+        {
+          cache_key =
+            decoded_cache->key_for (full_path, project_sample_rate);
+          decoded.mapped_frames = decoded_cache->map (*cache_key);
+        }
+      catch (const ZrythmException &e)
+        {
+          z_warning ("not using the decoded audio cache: {}", e.what ());
+        }
+    }
+
+  if (decoded.mapped_frames != nullptr)
+    {
+      z_debug ("mapped decoded frames of '{}' from cache", full_path);
+      decoded.mapped_frames->refer_to (decoded.frames);
+      return decoded;
+    }
 
   try
     {
       /* read frames into project's samplerate */
-      file.read_full (ch_frames_, samplerate_.in (units::sample_rate));
-      convert_mono_to_stereo ();
+      file.read_full (
+        decoded.frames, project_sample_rate.in (units::sample_rate));
+      convert_mono_to_stereo (decoded.frames);
     }
   catch (ZrythmException &e)
     {
@@ -100,6 +126,31 @@ FileAudioSource::init_from_file (
         fmt::format ("Failed to read frames from file '{}'", full_path));
     }
 
+  if (cache_key.has_value ())
+    {
+      decoded_cache->store (*cache_key, decoded.frames);
+    }
+
+  return decoded;
+}
+
+void
+FileAudioSource::init_from_decoded (
+  const std::filesystem::path &full_path,
+  units::sample_rate_t         project_sample_rate,
+  DecodedFile                  decoded,
+  std::optional<units::bpm_t>  bpm_to_set)
+{
+  samplerate_ = project_sample_rate;
+  assert (samplerate_ > units::sample_rate (0));
+  bit_depth_ = decoded.bit_depth;
+  bpm_ = decoded.bpm;
+
+  /* moving doesn't touch the previous frames, so the previous mapping (if
+   * any) can be released afterwards */
+  ch_frames_ = std::move (decoded.frames);
+  mapped_frames_ = std::move (decoded.mapped_frames);
+
   name_ = utils::Utf8String::from_path (
     utils::io::path_get_basename_without_ext (full_path));
   if (bpm_to_set.has_value () && bpm_to_set.value () > units::bpm (0.0))
@@ -123,6 +174,18 @@ FileAudioSource::init_from_file (
   Q_EMIT samplesChanged ();
 }
 
+void
+FileAudioSource::init_from_file (
+  const std::filesystem::path      &full_path,
+  units::sample_rate_t              project_sample_rate,
+  std::optional<units::bpm_t>       bpm_to_set,
+  utils::audio::DecodedAudioCache * decoded_cache)
+{
+  init_from_decoded (
+    full_path, project_sample_rate,
+    decode_file (full_path, project_sample_rate, decoded_cache), bpm_to_set);
+}
+
 void
 init_from (
   FileAudioSource       &obj,
@@ -200,23 +263,23 @@ FileAudioSource::expand_with_frames (const utils::audio::AudioBuffer &frames)
 }
 
 void
-FileAudioSource::convert_mono_to_stereo ()
+FileAudioSource::convert_mono_to_stereo (utils::audio::AudioBuffer &frames)
 {
-  if (ch_frames_.getNumChannels () != 1)
+  if (frames.getNumChannels () != 1)
     {
       return;
     }
 
   const auto [left_gain, _] =
     calculate_panning (PanLaw::Minus3dB, PanAlgorithm::SquareRoot, 0.5f);
-  const auto num_samples = ch_frames_.getNumSamples ();
+  const auto num_samples = frames.getNumSamples ();
   assert (num_samples >= 0);
   const auto samples = static_cast<size_t> (num_samples);
 
-  ch_frames_.setSize (2, num_samples, true);
+  frames.setSize (2, num_samples, true);
 
-  auto * left = ch_frames_.getWritePointer (0);
-  auto * right = ch_frames_.getWritePointer (1);
+  auto * left = frames.getWritePointer (0);
+  auto * right = frames.getWritePointer (1);
 
   utils::float_ranges::mul_k2 ({ left, samples }, left_gain);
   utils::float_ranges::copy ({ right, samples }, { left, samples });
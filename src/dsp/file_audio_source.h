@@ -5,6 +5,7 @@
 
 #include "utils/audio.h"
 #include "utils/audio_file.h"
+#include "utils/decoded_audio_cache.h"
 #include "utils/icloneable.h"
 #include "utils/monotonic_time_provider.h"
 #include "utils/typed_uuid_reference.h"
@@ -161,12 +162,59 @@ public:
   void clear_frames ()
   {
     ch_frames_.setSize (ch_frames_.getNumChannels (), 0, false, true);
+    mapped_frames_.reset ();
     Q_EMIT samplesChanged ();
   }
 
   auto get_num_channels () const { return ch_frames_.getNumChannels (); };
   auto get_num_frames () const { return ch_frames_.getNumSamples (); };
 
+  /**
+   * @brief Frames and metadata read from an audio file.
+   *
+   * @see decode_file()
+   */
+  struct DecodedFile
+  {
+    utils::audio::AudioBuffer frames;
+
+    /** Set if @ref frames refers to a mapped cache entry. */
+    std::shared_ptr<const utils::audio::DecodedAudioCache::MappedEntry>
+      mapped_frames;
+
+    utils::audio::BitDepth bit_depth{};
+
+    /** BPM from the file's metadata, or 0. */
+    units::bpm_t bpm{};
+  };
+
+  /**
+   * @brief Reads an audio file into @p project_sample_rate.
+   *
+   * Doesn't touch any FileAudioSource, so files can be decoded on worker
+   * threads and passed to init_from_decoded() on the source's thread.
+   *
+   * @param decoded_cache Optional cache to map the decoded frames from, or to
+   *                      store them in after decoding.
+   *
+   * @throw ZrythmException on I/O error.
+   */
+  static DecodedFile decode_file (
+    const std::filesystem::path      &full_path,
+    units::sample_rate_t              project_sample_rate,
+    utils::audio::DecodedAudioCache * decoded_cache = nullptr);
+
+  /**
+   * @brief Initializes members from a file read with decode_file().
+   *
+   * @param bpm_to_set See init_from_file().
+   */
+  void init_from_decoded (
+    const std::filesystem::path &full_path,
+    units::sample_rate_t         project_sample_rate,
+    DecodedFile                  decoded,
+    std::optional<units::bpm_t>  bpm_to_set);
+
   /**
    * @brief Initializes members from an audio file.
    *
@@ -175,13 +223,15 @@ public:
    *                   project to preserve the previously stored value. If
    *                   nullopt, the BPM is auto-detected from the file (see
    *                   @ref bpm_).
+   * @param decoded_cache See decode_file().
    *
    * @throw ZrythmException on I/O error.
    */
   void init_from_file (
-    const std::filesystem::path &full_path,
-    units::sample_rate_t         project_sample_rate,
-    std::optional<units::bpm_t>  bpm_to_set);
+    const std::filesystem::path      &full_path,
+    units::sample_rate_t              project_sample_rate,
+    std::optional<units::bpm_t>       bpm_to_set,
+    utils::audio::DecodedAudioCache * decoded_cache = nullptr);
 
 private:
   friend void init_from (
@@ -189,7 +239,7 @@ private:
     const FileAudioSource &other,
     utils::ObjectCloneType clone_type);
 
-  void convert_mono_to_stereo ();
+  static void convert_mono_to_stereo (utils::audio::AudioBuffer &frames);
 
   friend void to_json (nlohmann::json &j, const FileAudioSource &clip);
   friend void from_json (const nlohmann::json &j, FileAudioSource &clip);
@@ -198,6 +248,14 @@ private:
   /** Name of the clip. */
   utils::Utf8String name_;
 
+  /**
+   * Decoded frames mapped from a DecodedAudioCache, if any.
+   *
+   * @ref ch_frames_ refers to this memory until it is resized or replaced.
+   */
+  std::shared_ptr<const utils::audio::DecodedAudioCache::MappedEntry>
+    mapped_frames_;
+
   /**
    * Per-channel frames.
    */
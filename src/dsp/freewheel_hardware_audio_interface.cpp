@@ -0,0 +1,268 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+#include <cassert>
+#include <random>
+
+#include "dsp/freewheel_hardware_audio_interface.h"
+#include "utils/dsp_context.h"
+#include "utils/logger.h"
+#include "utils/tracy.h"
+
+namespace zrythm::dsp
+{
+
+double
+FreewheelHardwareAudioInterface::Statistics::mean_load (
+  std::chrono::nanoseconds block_period) const
+{
+  if (callback_count == 0 || block_period.count () <= 0)
+    return 0.0;
+
+  return static_cast<double> (total_duration.count ())
+         / static_cast<double> (callback_count)
+         / static_cast<double> (block_period.count ());
+}
+
+FreewheelHardwareAudioInterface::FreewheelHardwareAudioInterface (
+  Options options)
+    : options_ (std::move (options))
+{
+  assert (options_.device_info.sample_rate.in (units::sample_rate) > 0);
+  assert (options_.device_info.block_length.in (units::samples) > 0);
+}
+
+FreewheelHardwareAudioInterface::~FreewheelHardwareAudioInterface ()
+{
+  stop ();
+  for (auto * callback : callbacks_)
+    {
+      callback->stopped ();
+    }
+}
+
+[[nodiscard]] AudioDeviceInfo
+FreewheelHardwareAudioInterface::get_device_info () const
+{
+  return options_.device_info;
+}
+
+void
+FreewheelHardwareAudioInterface::add_audio_callback (IAudioCallback * callback)
+{
+  assert (callback != nullptr);
+  assert (!std::ranges::contains (callbacks_, callback));
+
+  stop ();
+  callback->about_to_start ();
+  callbacks_.push_back (callback);
+  start ();
+}
+
+void
+FreewheelHardwareAudioInterface::remove_audio_callback (
+  IAudioCallback * callback)
+{
+  assert (callback != nullptr);
+
+  auto it = std::ranges::find (callbacks_, callback);
+  if (it == callbacks_.end ())
+    return;
+
+  stop ();
+  callbacks_.erase (it);
+  callback->stopped ();
+  if (!callbacks_.empty ())
+    {
+      start ();
+    }
+}
+
+std::chrono::nanoseconds
+FreewheelHardwareAudioInterface::block_period () const
+{
+  const auto &info = options_.device_info;
+  return std::chrono::nanoseconds (
+    static_cast<int64_t> (
+      info.block_length.in<double> (units::samples) * 1'000'000'000.0
+      / info.sample_rate.in<double> (units::sample_rate)));
+}
+
+FreewheelHardwareAudioInterface::Statistics
+FreewheelHardwareAudioInterface::statistics () const
+{
+  Statistics stats;
+  stats.callback_count = callback_count_.load (std::memory_order_acquire);
+  stats.xrun_count = xrun_count_.load (std::memory_order_relaxed);
+  if (stats.callback_count > 0)
+    {
+      stats.min_duration = std::chrono::nanoseconds (
+        min_duration_ns_.load (std::memory_order_relaxed));
+    }
+  stats.max_duration = std::chrono::nanoseconds (
+    max_duration_ns_.load (std::memory_order_relaxed));
+  stats.total_duration = std::chrono::nanoseconds (
+    total_duration_ns_.load (std::memory_order_relaxed));
+  std::ranges::transform (
+    histogram_, stats.histogram.begin (),
+    [] (const auto &bin) { return bin.load (std::memory_order_relaxed); });
+  return stats;
+}
+
+void
+FreewheelHardwareAudioInterface::reset_statistics ()
+{
+  callback_count_.store (0, std::memory_order_release);
+  xrun_count_.store (0, std::memory_order_relaxed);
+  min_duration_ns_.store (
+    std::numeric_limits<int64_t>::max (), std::memory_order_relaxed);
+  max_duration_ns_.store (0, std::memory_order_relaxed);
+  total_duration_ns_.store (0, std::memory_order_relaxed);
+  for (auto &bin : histogram_)
+    {
+      bin.store (0, std::memory_order_relaxed);
+    }
+}
+
+std::unique_ptr<IHardwareAudioInterface>
+FreewheelHardwareAudioInterface::create (Options options)
+{
+  return std::make_unique<FreewheelHardwareAudioInterface> (
+    std::move (options));
+}
+
+void
+FreewheelHardwareAudioInterface::start ()
+{
+  assert (!driver_thread_.joinable ());
+  z_debug (
+    "Starting freewheel audio driver ({} mode, {} samples at {} Hz)",
+    options_.clock_mode == ClockMode::Realtime ? "realtime" : "free-run",
+    options_.device_info.block_length.in (units::samples),
+    options_.device_info.sample_rate.in (units::sample_rate));
+  driver_thread_ =
+    std::jthread ([this] (std::stop_token stop_token) { run (stop_token); });
+}
+
+void
+FreewheelHardwareAudioInterface::stop ()
+{
+  if (driver_thread_.joinable ())
+    {
+      driver_thread_.request_stop ();
+      driver_thread_.join ();
+    }
+}
+
+void
+FreewheelHardwareAudioInterface::run (std::stop_token stop_token)
+{
+  DspContextRAII dsp_context_raii;
+  utils::set_thread_name ("Freewheel Audio");
+
+  const auto &info = options_.device_info;
+  const auto  nframes = info.block_length.in<size_t> (units::samples);
+  const auto  num_inputs =
+    info.input_channel_count.in<size_t> (units::channels);
+  const auto num_outputs =
+    info.output_channel_count.in<size_t> (units::channels);
+
+  // Inputs are silent and outputs are discarded
+  std::vector<float>         input_buf (nframes * num_inputs, 0.f);
+  std::vector<float>         output_buf (nframes * num_outputs, 0.f);
+  std::vector<const float *> input_ptrs (num_inputs);
+  std::vector<float *>       output_ptrs (num_outputs);
+  for (size_t ch = 0; ch < num_inputs; ++ch)
+    {
+      input_ptrs[ch] = input_buf.data () + (ch * nframes);
+    }
+  for (size_t ch = 0; ch < num_outputs; ++ch)
+    {
+      output_ptrs[ch] = output_buf.data () + (ch * nframes);
+    }
+
+  using Clock = std::chrono::steady_clock;
+  const auto period = block_period ();
+  const bool realtime = options_.clock_mode == ClockMode::Realtime;
+  std::mt19937                           rng (options_.jitter_seed);
+  std::uniform_int_distribution<int64_t> jitter_dist (
+    0, options_.max_jitter.count ());
+  auto next_start = Clock::now ();
+
+  while (!stop_token.stop_requested ())
+    {
+      if (realtime)
+        {
+          std::this_thread::sleep_until (
+            next_start + std::chrono::microseconds (jitter_dist (rng)));
+        }
+
+      std::ranges::fill (output_buf, 0.f);
+      const auto start = Clock::now ();
+      for (auto * callback : callbacks_)
+        {
+          callback->process_audio (input_ptrs, output_ptrs, info.block_length);
+        }
+      const auto end = Clock::now ();
+
+      bool xrun{};
+      if (realtime)
+        {
+          // The device needs the next block when the next period starts
+          next_start += period;
+          if (end > next_start)
+            {
+              xrun = true;
+
+              // Drop the periods that were missed, like a real device
+              next_start += period * (((end - next_start) / period) + 1);
+            }
+        }
+      else
+        {
+          xrun = end - start > period;
+        }
+
+      record_callback (end - start, xrun);
+    }
+}
+
+void
+FreewheelHardwareAudioInterface::record_callback (
+  std::chrono::nanoseconds duration,
+  bool                     xrun)
+{
+  // reset_statistics() may run concurrently, so the extremes are updated with
+  // compare-exchange loops instead of separate loads and stores
+  const auto ns = duration.count ();
+  auto       min_ns = min_duration_ns_.load (std::memory_order_relaxed);
+  while (ns < min_ns
+         && !min_duration_ns_.compare_exchange_weak (
+           min_ns, ns, std::memory_order_relaxed))
+    {
+    }
+  auto max_ns = max_duration_ns_.load (std::memory_order_relaxed);
+  while (ns > max_ns
+         && !max_duration_ns_.compare_exchange_weak (
+           max_ns, ns, std::memory_order_relaxed))
+    {
+    }
+  total_duration_ns_.fetch_add (ns, std::memory_order_relaxed);
+
+  const auto load = static_cast<double> (ns)
+                    / static_cast<double> (block_period ().count ());
+  const auto bin = std::min (
+    static_cast<size_t> (
+      load * static_cast<double> (kHistogramBins) / kHistogramMaxLoad),
+    kHistogramBins);
+  histogram_[bin].fetch_add (1, std::memory_order_relaxed);
+
+  if (xrun)
+    xrun_count_.fetch_add (1, std::memory_order_relaxed);
+
+  // Published last so that readers see the other values of this callback
+  callback_count_.fetch_add (1, std::memory_order_release);
+}
+
+} // namespace zrythm::dsp
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dsp/hardware_audio_interface.h"
+#include "dsp/iaudio_callback.h"
+
+namespace zrythm::dsp
+{
+
+/**
+ * @brief Hardware audio interface that is not backed by any device.
+ *
+ * Drives the added callbacks from an internal thread, with silent inputs and
+ * discarded outputs. Used to measure DSP load on headless machines (e.g., CI
+ * servers) and when running without an audio device.
+ *
+ * The time spent in each round of callbacks is recorded in a histogram
+ * relative to the block period. A round that does not finish before the
+ * device would need the next block is counted as a simulated xrun.
+ */
+class FreewheelHardwareAudioInterface : public IHardwareAudioInterface
+{
+public:
+  enum class ClockMode : std::uint8_t
+  {
+    /**
+     * @brief Callbacks run back-to-back, as fast as possible.
+     *
+     * Xruns are counted for callbacks taking longer than a block period.
+     */
+    FreeRun,
+
+    /**
+     * @brief Callbacks are scheduled once per block period, like a real
+     * device.
+     *
+     * Jitter delays the start of each callback, leaving less time to meet
+     * the deadline.
+     */
+    Realtime,
+  };
+
+  struct Options
+  {
+    AudioDeviceInfo device_info{
+      .device_name = u8"Freewheel",
+      .sample_rate = units::sample_rate (48000),
+      .block_length = units::samples (256),
+      .input_channel_count = units::channels (2),
+      .output_channel_count = units::channels (2),
+    };
+    ClockMode clock_mode{ ClockMode::Realtime };
+
+    /** Maximum random delay of each callback (Realtime mode only). */
+    std::chrono::microseconds max_jitter{};
+
+    /** Seed for the jitter, so that runs are reproducible. */
+    unsigned int jitter_seed{ 1 };
+  };
+
+  /** Number of histogram bins below kHistogramMaxLoad. */
+  static constexpr size_t kHistogramBins = 40;
+
+  /** Load (callback duration over block period) covered by the histogram. */
+  static constexpr double kHistogramMaxLoad = 2.0;
+
+  struct Statistics
+  {
+    size_t                   callback_count{};
+    size_t                   xrun_count{};
+    std::chrono::nanoseconds min_duration{};
+    std::chrono::nanoseconds max_duration{};
+    std::chrono::nanoseconds total_duration{};
+
+    /**
+     * @brief Number of callbacks per load range.
+     *
+     * Bin `i` counts callbacks whose load is in `[i, i + 1) *
+     * kHistogramMaxLoad / kHistogramBins`. The last bin counts all callbacks
+     * above kHistogramMaxLoad.
+     */
+    std::array<size_t, kHistogramBins + 1> histogram{};
+
+    /**
+     * @brief Returns the mean callback duration relative to the block period.
+     */
+    double mean_load (std::chrono::nanoseconds block_period) const;
+  };
+
+  explicit FreewheelHardwareAudioInterface (Options options = {});
+  ~FreewheelHardwareAudioInterface () override;
+
+  [[nodiscard]] AudioDeviceInfo get_device_info () const override;
+
+  /**
+   * @brief Adds a callback and (re)starts the driver thread.
+   *
+   * about_to_start() is called on @p callback before its first
+   * process_audio().
+   */
+  void add_audio_callback (IAudioCallback * callback) override;
+
+  /**
+   * @brief Removes a callback, calling stopped() on it.
+   *
+   * The driver thread keeps running while other callbacks remain.
+   */
+  void remove_audio_callback (IAudioCallback * callback) override;
+
+  /**
+   * @brief Returns the duration of one block at the device sample rate.
+   */
+  std::chrono::nanoseconds block_period () const;
+
+  /**
+   * @brief Returns a snapshot of the statistics collected so far.
+   *
+   * Thread-safe.
+   */
+  Statistics statistics () const;
+
+  /**
+   * @brief Clears the collected statistics.
+   *
+   * Thread-safe. A callback that is being recorded concurrently may be
+   * counted partially.
+   */
+  void reset_statistics ();
+
+  /**
+   * @brief Creates a freewheel hardware audio interface.
+   */
+  static std::unique_ptr<IHardwareAudioInterface>
+  create (Options options = {});
+
+private:
+  void start ();
+  void stop ();
+  void run (std::stop_token stop_token);
+
+  /**
+   * @brief Records the duration of a round of callbacks.
+   */
+  void record_callback (std::chrono::nanoseconds duration, bool xrun);
+
+private:
+  Options options_;
+
+  /** Callbacks to drive. Only modified while the driver thread is stopped. */
+  std::vector<IAudioCallback *> callbacks_;
+
+  std::jthread driver_thread_;
+
+  std::atomic<size_t>  callback_count_{};
+  std::atomic<size_t>  xrun_count_{};
+  std::atomic<int64_t> min_duration_ns_{ std::numeric_limits<int64_t>::max () };
+  std::atomic<int64_t> max_duration_ns_{};
+  std::atomic<int64_t> total_duration_ns_{};
+  std::array<std::atomic<size_t>, kHistogramBins + 1> histogram_{};
+};
+
+} // namespace zrythm::dsp
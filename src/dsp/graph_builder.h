@@ -30,11 +30,29 @@ public:
     graph.finalize_nodes ();
   };
 
+  /**
+   * @brief Populates the graph to be processed ahead of the playhead (see
+   * LookaheadRenderer).
+   *
+   * Must be called after build_graph(), since the live graph decides which
+   * parts are processed ahead of time. Leaves @p graph empty if nothing is.
+   */
+  void build_lookahead_graph (Graph &graph)
+  {
+    build_lookahead_graph_impl (graph);
+    graph.finalize_nodes ();
+  }
+
 protected:
   /**
    * @brief Actual logic to be implemented by subclasses.
    */
   virtual void build_graph_impl (Graph &graph) = 0;
+
+  /**
+   * @brief Lookahead graph logic (no lookahead graph by default).
+   */
+  virtual void build_lookahead_graph_impl (Graph &graph) { }
 };
 
 } // namespace zrythm::dsp::graph
@@ -25,6 +25,7 @@ DspGraphDispatcher::DspGraphDispatcher (
       terminal_processables_provider_ (std::move (terminal_processables_provider)),
       run_on_main_thread_ (std::move (run_on_main_thread))
 {
+  lookahead_renderer_ = std::make_unique<LookaheadRenderer> (run_on_main_thread_);
 }
 
 units::sample_u32_t
@@ -140,6 +141,9 @@ DspGraphDispatcher::recalc_graph (bool soft)
   const auto buffer_size = device_info.block_length;
 
   const auto rebuild_graph = [&] () {
+    // Processables in the lookahead graph may move to the live graph
+    lookahead_renderer_->clear_graph ();
+
     graph::Graph graph;
 
     // Build graph
@@ -163,8 +167,30 @@ DspGraphDispatcher::recalc_graph (bool soft)
         graph::GraphExport::export_to_dot (graph, true));
     }
 
+    graph::Graph lookahead_graph;
+    graph_builder_->build_lookahead_graph (lookahead_graph);
+
     scheduler_->rechain_from_node_collection (
       graph.steal_nodes (), sample_rate, buffer_size);
+
+    if (!lookahead_graph.get_nodes ().graph_nodes_.empty ())
+      {
+        std::vector<LookaheadProcessor *> lookahead_processors;
+        for (const auto &node : scheduler_->get_nodes ().graph_nodes_)
+          {
+            if (
+              auto * processor =
+                dynamic_cast<LookaheadProcessor *> (&node->get_processable ()))
+              {
+                lookahead_processors.push_back (processor);
+              }
+          }
+        lookahead_renderer_->set_graph (
+          lookahead_graph.steal_nodes (), std::move (lookahead_processors),
+          sample_rate);
+        if (lookahead_suspensions_ == 0)
+          lookahead_renderer_->start ();
+      }
   };
 
   if (!scheduler_ && !soft)
@@ -191,17 +217,69 @@ DspGraphDispatcher::recalc_graph (bool soft)
 }
 
 void
-DspGraphDispatcher::clear_graph ()
+DspGraphDispatcher::reprepare_processable (graph::IProcessable &processable)
 {
   if (!scheduler_)
     return;
 
+  // The lookahead graph is prepared as a whole
+  if (
+    scheduler_->get_nodes ().find_node_for_processable (processable) == nullptr
+    && lookahead_renderer_->contains (processable))
+    {
+      recalc_graph (false);
+      return;
+    }
+
+  const auto device_info = hw_interface_.get_device_info ();
+  run_function_with_engine_lock_ ([&] () {
+    auto &nodes = scheduler_->get_nodes ();
+    const auto * node = nodes.find_node_for_processable (processable);
+    if (node == nullptr)
+      return;
+
+    z_debug ("Re-preparing {}", processable.get_node_name ());
+    processable.prepare_for_processing (
+      node, device_info.sample_rate, device_info.block_length);
+    nodes.update_latencies ();
+  });
+}
+
+void
+DspGraphDispatcher::clear_graph ()
+{
+  if (!scheduler_)
+    {
+      lookahead_renderer_->clear_graph ();
+      return;
+    }
+
   const auto device_info = hw_interface_.get_device_info ();
 
   run_function_with_engine_lock_ ([&] () {
+    // The lookahead processors are not processed while the lock is held
+    lookahead_renderer_->clear_graph ();
     scheduler_->rechain_from_node_collection (
       graph::GraphNodeCollection{}, device_info.sample_rate,
       device_info.block_length);
   });
 }
+
+void
+DspGraphDispatcher::suspend_lookahead ()
+{
+  ++lookahead_suspensions_;
+  lookahead_renderer_->stop ();
+}
+
+void
+DspGraphDispatcher::resume_lookahead ()
+{
+  if (lookahead_suspensions_ == 0)
+    return;
+
+  --lookahead_suspensions_;
+  if (lookahead_suspensions_ == 0)
+    lookahead_renderer_->start ();
+}
 }
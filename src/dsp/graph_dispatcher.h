@@ -6,6 +6,7 @@
 #include "dsp/graph_builder.h"
 #include "dsp/graph_scheduler.h"
 #include "dsp/hardware_audio_interface.h"
+#include "dsp/lookahead_renderer.h"
 #include "utils/rt_thread_id.h"
 
 #include <juce_audio_basics/juce_audio_basics.h>
@@ -46,6 +47,16 @@ public:
    */
   void recalc_graph (bool soft);
 
+  /**
+   * @brief Prepares @p processable again and readjusts latencies, without
+   * rebuilding the graph.
+   *
+   * For processables already in the graph whose processing resources changed
+   * (e.g., a plugin that got its instance). Does nothing if @p processable is
+   * not in the current graph.
+   */
+  void reprepare_processable (graph::IProcessable &processable);
+
   /**
    * Releases resources held by the current graph nodes and clears the graph.
    * Unlike recalc_graph(), does not rebuild — safe to call during shutdown
@@ -53,6 +64,22 @@ public:
    */
   void clear_graph ();
 
+  /**
+   * @brief Stops rendering the lookahead graph (if any) until
+   * resume_lookahead() is called.
+   *
+   * Calls nest. Used while processing is paused, since the renderer follows
+   * the position reported by the live graph.
+   *
+   * @warning Must not be called while the live graph is being processed.
+   */
+  void suspend_lookahead ();
+
+  /**
+   * @brief Balances a previous suspend_lookahead() call.
+   */
+  void resume_lookahead ();
+
   /**
    * Starts a new cycle.
    *
@@ -118,6 +145,24 @@ public:
     return false;
   }
 
+  /**
+   * @brief Returns the profiler of the live graph, or null if no graph was
+   * built yet.
+   */
+  graph::GraphProfiler * profiler ()
+  {
+    return scheduler_ ? &scheduler_->profiler () : nullptr;
+  }
+
+  /**
+   * @brief Returns the number of threads currently processing the live
+   * graph, or 0 if no graph was built yet.
+   */
+  int active_thread_count () const
+  {
+    return scheduler_ ? scheduler_->active_thread_count () : 0;
+  }
+
   /**
    * @brief Accessor for currently active trigger nodes.
    *
@@ -167,6 +212,12 @@ private:
 
   std::unique_ptr<graph::GraphScheduler> scheduler_;
 
+  /** Processes the graph built by IGraphBuilder::build_lookahead_graph(). */
+  std::unique_ptr<LookaheadRenderer> lookahead_renderer_;
+
+  /** Number of suspend_lookahead() calls not yet balanced. */
+  int lookahead_suspensions_{};
+
   /** Stored for the currently processing cycle */
   units::sample_u32_t max_route_playback_latency_;
 
@@ -318,6 +318,28 @@ public:
   bool terminal_{ false };
   bool initial_{ false };
 
+  /**
+   * @brief Smoothed processing time of this node, in microseconds.
+   *
+   * Only updated when critical-path scheduling is enabled. Starts at a
+   * nominal cost so that the graph topology alone decides priorities until
+   * measurements are available.
+   */
+  float avg_process_time_us_{ 1.f };
+
+  /**
+   * @brief Estimated time from the start of this node until the end of the
+   * longest path through its downstream nodes, in microseconds.
+   */
+  float remaining_path_cost_us_{};
+
+  /**
+   * @brief Priority of this node when it becomes ready (higher runs first).
+   *
+   * @see GraphScheduler::SchedulingMode.
+   */
+  int schedule_priority_{};
+
 private:
   NodeId node_id_ = 0;
 
@@ -0,0 +1,297 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+#include <numeric>
+#include <ranges>
+
+#include "dsp/graph_profiler.h"
+#include "utils/logger.h"
+
+#include <nlohmann/json.hpp>
+
+namespace zrythm::dsp::graph
+{
+
+void
+to_json (nlohmann::json &j, const GraphProfiler::NodeStats &stats)
+{
+  j = nlohmann::json{
+    { "nodeId",         stats.node_id          },
+    { "name",           stats.name             },
+    { "numRuns",        stats.num_runs         },
+    { "meanUs",         stats.mean_us          },
+    { "p99Us",          stats.p99_us           },
+    { "maxUs",          stats.max_us           },
+    { "threadId",       stats.thread_id        },
+    { "threadShare",    stats.thread_share     },
+    { "onCriticalPath", stats.on_critical_path },
+  };
+}
+
+void
+GraphProfiler::set_enabled (bool enabled)
+{
+  if (enabled_.exchange (enabled, std::memory_order_relaxed) != enabled)
+    {
+      z_debug ("{} graph profiler", enabled ? "enabled" : "disabled");
+    }
+}
+
+void
+GraphProfiler::set_num_threads (size_t num_worker_threads)
+{
+  std::scoped_lock lock (mutex_);
+  drain_locked ();
+  rings_.clear ();
+  for (size_t i = 0; i < num_worker_threads + 1; ++i)
+    {
+      rings_.push_back (std::make_unique<RingBuffer<Sample>> (kThreadRingSize));
+    }
+  for (auto &node : nodes_)
+    {
+      node.thread_runs.assign (rings_.size (), 0);
+    }
+}
+
+void
+GraphProfiler::set_nodes (const GraphNodeCollection &nodes)
+{
+  std::scoped_lock lock (mutex_);
+
+  // Timings in the rings refer to the previous nodes
+  discard_recorded_locked ();
+
+  nodes_.clear ();
+  node_indices_.clear ();
+  trigger_nodes_.clear ();
+  for (const auto &node : nodes.graph_nodes_)
+    {
+      node_indices_.emplace (node.get (), nodes_.size ());
+      nodes_.push_back (
+        NodeState{
+          .node_id = node->get_id (),
+          .name = node->get_processable ().get_node_name (),
+          .children = {},
+          .window = {},
+          .window_pos = 0,
+          .thread_runs = std::vector<size_t> (rings_.size ()),
+        });
+      nodes_.back ().window.reserve (kWindowSize);
+    }
+  for (const auto &node : nodes.graph_nodes_)
+    {
+      auto &children = nodes_.at (node_indices_.at (node.get ())).children;
+      for (const auto &child : node->feeds ())
+        {
+          children.push_back (node_indices_.at (std::addressof (child.get ())));
+        }
+    }
+  for (const auto &node : nodes.trigger_nodes_)
+    {
+      trigger_nodes_.push_back (
+        node_indices_.at (std::addressof (node.get ())));
+    }
+}
+
+void
+GraphProfiler::record (
+  int                      thread_id,
+  const GraphNode         &node,
+  std::chrono::nanoseconds duration) noexcept
+{
+  const auto slot = thread_slot (thread_id);
+  if (slot >= rings_.size ()) [[unlikely]]
+    return;
+
+  const Sample sample{
+    .node = std::addressof (node),
+    .duration_ns = static_cast<uint32_t> (
+      std::clamp<int64_t> (duration.count (), 0, UINT32_MAX)),
+  };
+  if (!rings_[slot]->write (sample)) [[unlikely]]
+    {
+      dropped_count_.fetch_add (1, std::memory_order_relaxed);
+    }
+}
+
+void
+GraphProfiler::drain ()
+{
+  std::scoped_lock lock (mutex_);
+  drain_locked ();
+}
+
+void
+GraphProfiler::drain_locked ()
+{
+  for (const auto slot : std::views::iota (0uz, rings_.size ()))
+    {
+      Sample sample;
+      while (rings_[slot]->read (sample))
+        {
+          const auto it = node_indices_.find (sample.node);
+          if (it == node_indices_.end ())
+            continue;
+
+          auto &state = nodes_[it->second];
+          if (state.window.size () < kWindowSize)
+            {
+              state.window.push_back (sample.duration_ns);
+            }
+          else
+            {
+              state.window[state.window_pos] = sample.duration_ns;
+            }
+          state.window_pos = (state.window_pos + 1) % kWindowSize;
+          ++state.thread_runs[slot];
+        }
+    }
+}
+
+void
+GraphProfiler::discard_recorded_locked ()
+{
+  // Only the graph threads may move the write heads, so the rings are emptied
+  // by reading from them (RingBuffer::reset() would race with record())
+  for (auto &ring : rings_)
+    {
+      Sample sample;
+      while (ring->read (sample))
+        {
+        }
+    }
+}
+
+std::vector<GraphProfiler::NodeStats>
+GraphProfiler::snapshot ()
+{
+  std::scoped_lock lock (mutex_);
+  drain_locked ();
+
+  std::vector<NodeStats> ret;
+  ret.reserve (nodes_.size ());
+  std::vector<double>   costs;
+  std::vector<uint32_t> sorted;
+  for (const auto &state : nodes_)
+    {
+      NodeStats stats{
+        .node_id = state.node_id,
+        .name = state.name,
+        .num_runs = state.window.size (),
+      };
+      if (!state.window.empty ())
+        {
+          constexpr double ns_per_us = 1000.0;
+          sorted = state.window;
+          const auto p99_idx =
+            std::min (sorted.size () - 1, (sorted.size () * 99) / 100);
+          std::ranges::nth_element (sorted, sorted.begin () + p99_idx);
+          stats.p99_us = sorted[p99_idx] / ns_per_us;
+          stats.max_us = std::ranges::max (state.window) / ns_per_us;
+          const auto total_ns = std::accumulate (
+            state.window.begin (), state.window.end (), uint64_t{});
+          stats.mean_us = static_cast<double> (total_ns)
+                          / static_cast<double> (state.window.size ())
+                          / ns_per_us;
+        }
+
+      const auto total_runs = std::accumulate (
+        state.thread_runs.begin (), state.thread_runs.end (), 0uz);
+      if (total_runs > 0)
+        {
+          const auto it = std::ranges::max_element (state.thread_runs);
+          stats.thread_id =
+            static_cast<int> (std::distance (state.thread_runs.begin (), it))
+            - 1;
+          stats.thread_share =
+            static_cast<double> (*it) / static_cast<double> (total_runs);
+        }
+
+      costs.push_back (stats.mean_us);
+      ret.push_back (std::move (stats));
+    }
+
+  const auto critical_path = find_critical_path (costs);
+  for (const auto i : std::views::iota (0uz, ret.size ()))
+    {
+      ret[i].on_critical_path = critical_path[i];
+    }
+  return ret;
+}
+
+void
+GraphProfiler::reset ()
+{
+  std::scoped_lock lock (mutex_);
+  discard_recorded_locked ();
+  for (auto &state : nodes_)
+    {
+      state.window.clear ();
+      state.window_pos = 0;
+      std::ranges::fill (state.thread_runs, 0);
+    }
+  dropped_count_.store (0, std::memory_order_relaxed);
+}
+
+std::vector<bool>
+GraphProfiler::find_critical_path (const std::vector<double> &costs) const
+{
+  // Cost of the longest path starting at each node, computed in reverse
+  // topological order
+  std::vector<double> path_costs (nodes_.size ());
+  std::vector<int>    remaining_children (nodes_.size ());
+  std::vector<size_t> ready;
+  for (const auto i : std::views::iota (0uz, nodes_.size ()))
+    {
+      remaining_children[i] = static_cast<int> (nodes_[i].children.size ());
+      if (remaining_children[i] == 0)
+        ready.push_back (i);
+    }
+  std::vector<std::vector<size_t>> parents (nodes_.size ());
+  for (const auto i : std::views::iota (0uz, nodes_.size ()))
+    {
+      for (const auto child : nodes_[i].children)
+        {
+          parents[child].push_back (i);
+        }
+    }
+  while (!ready.empty ())
+    {
+      const auto i = ready.back ();
+      ready.pop_back ();
+      double max_child_cost{};
+      for (const auto child : nodes_[i].children)
+        {
+          max_child_cost = std::max (max_child_cost, path_costs[child]);
+        }
+      path_costs[i] = costs[i] + max_child_cost;
+      for (const auto parent : parents[i])
+        {
+          if (--remaining_children[parent] == 0)
+            ready.push_back (parent);
+        }
+    }
+
+  // Follow the most expensive branch from the most expensive trigger node
+  std::vector<bool> on_path (nodes_.size ());
+  if (
+    trigger_nodes_.empty ()
+    || std::ranges::all_of (costs, [] (const auto cost) { return cost <= 0; }))
+    return on_path;
+
+  auto cur = *std::ranges::max_element (
+    trigger_nodes_, {}, [&] (const auto i) { return path_costs[i]; });
+  for (;;)
+    {
+      on_path[cur] = true;
+      const auto &children = nodes_[cur].children;
+      if (children.empty ())
+        break;
+      cur = *std::ranges::max_element (
+        children, {}, [&] (const auto i) { return path_costs[i]; });
+    }
+  return on_path;
+}
+
+} // namespace zrythm::dsp::graph
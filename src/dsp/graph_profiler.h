@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "dsp/graph_node.h"
+#include "utils/ring_buffer.h"
+#include "utils/utf8_string.h"
+
+#include <nlohmann/json_fwd.hpp>
+
+namespace zrythm::dsp::graph
+{
+
+/**
+ * @brief Collects per-node processing times of a GraphScheduler.
+ *
+ * When enabled, each graph thread records how long every node it processes
+ * takes into its own lock-free ring. The rings are drained from a non-realtime
+ * thread (e.g., periodically by the UI) into a window of recent timings per
+ * node, which snapshot() summarizes.
+ *
+ * Disabled profilers cost a single relaxed atomic load per node.
+ */
+class GraphProfiler
+{
+public:
+  /**
+   * @brief Summary of the recent timings of a node.
+   */
+  struct NodeStats
+  {
+    GraphNode::NodeId node_id{};
+    utils::Utf8String name;
+
+    /** Number of timings in the window. */
+    size_t num_runs{};
+
+    double mean_us{};
+    double p99_us{};
+    double max_us{};
+
+    /**
+     * @brief The graph thread that processed the node most often.
+     *
+     * -1 is the main graph thread (see GraphThread::id_).
+     */
+    int thread_id{ -1 };
+
+    /** Fraction of the runs that happened on @ref thread_id. */
+    double thread_share{};
+
+    /**
+     * @brief Whether the node is on the longest path through the graph,
+     * weighted by the mean processing times.
+     */
+    bool on_critical_path{};
+
+    friend void to_json (nlohmann::json &j, const NodeStats &stats);
+  };
+
+  /** Number of recent timings kept per node. */
+  static constexpr size_t kWindowSize = 1024;
+
+  /** Number of timings each thread can record between drains. */
+  static constexpr size_t kThreadRingSize = 16384;
+
+  GraphProfiler () = default;
+  GraphProfiler (const GraphProfiler &) = delete;
+  GraphProfiler &operator= (const GraphProfiler &) = delete;
+  GraphProfiler (GraphProfiler &&) = delete;
+  GraphProfiler &operator= (GraphProfiler &&) = delete;
+  ~GraphProfiler () = default;
+
+  [[nodiscard]] bool enabled () const noexcept [[clang::nonblocking]]
+  {
+    return enabled_.load (std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Starts or stops recording timings.
+   *
+   * Collected timings are kept when disabling.
+   */
+  void set_enabled (bool enabled);
+
+  /**
+   * @brief Allocates a ring for each graph thread.
+   *
+   * Must not be called while the threads are running.
+   *
+   * @param num_worker_threads Number of worker threads, excluding the main
+   * graph thread.
+   */
+  void set_num_threads (size_t num_worker_threads);
+
+  /**
+   * @brief Starts tracking the nodes of a new graph, dropping the timings of
+   * the previous one.
+   *
+   * Must not be called while the graph is processing.
+   */
+  void set_nodes (const GraphNodeCollection &nodes);
+
+  /**
+   * @brief Records the time a thread took to process a node.
+   *
+   * Timings are dropped when the thread's ring is full.
+   *
+   * @param thread_id The GraphThread::id_ of the calling thread.
+   */
+  void record (
+    int                      thread_id,
+    const GraphNode         &node,
+    std::chrono::nanoseconds duration) noexcept [[clang::nonblocking]];
+
+  /**
+   * @brief Moves the recorded timings into the per-node windows.
+   */
+  void drain ();
+
+  /**
+   * @brief Drains and returns the stats of each node, in graph order.
+   */
+  std::vector<NodeStats> snapshot ();
+
+  /**
+   * @brief Clears the collected timings.
+   *
+   * May be called while the graph threads are recording.
+   */
+  void reset ();
+
+  /**
+   * @brief Returns the number of timings dropped because a ring was full.
+   */
+  size_t dropped_count () const
+  {
+    return dropped_count_.load (std::memory_order_relaxed);
+  }
+
+private:
+  struct Sample
+  {
+    const GraphNode * node{};
+    uint32_t          duration_ns{};
+  };
+
+  struct NodeState
+  {
+    GraphNode::NodeId   node_id{};
+    utils::Utf8String   name;
+    std::vector<size_t> children;
+
+    /** Circular window of recent timings. */
+    std::vector<uint32_t> window;
+    size_t                window_pos{};
+
+    /** Runs per thread slot (see thread_slot()). */
+    std::vector<size_t> thread_runs;
+  };
+
+  static size_t thread_slot (int thread_id)
+  {
+    return static_cast<size_t> (thread_id + 1);
+  }
+
+  void drain_locked ();
+
+  /**
+   * @brief Drops the timings in the rings without accumulating them.
+   *
+   * Safe while the graph threads are recording.
+   */
+  void discard_recorded_locked ();
+
+  /**
+   * @brief Returns the indices of the nodes on the longest path, weighted by
+   * @p costs.
+   */
+  std::vector<bool> find_critical_path (const std::vector<double> &costs) const;
+
+private:
+  std::atomic<bool>   enabled_;
+  std::atomic<size_t> dropped_count_;
+
+  /** One ring per graph thread, indexed by thread_slot(). */
+  std::vector<std::unique_ptr<RingBuffer<Sample>>> rings_;
+
+  /** Guards everything below and reading from the rings. */
+  std::mutex mutex_;
+
+  std::vector<NodeState>                        nodes_;
+  std::unordered_map<const GraphNode *, size_t> node_indices_;
+  std::vector<size_t>                           trigger_nodes_;
+};
+
+} // namespace zrythm::dsp::graph
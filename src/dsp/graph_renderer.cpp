@@ -51,10 +51,13 @@ GraphRenderer::render (
       return;
     }
 
-  // Initialize output buffer with latency preroll added
+  // Initialize output buffer with latency preroll added (not needed when
+  // blocks are streamed to a sink)
   const auto total_samples_with_latency = num_samples + max_latency_frames;
   juce::AudioSampleBuffer output{
-    2, total_samples_with_latency.in<int> (units::samples)
+    2, options.block_sink_
+         ? 0
+         : total_samples_with_latency.in<int> (units::samples)
   };
   output.clear ();
 
@@ -82,7 +85,8 @@ GraphRenderer::render (
   auto            latency_preroll_frames = max_latency_frames;
 
   // Prepare for progress reporting
-  promise.setProgressRange (0, output.getNumSamples ());
+  promise.setProgressRange (
+    0, total_samples_with_latency.in<int> (units::samples));
 
   while (current_pos < range.second)
     {
@@ -138,15 +142,33 @@ GraphRenderer::render (
             }
         }
 
-      // Copy to output buffer
-      const auto output_offset = covered_frames;
-      for (int ch = 0; ch < output.getNumChannels (); ++ch)
+      if (options.loudness_analyzer_)
         {
-          if (ch < temp_buffer.getNumChannels ())
+          options.loudness_analyzer_->process (
+            temp_buffer, 0, nframes.in<int> (units::samples));
+        }
+
+      // Hand over to the sink or copy to output buffer
+      if (options.block_sink_)
+        {
+          if (!options.block_sink_ (
+                temp_buffer, nframes.in<int> (units::samples)))
             {
-              output.copyFrom (
-                ch, output_offset.in<int> (units::samples), temp_buffer, ch, 0,
-                nframes.in<int> (units::samples));
+              z_debug ("Block sink stopped rendering");
+              return;
+            }
+        }
+      else
+        {
+          const auto output_offset = covered_frames;
+          for (int ch = 0; ch < output.getNumChannels (); ++ch)
+            {
+              if (ch < temp_buffer.getNumChannels ())
+                {
+                  output.copyFrom (
+                    ch, output_offset.in<int> (units::samples), temp_buffer,
+                    ch, 0, nframes.in<int> (units::samples));
+                }
             }
         }
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "dsp/graph_node.h"
+#include "dsp/loudness_analyzer.h"
 #include "utils/units.h"
 
 #include <QPromise>
@@ -24,6 +25,26 @@ public:
     units::sample_t      block_length_;
     unsigned int         num_threads_ =
       std::max (5u, std::thread::hardware_concurrency ()) - 4;
+
+    /**
+     * @brief Optional analyzer fed with every rendered block.
+     *
+     * Lets exports get loudness/true-peak figures without a separate pass
+     * over the result. Call LoudnessAnalyzer::finish() once the render has
+     * completed.
+     */
+    std::shared_ptr<LoudnessAnalyzer> loudness_analyzer_;
+
+    /**
+     * @brief Optional consumer of the rendered blocks (e.g. an
+     * ExportPipeline).
+     *
+     * When set, blocks are passed here as they are rendered instead of being
+     * collected, and the result is an empty buffer. Returning false stops the
+     * render without a result.
+     */
+    std::function<bool (const juce::AudioSampleBuffer &block, int num_frames)>
+      block_sink_;
   };
 
   /**
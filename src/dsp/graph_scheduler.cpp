@@ -23,6 +23,7 @@
  * ---
  */
 
+#include <unordered_map>
 #include <utility>
 
 #include "dsp/graph_scheduler.h"
@@ -47,6 +48,9 @@ struct GraphScheduler::ThreadSet
   boost::concurrent_flat_set<GraphThreadPtr> threads_;
   GraphThreadPtr                             main_thread_;
   std::atomic<size_t>                        num_threads_{ 0 };
+
+  /** Worker threads indexed by their ID (for unparking). */
+  std::vector<GraphThread *> workers_;
 };
 
 size_t
@@ -66,6 +70,15 @@ GraphScheduler::GraphScheduler (
       sample_rate_ (sample_rate), max_block_length_ (max_block_length),
       run_on_main_thread_func_ (std::move (run_on_main_thread_func))
 {
+  if (env_get_int ("ZRYTHM_DSP_CRITICAL_PATH_SCHEDULING", 0) == 1)
+    {
+      scheduling_mode_.store (SchedulingMode::CriticalPath);
+    }
+  if (env_get_int ("ZRYTHM_DSP_ADAPTIVE_THREADS", 0) == 1)
+    {
+      adaptive_thread_count_.store (true);
+    }
+
   if (realtime_threads)
     {
       realtime_thread_options_ =
@@ -93,8 +106,213 @@ GraphScheduler::trigger_node (GraphNode &node)
       /* all nodes that feed this node have completed, so this node be
        * processed now. */
       /*z_info ("triggering node, pushing back");*/
-      trigger_queue_.push_back (&node);
+      push_ready_node (node);
+    }
+}
+
+void
+GraphScheduler::push_ready_node (GraphNode &node)
+{
+  trigger_queues_[node.schedule_priority_].push_back (&node);
+}
+
+bool
+GraphScheduler::pop_ready_node (GraphNode *&node)
+{
+  for (int priority = max_priority_.load (std::memory_order_relaxed);
+       priority >= 0; --priority)
+    {
+      if (trigger_queues_[priority].pop_front (node))
+        return true;
+    }
+  return false;
+}
+
+void
+GraphScheduler::record_node_process_time (
+  GraphNode               &node,
+  std::chrono::nanoseconds duration)
+{
+  const auto us = std::chrono::duration<float, std::micro> (duration).count ();
+  node.avg_process_time_us_ +=
+    kProcessTimeSmoothing * (us - node.avg_process_time_us_);
+}
+
+void
+GraphScheduler::start_cycle ()
+{
+  const bool critical_path =
+    scheduling_mode_.load (std::memory_order_relaxed)
+    == SchedulingMode::CriticalPath;
+  if (
+    critical_path != critical_path_scheduling_.load (std::memory_order_relaxed))
+    {
+      critical_path_scheduling_.store (
+        critical_path, std::memory_order_relaxed);
+      cycles_until_priority_update_ = 0;
+      if (!critical_path)
+        {
+          for (auto * node : priority_order_)
+            {
+              node->schedule_priority_ = 0;
+            }
+          max_priority_.store (0, std::memory_order_relaxed);
+        }
+    }
+
+  if (critical_path && cycles_until_priority_update_-- == 0)
+    {
+      update_node_priorities ();
+      cycles_until_priority_update_ = kPriorityUpdateInterval - 1;
+    }
+
+  const bool adaptive = adaptive_thread_count_.load (std::memory_order_relaxed);
+  if (adaptive != adaptive_threads_.load (std::memory_order_relaxed))
+    {
+      adaptive_threads_.store (adaptive, std::memory_order_relaxed);
+      cycle_work_ns_.store (0, std::memory_order_relaxed);
+      measured_work_ = {};
+      measured_cycles_ = 0;
+      if (!adaptive)
+        {
+          set_active_workers (static_cast<int> (num_threads ()));
+        }
+    }
+
+  if (adaptive && measured_cycles_ == kThreadCountUpdateInterval)
+    {
+      update_active_thread_count (measured_work_ / measured_cycles_);
+      measured_work_ = {};
+      measured_cycles_ = 0;
+    }
+
+  for (const auto node : graph_nodes_.trigger_nodes_)
+    {
+      push_ready_node (node.get ());
+    }
+}
+
+void
+GraphScheduler::finish_cycle ()
+{
+  if (adaptive_threads_.load (std::memory_order_relaxed))
+    {
+      measured_work_ += std::chrono::nanoseconds (
+        cycle_work_ns_.exchange (0, std::memory_order_relaxed));
+      ++measured_cycles_;
+    }
+}
+
+void
+GraphScheduler::update_active_thread_count (std::chrono::nanoseconds avg_work)
+{
+  const int cur_threads = active_thread_count ();
+  const int max_threads = std::min (
+    static_cast<int> (num_threads ()) + 1, std::max (graph_width_, 1));
+  const int wanted_threads = std::clamp (
+    static_cast<int> ((avg_work + kMinWorkPerThread - 1ns) / kMinWorkPerThread),
+    1, max_threads);
+
+  // Step gradually to avoid oscillating
+  if (wanted_threads > cur_threads)
+    {
+      set_active_workers (cur_threads);
+    }
+  else if (wanted_threads < cur_threads)
+    {
+      set_active_workers (cur_threads - 2);
+    }
+}
+
+void
+GraphScheduler::set_active_workers (int count)
+{
+  const int prev_count = active_workers_.load (std::memory_order_relaxed);
+  active_workers_.store (count, std::memory_order_relaxed);
+  for (int id = prev_count; id < count; ++id)
+    {
+      thread_set_->workers_[id]->park_sem_.signal ();
+    }
+}
+
+void
+GraphScheduler::update_node_priorities ()
+{
+  float max_cost{};
+  for (auto * node : priority_order_)
+    {
+      float max_child_cost{};
+      for (const auto child : node->feeds ())
+        {
+          max_child_cost =
+            std::max (max_child_cost, child.get ().remaining_path_cost_us_);
+        }
+      node->remaining_path_cost_us_ =
+        node->avg_process_time_us_ + max_child_cost;
+      max_cost = std::max (max_cost, node->remaining_path_cost_us_);
     }
+
+  int max_priority = 0;
+  for (auto * node : priority_order_)
+    {
+      node->schedule_priority_ =
+        max_cost > 0.f
+          ? std::min (
+              kNumPriorityLevels - 1,
+              static_cast<int> (
+                static_cast<float> (kNumPriorityLevels)
+                * node->remaining_path_cost_us_ / max_cost))
+          : 0;
+      max_priority = std::max (max_priority, node->schedule_priority_);
+    }
+  max_priority_.store (max_priority, std::memory_order_relaxed);
+}
+
+void
+GraphScheduler::update_graph_topology ()
+{
+  // Kahn's algorithm on the reversed graph, so that children come first
+  priority_order_.clear ();
+  priority_order_.reserve (graph_nodes_.graph_nodes_.size ());
+  std::unordered_map<const GraphNode *, size_t> remaining_children;
+  for (const auto &node : graph_nodes_.graph_nodes_)
+    {
+      node->schedule_priority_ = 0;
+      remaining_children.emplace (node.get (), node->feeds ().size ());
+      if (node->feeds ().empty ())
+        priority_order_.push_back (node.get ());
+    }
+  for (size_t i = 0; i < priority_order_.size (); ++i)
+    {
+      for (const auto parent : priority_order_[i]->depends ())
+        {
+          if (--remaining_children.at (std::addressof (parent.get ())) == 0)
+            priority_order_.push_back (std::addressof (parent.get ()));
+        }
+    }
+  assert (priority_order_.size () == graph_nodes_.graph_nodes_.size ());
+
+  max_priority_.store (0, std::memory_order_relaxed);
+  cycles_until_priority_update_ = 0;
+
+  // Group nodes by their longest distance from the trigger nodes
+  std::unordered_map<const GraphNode *, size_t> depths;
+  std::vector<int>                              nodes_per_depth;
+  for (auto * node : std::views::reverse (priority_order_))
+    {
+      size_t depth = 0;
+      for (const auto parent : node->depends ())
+        {
+          depth =
+            std::max (depth, depths.at (std::addressof (parent.get ())) + 1);
+        }
+      depths.emplace (node, depth);
+      if (depth >= nodes_per_depth.size ())
+        nodes_per_depth.resize (depth + 1);
+      ++nodes_per_depth[depth];
+    }
+  graph_width_ =
+    nodes_per_depth.empty () ? 1 : std::ranges::max (nodes_per_depth);
 }
 
 void
@@ -111,11 +329,16 @@ GraphScheduler::rechain_from_node_collection (
   /* --- swap setup nodes with graph nodes --- */
 
   graph_nodes_ = std::move (nodes);
+  profiler_.set_nodes (graph_nodes_);
 
   terminal_refcnt_.store (
     static_cast<int> (graph_nodes_.terminal_nodes_.size ()));
 
-  trigger_queue_.reserve (graph_nodes_.graph_nodes_.size ());
+  for (auto &queue : trigger_queues_)
+    {
+      queue.reserve (graph_nodes_.graph_nodes_.size ());
+    }
+  update_graph_topology ();
 
   sample_rate_ = sample_rate;
   max_block_length_ = max_block_length;
@@ -150,14 +373,18 @@ GraphScheduler::start_threads (std::optional<int> num_threads)
       num_threads.emplace (num_threads_int);
     }
 
+  profiler_.set_num_threads (static_cast<size_t> (num_threads.value ()));
+
   try
     {
       /* create worker threads */
       z_debug ("creating {} threads", num_threads.value ());
       for (int i = 0; i < num_threads.value (); ++i)
         {
-          thread_set_->threads_.insert (
-            std::make_unique<GraphThread> (i, false, *this, thread_workgroup_));
+          auto thread =
+            std::make_unique<GraphThread> (i, false, *this, thread_workgroup_);
+          thread_set_->workers_.push_back (thread.get ());
+          thread_set_->threads_.insert (std::move (thread));
         }
 
       /* and the main thread */
@@ -166,6 +393,9 @@ GraphScheduler::start_threads (std::optional<int> num_threads)
 
       thread_set_->num_threads_.store (
         thread_set_->threads_.size (), std::memory_order_relaxed);
+      active_workers_.store (
+        static_cast<int> (thread_set_->threads_.size ()),
+        std::memory_order_relaxed);
     }
   catch (const std::exception &e)
     {
@@ -268,6 +498,10 @@ GraphScheduler::terminate_threads ()
     {
       trigger_sem_.signal ();
     }
+  for (auto * worker : thread_set_->workers_)
+    {
+      worker->park_sem_.signal ();
+    }
 
   /* and the main thread */
   callback_start_sem_.signal ();
@@ -279,9 +513,11 @@ GraphScheduler::terminate_threads ()
   thread_set_->main_thread_->waitForThreadToExit (-1);
 
   /* Clear threads only after all threads have been joined */
+  thread_set_->workers_.clear ();
   thread_set_->threads_.clear ();
   thread_set_->main_thread_.reset ();
   thread_set_->num_threads_.store (0, std::memory_order_relaxed);
+  active_workers_.store (0, std::memory_order_relaxed);
 
   z_info ("graph terminated");
 }
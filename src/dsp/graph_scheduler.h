@@ -27,6 +27,7 @@
 #pragma once
 
 #include "dsp/graph_node.h"
+#include "dsp/graph_profiler.h"
 #include "utils/mpmc_queue.h"
 #include "utils/rt_thread_id.h"
 
@@ -66,6 +67,55 @@ public:
    */
   using RunOnMainThreadFunc = std::function<void (std::function<void ()>)>;
 
+  /**
+   * @brief Order in which ready nodes are picked up by the graph threads.
+   */
+  enum class SchedulingMode : std::uint8_t
+  {
+    /**
+     * @brief Nodes run in the order they became ready.
+     */
+    Fifo,
+
+    /**
+     * @brief Nodes with the longest estimated path to the end of the cycle
+     * run first.
+     *
+     * The estimate combines the graph topology with a smoothed history of
+     * measured node processing times, so that long chains (e.g., plugin
+     * chains) are not held back by cheap nodes (e.g., meters) that became
+     * ready at the same time.
+     */
+    CriticalPath,
+  };
+
+  /**
+   * @brief Number of distinct priorities used in SchedulingMode::CriticalPath.
+   */
+  static constexpr int kNumPriorityLevels = 8;
+
+  /**
+   * @brief Number of cycles between updates of the node priorities.
+   */
+  static constexpr int kPriorityUpdateInterval = 8;
+
+  /**
+   * @brief Weight of a new measurement in the smoothed node processing times.
+   */
+  static constexpr float kProcessTimeSmoothing = 0.1f;
+
+  /**
+   * @brief Number of cycles between adjustments of the active thread count
+   * when the thread count is adaptive.
+   */
+  static constexpr int kThreadCountUpdateInterval = 32;
+
+  /**
+   * @brief Minimum amount of processing time per cycle that justifies waking
+   * up another thread when the thread count is adaptive.
+   */
+  static constexpr auto kMinWorkPerThread = std::chrono::microseconds (50);
+
   /**
    * @brief Construct a new Graph Scheduler.
    *
@@ -125,6 +175,62 @@ public:
 
   auto &get_nodes () { return graph_nodes_; }
 
+  /**
+   * @brief Per-node timings of the graph threads.
+   */
+  GraphProfiler &profiler () { return profiler_; }
+
+  /**
+   * @brief Sets the order in which ready nodes are processed.
+   *
+   * Takes effect at the start of the next cycle. Defaults to
+   * SchedulingMode::Fifo unless the `ZRYTHM_DSP_CRITICAL_PATH_SCHEDULING`
+   * environment variable is set to 1.
+   */
+  void set_scheduling_mode (SchedulingMode mode)
+  {
+    scheduling_mode_.store (mode, std::memory_order_relaxed);
+  }
+  SchedulingMode scheduling_mode () const
+  {
+    return scheduling_mode_.load (std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Sets whether the number of threads processing the graph adapts to
+   * the graph.
+   *
+   * When enabled, worker threads that are not worth waking up (because the
+   * graph is too narrow or the work per cycle too small) are parked, and
+   * idle threads spin for a short while before falling asleep.
+   *
+   * Takes effect at the start of the next cycle. Defaults to false unless the
+   * `ZRYTHM_DSP_ADAPTIVE_THREADS` environment variable is set to 1.
+   */
+  void set_adaptive_thread_count (bool adaptive)
+  {
+    adaptive_thread_count_.store (adaptive, std::memory_order_relaxed);
+  }
+  bool adaptive_thread_count () const
+  {
+    return adaptive_thread_count_.load (std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns the number of threads currently processing the graph,
+   * including the main graph thread.
+   */
+  int active_thread_count () const
+  {
+    return active_workers_.load (std::memory_order_relaxed) + 1;
+  }
+
+  /**
+   * @brief Returns the maximum number of nodes that can be processed in
+   * parallel, based on the longest path from the trigger nodes to each node.
+   */
+  int graph_width () const { return graph_width_; }
+
   /**
    * @brief To be called repeatedly by a system audio callback thread.
    *
@@ -180,6 +286,74 @@ private:
    */
   [[gnu::hot]] void trigger_node (GraphNode &node);
 
+  /**
+   * @brief Pushes a node whose dependencies have completed to the queue
+   * matching its priority.
+   */
+  [[gnu::hot]] void push_ready_node (GraphNode &node);
+
+  /**
+   * @brief Pops the highest-priority ready node, if any.
+   */
+  [[gnu::hot]] bool pop_ready_node (GraphNode *&node);
+
+  /**
+   * @brief Updates the smoothed processing time of a node.
+   *
+   * Called by the thread that processed the node.
+   */
+  void
+  record_node_process_time (GraphNode &node, std::chrono::nanoseconds duration);
+
+  /**
+   * @brief Starts a cycle by pushing the trigger nodes.
+   *
+   * Called by the graph thread that kicks off the cycle while all other
+   * threads are idle, which is also when node priorities and the active
+   * thread count are updated.
+   */
+  [[gnu::hot]] void start_cycle ();
+
+  /**
+   * @brief Called by the graph thread that processed the last terminal node
+   * of a cycle.
+   */
+  void finish_cycle ();
+
+  /**
+   * @brief Moves the active thread count one step towards what the measured
+   * work per cycle suggests.
+   *
+   * @param avg_work Average total node processing time per cycle.
+   */
+  void update_active_thread_count (std::chrono::nanoseconds avg_work);
+
+  /**
+   * @brief Sets the number of active worker threads and wakes up any parked
+   * threads that became active.
+   */
+  void set_active_workers (int count);
+
+  /**
+   * @brief Returns whether the given worker thread should be parked.
+   */
+  bool should_park (int thread_id) const
+  {
+    return thread_id >= active_workers_.load (std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Recalculates the node priorities from the smoothed node
+   * processing times.
+   */
+  void update_node_priorities ();
+
+  /**
+   * @brief Calculates @ref priority_order_ and @ref graph_width_ from the
+   * current nodes.
+   */
+  void update_graph_topology ();
+
   /**
    * @brief Called before calling run_cycle() to make sure each node has
    * its buffers ready.
@@ -228,8 +402,67 @@ private:
   // This is not a std::counting_semaphore due to issues on MSVC/Windows.
   moodycamel::LightweightSemaphore trigger_sem_{ 0 };
 
-  /** Queue containing nodes that can be processed. */
-  MPMCQueue<GraphNode *> trigger_queue_;
+  /**
+   * @brief Queues containing nodes that can be processed, one per priority.
+   *
+   * Only the first queue is used in SchedulingMode::Fifo.
+   */
+  std::array<MPMCQueue<GraphNode *>, kNumPriorityLevels> trigger_queues_;
+
+  std::atomic<SchedulingMode> scheduling_mode_{ SchedulingMode::Fifo };
+
+  /**
+   * @brief Whether critical-path scheduling is used in the current cycle.
+   *
+   * Only changed at the start of a cycle. Atomic because spinning workers may
+   * still read it then.
+   */
+  std::atomic<bool> critical_path_scheduling_{ false };
+
+  /** Highest priority assigned to any node. */
+  std::atomic<int> max_priority_{ 0 };
+
+  /** Cycles remaining until the node priorities are recalculated. */
+  int cycles_until_priority_update_{};
+
+  /**
+   * @brief Live graph nodes ordered so that each node comes after all the
+   * nodes it feeds.
+   */
+  std::vector<GraphNode *> priority_order_;
+
+  /** Maximum number of nodes at the same depth in the graph. */
+  int graph_width_{ 1 };
+
+  std::atomic<bool> adaptive_thread_count_{ false };
+
+  /**
+   * @brief Whether the thread count is adaptive in the current cycle.
+   *
+   * Only changed at the start of a cycle. Atomic because spinning workers may
+   * still read it then.
+   */
+  std::atomic<bool> adaptive_threads_{ false };
+
+  /**
+   * @brief Number of worker threads (excluding the main graph thread) that
+   * are not parked.
+   *
+   * Only changed at the start of a cycle.
+   */
+  std::atomic<int> active_workers_{ 0 };
+
+  /**
+   * @brief Total node processing time in the current cycle, in nanoseconds
+   * (only measured with adaptive threads).
+   */
+  std::atomic<int64_t> cycle_work_ns_{ 0 };
+
+  /** Total node processing time since the last thread count update. */
+  std::chrono::nanoseconds measured_work_{};
+
+  /** Number of cycles in @ref measured_work_. */
+  int measured_cycles_{};
 
   /**
    * @brief Live graph nodes.
@@ -239,6 +472,8 @@ private:
   /** Remaining unprocessed terminal nodes in this cycle. */
   std::atomic<int> terminal_refcnt_ = 0;
 
+  GraphProfiler profiler_;
+
   /**
    * @brief If this contains a value, realtime threads will be created with
    * these options, otherwise default options will be used.
@@ -94,6 +94,13 @@
 #  include <sanitizer/rtsan_interface.h>
 #endif
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) \
+  || defined(_M_IX86)
+#  include <immintrin.h>
+#elif defined(_M_ARM64)
+#  include <intrin.h>
+#endif
+
 namespace zrythm::dsp::graph
 {
 
@@ -105,6 +112,33 @@ constexpr auto THREAD_STACK_SIZE = 0x80000; // 512kB
 constexpr auto THREAD_STACK_SIZE = 0x20000; // 128kB
 #endif
 
+/**
+ * @brief Number of times an idle thread checks for work before falling
+ * asleep (with adaptive thread counts).
+ */
+constexpr int SPIN_ROUNDS = 10;
+
+/**
+ * @brief The wait between spin rounds doubles each round up to
+ * 2^MAX_BACKOFF_SHIFT CPU pauses.
+ */
+constexpr int MAX_BACKOFF_SHIFT = 6;
+
+static inline void
+cpu_relax () noexcept
+{
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) \
+  || defined(_M_IX86)
+  _mm_pause ();
+#elif defined(_M_ARM64)
+  __yield ();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__ ("yield" ::: "memory");
+#else
+  std::atomic_signal_fence (std::memory_order_seq_cst);
+#endif
+}
+
 void
 GraphThread::on_reached_terminal_node ()
 {
@@ -112,6 +146,7 @@ GraphThread::on_reached_terminal_node ()
   if (scheduler_.terminal_refcnt_.fetch_sub (1) == 1)
     {
       /* all terminal nodes have completed, we're done with this cycle. */
+      scheduler_.finish_cycle ();
 
       /* Notify caller */
       scheduler_.callback_done_sem_.signal ();
@@ -144,12 +179,35 @@ GraphThread::on_reached_terminal_node ()
         static_cast<int> (scheduler_.graph_nodes_.terminal_nodes_.size ()));
 
       /* and start the initial nodes */
-      for (auto node : scheduler_.graph_nodes_.trigger_nodes_)
+      scheduler_.start_cycle ();
+      /* continue in worker-thread */
+    }
+}
+
+bool
+GraphThread::spin_for_work (GraphNode *&node)
+{
+  if (
+    !scheduler_.adaptive_threads_.load (std::memory_order_relaxed)
+    || scheduler_.should_park (id_))
+    return false;
+
+  for (int round = 0; round < SPIN_ROUNDS; ++round)
+    {
+      /* nothing more to wait for once the cycle is finished */
+      if (scheduler_.terminal_refcnt_.load (std::memory_order_relaxed) == 0)
+        return false;
+
+      const int num_pauses = 1 << std::min (round, MAX_BACKOFF_SHIFT);
+      for (int i = 0; i < num_pauses; ++i)
         {
-          scheduler_.trigger_queue_.push_back (std::addressof (node.get ()));
+          cpu_relax ();
         }
-      /* continue in worker-thread */
+
+      if (scheduler_.pop_ready_node (node))
+        return true;
     }
+  return false;
 }
 
 void
@@ -168,7 +226,7 @@ GraphThread::run_worker () noexcept
 
       /* Wake up idle threads, but at most as many as there's work in the
        * trigger queue that can be processed by other threads */
-      if (scheduler->trigger_queue_.pop_front (to_run))
+      if (scheduler->pop_ready_node (to_run) || spin_for_work (to_run))
         {
           assert (to_run != nullptr);
           if constexpr (DEBUG_THREADS)
@@ -186,6 +244,23 @@ GraphThread::run_worker () noexcept
 
       while (to_run == nullptr)
         {
+          if (scheduler->should_park (id_))
+            {
+              /* not needed for now - sleep until the scheduler needs more
+               * threads */
+              scheduler->idle_thread_cnt_.fetch_add (1);
+              park_sem_.wait ();
+
+              if (threadShouldExit ()) [[unlikely]]
+                {
+                  return;
+                }
+
+              scheduler->idle_thread_cnt_.fetch_sub (1);
+              scheduler->pop_ready_node (to_run);
+              continue;
+            }
+
           /* wait for work, fall asleep */
           scheduler->idle_thread_cnt_.fetch_add (1);
 
@@ -215,6 +290,14 @@ GraphThread::run_worker () noexcept
 
           /* not idle anymore - decrease idle thread count */
           scheduler->idle_thread_cnt_.fetch_sub (1);
+
+          if (scheduler->should_park (id_))
+            {
+              /* parked since falling asleep - pass the wake-up on to an
+               * active thread */
+              scheduler->trigger_sem_.signal ();
+              continue;
+            }
           if constexpr (DEBUG_THREADS)
             {
               z_info (
@@ -224,7 +307,7 @@ GraphThread::run_worker () noexcept
             }
 
           /* try to find some work to do */
-          scheduler->trigger_queue_.pop_front (to_run);
+          scheduler->pop_ready_node (to_run);
         }
 
       /* this thread has now claimed the graph node for processing - process it */
@@ -233,11 +316,42 @@ GraphThread::run_worker () noexcept
           z_info ("[{}]: running node", id_);
         }
 
+      const bool profile = scheduler->profiler_.enabled ();
+      const bool measure =
+        profile
+        || scheduler->critical_path_scheduling_.load (std::memory_order_relaxed)
+        || scheduler->adaptive_threads_.load (std::memory_order_relaxed);
+      const auto start_time =
+        measure
+          ? std::chrono::steady_clock::now ()
+          : std::chrono::steady_clock::time_point{};
+
       to_run->process (
         scheduler_.get_time_nfo (), scheduler_.get_remaining_preroll_frames (),
         scheduler_.get_transport_for_this_cycle (),
         scheduler_.get_tempo_map_for_this_cycle ());
 
+      if (measure)
+        {
+          const auto duration = std::chrono::steady_clock::now () - start_time;
+          if (profile)
+            {
+              scheduler->profiler_.record (id_, *to_run, duration);
+            }
+          if (
+            scheduler->critical_path_scheduling_.load (
+              std::memory_order_relaxed))
+            {
+              scheduler->record_node_process_time (*to_run, duration);
+            }
+          if (scheduler->adaptive_threads_.load (std::memory_order_relaxed))
+            {
+              scheduler->cycle_work_ns_.fetch_add (
+                std::chrono::nanoseconds (duration).count (),
+                std::memory_order_relaxed);
+            }
+        }
+
       /* if there are no outgoing edges, this is a terminal node */
       if (to_run->feeds ().empty ())
         {
@@ -287,11 +401,7 @@ GraphThread::run ()
 
       /* bootstrap trigger-list.
        * (later this is done by Graph.reached_terminal_node())*/
-      for (const auto node : graph->graph_nodes_.trigger_nodes_)
-        {
-          /*z_info ("[main] pushing back node {} during bootstrap", i);*/
-          graph->trigger_queue_.push_back (std::addressof (node.get ()));
-        }
+      graph->start_cycle ();
 
       /* after setup, the main-thread just becomes a normal worker */
     }
@@ -9,10 +9,12 @@
 
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_core/juce_core.h>
+#include <moodycamel/lightweightsemaphore.h>
 
 namespace zrythm::dsp::graph
 {
 
+class GraphNode;
 class GraphScheduler;
 
 /**
@@ -54,6 +56,17 @@ private:
    */
   void run_worker () noexcept [[clang::nonblocking]];
 
+  /**
+   * @brief Checks for new work a few times with exponential backoff before
+   * the thread falls asleep.
+   *
+   * Only used with adaptive thread counts, and only while a cycle is in
+   * progress.
+   *
+   * @return Whether a node to process was found.
+   */
+  bool spin_for_work (GraphNode *&node);
+
 public:
   /**
    * Thread index in zrythm.
@@ -72,6 +85,13 @@ public:
   /** Pointer back to the owner scheduler. */
   GraphScheduler &scheduler_;
 
+  /**
+   * @brief Semaphore this thread sleeps on while parked.
+   *
+   * @see GraphScheduler::set_adaptive_thread_count().
+   */
+  moodycamel::LightweightSemaphore park_sem_{ 0 };
+
   /**
    * @brief Non-owning pointer (optional) to a workgroup to join.
    *
@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include "dsp/lookahead_processor.h"
+#include "dsp/lookahead_renderer.h"
+#include "utils/registry_utils.h"
+
+namespace zrythm::dsp
+{
+
+LookaheadProcessor::LookaheadProcessor (
+  utils::IObjectRegistry &registry,
+  QObject *               parent)
+    : QObject (parent), ProcessorBase (registry, u8"Lookahead"),
+      capture_port_ (
+        std::make_unique<AudioPort> (
+          u8"Lookahead Capture", PortFlow::Input, AudioPort::BusLayout::Stereo,
+          2))
+{
+  auto port_ref = utils::create_object<AudioPort> (
+    registry, u8"Lookahead Out", PortFlow::Output, AudioPort::BusLayout::Stereo,
+    2);
+  port_ref.get_object_as<AudioPort> ()->set_symbol (u8"lookahead_stereo_out");
+  add_output_port (port_ref);
+}
+
+LookaheadProcessor::~LookaheadProcessor () = default;
+
+void
+LookaheadProcessor::attach (LookaheadRenderer * renderer)
+{
+  renderer_.store (nullptr, std::memory_order_release);
+  read_index_.store (0);
+  write_index_.store (0);
+  stopped_read_offset_ = 0;
+  renderer_.store (renderer, std::memory_order_release);
+}
+
+bool
+LookaheadProcessor::has_free_chunk () const
+{
+  return write_index_.load (std::memory_order_relaxed)
+           - read_index_.load (std::memory_order_acquire)
+         < NUM_CHUNKS;
+}
+
+void
+LookaheadProcessor::push_chunk (
+  units::sample_t position,
+  int             num_frames,
+  bool            rolling,
+  uint64_t        generation)
+{
+  const auto write_index = write_index_.load (std::memory_order_relaxed);
+  auto      &chunk = chunks_[write_index % NUM_CHUNKS];
+  if (chunk.frames.getNumSamples () < num_frames)
+    {
+      // Not prepared (yet)
+      return;
+    }
+
+  chunk.position = position;
+  chunk.num_frames = num_frames;
+  chunk.rolling = rolling;
+  chunk.generation = generation;
+  const auto &captured = *capture_port_->buffers ();
+  for (int ch = 0; ch < chunk.frames.getNumChannels (); ++ch)
+    {
+      chunk.frames.copyFrom (ch, 0, captured, ch, 0, num_frames);
+    }
+  write_index_.store (write_index + 1, std::memory_order_release);
+}
+
+void
+LookaheadProcessor::custom_prepare_for_processing (
+  const graph::GraphNode * node,
+  units::sample_rate_t     sample_rate,
+  units::sample_u32_t      max_block_length)
+{
+  audio_out_rt_ = &get_stereo_out_port ();
+  for (auto &chunk : chunks_)
+    {
+      chunk.frames.setSize (
+        2, LookaheadRenderer::CHUNK_LENGTH.in<int> (units::samples));
+      chunk.frames.clear ();
+    }
+}
+
+void
+LookaheadProcessor::custom_process_block (
+  graph::ProcessBlockInfo time_nfo,
+  const ITransport       &transport,
+  const TempoMap         &tempo_map) noexcept
+{
+  // Output ports are already cleared by ProcessorBase::process_block.
+
+  auto * renderer = renderer_.load (std::memory_order_acquire);
+  if (renderer == nullptr)
+    return;
+
+  const auto generation = renderer->generation ();
+  const bool rolling =
+    transport.get_play_state () == ITransport::PlayState::Rolling;
+  const bool loop_enabled = transport.loop_enabled ();
+  const auto [loop_start, loop_end] = transport.get_loop_range_positions ();
+  auto       position = units::samples (
+    static_cast<int64_t> (time_nfo.transport_position_.in (units::samples)));
+  const auto buffer_offset = time_nfo.buffer_offset_.in<int> (units::samples);
+  const auto nframes = time_nfo.nframes_.in<int> (units::samples);
+  auto      &out = *audio_out_rt_->buffers ();
+
+  // Nothing was requested since the renderer started
+  bool restart = generation == 0;
+
+  int processed = 0;
+  while (processed < nframes && !restart)
+    {
+      const auto read_index = read_index_.load (std::memory_order_relaxed);
+      if (read_index == write_index_.load (std::memory_order_acquire))
+        {
+          // Underrun - the renderer is still catching up
+          break;
+        }
+
+      auto      &chunk = chunks_[read_index % NUM_CHUNKS];
+      const auto pop_chunk = [&] () {
+        stopped_read_offset_ = 0;
+        read_index_.store (read_index + 1, std::memory_order_release);
+      };
+
+      // Rendered before the last restart request
+      if (chunk.generation != generation)
+        {
+          pop_chunk ();
+          continue;
+        }
+
+      int offset{};
+      if (chunk.rolling != rolling)
+        {
+          restart = true;
+          break;
+        }
+      if (rolling)
+        {
+          const auto chunk_end =
+            chunk.position
+            + units::samples (static_cast<int64_t> (chunk.num_frames));
+          // Behind the playhead (e.g., the renderer is catching up)
+          if (position >= chunk_end)
+            {
+              pop_chunk ();
+              continue;
+            }
+          // The playhead jumped back
+          if (position < chunk.position)
+            {
+              restart = true;
+              break;
+            }
+          offset = (position - chunk.position).in<int> (units::samples);
+        }
+      else
+        {
+          // While stopped the position stays the same and each chunk is
+          // played once (e.g., plugin tails)
+          if (position != chunk.position)
+            {
+              restart = true;
+              break;
+            }
+          offset = stopped_read_offset_;
+        }
+
+      auto num_frames =
+        std::min (chunk.num_frames - offset, nframes - processed);
+      // Chunks are split at the loop end
+      if (rolling && loop_enabled && position < loop_end)
+        {
+          num_frames = std::min (
+            num_frames, (loop_end - position).in<int> (units::samples));
+        }
+      for (int ch = 0; ch < out.getNumChannels (); ++ch)
+        {
+          out.copyFrom (
+            ch, buffer_offset + processed, chunk.frames, ch, offset,
+            num_frames);
+        }
+      processed += num_frames;
+
+      if (offset + num_frames == chunk.num_frames)
+        {
+          pop_chunk ();
+        }
+      else if (!rolling)
+        {
+          stopped_read_offset_ = offset + num_frames;
+        }
+      if (rolling)
+        {
+          position = playhead_position_after_adding_frames (
+            position, units::samples (static_cast<int64_t> (num_frames)),
+            loop_enabled, loop_start, loop_end);
+        }
+    }
+
+  if (restart)
+    {
+      renderer->request_restart (generation, position, transport, tempo_map);
+    }
+}
+
+void
+LookaheadProcessor::custom_release_resources ()
+{
+  audio_out_rt_ = nullptr;
+  for (auto &chunk : chunks_)
+    {
+      chunk.frames.setSize (0, 0);
+    }
+}
+
+} // namespace zrythm::dsp
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include "dsp/processor_base.h"
+#include "utils/audio.h"
+
+namespace zrythm::dsp
+{
+
+class LookaheadRenderer;
+
+/**
+ * @brief Plays the output of a processing chain rendered ahead of time.
+ *
+ * Takes the place of a playback-only chain (e.g., a track's processor and
+ * plugins) in the live graph. The chain itself is processed by a
+ * LookaheadRenderer on non-realtime threads, in chunks much larger than the
+ * device's block length and ahead of the playhead, with its output connected
+ * to get_capture_port(). In the realtime cycle this processor only copies the
+ * pre-rendered frames for the current position to its output.
+ *
+ * Outputs silence while the renderer is not running, or until it catches up
+ * after a jump in the playhead position (seek, start/stop).
+ */
+class LookaheadProcessor final : public QObject, public ProcessorBase
+{
+  Q_OBJECT
+  Q_DISABLE_COPY_MOVE (LookaheadProcessor)
+
+public:
+  /** Number of chunks the renderer may render ahead of the playhead. */
+  static constexpr size_t NUM_CHUNKS = 8;
+
+  LookaheadProcessor (
+    utils::IObjectRegistry &registry,
+    QObject *               parent = nullptr);
+  ~LookaheadProcessor () override;
+
+  AudioPort &get_stereo_out_port () const
+  {
+    return *get_output_ports ().front ().get_object_as<AudioPort> ();
+  }
+
+  /**
+   * @brief Port to connect the rendered chain to in the lookahead graph.
+   *
+   * Not one of this processor's ports (and not in any registry), since it must
+   * not be added to the live graph.
+   */
+  AudioPort &get_capture_port () const { return *capture_port_; }
+
+  // ============================================================================
+  // ProcessorBase Interface
+  // ============================================================================
+
+  void custom_prepare_for_processing (
+    const graph::GraphNode * node,
+    units::sample_rate_t     sample_rate,
+    units::sample_u32_t      max_block_length) override;
+
+  void custom_process_block (
+    graph::ProcessBlockInfo time_nfo,
+    const ITransport       &transport,
+    const TempoMap         &tempo_map) noexcept override;
+
+  void custom_release_resources () override;
+
+  // ============================================================================
+
+private:
+  friend class LookaheadRenderer;
+
+  /**
+   * @brief A block of frames rendered by the renderer.
+   */
+  struct Chunk
+  {
+    /** Timeline position of the first frame. */
+    units::sample_t position;
+
+    int num_frames{};
+
+    /** Whether the transport was rolling when rendering. */
+    bool rolling{};
+
+    /** Renderer generation the chunk was rendered in. */
+    uint64_t generation{};
+
+    utils::audio::AudioBuffer frames;
+  };
+
+  /**
+   * @brief Starts reading chunks pushed by @p renderer, or stops reading if
+   * nullptr.
+   *
+   * Pending chunks are dropped.
+   *
+   * @warning Must not be called while the processor is being processed.
+   */
+  void attach (LookaheadRenderer * renderer);
+
+  /**
+   * @brief Returns whether there is room for another chunk.
+   *
+   * To be called from the renderer's thread only.
+   */
+  bool has_free_chunk () const;
+
+  /**
+   * @brief Pushes the first @p num_frames frames of the capture port as the
+   * next chunk.
+   *
+   * To be called from the renderer's thread only, when has_free_chunk() is
+   * true.
+   */
+  void push_chunk (
+    units::sample_t position,
+    int             num_frames,
+    bool            rolling,
+    uint64_t        generation);
+
+private:
+  std::unique_ptr<AudioPort> capture_port_;
+
+  std::array<Chunk, NUM_CHUNKS> chunks_;
+
+  /** Incremented by the renderer when a chunk is pushed. */
+  std::atomic<size_t> write_index_;
+
+  /** Incremented in the realtime thread when a chunk is consumed. */
+  std::atomic<size_t> read_index_;
+
+  /**
+   * @brief Number of frames already consumed from the current chunk while the
+   * transport is stopped (when rolling, the offset follows the position).
+   */
+  int stopped_read_offset_{};
+
+  std::atomic<LookaheadRenderer *> renderer_;
+
+  AudioPort * audio_out_rt_{};
+};
+
+} // namespace zrythm::dsp
@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+
+#include "dsp/lookahead_renderer.h"
+#include "dsp/transport.h"
+#include "utils/dsp_context.h"
+#include "utils/logger.h"
+#include "utils/tracy.h"
+
+using namespace std::chrono_literals;
+
+namespace zrythm::dsp
+{
+
+LookaheadRenderer::LookaheadRenderer (
+  graph::GraphScheduler::RunOnMainThreadFunc run_on_main_thread)
+    : run_on_main_thread_ (std::move (run_on_main_thread))
+{
+}
+
+LookaheadRenderer::~LookaheadRenderer ()
+{
+  clear_graph ();
+}
+
+void
+LookaheadRenderer::set_graph (
+  graph::GraphNodeCollection      &&nodes,
+  std::vector<LookaheadProcessor *> processors,
+  units::sample_rate_t              sample_rate)
+{
+  clear_graph ();
+
+  z_debug (
+    "Preparing lookahead graph for {} processors...", processors.size ());
+  scheduler_ = std::make_unique<graph::GraphScheduler> (
+    run_on_main_thread_, sample_rate, CHUNK_LENGTH, false);
+  scheduler_->rechain_from_node_collection (
+    std::move (nodes), sample_rate, CHUNK_LENGTH);
+  scheduler_->start_threads (
+    static_cast<int> (std::max (5u, std::thread::hardware_concurrency ()) - 4));
+  max_latency_ = scheduler_->get_nodes ().get_max_route_playback_latency ();
+  processors_ = std::move (processors);
+}
+
+void
+LookaheadRenderer::clear_graph ()
+{
+  stop ();
+  if (scheduler_ != nullptr)
+    {
+      z_debug ("Releasing lookahead graph");
+      scheduler_.reset ();
+    }
+  processors_.clear ();
+}
+
+bool
+LookaheadRenderer::contains (const graph::IProcessable &processable)
+{
+  return scheduler_ != nullptr
+         && scheduler_->get_nodes ().find_node_for_processable (processable)
+              != nullptr;
+}
+
+void
+LookaheadRenderer::start ()
+{
+  if (scheduler_ == nullptr || running ())
+    return;
+
+  // Wait for the first request from the realtime thread
+  requested_generation_.store (0);
+  claimed_generation_.store (0);
+  for (auto * processor : processors_)
+    {
+      processor->attach (this);
+    }
+  driver_thread_ = std::jthread ([this] (std::stop_token stop_token) {
+    run (std::move (stop_token));
+  });
+}
+
+void
+LookaheadRenderer::stop ()
+{
+  if (!running ())
+    return;
+
+  driver_thread_.request_stop ();
+  driver_thread_.join ();
+  driver_thread_ = {};
+  for (auto * processor : processors_)
+    {
+      processor->attach (nullptr);
+    }
+}
+
+void
+LookaheadRenderer::request_restart (
+  uint64_t             seen_generation,
+  units::sample_t      position,
+  const ITransport    &transport,
+  const dsp::TempoMap &tempo_map) noexcept
+{
+  // Another processor already requested a restart after seen_generation
+  auto expected = seen_generation;
+  if (
+    !claimed_generation_.compare_exchange_strong (
+      expected, seen_generation + 1, std::memory_order_relaxed))
+    return;
+
+  const auto [loop_start, loop_end] = transport.get_loop_range_positions ();
+  requested_position_.store (
+    position.in (units::samples), std::memory_order_relaxed);
+  requested_rolling_.store (
+    transport.get_play_state () == ITransport::PlayState::Rolling,
+    std::memory_order_relaxed);
+  requested_loop_enabled_.store (
+    transport.loop_enabled (), std::memory_order_relaxed);
+  requested_loop_start_.store (
+    loop_start.in (units::samples), std::memory_order_relaxed);
+  requested_loop_end_.store (
+    loop_end.in (units::samples), std::memory_order_relaxed);
+  requested_tempo_map_.store (&tempo_map, std::memory_order_relaxed);
+  requested_generation_.store (seen_generation + 1, std::memory_order_release);
+}
+
+void
+LookaheadRenderer::run (std::stop_token stop_token)
+{
+  DspContextRAII dsp_context_raii;
+  utils::set_thread_name ("DSP lookahead");
+
+  uint64_t                                    generation{};
+  units::sample_t                             position;
+  bool                                        rolling{};
+  bool                                        loop_enabled{};
+  std::pair<units::sample_t, units::sample_t> loop_range;
+  const dsp::TempoMap *                       tempo_map{};
+  units::sample_u64_t                         remaining_preroll;
+
+  while (!stop_token.stop_requested ())
+    {
+      const auto requested =
+        requested_generation_.load (std::memory_order_acquire);
+      if (requested == 0)
+        {
+          std::this_thread::sleep_for (1ms);
+          continue;
+        }
+      if (requested != generation)
+        {
+          generation = requested;
+          position = units::samples (requested_position_.load ());
+          rolling = requested_rolling_.load ();
+          loop_enabled = requested_loop_enabled_.load ();
+          loop_range = std::make_pair (
+            units::samples (requested_loop_start_.load ()),
+            units::samples (requested_loop_end_.load ()));
+          tempo_map = requested_tempo_map_.load ();
+
+          // Fill the latency of the chains again, since processing jumps
+          remaining_preroll = max_latency_;
+          z_debug (
+            "Lookahead rendering restarted at {} (rolling: {})", position,
+            rolling);
+        }
+
+      // Wait for the processors to consume chunks
+      if (
+        !std::ranges::all_of (processors_, &LookaheadProcessor::has_free_chunk))
+        {
+          std::this_thread::sleep_for (1ms);
+          continue;
+        }
+
+      ZoneScopedN ("Lookahead chunk");
+
+      auto nframes = CHUNK_LENGTH;
+      if (remaining_preroll > units::samples (0))
+        {
+          nframes = std::min (
+            nframes, remaining_preroll.as<uint32_t> (units::samples));
+        }
+      // Split at the loop end, so processors can wrap around between chunks
+      else if (rolling && loop_enabled && position < loop_range.second)
+        {
+          nframes = std::min (
+            nframes,
+            (loop_range.second - position).as<uint32_t> (units::samples));
+        }
+
+      Transport::TransportSnapshot transport_snapshot{
+        loop_range,
+        std::make_pair (units::samples (0), units::samples (0)), // punch_range
+        position,
+        units::samples (0), // recording_preroll_frames_remaining
+        units::samples (0), // metronome_countin_frames_remaining
+        rolling ? ITransport::PlayState::Rolling
+                : ITransport::PlayState::Paused,
+        loop_enabled,
+        false, // punch_enabled
+        false  // recording_enabled
+      };
+      scheduler_->run_cycle (
+        graph::ProcessBlockInfo::from_position_and_nframes (
+          position.as<uint64_t> (units::samples), nframes),
+        remaining_preroll, transport_snapshot, *tempo_map);
+
+      for (auto * processor : processors_)
+        {
+          // Frames rendered during the preroll are not aligned yet
+          if (remaining_preroll == units::samples (0))
+            {
+              processor->push_chunk (
+                position, nframes.in<int> (units::samples), rolling,
+                generation);
+            }
+          processor->get_capture_port ().clear_buffer (
+            0, nframes.in<size_t> (units::samples));
+        }
+
+      if (remaining_preroll > units::samples (0))
+        {
+          remaining_preroll = remaining_preroll - nframes;
+        }
+      else if (rolling)
+        {
+          position = playhead_position_after_adding_frames (
+            position, nframes.as<int64_t> (units::samples), loop_enabled,
+            loop_range.first, loop_range.second);
+        }
+    }
+}
+
+} // namespace zrythm::dsp
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "dsp/graph_scheduler.h"
+#include "dsp/lookahead_processor.h"
+
+namespace zrythm::dsp
+{
+
+/**
+ * @brief Processes playback-only parts of the project ahead of the playhead.
+ *
+ * Owns a separate graph (the "lookahead graph") whose terminals are the
+ * capture ports of LookaheadProcessor's in the live graph. A driver thread
+ * processes it in chunks of @ref CHUNK_LENGTH frames on non-realtime worker
+ * threads, following the transport position reported by the processors, and
+ * hands each chunk to the processors. This way heavy chains run in large
+ * blocks without deadlines, while the live graph can run at small device block
+ * lengths.
+ *
+ * The lookahead graph must not share processables with the live graph (or any
+ * other graph).
+ */
+class LookaheadRenderer
+{
+public:
+  /** Number of frames rendered per chunk. */
+  static constexpr auto CHUNK_LENGTH = units::samples (2048u);
+
+  LookaheadRenderer (
+    graph::GraphScheduler::RunOnMainThreadFunc run_on_main_thread);
+  // copy/move don't make sense here
+  LookaheadRenderer (const LookaheadRenderer &) = delete;
+  LookaheadRenderer &operator= (const LookaheadRenderer &) = delete;
+  LookaheadRenderer (LookaheadRenderer &&) = delete;
+  LookaheadRenderer &operator= (LookaheadRenderer &&) = delete;
+  ~LookaheadRenderer ();
+
+  /**
+   * @brief Prepares @p nodes for processing and uses them as the lookahead
+   * graph.
+   *
+   * The previous graph (if any) is stopped and released first.
+   *
+   * @param processors Processors whose capture ports are terminals of @p nodes.
+   */
+  void set_graph (
+    graph::GraphNodeCollection        &&nodes,
+    std::vector<LookaheadProcessor *>   processors,
+    units::sample_rate_t                sample_rate);
+
+  /**
+   * @brief Stops rendering and releases the lookahead graph.
+   */
+  void clear_graph ();
+
+  bool has_graph () const { return scheduler_ != nullptr; }
+
+  /**
+   * @brief Returns whether @p processable is part of the lookahead graph.
+   */
+  bool contains (const graph::IProcessable &processable);
+
+  /**
+   * @brief Starts rendering (if there is a graph).
+   *
+   * Rendering starts once a processor requests it from the realtime thread.
+   */
+  void start ();
+
+  /**
+   * @brief Stops rendering, keeping the graph prepared.
+   *
+   * Processors output silence until start() is called again.
+   */
+  void stop ();
+
+  bool running () const { return driver_thread_.joinable (); }
+
+  /**
+   * @brief Restarts rendering at @p position.
+   *
+   * Called by processors from the realtime thread when the rendered chunks
+   * don't match the transport (or nothing was rendered yet).
+   *
+   * Only the first request made for @p seen_generation is applied, so that
+   * processors requesting a restart in the same cycle don't discard the chunks
+   * rendered for each other's request.
+   *
+   * @param seen_generation The generation() the caller based its decision on.
+   */
+  void request_restart (
+    uint64_t             seen_generation,
+    units::sample_t      position,
+    const ITransport    &transport,
+    const dsp::TempoMap &tempo_map) noexcept [[clang::nonblocking]];
+
+  /**
+   * @brief Returns the generation of the last restart request (0 if none).
+   *
+   * Chunks rendered before the last request have an older generation.
+   */
+  uint64_t generation () const noexcept [[clang::nonblocking]]
+  {
+    return requested_generation_.load (std::memory_order_acquire);
+  }
+
+private:
+  void run (std::stop_token stop_token);
+
+private:
+  graph::GraphScheduler::RunOnMainThreadFunc run_on_main_thread_;
+
+  std::unique_ptr<graph::GraphScheduler> scheduler_;
+  std::vector<LookaheadProcessor *>      processors_;
+
+  /** Max latency of the lookahead graph, prerolled after each restart. */
+  units::sample_u32_t max_latency_;
+
+  // Last restart request (written by the realtime thread before incrementing
+  // requested_generation_)
+  std::atomic<int64_t>               requested_position_;
+  std::atomic<bool>                  requested_rolling_;
+  std::atomic<bool>                  requested_loop_enabled_;
+  std::atomic<int64_t>               requested_loop_start_;
+  std::atomic<int64_t>               requested_loop_end_;
+  std::atomic<const dsp::TempoMap *> requested_tempo_map_;
+  std::atomic<uint64_t>              requested_generation_;
+
+  /**
+   * @brief Generation of the last request claimed by a processor.
+   *
+   * Ahead of @ref requested_generation_ while the claiming processor writes
+   * the request.
+   */
+  std::atomic<uint64_t> claimed_generation_;
+
+  std::jthread driver_thread_;
+};
+
+} // namespace zrythm::dsp
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+#include <cmath>
+#include <ranges>
+#include <vector>
+
+#include "dsp/file_audio_source.h"
+#include "dsp/loudness_analysis_service.h"
+
+#include <QThreadPool>
+#include <QtConcurrentMap>
+#include <QtConcurrentRun>
+
+namespace zrythm::dsp
+{
+
+LoudnessAnalysisService::LoudnessAnalysisService ()
+    : cache_ (std::make_shared<Cache> ())
+{
+}
+
+QFuture<LoudnessMeasurement>
+LoudnessAnalysisService::analyze (const FileAudioSource &source)
+{
+  return analyze (
+    std::make_shared<const juce::AudioSampleBuffer> (source.get_samples ()),
+    source.get_samplerate ());
+}
+
+QFuture<LoudnessMeasurement>
+LoudnessAnalysisService::analyze (
+  const FileAudioSource &source,
+  utils::hash::HashT     content_hash)
+{
+  if (auto cached = cached_measurement (content_hash))
+    return QtFuture::makeReadyValueFuture (*cached);
+
+  return QtConcurrent::run (
+    [cache = cache_,
+     buffer =
+       std::make_shared<const juce::AudioSampleBuffer> (source.get_samples ()),
+     sample_rate = source.get_samplerate (), content_hash] () {
+      const auto measurement = analyze_blocking (*buffer, sample_rate);
+      cache->insert_or_assign (content_hash, measurement);
+      return measurement;
+    });
+}
+
+QFuture<LoudnessMeasurement>
+LoudnessAnalysisService::analyze (
+  std::shared_ptr<const juce::AudioSampleBuffer> buffer,
+  units::sample_rate_t                           sample_rate)
+{
+  return QtConcurrent::run ([cache = cache_, buffer, sample_rate] () {
+    const auto hash = content_hash (*buffer, sample_rate);
+    std::optional<LoudnessMeasurement> cached;
+    cache->cvisit (hash, [&cached] (const auto &entry) {
+      cached = entry.second;
+    });
+    if (cached)
+      return *cached;
+
+    const auto measurement = analyze_blocking (*buffer, sample_rate);
+    cache->insert_or_assign (hash, measurement);
+    return measurement;
+  });
+}
+
+std::optional<LoudnessMeasurement>
+LoudnessAnalysisService::cached_measurement (utils::hash::HashT hash) const
+{
+  std::optional<LoudnessMeasurement> ret;
+  cache_->cvisit (hash, [&ret] (const auto &entry) { ret = entry.second; });
+  return ret;
+}
+
+utils::hash::HashT
+LoudnessAnalysisService::content_hash (
+  const juce::AudioSampleBuffer &buffer,
+  units::sample_rate_t           sample_rate)
+{
+  std::vector<utils::hash::HashT> parts;
+  parts.push_back (
+    static_cast<utils::hash::HashT> (sample_rate.in (units::sample_rate)));
+  for (int ch = 0; ch < buffer.getNumChannels (); ++ch)
+    {
+      parts.push_back (
+        utils::hash::get_custom_hash (
+          buffer.getReadPointer (ch),
+          static_cast<size_t> (buffer.getNumSamples ()) * sizeof (float)));
+    }
+  return utils::hash::get_custom_hash (
+    parts.data (), parts.size () * sizeof (utils::hash::HashT));
+}
+
+LoudnessMeasurement
+LoudnessAnalysisService::analyze_blocking (
+  const juce::AudioSampleBuffer &buffer,
+  units::sample_rate_t           sample_rate)
+{
+  const int num_channels = buffer.getNumChannels ();
+  const int num_frames = buffer.getNumSamples ();
+  const auto sr = sample_rate.in<double> (units::sample_rate);
+
+  // Chunk boundaries must fall on 100 ms blocks so that appending the chunk
+  // measurements yields the same blocks as a single pass
+  const int block_frames = LoudnessAnalyzer::block_frames_for (sample_rate);
+  const int min_chunk_blocks = static_cast<int> (
+    std::ceil (kMinChunkSeconds * sr / static_cast<double> (block_frames)));
+  const int total_blocks = (num_frames + block_frames - 1) / block_frames;
+  const int max_chunks = std::clamp (
+    total_blocks / std::max (1, min_chunk_blocks), 1,
+    std::max (1, QThreadPool::globalInstance ()->maxThreadCount ()));
+  const int chunk_blocks =
+    std::max (1, (total_blocks + max_chunks - 1) / max_chunks);
+  const int chunk_frames = chunk_blocks * block_frames;
+  const int num_chunks =
+    std::max (1, (total_blocks + chunk_blocks - 1) / chunk_blocks);
+  const int prime_frames = static_cast<int> (
+    std::lround (LoudnessAnalyzer::kPrimeSeconds * sr));
+
+  std::vector<LoudnessAnalyzer> chunks;
+  chunks.reserve (static_cast<size_t> (num_chunks));
+  for (int i = 0; i < num_chunks; ++i)
+    chunks.emplace_back (sample_rate, num_channels);
+
+  auto chunk_indices =
+    std::views::iota (0, num_chunks) | std::ranges::to<std::vector> ();
+  QtConcurrent::blockingMap (chunk_indices, [&] (const int &index) {
+    const int start = std::min (index * chunk_frames, num_frames);
+    const int end = std::min (start + chunk_frames, num_frames);
+    auto     &analyzer = chunks[static_cast<size_t> (index)];
+    const int prime_start = std::max (0, start - prime_frames);
+    analyzer.prime (buffer, prime_start, start - prime_start);
+    analyzer.process (buffer, start, end - start);
+  });
+
+  auto &result = chunks.front ();
+  for (auto &chunk : chunks | std::views::drop (1))
+    result.append (std::move (chunk));
+  return result.finish ();
+}
+
+} // namespace zrythm::dsp
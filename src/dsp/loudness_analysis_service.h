@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "dsp/loudness_analyzer.h"
+#include "utils/hash.h"
+#include "utils/units.h"
+
+#include <QFuture>
+
+#include <boost/unordered/concurrent_flat_map.hpp>
+
+namespace zrythm::dsp
+{
+
+class FileAudioSource;
+
+/**
+ * @brief Computes loudness/peak measurements of audio on the global thread
+ * pool and caches them by content hash.
+ *
+ * Each analysis splits the audio into chunks of at least kMinChunkSeconds,
+ * which are measured in parallel and merged in order (see LoudnessAnalyzer).
+ * Identical audio (e.g. a pool file whose measurement is requested again
+ * after an unrelated edit) is only analyzed once.
+ */
+class LoudnessAnalysisService
+{
+public:
+  using Cache = boost::unordered::
+    concurrent_flat_map<utils::hash::HashT, LoudnessMeasurement>;
+
+  static constexpr double kMinChunkSeconds = 10.0;
+
+  LoudnessAnalysisService ();
+
+  /**
+   * @brief Analyzes the current samples of @p source asynchronously.
+   *
+   * Must be called from the thread that owns @p source. The samples are copied,
+   * so the source may be edited or destroyed while the analysis runs.
+   */
+  QFuture<LoudnessMeasurement> analyze (const FileAudioSource &source);
+
+  /**
+   * @brief Analyzes @p source, caching the result under @p content_hash.
+   *
+   * For callers that already know a hash identifying the source's samples
+   * (e.g. the hash of its pool file). The cache is checked before the samples
+   * are copied, so a hit returns a finished future without touching them.
+   */
+  QFuture<LoudnessMeasurement>
+  analyze (const FileAudioSource &source, utils::hash::HashT content_hash);
+
+  /**
+   * @brief Analyzes @p buffer asynchronously.
+   */
+  QFuture<LoudnessMeasurement> analyze (
+    std::shared_ptr<const juce::AudioSampleBuffer> buffer,
+    units::sample_rate_t                           sample_rate);
+
+  /**
+   * @brief Returns the cached measurement for the given content hash, if any.
+   *
+   * @see content_hash().
+   */
+  std::optional<LoudnessMeasurement>
+  cached_measurement (utils::hash::HashT hash) const;
+
+  /**
+   * @brief Hash used as the cache key for @p buffer.
+   */
+  static utils::hash::HashT content_hash (
+    const juce::AudioSampleBuffer &buffer,
+    units::sample_rate_t           sample_rate);
+
+  /**
+   * @brief Measures @p buffer, splitting it across the global thread pool.
+   *
+   * Blocks until done (the calling thread takes part in the work).
+   */
+  static LoudnessMeasurement analyze_blocking (
+    const juce::AudioSampleBuffer &buffer,
+    units::sample_rate_t           sample_rate);
+
+private:
+  /** Shared with running tasks so they can outlive the service. */
+  std::shared_ptr<Cache> cache_;
+};
+
+} // namespace zrythm::dsp
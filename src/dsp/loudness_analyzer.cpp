@@ -0,0 +1,313 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include <numbers>
+#include <numeric>
+#include <span>
+
+#include "dsp/loudness_analyzer.h"
+#include "dsp/true_peak_dsp.h"
+
+namespace zrythm::dsp
+{
+
+namespace
+{
+
+/** Frames handed to TruePeakDsp at once (it accepts at most 8192). */
+constexpr int kTruePeakSliceFrames = 4096;
+
+/** Zeros fed to the oversampler in finish() to flush its delay line. */
+constexpr int kTruePeakFlushFrames = 64;
+
+constexpr double kAbsoluteGateLufs = -70.0;
+constexpr double kIntegratedRelativeGateLu = -10.0;
+constexpr double kRangeRelativeGateLu = -20.0;
+
+constexpr size_t kMomentaryBlocks = 4;
+constexpr size_t kShortTermBlocks = 30;
+
+double
+energy_to_lufs (double energy)
+{
+  return energy > 0.0
+           ? -0.691 + 10.0 * std::log10 (energy)
+           : LoudnessMeasurement::kSilence;
+}
+
+double
+mean (std::span<const double> values)
+{
+  return std::accumulate (values.begin (), values.end (), 0.0)
+         / static_cast<double> (values.size ());
+}
+
+/**
+ * Returns the mean energy of each window of @p window_blocks consecutive
+ * blocks, with a hop of one block.
+ */
+std::vector<double>
+windowed_energies (std::span<const double> block_energies, size_t window_blocks)
+{
+  std::vector<double> ret;
+  if (block_energies.size () < window_blocks)
+    return ret;
+
+  ret.reserve (block_energies.size () - window_blocks + 1);
+  for (size_t i = 0; i + window_blocks <= block_energies.size (); ++i)
+    ret.push_back (mean (block_energies.subspan (i, window_blocks)));
+  return ret;
+}
+
+/**
+ * Returns the energies above the absolute gate and, relative to their mean,
+ * the given relative gate.
+ */
+std::vector<double>
+gate_energies (std::span<const double> energies, double relative_gate_lu)
+{
+  std::vector<double> gated;
+  std::ranges::copy_if (energies, std::back_inserter (gated), [] (double e) {
+    return energy_to_lufs (e) > kAbsoluteGateLufs;
+  });
+  if (gated.empty ())
+    return gated;
+
+  const double relative_threshold =
+    energy_to_lufs (mean (gated)) + relative_gate_lu;
+  std::erase_if (gated, [relative_threshold] (double e) {
+    return energy_to_lufs (e) <= relative_threshold;
+  });
+  return gated;
+}
+
+} // namespace
+
+LoudnessAnalyzer::KWeightingFilter::KWeightingFilter (double sample_rate)
+{
+  // Coefficients derived from the analog prototypes of ITU-R BS.1770 so that
+  // any sample rate is supported (the standard only lists 48 kHz)
+  {
+    constexpr double f0 = 1681.974450955533;
+    constexpr double gain_db = 3.999843853973347;
+    constexpr double q = 0.7071752369554196;
+
+    const double k = std::tan (std::numbers::pi * f0 / sample_rate);
+    const double vh = std::pow (10.0, gain_db / 20.0);
+    const double vb = std::pow (vh, 0.4996667741545416);
+    const double a0 = 1.0 + k / q + k * k;
+
+    pre_filter.b0 = (vh + vb * k / q + k * k) / a0;
+    pre_filter.b1 = 2.0 * (k * k - vh) / a0;
+    pre_filter.b2 = (vh - vb * k / q + k * k) / a0;
+    pre_filter.a1 = 2.0 * (k * k - 1.0) / a0;
+    pre_filter.a2 = (1.0 - k / q + k * k) / a0;
+  }
+  {
+    constexpr double f0 = 38.13547087602444;
+    constexpr double q = 0.5003270373238773;
+
+    const double k = std::tan (std::numbers::pi * f0 / sample_rate);
+    const double a0 = 1.0 + k / q + k * k;
+
+    rlb_filter.b0 = 1.0;
+    rlb_filter.b1 = -2.0;
+    rlb_filter.b2 = 1.0;
+    rlb_filter.a1 = 2.0 * (k * k - 1.0) / a0;
+    rlb_filter.a2 = (1.0 - k / q + k * k) / a0;
+  }
+}
+
+LoudnessAnalyzer::LoudnessAnalyzer (
+  units::sample_rate_t sample_rate,
+  int                  num_channels)
+    : num_channels_ (num_channels),
+      block_frames_ (block_frames_for (sample_rate)),
+      scratch_ (kTruePeakSliceFrames, 0.f)
+{
+  const auto sr = sample_rate.in<double> (units::sample_rate);
+  for (int ch = 0; ch < num_channels_; ++ch)
+    {
+      filters_.emplace_back (sr);
+      auto tp = std::make_unique<TruePeakDsp> ();
+      tp->init (static_cast<float> (sr));
+      true_peaks_.push_back (std::move (tp));
+    }
+
+  // ITU-R BS.1770 channel weights: for a 5.1 layout the LFE is excluded and
+  // the surround channels get +1.5 dB
+  channel_weights_.assign (static_cast<size_t> (num_channels_), 1.0);
+  if (num_channels_ == 6)
+    {
+      channel_weights_[3] = 0.0;
+      channel_weights_[4] = 1.41;
+      channel_weights_[5] = 1.41;
+    }
+}
+
+LoudnessAnalyzer::~LoudnessAnalyzer () = default;
+LoudnessAnalyzer::LoudnessAnalyzer (LoudnessAnalyzer &&) noexcept = default;
+LoudnessAnalyzer &
+LoudnessAnalyzer::operator= (LoudnessAnalyzer &&) noexcept = default;
+
+void
+LoudnessAnalyzer::prime (
+  const juce::AudioSampleBuffer &buffer,
+  int                            start,
+  int                            num_frames)
+{
+  run (buffer, start, num_frames, false);
+}
+
+void
+LoudnessAnalyzer::process (
+  const juce::AudioSampleBuffer &buffer,
+  int                            start,
+  int                            num_frames)
+{
+  run (buffer, start, num_frames, true);
+}
+
+void
+LoudnessAnalyzer::run (
+  const juce::AudioSampleBuffer &buffer,
+  int                            start,
+  int                            num_frames,
+  bool                           measure)
+{
+  if (num_frames <= 0)
+    return;
+
+  const int channels = std::min (num_channels_, buffer.getNumChannels ());
+
+  // True peak and sample peak
+  for (int ch = 0; ch < channels; ++ch)
+    {
+      auto &tp = *true_peaks_[static_cast<size_t> (ch)];
+      for (int offset = 0; offset < num_frames; offset += kTruePeakSliceFrames)
+        {
+          const int len = std::min (kTruePeakSliceFrames, num_frames - offset);
+          std::copy_n (
+            buffer.getReadPointer (ch, start + offset), len, scratch_.data ());
+          tp.process_max (scratch_.data (), len);
+
+          // process_max() does not accumulate across calls, so read each time
+          const float peak = tp.read_f ();
+          if (measure)
+            true_peak_ = std::max (true_peak_, peak);
+        }
+      if (measure)
+        sample_peak_ =
+          std::max (sample_peak_, buffer.getMagnitude (ch, start, num_frames));
+    }
+
+  // K-weighted energy, split at block boundaries
+  int offset = 0;
+  while (offset < num_frames)
+    {
+      const int len =
+        std::min (num_frames - offset, block_frames_ - partial_block_frames_);
+      double block_sum = 0.0;
+      for (int ch = 0; ch < channels; ++ch)
+        {
+          auto        &filter = filters_[static_cast<size_t> (ch)];
+          const auto * in = buffer.getReadPointer (ch, start + offset);
+          double       sum = 0.0;
+          for (int i = 0; i < len; ++i)
+            {
+              const double y = filter.process (static_cast<double> (in[i]));
+              sum += y * y;
+            }
+          block_sum += sum * channel_weights_[static_cast<size_t> (ch)];
+        }
+      offset += len;
+
+      if (!measure)
+        continue;
+
+      partial_block_sum_ += block_sum;
+      partial_block_frames_ += len;
+      if (partial_block_frames_ == block_frames_)
+        {
+          block_energies_.push_back (
+            partial_block_sum_ / static_cast<double> (block_frames_));
+          partial_block_sum_ = 0.0;
+          partial_block_frames_ = 0;
+        }
+    }
+}
+
+void
+LoudnessAnalyzer::append (LoudnessAnalyzer &&next)
+{
+  assert (partial_block_frames_ == 0);
+  assert (next.block_frames_ == block_frames_);
+
+  block_energies_.insert (
+    block_energies_.end (), next.block_energies_.begin (),
+    next.block_energies_.end ());
+  partial_block_sum_ = next.partial_block_sum_;
+  partial_block_frames_ = next.partial_block_frames_;
+  sample_peak_ = std::max (sample_peak_, next.sample_peak_);
+  true_peak_ = std::max (true_peak_, next.true_peak_);
+
+  // Continue with the filter state at the end of the appended audio
+  filters_ = std::move (next.filters_);
+  true_peaks_ = std::move (next.true_peaks_);
+}
+
+LoudnessMeasurement
+LoudnessAnalyzer::finish ()
+{
+  // Flush the samples still in the oversampler's delay line
+  std::ranges::fill (scratch_, 0.f);
+  for (auto &tp : true_peaks_)
+    {
+      tp->process_max (scratch_.data (), kTruePeakFlushFrames);
+      true_peak_ = std::max (true_peak_, tp->read_f ());
+    }
+
+  LoudnessMeasurement ret;
+  ret.sample_peak = sample_peak_;
+  ret.true_peak = std::max (true_peak_, sample_peak_);
+
+  const auto momentary =
+    windowed_energies (block_energies_, kMomentaryBlocks);
+  if (!momentary.empty ())
+    {
+      ret.max_momentary_lufs =
+        energy_to_lufs (*std::ranges::max_element (momentary));
+
+      const auto gated = gate_energies (momentary, kIntegratedRelativeGateLu);
+      if (!gated.empty ())
+        ret.integrated_lufs = energy_to_lufs (mean (gated));
+    }
+
+  const auto short_term =
+    windowed_energies (block_energies_, kShortTermBlocks);
+  if (!short_term.empty ())
+    {
+      ret.max_short_term_lufs =
+        energy_to_lufs (*std::ranges::max_element (short_term));
+
+      auto gated = gate_energies (short_term, kRangeRelativeGateLu);
+      if (gated.size () > 1)
+        {
+          std::ranges::sort (gated);
+          const auto percentile = [&gated] (double p) {
+            const auto index = static_cast<size_t> (
+              std::lround (p * static_cast<double> (gated.size () - 1)));
+            return energy_to_lufs (gated[index]);
+          };
+          ret.loudness_range_lu = percentile (0.95) - percentile (0.10);
+        }
+    }
+
+  return ret;
+}
+
+} // namespace zrythm::dsp
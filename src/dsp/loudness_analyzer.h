@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "utils/units.h"
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+namespace zrythm::dsp
+{
+
+class TruePeakDsp;
+
+/**
+ * @brief EBU R128 loudness and peak figures for a piece of audio.
+ *
+ * Loudness values of silent (or fully gated) material are -inf.
+ */
+struct LoudnessMeasurement
+{
+  static constexpr double kSilence = -std::numeric_limits<double>::infinity ();
+
+  /** Gated integrated loudness (EBU R128), in LUFS. */
+  double integrated_lufs = kSilence;
+
+  /** Loudness range (EBU Tech 3342), in LU. */
+  double loudness_range_lu = 0.0;
+
+  /** Highest momentary (400 ms) loudness, in LUFS. */
+  double max_momentary_lufs = kSilence;
+
+  /** Highest short-term (3 s) loudness, in LUFS. */
+  double max_short_term_lufs = kSilence;
+
+  /** Highest absolute sample value over all channels (linear). */
+  float sample_peak = 0.f;
+
+  /** Highest 4x-oversampled peak over all channels (linear). */
+  float true_peak = 0.f;
+
+  double true_peak_dbtp () const
+  {
+    return 20.0 * std::log10 (static_cast<double> (true_peak));
+  }
+};
+
+/**
+ * @brief Incremental EBU R128 loudness and true-peak analyzer.
+ *
+ * Audio is K-weighted and its energy is accumulated in 100 ms blocks, from
+ * which momentary (4 blocks), short-term (30 blocks), gated integrated
+ * loudness and loudness range are derived in finish(). True peak uses
+ * TruePeakDsp on each channel.
+ *
+ * Because only per-block energies are kept, a long file can be split into
+ * chunks that are analyzed by separate instances and joined with append(). To
+ * get the same filter state as a single pass, prime each chunk's analyzer with
+ * audio preceding the chunk (see kPrimeSeconds).
+ */
+class LoudnessAnalyzer
+{
+public:
+  /** Preceding audio needed for the filters to settle at a chunk start. */
+  static constexpr double kPrimeSeconds = 0.5;
+
+  LoudnessAnalyzer (units::sample_rate_t sample_rate, int num_channels);
+  ~LoudnessAnalyzer ();
+  LoudnessAnalyzer (LoudnessAnalyzer &&) noexcept;
+  LoudnessAnalyzer &operator= (LoudnessAnalyzer &&) noexcept;
+  LoudnessAnalyzer (const LoudnessAnalyzer &) = delete;
+  LoudnessAnalyzer &operator= (const LoudnessAnalyzer &) = delete;
+
+  /**
+   * @brief Number of frames in one 100 ms energy block.
+   *
+   * Chunks passed to append() must be a multiple of this (except the last
+   * one).
+   */
+  int block_frames () const { return block_frames_; }
+
+  static int block_frames_for (units::sample_rate_t sample_rate)
+  {
+    return std::max (
+      1, static_cast<int> (
+           std::lround (sample_rate.in<double> (units::sample_rate) * 0.1)));
+  }
+
+  /**
+   * @brief Runs audio through the filters without measuring it.
+   *
+   * Used to settle the filter state before the first process() call of a
+   * chunk.
+   */
+  void prime (const juce::AudioSampleBuffer &buffer, int start, int num_frames);
+
+  /**
+   * @brief Measures the given frames.
+   *
+   * Channels beyond the analyzer's channel count are ignored, missing ones are
+   * treated as silent.
+   */
+  void
+  process (const juce::AudioSampleBuffer &buffer, int start, int num_frames);
+
+  /**
+   * @brief Appends the measurements of an analyzer that processed the audio
+   * directly following this one's.
+   *
+   * @pre This analyzer has processed a whole number of blocks.
+   */
+  void append (LoudnessAnalyzer &&next);
+
+  /**
+   * @brief Computes the final figures.
+   *
+   * Flushes the true-peak oversampler, so no more audio can be processed
+   * afterwards. A trailing partial block only contributes to the peaks.
+   */
+  LoudnessMeasurement finish ();
+
+private:
+  /** Two cascaded biquads (pre-filter + RLB high-pass). */
+  struct KWeightingFilter
+  {
+    struct Biquad
+    {
+      double b0{}, b1{}, b2{}, a1{}, a2{};
+      double z1{}, z2{};
+
+      double process (double in)
+      {
+        const double out = b0 * in + z1;
+        z1 = b1 * in - a1 * out + z2;
+        z2 = b2 * in - a2 * out;
+        return out;
+      }
+    };
+
+    Biquad pre_filter;
+    Biquad rlb_filter;
+
+    explicit KWeightingFilter (double sample_rate);
+    double process (double in)
+    {
+      return rlb_filter.process (pre_filter.process (in));
+    }
+  };
+
+  void run (
+    const juce::AudioSampleBuffer &buffer,
+    int                            start,
+    int                            num_frames,
+    bool                           measure);
+
+  int num_channels_;
+  int block_frames_;
+
+  std::vector<KWeightingFilter>             filters_;
+  std::vector<double>                       channel_weights_;
+  std::vector<std::unique_ptr<TruePeakDsp>> true_peaks_;
+  std::vector<float>                        scratch_;
+
+  /** Weighted mean-square energy of each complete 100 ms block. */
+  std::vector<double> block_energies_;
+
+  /** Weighted sum of squares of the block in progress. */
+  double partial_block_sum_ = 0.0;
+  int    partial_block_frames_ = 0;
+
+  float sample_peak_ = 0.f;
+  float true_peak_ = 0.f;
+};
+
+} // namespace zrythm::dsp
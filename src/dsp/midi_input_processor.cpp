@@ -16,6 +16,7 @@ struct MidiInputProcessor::Impl
   dsp::MidiDeviceBuffer *                buffer_rt = nullptr;
   juce::MidiBuffer                       drain_buffer;
   dsp::MidiPort *                        output_port = nullptr;
+  dsp::MidiEventBuffer                   received_events;
   units::sample_rate_t sample_rate{ units::sample_rate (48000) };
   std::optional<units::precise_second_t> block_start_time;
 
@@ -53,6 +54,7 @@ MidiInputProcessor::custom_prepare_for_processing (
   impl_->sample_rate = sample_rate;
   impl_->drain_buffer.ensureSize (dsp::MidiEventBuffer::kMaxReserveBytes);
   impl_->output_port->buffer_.reserve (dsp::MidiEventBuffer::kMaxReserveBytes);
+  impl_->received_events.reserve (dsp::MidiEventBuffer::kMaxReserveBytes);
 }
 
 void
@@ -75,6 +77,14 @@ MidiInputProcessor::custom_process_block (
   if (impl_->drain_buffer.isEmpty ())
     return;
 
+  // Prevent unbounded growth
+  const auto has_room_for =
+    [] (const dsp::MidiEventBuffer &buf, std::span<const midi_byte_t> data) {
+      return buf.size_in_bytes () + dsp::MidiEventBuffer::kHeaderSize
+               + data.size ()
+             <= buf.capacity ();
+    };
+
   auto &port = *impl_->output_port;
   for (const auto metadata : impl_->drain_buffer)
     {
@@ -85,17 +95,27 @@ MidiInputProcessor::custom_process_block (
       const auto midi_time =
         units::samples (static_cast<uint32_t> (metadata.samplePosition));
 
-      // Prevent unbounded growth
-      const auto needed =
-        port.buffer_.size_in_bytes () + dsp::MidiEventBuffer::kHeaderSize
-        + raw_data.size ();
-      if (needed > port.buffer_.capacity ())
+      if (!has_room_for (port.buffer_, raw_data))
         break;
 
       port.buffer_.push_back (midi_time, raw_data);
+      if (has_room_for (impl_->received_events, raw_data))
+        impl_->received_events.push_back (midi_time, raw_data);
     }
 }
 
+const dsp::MidiEventBuffer &
+MidiInputProcessor::received_events () const noexcept
+{
+  return impl_->received_events;
+}
+
+void
+MidiInputProcessor::clear_received_events () noexcept
+{
+  impl_->received_events.clear ();
+}
+
 dsp::MidiPort &
 MidiInputProcessor::get_output_port () const noexcept
 {
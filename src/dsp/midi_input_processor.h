@@ -14,6 +14,7 @@ namespace zrythm::dsp
 {
 
 class MidiDeviceBuffer;
+class MidiEventBuffer;
 
 /**
  * @brief Bridges hardware MIDI input into the DSP graph as a MidiPort output.
@@ -47,6 +48,17 @@ public:
 
   void set_block_start_time (units::precise_second_t time);
 
+  /**
+   * @brief Events received since the last clear_received_events() call.
+   *
+   * Unlike the output port, which only holds the events of the current
+   * (possibly split) block, this accumulates the events of all blocks of an
+   * engine cycle.
+   */
+  const dsp::MidiEventBuffer &received_events () const noexcept
+    [[clang::nonblocking]];
+  void clear_received_events () noexcept [[clang::nonblocking]];
+
 private:
   struct Impl;
   std::unique_ptr<Impl> impl_;
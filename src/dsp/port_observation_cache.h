@@ -3,28 +3,115 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "dsp/midi_event.h"
+#include "utils/enum_utils.h"
 
 namespace zrythm::dsp
 {
 
+/**
+ * @brief What is observed on an audio or CV port.
+ *
+ * MIDI ports are always observed as raw events.
+ */
+enum class ObservationKinds : uint8_t
+{
+  /** Raw samples (e.g., for waveform and spectrum views). */
+  Samples = 1 << 0,
+
+  /** Digital peak and RMS (see PeakDsp). */
+  DigitalPeak = 1 << 1,
+
+  /** True peak (see TruePeakDsp). */
+  TruePeak = 1 << 2,
+
+  /** K-meter (see KMeterDsp). */
+  KMeter = 1 << 3,
+};
+
+/**
+ * @brief Meter readings of a single channel for one processed block.
+ *
+ * Computed on the realtime thread for the requested ObservationKinds, so
+ * meters don't need the raw samples. Fields of kinds that were not requested
+ * are left at 0.
+ */
+struct MeterRecord
+{
+  /** Number of frames the record covers. */
+  uint32_t num_frames{};
+
+  /** Maximum absolute sample value in the block (PeakDsp). */
+  float digital_value{};
+
+  /** Peak with hold and falloff (PeakDsp). */
+  float digital_peak{};
+
+  /** RMS of the block. */
+  float rms{};
+
+  /** True peak level (TruePeakDsp). */
+  float true_peak{};
+
+  /** RMS with K-meter ballistics (KMeterDsp). */
+  float k_rms{};
+
+  /** Peak with hold and falloff (KMeterDsp). */
+  float k_peak{};
+};
+
+/**
+ * @brief Data drained from the observer of a port in one drain pass.
+ *
+ * Immutable once handed to caches, and shared by the caches of all requesters
+ * of the port.
+ */
+struct ObservationChunk
+{
+  std::vector<std::vector<float>>       audio;
+  std::vector<RealtimeMidiEvent>        midi;
+  std::vector<std::vector<MeterRecord>> meters;
+
+  bool empty () const
+  {
+    const auto is_empty = [] (const auto &channel) { return channel.empty (); };
+    return std::ranges::all_of (audio, is_empty) && midi.empty ()
+           && std::ranges::all_of (meters, is_empty);
+  }
+};
+
 /**
  * @brief Per-requester cache for drained observation data.
  *
  * Filled by the manager's drain timer (consuming reads from observer ring
  * buffers). Read by UI components at their own pace — no synchronization
  * needed since each requester has its own cache.
+ *
+ * The drain timer only queues shared chunks in @ref pending_chunks. They are
+ * appended to the vectors below when the cache is accessed through
+ * PortObservationManager::cache(), so caches that are not read don't cost any
+ * copies.
  */
 struct PortObservationCache
 {
   static constexpr size_t kMaxAudioSamples = 100000;
   static constexpr size_t kMaxMidiEvents = 4096;
+  static constexpr size_t kMaxMeterRecords = 1024;
+
+  /** Maximum number of queued chunks (about 1 second of drain passes). */
+  static constexpr size_t kMaxPendingChunks = 64;
+
+  std::vector<std::vector<float>>       audio;
+  std::vector<RealtimeMidiEvent>        midi;
+  std::vector<std::vector<MeterRecord>> meters;
 
-  std::vector<std::vector<float>> audio;
-  std::vector<RealtimeMidiEvent>  midi;
+  /** Chunks drained since the cache was last accessed, oldest first. */
+  std::vector<std::shared_ptr<const ObservationChunk>> pending_chunks;
 
   void clear_audio ()
   {
@@ -32,11 +119,20 @@ struct PortObservationCache
       c.clear ();
   }
   void clear_midi () { midi.clear (); }
+  void clear_meters ()
+  {
+    for (auto &c : meters)
+      c.clear ();
+  }
   void clear ()
   {
     clear_audio ();
     clear_midi ();
+    clear_meters ();
+    pending_chunks.clear ();
   }
 };
 
 }
+
+ENUM_ENABLE_BITSET (zrythm::dsp::ObservationKinds);
@@ -3,6 +3,8 @@
 
 #include <algorithm>
 #include <concepts>
+#include <iterator>
+#include <memory>
 #include <ranges>
 
 #include "dsp/port.h"
@@ -33,6 +35,44 @@ append_capped (std::vector<T> &buf, R &&incoming, size_t cap)
       buf.erase (new_end, buf.end ());
     }
 }
+
+// Consuming read of everything available in @p ring into @p out, reusing the
+// capacity of @p out.
+template <typename T>
+void
+read_ring (RingBuffer<T> &ring, std::vector<T> &out)
+{
+  out.resize (ring.read_space ());
+  if (!ring.read_multiple (out.data (), out.size ()))
+    out.clear ();
+}
+
+// Append the chunks queued in @p cache to its vectors, trimming the oldest
+// entries when a cap is exceeded.
+void
+apply_pending_chunks (PortObservationCache &cache)
+{
+  for (const auto &chunk : cache.pending_chunks)
+    {
+      if (cache.audio.size () < chunk->audio.size ())
+        cache.audio.resize (chunk->audio.size ());
+      for (size_t ch = 0; ch < chunk->audio.size (); ++ch)
+        append_capped (
+          cache.audio[ch], chunk->audio[ch],
+          PortObservationCache::kMaxAudioSamples);
+
+      append_capped (
+        cache.midi, chunk->midi, PortObservationCache::kMaxMidiEvents);
+
+      if (cache.meters.size () < chunk->meters.size ())
+        cache.meters.resize (chunk->meters.size ());
+      for (size_t ch = 0; ch < chunk->meters.size (); ++ch)
+        append_capped (
+          cache.meters[ch], chunk->meters[ch],
+          PortObservationCache::kMaxMeterRecords);
+    }
+  cache.pending_chunks.clear ();
+}
 } // namespace
 
 struct PortObservationManager::Impl
@@ -46,13 +86,52 @@ struct PortObservationManager::Impl
   struct Registration
   {
     PortUuid                              port_uuid;
+    ObservationKinds                      kinds;
     std::unique_ptr<PortObservationCache> cache;
   };
 
-  std::unordered_map<RegistrationId, Registration>            registrations_;
-  std::unordered_map<PortUuid, int>                           ref_counts_;
-  std::unordered_map<PortUuid, std::unique_ptr<PortObserver>> observers_;
-  std::vector<PortObserver *>                                 observer_ptrs_;
+  /**
+   * @brief An observed port along with its drain state.
+   */
+  struct ObservedPort
+  {
+    std::unique_ptr<PortObserver> observer;
+
+    /** Caches of all requesters of the port. */
+    std::vector<PortObservationCache *> caches;
+
+    /**
+     * @brief Chunks drained from the observer.
+     *
+     * A chunk is reused (along with the capacity of its vectors) once no
+     * cache references it anymore, so draining doesn't allocate in steady
+     * state.
+     */
+    std::vector<std::shared_ptr<ObservationChunk>> chunk_pool;
+
+    /**
+     * @brief Returns a chunk not referenced by any cache.
+     */
+    ObservationChunk &acquire_chunk ()
+    {
+      auto it = std::ranges::find_if (chunk_pool, [] (const auto &chunk) {
+        return chunk.use_count () == 1;
+      });
+      if (it == chunk_pool.end ())
+        {
+          chunk_pool.push_back (std::make_shared<ObservationChunk> ());
+          it = std::prev (chunk_pool.end ());
+        }
+      // Keep the chunk at the back so the caller can share it
+      std::iter_swap (it, std::prev (chunk_pool.end ()));
+      return *chunk_pool.back ();
+    }
+  };
+
+  std::unordered_map<RegistrationId, Registration> registrations_;
+  std::unordered_map<PortUuid, int>                ref_counts_;
+  std::unordered_map<PortUuid, ObservedPort>       observed_ports_;
+  std::vector<PortObserver *>                      observer_ptrs_;
 
   utils::QObjectUniquePtr<QTimer> drain_timer_;
 };
@@ -73,14 +152,18 @@ PortObservationManager::PortObservationManager (
 PortObservationManager::~PortObservationManager () = default;
 
 PortObservationManager::RegistrationId
-PortObservationManager::register_request (const Port &port)
+PortObservationManager::register_request (
+  const Port      &port,
+  ObservationKinds kinds)
 {
   const auto port_uuid = port.get_uuid ();
   const int  id = impl_->next_id_++;
 
+  auto cache = std::make_unique<PortObservationCache> ();
+  cache->pending_chunks.reserve (PortObservationCache::kMaxPendingChunks);
+  impl_->observed_ports_[port_uuid].caches.push_back (cache.get ());
   impl_->registrations_.emplace (
-    id,
-    Impl::Registration{ port_uuid, std::make_unique<PortObservationCache> () });
+    id, Impl::Registration{ port_uuid, kinds, std::move (cache) });
 
   auto      &ref_count = impl_->ref_counts_[port_uuid];
   const bool was_empty = ref_count == 0;
@@ -88,11 +171,22 @@ PortObservationManager::register_request (const Port &port)
 
   if (was_empty)
     {
-      auto observer = std::make_unique<PortObserver> (impl_->registry_, port);
+      auto observer =
+        std::make_unique<PortObserver> (impl_->registry_, port, kinds);
       impl_->observer_ptrs_.push_back (observer.get ());
-      impl_->observers_.emplace (port_uuid, std::move (observer));
+      impl_->observed_ports_.at (port_uuid).observer = std::move (observer);
       Q_EMIT observationChanged ();
     }
+  else if (auto * observer = find_observer_by_uuid (port_uuid))
+    {
+      // Re-prepare the observer if it must capture more
+      const auto new_kinds = requested_kinds (port_uuid);
+      if (new_kinds != observer->kinds ())
+        {
+          observer->set_kinds (new_kinds);
+          Q_EMIT observationChanged ();
+        }
+    }
 
   return id;
 }
@@ -105,6 +199,12 @@ PortObservationManager::unregister_request (RegistrationId id)
     return;
 
   auto port_uuid = reg_it->second.port_uuid;
+  if (
+    auto port_it = impl_->observed_ports_.find (port_uuid);
+    port_it != impl_->observed_ports_.end ())
+    {
+      std::erase (port_it->second.caches, reg_it->second.cache.get ());
+    }
   impl_->registrations_.erase (reg_it);
 
   auto it = impl_->ref_counts_.find (port_uuid);
@@ -117,16 +217,38 @@ PortObservationManager::unregister_request (RegistrationId id)
       impl_->ref_counts_.erase (it);
 
       std::unique_ptr<PortObserver> doomed;
-      auto                          obs_it = impl_->observers_.find (port_uuid);
-      if (obs_it != impl_->observers_.end ())
+      auto port_it = impl_->observed_ports_.find (port_uuid);
+      if (port_it != impl_->observed_ports_.end ())
         {
-          doomed = std::move (obs_it->second);
-          impl_->observers_.erase (obs_it);
+          doomed = std::move (port_it->second.observer);
+          impl_->observed_ports_.erase (port_it);
           std::erase (impl_->observer_ptrs_, doomed.get ());
         }
 
       Q_EMIT observationChanged ();
     }
+  else if (auto * observer = find_observer_by_uuid (port_uuid))
+    {
+      // Stop capturing what is no longer requested
+      const auto new_kinds = requested_kinds (port_uuid);
+      if (new_kinds != observer->kinds ())
+        {
+          observer->set_kinds (new_kinds);
+          Q_EMIT observationChanged ();
+        }
+    }
+}
+
+ObservationKinds
+PortObservationManager::requested_kinds (const PortUuid &port_uuid) const
+{
+  ObservationKinds kinds{};
+  for (const auto &reg : impl_->registrations_ | std::views::values)
+    {
+      if (reg.port_uuid == port_uuid)
+        kinds |= reg.kinds;
+    }
+  return kinds;
 }
 
 PortObservationCache &
@@ -135,14 +257,18 @@ PortObservationManager::cache (RegistrationId id)
   auto it = impl_->registrations_.find (id);
   if (it == impl_->registrations_.end ())
     throw std::out_of_range ("PortObservationManager: invalid registration ID");
-  return *it->second.cache;
+
+  auto &cache = *it->second.cache;
+  apply_pending_chunks (cache);
+  return cache;
 }
 
 PortObserver *
 PortObservationManager::find_observer_by_uuid (const PortUuid &port_uuid) const
 {
-  auto it = impl_->observers_.find (port_uuid);
-  return it != impl_->observers_.end () ? it->second.get () : nullptr;
+  auto it = impl_->observed_ports_.find (port_uuid);
+  return it != impl_->observed_ports_.end () ? it->second.observer.get ()
+                                             : nullptr;
 }
 
 PortObserver *
@@ -160,71 +286,45 @@ PortObservationManager::observers () const
 void
 PortObservationManager::drain_all ()
 {
-  // Read once per port (consuming read), then fan out to all caches
-  struct TempData
-  {
-    std::vector<std::vector<float>> audio;
-    std::vector<RealtimeMidiEvent>  midi;
-  };
-
-  std::unordered_map<PortUuid, TempData> port_data;
-
-  // Pass 1: consuming read from ring buffers into temp storage
-  for (auto &[id, reg] : impl_->registrations_)
+  // Read each port once (consuming read) into a chunk shared by all caches of
+  // the port
+  for (auto &port : impl_->observed_ports_ | std::views::values)
     {
-      if (port_data.contains (reg.port_uuid))
+      auto * observer = port.observer.get ();
+      if (observer == nullptr || port.caches.empty ())
         continue;
 
-      auto * observer = find_observer_by_uuid (reg.port_uuid);
-      if (observer == nullptr)
-        continue;
+      auto &chunk = port.acquire_chunk ();
 
-      auto &data = port_data[reg.port_uuid];
+      const auto num_channels =
+        static_cast<size_t> (std::max (observer->num_channels (), 0));
+      chunk.audio.resize (observer->has_audio_rings () ? num_channels : 0);
+      for (const auto ch : std::views::iota (0uz, chunk.audio.size ()))
+        read_ring (
+          observer->audio_ring (static_cast<int> (ch)), chunk.audio[ch]);
 
-      if (observer->has_audio_rings ())
-        {
-          const auto num_channels = observer->num_channels ();
-          data.audio.resize (num_channels);
-          for (int ch = 0; ch < num_channels; ++ch)
-            {
-              auto &ring = observer->audio_ring (ch);
-              auto  avail = ring.read_space ();
-              data.audio[ch].resize (avail);
-              if (!ring.read_multiple (data.audio[ch].data (), avail))
-                data.audio[ch].clear ();
-            }
-        }
+      chunk.meters.resize (observer->has_meter_rings () ? num_channels : 0);
+      for (const auto ch : std::views::iota (0uz, chunk.meters.size ()))
+        read_ring (
+          observer->meter_ring (static_cast<int> (ch)), chunk.meters[ch]);
 
       if (observer->has_midi_ring ())
-        {
-          auto &ring = observer->midi_ring ();
-          auto  avail = ring.read_space ();
-          data.midi.resize (avail);
-          if (!ring.read_multiple (data.midi.data (), avail))
-            data.midi.clear ();
-        }
-    }
+        read_ring (observer->midi_ring (), chunk.midi);
+      else
+        chunk.midi.clear ();
 
-  // Pass 2: append temp data into all registration caches, trimming the
-  // oldest entries when a cap is exceeded.
-  for (auto &[id, reg] : impl_->registrations_)
-    {
-      auto it = port_data.find (reg.port_uuid);
-      if (it == port_data.end ())
+      if (chunk.empty ())
         continue;
 
-      auto &data = it->second;
-      auto &cache = *reg.cache;
-
-      if (cache.audio.size () < data.audio.size ())
-        cache.audio.resize (data.audio.size ());
-      for (size_t ch = 0; ch < data.audio.size (); ++ch)
-        append_capped (
-          cache.audio[ch], data.audio[ch],
-          PortObservationCache::kMaxAudioSamples);
-
-      append_capped (
-        cache.midi, data.midi, PortObservationCache::kMaxMidiEvents);
+      for (auto * cache : port.caches)
+        {
+          // Bound the memory held by caches that are not being read
+          if (
+            cache->pending_chunks.size ()
+            >= PortObservationCache::kMaxPendingChunks)
+            apply_pending_chunks (*cache);
+          cache->pending_chunks.push_back (port.chunk_pool.back ());
+        }
     }
 }
 
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "dsp/port.h"
+#include "dsp/port_observation_cache.h"
 
 #include <QObject>
 #include <QtQmlIntegration/qqmlintegration.h>
@@ -17,7 +18,6 @@ namespace zrythm::dsp
 {
 
 class PortObserver;
-struct PortObservationCache;
 
 /**
  * @brief Manages port observer lifecycle and runs a drain timer.
@@ -28,7 +28,14 @@ struct PortObservationCache;
  * graph rebuilds.
  *
  * A 60fps drain timer consuming-reads from observer ring buffers into
- * per-requester caches on the UI thread.
+ * per-requester caches on the UI thread. Each port is read once per drain
+ * into a pooled, immutable chunk that is shared by the caches of all
+ * requesters of the port, so draining doesn't allocate in steady state and
+ * its cost doesn't grow with the number of requesters.
+ *
+ * Each request specifies what to observe (ObservationKinds). The observer of a
+ * port captures the union of the kinds requested for it, so e.g. meters that
+ * only need per-block meter records don't cause raw samples to be copied.
  *
  * @par Thread safety
  * All register/unregister calls and drain_all() run on the Qt event loop
@@ -57,10 +64,13 @@ public:
   Q_DISABLE_COPY_MOVE (PortObservationManager)
 
   // Called by ObservationToken on construction/destruction
-  RegistrationId register_request (const Port &port);
+  RegistrationId register_request (
+    const Port      &port,
+    ObservationKinds kinds = ObservationKinds::Samples);
   void           unregister_request (RegistrationId id);
 
-  // Cache access for registered requesters
+  // Cache access for registered requesters. Appends the chunks drained since
+  // the last access to the cache.
   PortObservationCache &cache (RegistrationId id);
 
   // Called by graph builder during build
@@ -78,6 +88,11 @@ Q_SIGNALS:
 private:
   PortObserver * find_observer_by_uuid (const PortUuid &port_uuid) const;
 
+  /**
+   * @brief Returns the union of the kinds requested for the given port.
+   */
+  ObservationKinds requested_kinds (const PortUuid &port_uuid) const;
+
   struct Impl;
   std::unique_ptr<Impl> impl_;
 };
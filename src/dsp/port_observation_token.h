@@ -14,9 +14,12 @@ namespace zrythm::dsp
 class ObservationToken
 {
 public:
-  ObservationToken (PortObservationManager &manager, const Port &port)
+  ObservationToken (
+    PortObservationManager &manager,
+    const Port             &port,
+    ObservationKinds        kinds = ObservationKinds::Samples)
       : manager_ (&manager), port_uuid_ (port.get_uuid ()),
-        id_ (manager.register_request (port))
+        id_ (manager.register_request (port, kinds))
   {
   }
 
@@ -6,6 +6,7 @@
 #include "dsp/midi_port.h"
 #include "dsp/port.h"
 #include "dsp/port_observer.h"
+#include "utils/math_utils.h"
 #include "utils/traits.h"
 
 namespace zrythm::dsp
@@ -13,11 +14,12 @@ namespace zrythm::dsp
 
 PortObserver::PortObserver (
   utils::IObjectRegistry &registry,
-  const Port             &observed_port)
+  const Port             &observed_port,
+  ObservationKinds        kinds)
     : ProcessorBase (
         registry,
         observed_port.get_full_designation () + u8"/Observer"),
-      observed_port_uuid_ (observed_port.get_uuid ())
+      observed_port_uuid_ (observed_port.get_uuid ()), kinds_ (kinds)
 {
   if (const auto * audio_port = qobject_cast<const AudioPort *> (&observed_port))
     typed_port_ = audio_port;
@@ -57,10 +59,46 @@ PortObserver::custom_prepare_for_processing (
               return 1;
           }();
           audio_rings_.clear ();
-          audio_rings_.reserve (num_channels);
-          for (int ch = 0; ch < num_channels; ++ch)
-            audio_rings_.push_back (
-              std::make_unique<RingBuffer<float>> (ring_size));
+          meters_.clear ();
+          if (ENUM_BITSET_TEST (kinds_, ObservationKinds::Samples))
+            {
+              audio_rings_.reserve (num_channels);
+              for (int ch = 0; ch < num_channels; ++ch)
+                audio_rings_.push_back (
+                  std::make_unique<RingBuffer<float>> (ring_size));
+            }
+
+          const auto rate = sample_rate.in<float> (units::sample_rate);
+          const bool digital_peak =
+            ENUM_BITSET_TEST (kinds_, ObservationKinds::DigitalPeak);
+          const bool true_peak =
+            ENUM_BITSET_TEST (kinds_, ObservationKinds::TruePeak);
+          const bool kmeter =
+            ENUM_BITSET_TEST (kinds_, ObservationKinds::KMeter);
+          if (digital_peak || true_peak || kmeter)
+            {
+              meters_.reserve (num_channels);
+              for (int ch = 0; ch < num_channels; ++ch)
+                {
+                  auto meters = std::make_unique<ChannelMeters> ();
+                  if (digital_peak)
+                    {
+                      meters->peak = std::make_unique<PeakDsp> ();
+                      meters->peak->init (rate);
+                    }
+                  if (true_peak)
+                    {
+                      meters->true_peak = std::make_unique<TruePeakDsp> ();
+                      meters->true_peak->init (rate);
+                    }
+                  if (kmeter)
+                    {
+                      meters->kmeter = std::make_unique<KMeterDsp> ();
+                      meters->kmeter->init (rate);
+                    }
+                  meters_.push_back (std::move (meters));
+                }
+            }
         }
       else if constexpr (std::is_same_v<T, MidiPort>)
         {
@@ -75,6 +113,7 @@ void
 PortObserver::custom_release_resources ()
 {
   audio_rings_.clear ();
+  meters_.clear ();
   midi_ring_.reset ();
 }
 
@@ -122,6 +161,13 @@ PortObserver::process_audio (
             data, static_cast<size_t> (len));
         }
     }
+
+  const int num_meter_ch =
+    std::min (buf->getNumChannels (), static_cast<int> (meters_.size ()));
+  for (int ch = 0; ch < num_meter_ch; ++ch)
+    {
+      process_meters (ch, buf->getReadPointer (ch, start), len);
+    }
 }
 
 void
@@ -139,6 +185,37 @@ PortObserver::process_cv (
       audio_rings_[0]->force_write_multiple (
         port.buf_.data () + start, static_cast<size_t> (len));
     }
+  if (!meters_.empty ())
+    {
+      process_meters (0, port.buf_.data () + start, len);
+    }
+}
+
+void
+PortObserver::process_meters (int ch, const float * data, int len) noexcept
+{
+  auto       &meters = *meters_[ch];
+  MeterRecord record{ .num_frames = static_cast<uint32_t> (len) };
+  if (meters.peak)
+    {
+      meters.peak->process (data, len);
+      std::tie (record.digital_value, record.digital_peak) =
+        meters.peak->read ();
+      record.rms =
+        utils::math::calculate_rms_amp (data, static_cast<uint32_t> (len));
+    }
+  if (meters.true_peak)
+    {
+      // Only reads from the buffer
+      meters.true_peak->process (const_cast<float *> (data), len);
+      record.true_peak = meters.true_peak->read_f ();
+    }
+  if (meters.kmeter)
+    {
+      meters.kmeter->process (data, len);
+      std::tie (record.k_rms, record.k_peak) = meters.kmeter->read ();
+    }
+  meters.ring.force_write (record);
 }
 
 void
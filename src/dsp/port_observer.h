@@ -3,9 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <variant>
 
+#include "dsp/kmeter_dsp.h"
+#include "dsp/peak_dsp.h"
+#include "dsp/port_observation_cache.h"
 #include "dsp/processor_base.h"
+#include "dsp/true_peak_dsp.h"
 #include "utils/ring_buffer.h"
 
 #include <QObject>
@@ -24,11 +29,15 @@ using ObservedPortPtr =
   std::variant<const AudioPort *, const CVPort *, const MidiPort *>;
 
 /**
- * @brief Pure data-capture graph node that observes a port's output.
+ * @brief Data-capture graph node that observes a port's output.
  *
- * Copies raw audio samples to per-channel RingBuffer<float> and raw MIDI
- * events to RingBuffer<RealtimeMidiEvent>. No DSP, no metering — all signal
- * processing stays on the UI side.
+ * For audio and CV ports, depending on the requested ObservationKinds:
+ * - copies raw samples to per-channel RingBuffer<float> (Samples), and/or
+ * - runs the requested meter DSP per block and writes one MeterRecord per
+ *   block to per-channel RingBuffer<MeterRecord> (meter kinds), so that
+ *   meters don't need the raw samples.
+ *
+ * Raw MIDI events are copied to RingBuffer<RealtimeMidiEvent>.
  *
  * RT thread writes to ring buffers via custom_process_block().
  * UI-side drain timer consuming-reads into per-requester token caches.
@@ -42,13 +51,30 @@ class PortObserver : public QObject, public ProcessorBase
 public:
   static constexpr size_t kAudioRingSeconds = 5;
   static constexpr size_t kMidiRingSize = 8192;
+  static constexpr size_t kMeterRingSize = 1024;
 
-  PortObserver (utils::IObjectRegistry &registry, const Port &observed_port);
+  PortObserver (
+    utils::IObjectRegistry &registry,
+    const Port             &observed_port,
+    ObservationKinds        kinds = ObservationKinds::Samples);
 
   PortUuid    observed_port_uuid () const { return observed_port_uuid_; }
   const Port &observed_port () const;
 
-  int num_channels () const { return static_cast<int> (audio_rings_.size ()); }
+  int num_channels () const
+  {
+    return static_cast<int> (std::max (audio_rings_.size (), meters_.size ()));
+  }
+
+  ObservationKinds kinds () const { return kinds_; }
+
+  /**
+   * @brief Sets what to observe.
+   *
+   * Takes effect the next time the observer is prepared for processing (the
+   * manager triggers a graph rebuild).
+   */
+  void set_kinds (ObservationKinds kinds) { kinds_ = kinds; }
 
   // --- Audio ring buffers (RT writes, drain timer reads) ---
   RingBuffer<float> &audio_ring (int ch)
@@ -76,7 +102,20 @@ public:
     return *midi_ring_;
   }
 
+  // --- Meter ring buffers (RT writes, drain timer reads) ---
+  RingBuffer<MeterRecord> &meter_ring (int ch)
+  {
+    assert (ch >= 0 && ch < static_cast<int> (meters_.size ()));
+    return meters_[ch]->ring;
+  }
+  const RingBuffer<MeterRecord> &meter_ring (int ch) const
+  {
+    assert (ch >= 0 && ch < static_cast<int> (meters_.size ()));
+    return meters_[ch]->ring;
+  }
+
   bool has_audio_rings () const { return !audio_rings_.empty (); }
+  bool has_meter_rings () const { return !meters_.empty (); }
   bool has_midi_ring () const { return midi_ring_ != nullptr; }
 
 private:
@@ -100,10 +139,33 @@ private:
     [[clang::nonblocking]];
   void process_midi (const MidiPort &port) noexcept [[clang::nonblocking]];
 
-  PortUuid        observed_port_uuid_;
-  ObservedPortPtr typed_port_;
+  /**
+   * @brief Runs the meter DSP of a channel on a block and pushes a record.
+   */
+  void process_meters (int ch, const float * data, int len) noexcept
+    [[clang::nonblocking]];
+
+  /**
+   * @brief Meter state of a channel.
+   *
+   * Only the DSP for the requested kinds is created.
+   */
+  struct ChannelMeters
+  {
+    ChannelMeters () : ring (kMeterRingSize) { }
+
+    std::unique_ptr<PeakDsp>     peak;
+    std::unique_ptr<TruePeakDsp> true_peak;
+    std::unique_ptr<KMeterDsp>   kmeter;
+    RingBuffer<MeterRecord>      ring;
+  };
+
+  PortUuid         observed_port_uuid_;
+  ObservedPortPtr  typed_port_;
+  ObservationKinds kinds_;
 
   std::vector<std::unique_ptr<RingBuffer<float>>> audio_rings_;
+  std::vector<std::unique_ptr<ChannelMeters>>     meters_;
   std::unique_ptr<RingBuffer<RealtimeMidiEvent>>  midi_ring_;
 };
 
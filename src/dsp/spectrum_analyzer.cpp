@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <numbers>
+#include <stdexcept>
+
+#include "dsp/spectrum_analyzer.h"
+
+#include <kiss_fftr.h>
+
+namespace zrythm::dsp
+{
+
+// ============================================================================
+// SpectrumFrameAnalyzer
+// ============================================================================
+
+struct SpectrumFrameAnalyzer::Impl
+{
+  struct FftrConfigDeleter
+  {
+    void operator() (kiss_fftr_cfg cfg) const noexcept { kiss_fftr_free (cfg); }
+  };
+
+  std::unique_ptr<std::remove_pointer_t<kiss_fftr_cfg>, FftrConfigDeleter>
+    fft_cfg_;
+
+  std::vector<float>        window_;
+  float                     amplitude_scale_{};
+  std::vector<float>        windowed_;
+  std::vector<kiss_fft_cpx> spectrum_;
+  std::vector<float>        magnitudes_;
+};
+
+bool
+SpectrumFrameAnalyzer::is_valid_fft_size (size_t fft_size)
+{
+  return std::has_single_bit (fft_size) && fft_size >= kMinFftSize
+         && fft_size <= kMaxFftSize;
+}
+
+SpectrumFrameAnalyzer::SpectrumFrameAnalyzer (
+  const SpectrumAnalyzerConfig &config)
+    : config_ (config), impl_ (std::make_unique<Impl> ())
+{
+  if (!is_valid_fft_size (config_.fft_size))
+    throw std::invalid_argument ("SpectrumFrameAnalyzer: invalid FFT size");
+  if (config_.num_bands == 0 || config_.overlap == 0)
+    throw std::invalid_argument ("SpectrumFrameAnalyzer: invalid config");
+
+  const auto n = config_.fft_size;
+  const auto num_bins = n / 2 + 1;
+
+  impl_->fft_cfg_.reset (
+    kiss_fftr_alloc (static_cast<int> (n), 0, nullptr, nullptr));
+
+  // Periodic Hann window. Scale so that a full-scale sine reads 0 dBFS.
+  impl_->window_.resize (n);
+  float window_sum = 0.f;
+  for (size_t i = 0; i < n; ++i)
+    {
+      impl_->window_[i] =
+        0.5f
+        - 0.5f
+            * std::cos (
+              2.f * std::numbers::pi_v<float> * static_cast<float> (i)
+              / static_cast<float> (n));
+      window_sum += impl_->window_[i];
+    }
+  impl_->amplitude_scale_ = 2.f / window_sum;
+
+  impl_->windowed_.resize (n);
+  impl_->spectrum_.resize (num_bins);
+  impl_->magnitudes_.resize (num_bins);
+
+  // Precompute the bin mapping of each logarithmic band
+  const float nyquist = config_.sample_rate / 2.f;
+  const float min_freq = std::clamp (config_.min_frequency, 1.f, nyquist / 2.f);
+  const float bin_hz = config_.sample_rate / static_cast<float> (n);
+  const float band_ratio = std::pow (
+    nyquist / min_freq, 1.f / static_cast<float> (config_.num_bands));
+  bands_.resize (config_.num_bands);
+  for (size_t k = 0; k < config_.num_bands; ++k)
+    {
+      const float lo = min_freq * std::pow (band_ratio, static_cast<float> (k));
+      const float hi = lo * band_ratio;
+      auto       &band = bands_[k];
+      band.first_bin =
+        std::min (static_cast<size_t> (std::ceil (lo / bin_hz)), num_bins);
+      band.end_bin =
+        std::min (static_cast<size_t> (std::ceil (hi / bin_hz)), num_bins);
+      band.interp_bin = std::sqrt (lo * hi) / bin_hz;
+    }
+}
+
+SpectrumFrameAnalyzer::~SpectrumFrameAnalyzer () = default;
+
+float
+SpectrumFrameAnalyzer::band_center_frequency (size_t band) const
+{
+  const float bin_hz =
+    config_.sample_rate / static_cast<float> (config_.fft_size);
+  return bands_.at (band).interp_bin * bin_hz;
+}
+
+void
+SpectrumFrameAnalyzer::analyze (
+  std::span<const float> input,
+  std::span<float>       bands)
+{
+  assert (input.size () == config_.fft_size);
+  assert (bands.size () == config_.num_bands);
+
+  auto &windowed = impl_->windowed_;
+  std::ranges::transform (
+    input, impl_->window_, windowed.begin (), std::multiplies{});
+
+  kiss_fftr (
+    impl_->fft_cfg_.get (), windowed.data (), impl_->spectrum_.data ());
+
+  auto &magnitudes = impl_->magnitudes_;
+  std::ranges::transform (
+    impl_->spectrum_, magnitudes.begin (), [this] (const kiss_fft_cpx &c) {
+      return std::sqrt (c.r * c.r + c.i * c.i) * impl_->amplitude_scale_;
+    });
+
+  const float inv_range = 1.f / -config_.min_db;
+  for (size_t k = 0; k < bands_.size (); ++k)
+    {
+      const auto &band = bands_[k];
+      float       amplitude = 0.f;
+      if (band.end_bin > band.first_bin)
+        {
+          amplitude = *std::ranges::max_element (
+            std::span (magnitudes)
+              .subspan (band.first_bin, band.end_bin - band.first_bin));
+        }
+      else
+        {
+          const auto lower = std::min (
+            static_cast<size_t> (band.interp_bin), magnitudes.size () - 1);
+          const auto  upper = std::min (lower + 1, magnitudes.size () - 1);
+          const float frac = band.interp_bin - static_cast<float> (lower);
+          amplitude =
+            magnitudes[lower] * (1.f - frac) + magnitudes[upper] * frac;
+        }
+
+      const float db = 20.f * std::log10 (amplitude + 1e-12f);
+      bands[k] = std::clamp ((db - config_.min_db) * inv_range, 0.f, 1.f);
+    }
+}
+
+// ============================================================================
+// SpectrumAnalyzer
+// ============================================================================
+
+SpectrumAnalyzer::SpectrumAnalyzer (const SpectrumAnalyzerConfig &config)
+    : frame_analyzer_ (config),
+      input_ring_ (
+        std::max (
+          static_cast<size_t> (config.sample_rate), config.fft_size * 2)),
+      published_frame_ (config.num_bands, 0.f),
+      worker_ ([this] (std::stop_token stop_token) {
+        run (std::move (stop_token));
+      })
+{
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer ()
+{
+  worker_.request_stop ();
+  wake_cv_.notify_all ();
+}
+
+void
+SpectrumAnalyzer::push_samples (
+  std::span<const float> left,
+  std::span<const float> right)
+{
+  if (left.empty () && right.empty ())
+    return;
+
+  const auto n = std::max (left.size (), right.size ());
+  mono_scratch_.resize (n);
+  for (size_t i = 0; i < n; ++i)
+    {
+      const float l = i < left.size () ? left[i] : 0.f;
+      const float r = i < right.size () ? right[i] : 0.f;
+      if (left.empty ())
+        mono_scratch_[i] = r;
+      else if (right.empty ())
+        mono_scratch_[i] = l;
+      else
+        mono_scratch_[i] = (l + r) * 0.5f;
+    }
+
+  const auto to_write = std::min (n, input_ring_.write_space ());
+  if (to_write == 0)
+    return;
+  input_ring_.write_multiple (mono_scratch_.data (), to_write);
+
+  {
+    std::lock_guard lock (wake_mutex_);
+    samples_pending_ = true;
+  }
+  wake_cv_.notify_one ();
+}
+
+bool
+SpectrumAnalyzer::fetch_latest_frame (
+  std::vector<float> &dest,
+  uint64_t           &generation) const
+{
+  std::lock_guard lock (publish_mutex_);
+  if (published_generation_ == generation)
+    return false;
+  dest.assign (published_frame_.begin (), published_frame_.end ());
+  generation = published_generation_;
+  return true;
+}
+
+void
+SpectrumAnalyzer::run (std::stop_token stop_token)
+{
+  const auto &cfg = frame_analyzer_.config ();
+  const auto  hop = cfg.fft_size / cfg.overlap;
+
+  std::vector<float> window (cfg.fft_size, 0.f);
+  std::vector<float> frame (cfg.num_bands, 0.f);
+  std::vector<float> merged_frame (cfg.num_bands, 0.f);
+
+  while (!stop_token.stop_requested ())
+    {
+      {
+        std::unique_lock lock (wake_mutex_);
+        if (!wake_cv_.wait (
+              lock, stop_token, [this] { return samples_pending_; }))
+          return;
+        samples_pending_ = false;
+      }
+
+      // Consume whole hops only; leftover samples stay in the ring until a
+      // later push completes the hop. When several hops arrive at once, the
+      // published frame holds the per-band maximum so short transients are
+      // not lost between consumer polls.
+      bool have_new_frame = false;
+      while (input_ring_.read_space () >= hop)
+        {
+          std::shift_left (window.begin (), window.end (), hop);
+          input_ring_.read_multiple (&window[cfg.fft_size - hop], hop);
+          frame_analyzer_.analyze (window, frame);
+          if (have_new_frame)
+            std::ranges::transform (
+              merged_frame, frame, merged_frame.begin (),
+              [] (float a, float b) { return std::max (a, b); });
+          else
+            merged_frame = frame;
+          have_new_frame = true;
+
+          if (stop_token.stop_requested ())
+            return;
+        }
+
+      if (have_new_frame)
+        {
+          std::lock_guard lock (publish_mutex_);
+          published_frame_.swap (merged_frame);
+          ++published_generation_;
+        }
+    }
+}
+
+} // namespace zrythm::dsp
@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "utils/ring_buffer.h"
+
+namespace zrythm::dsp
+{
+
+/**
+ * @brief Settings shared by SpectrumFrameAnalyzer and SpectrumAnalyzer.
+ */
+struct SpectrumAnalyzerConfig
+{
+  /** FFT size in samples. Must be a power of 2. */
+  size_t fft_size = 8192;
+
+  /**
+   * Number of analysis frames per FFT window (hop size is
+   * fft_size / overlap).
+   */
+  size_t overlap = 4;
+
+  /** Number of logarithmically spaced output bands. */
+  size_t num_bands = 256;
+
+  /** Lowest band edge frequency (highest is Nyquist). */
+  float min_frequency = 20.f;
+
+  float sample_rate = 44100.f;
+
+  /** Level (dBFS) that maps to 0 in the output. 0 dBFS maps to 1. */
+  float min_db = -90.f;
+};
+
+/**
+ * @brief Single-threaded STFT frame analyzer.
+ *
+ * Runs a Hann-windowed real-to-complex FFT over exactly `fft_size` samples and
+ * folds the magnitude spectrum into logarithmically spaced bands. Bands that
+ * span multiple FFT bins take the loudest bin; bands narrower than a bin
+ * interpolate between neighboring bins.
+ *
+ * Output values are normalized levels in [0, 1] (see
+ * SpectrumAnalyzerConfig::min_db).
+ */
+class SpectrumFrameAnalyzer
+{
+public:
+  explicit SpectrumFrameAnalyzer (const SpectrumAnalyzerConfig &config);
+  ~SpectrumFrameAnalyzer ();
+  SpectrumFrameAnalyzer (const SpectrumFrameAnalyzer &) = delete;
+  SpectrumFrameAnalyzer &operator= (const SpectrumFrameAnalyzer &) = delete;
+  SpectrumFrameAnalyzer (SpectrumFrameAnalyzer &&) = delete;
+  SpectrumFrameAnalyzer &operator= (SpectrumFrameAnalyzer &&) = delete;
+
+  /**
+   * @brief Analyzes one frame.
+   *
+   * @param input fft_size time-domain samples.
+   * @param bands num_bands output levels.
+   */
+  void analyze (std::span<const float> input, std::span<float> bands);
+
+  /**
+   * @brief Returns the geometric center frequency of the given band.
+   */
+  float band_center_frequency (size_t band) const;
+
+  const SpectrumAnalyzerConfig &config () const { return config_; }
+
+  /**
+   * @brief Returns whether @p fft_size is supported.
+   */
+  static bool is_valid_fft_size (size_t fft_size);
+
+  static constexpr size_t kMinFftSize = 256;
+  static constexpr size_t kMaxFftSize = 32768;
+
+private:
+  struct Band
+  {
+    /** FFT bin range [first_bin, end_bin) when the band covers whole bins. */
+    size_t first_bin{};
+    size_t end_bin{};
+
+    /** Fractional bin position used when the band is narrower than a bin. */
+    float interp_bin{};
+  };
+
+  SpectrumAnalyzerConfig config_;
+  std::vector<Band>      bands_;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * @brief Spectrum analyzer that runs its FFTs on a worker thread.
+ *
+ * A single producer (usually the GUI thread, after draining a
+ * PortObservationCache) pushes samples with push_samples(). The worker slides
+ * a window over them with the configured overlap and publishes each finished
+ * band frame. Consumers poll fetch_latest_frame(), which is cheap and never
+ * waits for an FFT to finish.
+ *
+ * Samples pushed while the worker is behind by more than the internal buffer
+ * (about one second) are dropped.
+ */
+class SpectrumAnalyzer
+{
+public:
+  explicit SpectrumAnalyzer (const SpectrumAnalyzerConfig &config);
+  ~SpectrumAnalyzer ();
+  SpectrumAnalyzer (const SpectrumAnalyzer &) = delete;
+  SpectrumAnalyzer &operator= (const SpectrumAnalyzer &) = delete;
+  SpectrumAnalyzer (SpectrumAnalyzer &&) = delete;
+  SpectrumAnalyzer &operator= (SpectrumAnalyzer &&) = delete;
+
+  /**
+   * @brief Queues samples for analysis, mixing @p left and @p right to mono.
+   *
+   * Either span may be empty (e.g. for mono sources).
+   */
+  void push_samples (std::span<const float> left, std::span<const float> right);
+
+  /**
+   * @brief Copies the latest published frame into @p dest if it is newer than
+   * @p generation.
+   *
+   * @param[in,out] generation Generation of the caller's current frame.
+   * Updated on success.
+   * @return Whether a newer frame was copied.
+   */
+  bool
+  fetch_latest_frame (std::vector<float> &dest, uint64_t &generation) const;
+
+  const SpectrumAnalyzerConfig &config () const
+  {
+    return frame_analyzer_.config ();
+  }
+
+  float band_center_frequency (size_t band) const
+  {
+    return frame_analyzer_.band_center_frequency (band);
+  }
+
+private:
+  void run (std::stop_token stop_token);
+
+  SpectrumFrameAnalyzer frame_analyzer_;
+  RingBuffer<float>     input_ring_;
+  std::vector<float>    mono_scratch_;
+
+  std::mutex                  wake_mutex_;
+  std::condition_variable_any wake_cv_;
+  bool                        samples_pending_ = false;
+
+  mutable std::mutex publish_mutex_;
+  std::vector<float> published_frame_;
+  uint64_t           published_generation_ = 0;
+
+  // Declared last so it is joined before the members it uses are destroyed
+  std::jthread worker_;
+};
+
+} // namespace zrythm::dsp
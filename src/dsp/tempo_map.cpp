@@ -193,20 +193,139 @@ FixedPpqTempoMap<PPQ>::tick_to_seconds (TimelineTick tick) const
   if (events_.empty ())
     return tick_q / base_bpm_;
 
-  // Find the last event <= target tick
-  auto it = std::ranges::upper_bound (events_, tick_q, {}, &TempoEvent::tick);
+  // Find the segment of the last event <= target tick
+  const auto it =
+    std::ranges::upper_bound (events_, tick_q, {}, &TempoEvent::tick);
+  return segment_tick_to_seconds (
+    static_cast<size_t> (std::distance (events_.begin (), it)), tick_q);
+}
 
-  if (it == events_.begin ())
+template <units::tick_t::NTTP PPQ>
+TimelineTick
+FixedPpqTempoMap<PPQ>::seconds_to_tick (units::precise_second_t seconds) const
+{
+  if (seconds <= units::seconds (0.0))
+    return TimelineTick{ units::ticks (0.0) };
+
+  // No inserted events: base tempo (constant) over the whole timeline.
+  if (events_.empty ())
+    return TimelineTick{ seconds * base_bpm_ };
+
+  // Find the segment containing the time
+  const auto it = std::ranges::upper_bound (cumulative_seconds_, seconds);
+  return TimelineTick{ segment_seconds_to_tick (
+    static_cast<size_t> (std::distance (cumulative_seconds_.begin (), it)),
+    seconds) };
+}
+
+template <units::tick_t::NTTP PPQ>
+void
+FixedPpqTempoMap<PPQ>::ticks_to_samples (
+  std::span<const TimelineTick>      ticks,
+  std::span<units::precise_sample_t> samples) const
+{
+  assert (samples.size () == ticks.size ());
+
+  // Constant tempo: no segments to look up
+  if (events_.empty ())
+    {
+      for (const auto i : std::views::iota (0uz, ticks.size ()))
+        {
+          samples[i] = ticks[i].asQuantity () / base_bpm_ * sample_rate_;
+        }
+      return;
+    }
+
+  Cursor cursor (*this);
+  for (const auto i : std::views::iota (0uz, ticks.size ()))
+    {
+      samples[i] = cursor.tick_to_samples (ticks[i]);
+    }
+}
+
+template <units::tick_t::NTTP PPQ>
+void
+FixedPpqTempoMap<PPQ>::samples_to_ticks (
+  std::span<const units::precise_sample_t> samples,
+  std::span<TimelineTick>                  ticks) const
+{
+  assert (ticks.size () == samples.size ());
+
+  Cursor cursor (*this);
+  for (const auto i : std::views::iota (0uz, samples.size ()))
+    {
+      ticks[i] = cursor.samples_to_tick (samples[i]);
+    }
+}
+
+template <units::tick_t::NTTP PPQ>
+size_t
+FixedPpqTempoMap<PPQ>::find_segment_at_tick (
+  units::precise_tick_t tick,
+  size_t                hint) const
+{
+  const auto starts_before = [this, tick] (size_t segment) {
+    return segment == 0
+           || static_cast<units::precise_tick_t> (events_[segment - 1].tick)
+                <= tick;
+  };
+  const auto contains = [&] (size_t segment) {
+    return starts_before (segment)
+           && (segment == events_.size () || !starts_before (segment + 1));
+  };
+
+  // Positions usually stay in the same segment or move to the next one
+  if (hint <= events_.size () && contains (hint))
+    return hint;
+  if (hint < events_.size () && contains (hint + 1))
+    return hint + 1;
+
+  const auto it =
+    std::ranges::upper_bound (events_, tick, {}, &TempoEvent::tick);
+  return static_cast<size_t> (std::distance (events_.begin (), it));
+}
+
+template <units::tick_t::NTTP PPQ>
+size_t
+FixedPpqTempoMap<PPQ>::find_segment_at_seconds (
+  units::precise_second_t seconds,
+  size_t                  hint) const
+{
+  const auto starts_before = [this, seconds] (size_t segment) {
+    return segment == 0 || cumulative_seconds_[segment - 1] <= seconds;
+  };
+  const auto contains = [&] (size_t segment) {
+    return starts_before (segment)
+           && (segment == events_.size () || !starts_before (segment + 1));
+  };
+
+  // Positions usually stay in the same segment or move to the next one
+  if (hint <= events_.size () && contains (hint))
+    return hint;
+  if (hint < events_.size () && contains (hint + 1))
+    return hint + 1;
+
+  const auto it = std::ranges::upper_bound (cumulative_seconds_, seconds);
+  return static_cast<size_t> (std::distance (cumulative_seconds_.begin (), it));
+}
+
+template <units::tick_t::NTTP PPQ>
+auto
+FixedPpqTempoMap<PPQ>::segment_tick_to_seconds (
+  size_t                segment,
+  units::precise_tick_t tick) const -> units::precise_second_t
+{
+  if (segment == 0)
     {
       // Before the first inserted event: base tempo (constant) from tick 0.
-      return tick_q / base_bpm_;
+      return tick / base_bpm_;
     }
 
-  size_t              index = std::distance (events_.begin (), it) - 1;
+  const size_t        index = segment - 1;
   const auto         &startEvent = events_[index];
   const units::tick_t segmentStart = startEvent.tick;
   const auto          ticksFromStart =
-    tick_q - static_cast<units::precise_tick_t> (segmentStart);
+    tick - static_cast<units::precise_tick_t> (segmentStart);
   const auto baseSeconds = cumulative_seconds_[index];
 
   // Last event segment
@@ -246,74 +365,63 @@ FixedPpqTempoMap<PPQ>::tick_to_seconds (TimelineTick tick) const
 }
 
 template <units::tick_t::NTTP PPQ>
-TimelineTick
-FixedPpqTempoMap<PPQ>::seconds_to_tick (units::precise_second_t seconds) const
+units::precise_tick_t
+FixedPpqTempoMap<PPQ>::segment_seconds_to_tick (
+  size_t                  segment,
+  units::precise_second_t seconds) const
 {
-  return TimelineTick{ [&] () -> units::precise_tick_t {
-    if (seconds <= units::seconds (0.0))
-      return units::ticks (0.0);
-
-    // No inserted events: base tempo (constant) over the whole timeline.
-    if (events_.empty ())
+  if (segment == 0)
+    {
+      // Lead base segment: before the first inserted event's cumulative time.
       return seconds * base_bpm_;
+    }
 
-    // Lead base segment: before the first inserted event's cumulative time.
-    if (seconds < cumulative_seconds_[0])
-      return seconds * base_bpm_;
+  const size_t      index = segment - 1;
+  const auto        baseSeconds = cumulative_seconds_[index];
+  const auto        timeInSegment = seconds - baseSeconds;
+  const TempoEvent &startEvent = events_[index];
+
+  // Last segment
+  if (index == events_.size () - 1)
+    {
+      return static_cast<units::precise_tick_t> (startEvent.tick)
+             + timeInSegment * startEvent.bpm;
+    }
+
+  const TempoEvent   &endEvent = events_[index + 1];
+  const units::tick_t segmentTicks = endEvent.tick - startEvent.tick;
+  const auto dSegmentTicks = static_cast<units::precise_tick_t> (segmentTicks);
+
+  // Constant tempo segment
+  if (startEvent.curve == CurveType::Constant)
+    {
+      return static_cast<units::precise_tick_t> (startEvent.tick)
+             + timeInSegment * startEvent.bpm;
+    }
+  // Linear tempo ramp
+  else if (startEvent.curve == CurveType::Linear)
+    {
+      const auto bpm0 = startEvent.bpm;
+      const auto bpm1 = endEvent.bpm;
+
+      if (abs (bpm1 - bpm0) < units::bpm (1e-5))
+        {
+          return static_cast<units::precise_tick_t> (startEvent.tick)
+                 + timeInSegment * bpm0;
+        }
+
+      // Coerce the mixed-unit product to plain ticks before dividing, so the
+      // ratio is unitless (magnitude 1) and usable directly with std::exp.
+      const auto exponent = au::as_raw_number (
+        (timeInSegment * (bpm1 - bpm0)).as (units::ticks) / dSegmentTicks);
+      const auto expVal = std::exp (exponent);
+      const auto f = (expVal - 1.0) * (bpm0 / (bpm1 - bpm0));
+
+      return static_cast<units::precise_tick_t> (startEvent.tick)
+             + f * dSegmentTicks;
+    }
 
-    // Find the segment containing the time
-    auto         it = std::ranges::upper_bound (cumulative_seconds_, seconds);
-    const size_t index =
-      (it == cumulative_seconds_.begin ())
-        ? 0
-        : std::distance (cumulative_seconds_.begin (), it) - 1;
-
-    const auto        baseSeconds = cumulative_seconds_[index];
-    const auto        timeInSegment = seconds - baseSeconds;
-    const TempoEvent &startEvent = events_[index];
-
-    // Last segment
-    if (index == events_.size () - 1)
-      {
-        return static_cast<units::precise_tick_t> (startEvent.tick)
-               + timeInSegment * startEvent.bpm;
-      }
-
-    const TempoEvent   &endEvent = events_[index + 1];
-    const units::tick_t segmentTicks = endEvent.tick - startEvent.tick;
-    const auto dSegmentTicks = static_cast<units::precise_tick_t> (segmentTicks);
-
-    // Constant tempo segment
-    if (startEvent.curve == CurveType::Constant)
-      {
-        return static_cast<units::precise_tick_t> (startEvent.tick)
-               + timeInSegment * startEvent.bpm;
-      }
-    // Linear tempo ramp
-    else if (startEvent.curve == CurveType::Linear)
-      {
-        const auto bpm0 = startEvent.bpm;
-        const auto bpm1 = endEvent.bpm;
-
-        if (abs (bpm1 - bpm0) < units::bpm (1e-5))
-          {
-            return static_cast<units::precise_tick_t> (startEvent.tick)
-                   + timeInSegment * bpm0;
-          }
-
-        // Coerce the mixed-unit product to plain ticks before dividing, so the
-        // ratio is unitless (magnitude 1) and usable directly with std::exp.
-        const auto exponent = au::as_raw_number (
-          (timeInSegment * (bpm1 - bpm0)).as (units::ticks) / dSegmentTicks);
-        const auto expVal = std::exp (exponent);
-        const auto f = (expVal - 1.0) * (bpm0 / (bpm1 - bpm0));
-
-        return static_cast<units::precise_tick_t> (startEvent.tick)
-               + f * dSegmentTicks;
-      }
-
-    return static_cast<units::precise_tick_t> (startEvent.tick);
-  }() };
+  return static_cast<units::precise_tick_t> (startEvent.tick);
 }
 
 template <units::tick_t::NTTP PPQ>
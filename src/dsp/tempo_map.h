@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <cstdint>
 #include <span>
 #include <string_view>
@@ -182,6 +183,95 @@ public:
     return seconds_to_tick (seconds);
   }
 
+  /**
+   * @brief Converts ascending timeline ticks to samples.
+   *
+   * Equivalent to calling tick_to_samples() for each tick, but only looks up
+   * the tempo segment of a tick when it differs from that of the previous
+   * one (see Cursor).
+   *
+   * @param ticks Ticks, preferably sorted in ascending order (other orders
+   * give correct results but are slower).
+   * @param[out] samples Output, same size as @p ticks.
+   */
+  void ticks_to_samples (
+    std::span<const TimelineTick>      ticks,
+    std::span<units::precise_sample_t> samples) const;
+
+  /**
+   * @brief Converts ascending sample positions to timeline ticks.
+   *
+   * Batch version of samples_to_tick(), see ticks_to_samples().
+   */
+  void samples_to_ticks (
+    std::span<const units::precise_sample_t> samples,
+    std::span<TimelineTick>                  ticks) const;
+
+  /**
+   * @brief Converts positions between ticks and time while remembering the
+   * current tempo segment.
+   *
+   * Intended for converting many positions per block in ascending order (e.g.
+   * when generating events): each conversion only checks the current and next
+   * tempo segment, and falls back to a binary search on larger jumps or when
+   * moving backwards. With no tempo events (constant tempo) no lookup is done
+   * at all.
+   *
+   * Conversions give the same results as the corresponding FixedPpqTempoMap
+   * methods.
+   *
+   * @warning Must not be used after the tempo map is modified.
+   */
+  class Cursor
+  {
+  public:
+    explicit Cursor (const FixedPpqTempoMap &tempo_map)
+        : tempo_map_ (&tempo_map)
+    {
+    }
+
+    units::precise_second_t tick_to_seconds (TimelineTick tick)
+    {
+      const auto tick_q = tick.asQuantity ();
+      assert (tick_q >= units::ticks (0.0));
+      if (!tempo_map_->events_.empty ())
+        segment_ = tempo_map_->find_segment_at_tick (tick_q, segment_);
+      return tempo_map_->segment_tick_to_seconds (segment_, tick_q);
+    }
+
+    units::precise_sample_t tick_to_samples (TimelineTick tick)
+    {
+      return tick_to_seconds (tick) * tempo_map_->sample_rate_;
+    }
+
+    units::sample_t tick_to_samples_rounded (TimelineTick tick)
+    {
+      return au::round_as<int64_t> (units::samples, tick_to_samples (tick));
+    }
+
+    TimelineTick seconds_to_tick (units::precise_second_t seconds)
+    {
+      if (seconds <= units::seconds (0.0))
+        return TimelineTick{ units::ticks (0.0) };
+      if (!tempo_map_->events_.empty ())
+        segment_ = tempo_map_->find_segment_at_seconds (seconds, segment_);
+      return TimelineTick{
+        tempo_map_->segment_seconds_to_tick (segment_, seconds)
+      };
+    }
+
+    TimelineTick samples_to_tick (units::precise_sample_t samples)
+    {
+      return seconds_to_tick (samples / tempo_map_->sample_rate_);
+    }
+
+  private:
+    const FixedPpqTempoMap * tempo_map_;
+
+    /// Index of the current tempo segment (see find_segment_at_tick()).
+    size_t segment_{};
+  };
+
   /**
    * @brief Get the time signature event active at the given tick.
    * @param tick Position in ticks
@@ -294,6 +384,29 @@ private:
   /// [1, 128] (i.e. one of 1, 2, 4, 8, 16, 32, 64, 128).
   static void throw_if_invalid_time_signature (int numerator, int denominator);
 
+  /**
+   * @brief Returns the index of the tempo segment containing @p tick.
+   *
+   * Segment 0 is the lead segment governed by the base tempo, and segment
+   * `i > 0` starts at `events_[i - 1]`.
+   *
+   * @param hint Segment to check (along with the next one) before searching.
+   */
+  size_t find_segment_at_tick (units::precise_tick_t tick, size_t hint) const;
+
+  /// Same as find_segment_at_tick() for a time position.
+  size_t
+  find_segment_at_seconds (units::precise_second_t seconds, size_t hint) const;
+
+  /// Convert a tick within the given segment to seconds
+  units::precise_second_t
+  segment_tick_to_seconds (size_t segment, units::precise_tick_t tick) const;
+
+  /// Convert a time within the given segment to ticks
+  units::precise_tick_t segment_seconds_to_tick (
+    size_t                  segment,
+    units::precise_second_t seconds) const;
+
   /// Compute time duration for a segment between two tempo events
   units::precise_second_t compute_segment_time (
     const TempoEvent &start,
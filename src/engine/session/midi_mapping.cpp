@@ -1,7 +1,11 @@
 // SPDX-FileCopyrightText: © 2019-2022, 2024-2026 Alexandros Theodotou <alex@zrythm.org>
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
+#include <algorithm>
+#include <cassert>
+#include <functional>
 #include <memory>
+#include <string_view>
 
 #include "utils/format_qt.h"
 #include <fmt/std.h>
@@ -14,6 +18,54 @@
 
 namespace zrythm::engine::session
 {
+namespace
+{
+/**
+ * @brief Applies @p count coalesced events whose last value is @p value.
+ */
+void
+apply_to_parameter (dsp::ProcessorParameter &dest, float value, uint32_t count)
+{
+  /* if toggle, reverse value for every event */
+  if (dest.range ().type_ == dsp::ParameterRange::Type::Toggle)
+    {
+      if (count % 2 == 1)
+        {
+          dest.setBaseValue (
+            dest.range ().isToggled (dest.baseValue ()) ? 0.f : 1.f);
+        }
+    }
+  /* else if not toggle set the control value received */
+  else
+    {
+      dest.setBaseValue (value);
+    }
+}
+
+/**
+ * @brief Marks the realtime side of the lookup table as in use.
+ *
+ * farbot's nonRealtimeMutatable RealtimeObject supports a single realtime
+ * reader, so dispatch must never run concurrently.
+ */
+class DispatchGuard
+{
+public:
+  explicit DispatchGuard (std::atomic<bool> &dispatching)
+      : dispatching_ (dispatching)
+  {
+    [[maybe_unused]] const bool was_dispatching =
+      dispatching_.exchange (true, std::memory_order_acquire);
+    assert (!was_dispatching);
+  }
+  ~DispatchGuard () { dispatching_.store (false, std::memory_order_release); }
+  Q_DISABLE_COPY_MOVE (DispatchGuard)
+
+private:
+  std::atomic<bool> &dispatching_;
+};
+}
+
 MidiMapping::MidiMapping (utils::IObjectRegistry &registry, QObject * parent)
     : QObject (parent), registry_ (registry)
 {
@@ -51,6 +103,7 @@ MidiMappings::bind_at (
   mapping->enabled_.store (true);
 
   mappings_.insert (mappings_.begin () + idx, std::move (mapping));
+  rebuild_lookup ();
 
   auto str = utils::midi::midi_ctrl_change_get_description (buf);
   z_info ("bounded MIDI mapping from {} to {}", str, dest_port.get ()->label ());
@@ -61,7 +114,10 @@ MidiMappings::unbind (int idx, bool fire_events)
 {
   z_return_if_fail (idx >= 0 && idx < static_cast<int> (mappings_.size ()));
 
+  // Keep the mapping alive until the lookup table stops referencing it
+  auto mapping = std::move (mappings_[idx]);
   mappings_.erase (mappings_.begin () + idx);
+  rebuild_lookup ();
 }
 
 int
@@ -73,22 +129,16 @@ MidiMappings::get_mapping_index (const MidiMapping &mapping) const
   return it != mappings_.end () ? std::distance (mappings_.begin (), it) : -1;
 }
 
+void
+MidiMapping::apply_value (float value)
+{
+  apply_to_parameter (*dest_id_->get (), value, 1);
+}
+
 void
 MidiMapping::apply (std::array<midi_byte_t, 3> buf)
 {
-  auto * dest = dest_id_->get ();
-  /* if toggle, reverse value */
-  if (dest->range ().type_ == dsp::ParameterRange::Type::Toggle)
-    {
-      dest->setBaseValue (
-        dest->range ().isToggled (dest->baseValue ()) ? 0.f : 1.f);
-    }
-  /* else if not toggle set the control value received */
-  else
-    {
-      float normalized_val = static_cast<float> (buf[2]) / 127.f;
-      dest->setBaseValue (normalized_val);
-    }
+  apply_value (static_cast<float> (buf[2]) / 127.f);
     // TODO port these from MidiPort's to parameters
 #if 0
   else if (dest_->id_->type_ == dsp::PortType::Midi)
@@ -136,35 +186,144 @@ MidiMapping::apply (std::array<midi_byte_t, 3> buf)
 #endif
 }
 
+size_t
+MidiMappings::hash_device_id (const utils::Utf8String &device_id)
+{
+  // 0 is reserved for bindings to any device
+  return std::max<size_t> (std::hash<std::string_view>{}(device_id.view ()), 1);
+}
+
+void
+MidiMappings::rebuild_lookup ()
+{
+  LookupTable table;
+
+  boost::unordered_flat_map<dsp::ProcessorParameter *, size_t> dest_slots;
+  for (const auto &mapping : mappings_)
+    {
+      if (!mapping->dest_id_.has_value ())
+        continue;
+
+      auto * dest = mapping->dest_id_->get ();
+      const auto slot_it =
+        dest_slots.try_emplace (dest, dest_slots.size ()).first;
+      table.entries[LookupTable::make_key (mapping->key_[0], mapping->key_[1])]
+        .push_back (
+          LookupEntry{
+            .mapping = mapping.get (),
+            .device_hash =
+              mapping->device_id_ ? hash_device_id (*mapping->device_id_) : 0,
+            .pending_index = slot_it->second });
+    }
+  table.pending = std::make_shared<PendingValues> (dest_slots.size ());
+  for (const auto &[dest, slot] : dest_slots)
+    (*table.pending)[slot].dest = dest;
+  auto pending = table.pending;
+
+  // Publishes the new table without copying the previous one (blocks until
+  // the audio thread is done with it)
+  lookup_.nonRealtimeReplace (std::move (table));
+
+  // Apply what was received through the previous table
+  flush_pending ();
+  pending_ = std::move (pending);
+}
+
+void
+MidiMappings::record_pending (
+  const LookupTable &table,
+  const LookupEntry &entry,
+  float              value)
+{
+  auto &pending = (*table.pending)[entry.pending_index];
+  pending.value.store (value, std::memory_order_relaxed);
+  pending.count.fetch_add (1, std::memory_order_release);
+}
+
+void
+MidiMappings::flush_pending ()
+{
+  if (!pending_)
+    return;
+
+  for (auto &pending : *pending_)
+    {
+      const auto count = pending.count.exchange (0, std::memory_order_acq_rel);
+      if (count == 0)
+        continue;
+
+      apply_to_parameter (
+        *pending.dest, pending.value.load (std::memory_order_relaxed), count);
+    }
+}
+
 void
 MidiMappings::apply_from_cc_events (
-  std::span<const dsp::RealtimeMidiEvent> events)
+  const dsp::MidiEventBuffer &events,
+  const utils::Utf8String *   device_id)
 {
-  for (const auto &ev : events)
+  const DispatchGuard guard{ dispatching_ };
+  decltype (lookup_)::ScopedAccess<farbot::ThreadType::realtime> access{
+    lookup_
+  };
+  const auto &table = *access;
+  if (table.entries.empty ())
+    return;
+
+  const size_t device_hash =
+    device_id != nullptr ? hash_device_id (*device_id) : 0;
+
+  for (const auto ev : events)
     {
-      auto d = ev.data ();
+      const auto d = ev.data ();
       if (d.size () < 3 || !utils::midi::midi_is_controller (d))
         continue;
-      auto  channel = utils::midi::midi_get_channel_1_to_16 (d);
-      auto  controller = utils::midi::midi_get_controller_number (d);
-      auto &mapping = mappings_[(channel - 1) * 128 + controller];
-      std::array<midi_byte_t, 3> buf = { d[0], d[1], d[2] };
-      mapping->apply (buf);
+
+      const auto it = table.entries.find (LookupTable::make_key (d[0], d[1]));
+      if (it == table.entries.end ())
+        continue;
+
+      for (const auto &entry : it->second)
+        {
+          if (!entry.mapping->enabled_.load (std::memory_order_relaxed))
+            continue;
+          if (
+            device_id != nullptr && entry.device_hash != 0
+            && entry.device_hash != device_hash)
+            continue;
+
+          record_pending (table, entry, static_cast<float> (d[2]) / 127.f);
+        }
     }
 }
 
 void
-MidiMappings::apply (const midi_byte_t * buf)
+MidiMappings::apply (
+  const midi_byte_t *       buf,
+  const utils::Utf8String * device_id)
 {
-  for (auto &mapping : mappings_)
+  const DispatchGuard guard{ dispatching_ };
+  decltype (lookup_)::ScopedAccess<farbot::ThreadType::realtime> access{
+    lookup_
+  };
+  const auto &table = *access;
+  const auto  it = table.entries.find (LookupTable::make_key (buf[0], buf[1]));
+  if (it == table.entries.end ())
+    return;
+
+  const size_t device_hash =
+    device_id != nullptr ? hash_device_id (*device_id) : 0;
+  const float value = static_cast<float> (buf[2]) / 127.f;
+  for (const auto &entry : it->second)
     {
+      if (!entry.mapping->enabled_.load (std::memory_order_relaxed))
+        continue;
       if (
-        mapping->enabled_.load () && mapping->key_[0] == buf[0]
-        && mapping->key_[1] == buf[1])
-        {
-          std::array<midi_byte_t, 3> arr = { buf[0], buf[1], buf[2] };
-          mapping->apply (arr);
-        }
+        device_id != nullptr && entry.device_hash != 0
+        && entry.device_hash != device_hash)
+        continue;
+
+      record_pending (table, entry, value);
     }
 }
 
@@ -228,5 +387,6 @@ from_json (const nlohmann::json &j, MidiMappings &mappings)
       from_json (mapping_json, *mapping);
       mappings.mappings_.push_back (std::move (mapping));
     }
+  mappings.rebuild_lookup ();
 }
 }
@@ -4,10 +4,13 @@
 #pragma once
 
 #include "dsp/midi_event.h"
+#include "dsp/midi_event_buffer.h"
 #include "dsp/parameter.h"
 #include "utils/icloneable.h"
 #include "utils/iobject_registry.h"
 
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <farbot/RealtimeObject.hpp>
 #include <nlohmann/json_fwd.hpp>
 
 #define MIDI_MAPPINGS (PROJECT->midi_mappings_)
@@ -37,6 +40,13 @@ public:
 
   void apply (std::array<midi_byte_t, 3> buf);
 
+  /**
+   * @brief Applies a normalized (0-1) value to the destination.
+   *
+   * Toggle destinations are flipped instead, regardless of @p value.
+   */
+  void apply_value (float value);
+
 private:
   static constexpr auto kKeyKey = "key"sv;
   static constexpr auto kDeviceIdKey = "deviceIdentifier"sv;
@@ -92,8 +102,8 @@ public:
   /**
    * Unbinds the given binding.
    *
-   * @note This must be called inside a port operation lock, such as inside an
-   * undoable action.
+   * Safe to call while the audio thread is dispatching: the binding is only
+   * destroyed after the lookup table no longer references it.
    */
   void unbind (int idx, bool fire_events);
 
@@ -121,18 +131,60 @@ public:
   int get_mapping_index (const MidiMapping &mapping) const;
 
   /**
-   * Applies the events to the appropriate mapping.
+   * Applies the CC events received from a MIDI input device to the matching
+   * mappings.
+   *
+   * Realtime-safe: values are only recorded here and applied to the
+   * parameters by the next flush_pending() call on the main thread. CC events
+   * that target the same destination before that are coalesced: only the
+   * last value is applied (toggles are flipped once per odd number of
+   * events).
    *
-   * This is used only for TrackProcessor.cc_mappings.
+   * @param device_id Device the events came from. If null, bindings for all
+   * devices match.
    *
-   * @note Must only be called while transport is recording.
+   * @note Called by the engine on the audio thread once per device and cycle
+   * (see dsp::AudioEngine::set_midi_input_observer()). Must never run
+   * concurrently with itself or with apply() (the lookup table allows a
+   * single realtime reader); this is asserted.
    */
-  void apply_from_cc_events (std::span<const dsp::RealtimeMidiEvent> events);
+  void apply_from_cc_events (
+    const dsp::MidiEventBuffer &events,
+    const utils::Utf8String *   device_id = nullptr);
 
   /**
    * Applies the given buffer to the matching ports.
+   *
+   * Like apply_from_cc_events(), this only records the value for the next
+   * flush_pending().
+   *
+   * @param device_id Device the message came from. If null, bindings for
+   * all devices match.
+   *
+   * @note Must never run concurrently with itself or with
+   * apply_from_cc_events(); this is asserted.
+   */
+  void apply (
+    const midi_byte_t *       buf,
+    const utils::Utf8String * device_id = nullptr);
+
+  /**
+   * @brief Applies the values recorded by apply() and apply_from_cc_events()
+   * since the last call to their destination parameters.
+   *
+   * Must be called periodically from the main thread.
    */
-  void apply (const midi_byte_t * buf);
+  void flush_pending ();
+
+  /**
+   * @brief Rebuilds the lookup table used by apply() and
+   * apply_from_cc_events().
+   *
+   * Called automatically by bind_at() and unbind(). Must be called after
+   * modifying @ref mappings_ directly (other than toggling
+   * MidiMapping::enabled_). Never call from the audio thread.
+   */
+  void rebuild_lookup ();
 
   /**
    * Get MIDI mappings for the given port.
@@ -163,7 +215,89 @@ public:
   std::vector<std::unique_ptr<MidiMapping>> mappings_;
 
 private:
+  /**
+   * @brief Value received for a destination, waiting to be applied on the
+   * main thread.
+   *
+   * Written by the dispatching (audio) thread and consumed by
+   * flush_pending().
+   */
+  struct PendingValue
+  {
+    /** Destination (kept alive by MidiMapping::dest_id_). */
+    dsp::ProcessorParameter * dest{};
+
+    /** Last received value. */
+    std::atomic<float> value{};
+
+    /** Number of events received since the last flush (0 if none). */
+    std::atomic<uint32_t> count{};
+  };
+  using PendingValues = std::vector<PendingValue>;
+
+  /**
+   * @brief Binding resolved for dispatch.
+   */
+  struct LookupEntry
+  {
+    MidiMapping * mapping{};
+
+    /** Hash of MidiMapping::device_id_, or 0 for bindings to any device. */
+    size_t device_hash{};
+
+    /**
+     * Slot in LookupTable::pending used to coalesce events. Shared by all
+     * entries with the same destination.
+     */
+    size_t pending_index{};
+  };
+
+  /**
+   * @brief Precomputed bindings keyed by (status byte, data byte 1).
+   *
+   * Built on the main thread by rebuild_lookup() and swapped in atomically so
+   * that dispatch never walks @ref mappings_.
+   */
+  struct LookupTable
+  {
+    static constexpr uint16_t make_key (midi_byte_t status, midi_byte_t data1)
+    {
+      return static_cast<uint16_t> ((status << 8) | data1);
+    }
+
+    boost::unordered_flat_map<uint16_t, std::vector<LookupEntry>> entries;
+
+    /** One slot per destination (shared with @ref pending_). */
+    std::shared_ptr<PendingValues> pending;
+  };
+
+  /**
+   * @brief Records a value received for @p entry.
+   */
+  static void record_pending (
+    const LookupTable &table,
+    const LookupEntry &entry,
+    float              value);
+
+  static size_t hash_device_id (const utils::Utf8String &device_id);
+
   utils::IObjectRegistry &registry_;
+
+  farbot::RealtimeObject<
+    LookupTable,
+    farbot::RealtimeObjectOptions::nonRealtimeMutatable>
+    lookup_;
+
+  /**
+   * @brief Slots of the published lookup table, for flush_pending().
+   */
+  std::shared_ptr<PendingValues> pending_;
+
+  /**
+   * @brief Set while apply() or apply_from_cc_events() holds the realtime
+   * side of @ref lookup_, to catch concurrent dispatch.
+   */
+  std::atomic<bool> dispatching_{ false };
 };
 
 }
@@ -10,11 +10,91 @@
 
 namespace zrythm::gui
 {
-FileSystemModel::FileSystemModel (QObject * parent) : QFileSystemModel (parent)
+FileSystemModel::FileSystemModel (QObject * parent)
+    : FileSystemModel (
+        std::make_shared<utils::audio::WaveformThumbnailCache> (
+          utils::audio::WaveformThumbnailCache::default_dir (),
+          utils::audio::WaveformThumbnailCache::DEFAULT_MAX_SIZE_BYTES),
+        parent)
 {
+}
+
+FileSystemModel::FileSystemModel (
+  std::shared_ptr<utils::audio::WaveformThumbnailCache> thumbnail_cache,
+  QObject *                                             parent)
+    : QFileSystemModel (parent),
+      thumbnail_scanner_ (
+        utils::make_qobject_unique<WaveformThumbnailScanner> (
+          std::move (thumbnail_cache), this))
+{
+  // Thumbnails are computed as directories get browsed, so the waveforms are
+  // usually ready by the time the user scrolls to them
+  connect (
+    this, &QFileSystemModel::directoryLoaded, this,
+    &FileSystemModel::scan_directory);
+  connect (
+    this, &QFileSystemModel::rootPathChanged, this,
+    &FileSystemModel::on_browsed_directory_changed);
+  connect (
+    thumbnail_scanner_.get (), &WaveformThumbnailScanner::thumbnailReady, this,
+    [this] (const QString &path) {
+      const auto idx = index (path);
+      if (idx.isValid ())
+        {
+          Q_EMIT dataChanged (idx, idx, { WaveformPeaksRole, DurationRole });
+        }
+    });
+
   setRootPath (QDir::homePath ());
 }
 
+bool
+FileSystemModel::is_audio_file (const QFileInfo &file_info) const
+{
+  return file_info.isFile ()
+         && mime_db_.mimeTypeForFile (file_info, QMimeDatabase::MatchExtension)
+              .name ()
+              .startsWith (u"audio/");
+}
+
+QString
+FileSystemModel::browsed_directory () const
+{
+  return root_index_.isValid () ? filePath (root_index_) : rootPath ();
+}
+
+void
+FileSystemModel::on_browsed_directory_changed ()
+{
+  // Files of directories the user left are no longer worth decoding
+  thumbnail_scanner_->cancel_pending ();
+
+  // Scanned right away if already loaded, or once directoryLoaded is emitted
+  const auto browsed_index = index (browsed_directory ());
+  if (canFetchMore (browsed_index))
+    fetchMore (browsed_index);
+  scan_directory (browsed_directory ());
+}
+
+void
+FileSystemModel::scan_directory (const QString &path)
+{
+  // Subdirectories and parents get loaded too, but only the browsed directory
+  // is shown
+  if (QDir (path) != QDir (browsed_directory ()))
+    return;
+
+  const auto  parent_index = index (path);
+  QStringList audio_files;
+  for (int row = 0; row < rowCount (parent_index); ++row)
+    {
+      const auto file_info = fileInfo (index (row, 0, parent_index));
+      if (is_audio_file (file_info))
+        audio_files.append (file_info.absoluteFilePath ());
+    }
+  thumbnail_scanner_->scan_files (audio_files);
+}
+
 void
 FileSystemModel::setRootIndex (const QModelIndex &index)
 {
@@ -22,6 +102,7 @@ FileSystemModel::setRootIndex (const QModelIndex &index)
     return;
 
   root_index_ = index;
+  on_browsed_directory_changed ();
   Q_EMIT rootIndexChanged ();
 }
 
@@ -72,6 +153,20 @@ FileSystemModel::data (const QModelIndex &index, int role) const
 {
   switch (role)
     {
+    case WaveformPeaksRole:
+    case DurationRole:
+      {
+        const auto * thumbnail =
+          thumbnail_scanner_->thumbnail (filePath (index));
+        if (thumbnail == nullptr)
+          return role == DurationRole ? QVariant (-1.0) : QVariant ();
+        if (role == DurationRole)
+          return thumbnail->duration_seconds ();
+
+        const auto peaks = thumbnail->mixed_peaks ();
+        return QVariant::fromValue (
+          QList<float> (peaks.begin (), peaks.end ()));
+      }
     default:
       return QFileSystemModel::data (index, role);
     }
@@ -81,6 +176,8 @@ QHash<int, QByteArray>
 FileSystemModel::roleNames () const
 {
   auto result = QFileSystemModel::roleNames ();
+  result.insert (WaveformPeaksRole, "waveformPeaks");
+  result.insert (DurationRole, "duration");
   return result;
 }
 }
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include "gui/backend/waveform_thumbnail_scanner.h"
+#include "utils/qt.h"
+
 #include <QFileSystemModel>
 #include <QMimeDatabase>
 #include <QMimeType>
@@ -21,9 +24,23 @@ class FileSystemModel : public QFileSystemModel
 public:
   explicit FileSystemModel (QObject * parent = nullptr);
 
+  /**
+   * @param thumbnail_cache Cache to keep the waveform thumbnails in.
+   */
+  FileSystemModel (
+    std::shared_ptr<utils::audio::WaveformThumbnailCache> thumbnail_cache,
+    QObject *                                             parent = nullptr);
+
   enum Roles
   {
-    FileSizeRole = Qt::UserRole + 1
+    FileSizeRole = Qt::UserRole + 1,
+
+    /** Combined peaks of all channels (list of floats in [0, 1]) for audio
+       files, computed in the background. */
+    WaveformPeaksRole,
+
+    /** Duration in seconds for audio files, or -1 if not known yet. */
+    DurationRole,
   };
 
   Q_INVOKABLE static bool isDir (const QFileInfo * fileInfo)
@@ -42,8 +59,25 @@ public:
   QVariant data (const QModelIndex &index, int role) const override;
   QHash<int, QByteArray> roleNames () const override;
 
+private:
+  bool is_audio_file (const QFileInfo &file_info) const;
+
+  /** The root index's directory, or the root path if no root index is set. */
+  QString browsed_directory () const;
+
+  /** Drops queued thumbnails and queues the new directory's files. */
+  void on_browsed_directory_changed ();
+
+  /**
+   * Queues the audio files directly inside @p path for thumbnailing, if it is
+   * the browsed directory.
+   */
+  void scan_directory (const QString &path);
+
 private:
   QModelIndex         root_index_;
   const QMimeDatabase mime_db_;
+
+  utils::QObjectUniquePtr<WaveformThumbnailScanner> thumbnail_scanner_;
 };
 }
@@ -4,11 +4,12 @@
 #include "zrythm-config.h"
 
 #include "dsp/graph_pruner.h"
+#include "dsp/export_pipeline.h"
 #include "dsp/graph_renderer.h"
 #include "gui/backend/project_exporter.h"
 #include "structure/project/project.h"
 #include "structure/project/project_graph_builder.h"
-#include "utils/audio_file_writer.h"
+#include "utils/exceptions.h"
 
 #include <QQmlEngine>
 #include <QtConcurrentRun>
@@ -20,11 +21,77 @@ gui::qquick::QFutureQmlWrapper *
 ProjectExporter::exportAudio (
   structure::project::Project * project,
   const QString                &exportDirectory,
-  const QString                &projectTitle)
+  const QString                &projectTitle,
+  const QStringList            &formats,
+  int                           bitDepth,
+  bool                          dither,
+  int                           sampleRate)
 {
+  const auto exports_path =
+    utils::Utf8String::from_qstring (exportDirectory).to_path ();
+  const auto title = utils::Utf8String::from_qstring (projectTitle);
+
+  std::unordered_map<juce::String, juce::String> metadata;
+  metadata.emplace (juce::String ("title"), title.to_juce_string ());
+  metadata.emplace (juce::String ("software"), juce::String (PROGRAM_NAME));
+
+  // One output per requested format, all fed from a single render
+  std::vector<dsp::ExportPipeline::OutputOptions> outputs;
+  QStringList                                     paths;
+  for (const auto &format : formats)
+    {
+      const auto extension = format.toLower ();
+      const bool lossy = extension == u"ogg";
+      auto       bit_depth = utils::audio::bit_depth_int_to_enum (bitDepth);
+      // FLAC doesn't support 32-bit
+      if (
+        extension == u"flac"
+        && bit_depth == utils::audio::BitDepth::BIT_DEPTH_32)
+        bit_depth = utils::audio::BitDepth::BIT_DEPTH_24;
+
+      const auto file_name =
+        title + u8"- Mixdown." + utils::Utf8String::from_qstring (extension);
+      dsp::ExportPipeline::OutputOptions output{
+        .path_ = exports_path / file_name.to_path (),
+        .sample_rate_ =
+          sampleRate > 0
+            ? std::make_optional (units::sample_rate (sampleRate))
+            : std::nullopt,
+        .bit_depth_ = bit_depth,
+        .dither_ = dither && !lossy,
+        .metadata_ = metadata,
+      };
+      paths.append (utils::Utf8String::from_path (output.path_).to_qstring ());
+      outputs.push_back (std::move (output));
+    }
+
+  std::shared_ptr<dsp::ExportPipeline> pipeline;
+  try
+    {
+      pipeline = std::make_shared<dsp::ExportPipeline> (
+        project->engine ()->sample_rate (), 2, std::move (outputs));
+    }
+  catch (const std::exception &e)
+    {
+      z_warning ("Failed to set up audio export: {}", e.what ());
+      auto * failed_wrapper = new gui::qquick::QFutureQmlWrapperT (
+        QtFuture::makeExceptionalFuture<QStringList> (
+          std::current_exception ()));
+      QQmlEngine::setObjectOwnership (
+        failed_wrapper, QQmlEngine::JavaScriptOwnership);
+      return failed_wrapper;
+    }
+
+  auto loudness_analyzer = std::make_shared<dsp::LoudnessAnalyzer> (
+    project->engine ()->sample_rate (), 2);
   dsp::GraphRenderer::RenderOptions options{
     .sample_rate_ = project->engine ()->sample_rate (),
-    .block_length_ = project->engine ()->block_length ()
+    .block_length_ = project->engine ()->block_length (),
+    .loudness_analyzer_ = loudness_analyzer,
+    .block_sink_ =
+      [pipeline] (const juce::AudioSampleBuffer &block, int num_frames) {
+        return pipeline->push (block, num_frames);
+      },
   };
   dsp::AudioEngine::EngineState state{};
   project->engine ()->wait_for_pause (state, false, true);
@@ -60,110 +127,92 @@ ProjectExporter::exportAudio (
         marker_track->get_end_marker ()->position ()->asTick ())),
     project->tempo_map ());
 
-  auto combined_future =
-    QtConcurrent::run (
-      [title = projectTitle, sample_rate = project->engine ()->sampleRate (),
-       exports_path =
-         utils::Utf8String::from_qstring (exportDirectory).to_path ()] (
-        QPromise<QStringList>           &promise,
-        QFuture<juce::AudioSampleBuffer> inner_graph_render_future) {
-        // Wait for task to establish its progress min/max
-        while (inner_graph_render_future.progressMaximum () <= 0)
-          {
-            std::this_thread::sleep_for (1ms);
-          }
-
-        const auto render_task_progress_range = std::make_pair (
-          inner_graph_render_future.progressMinimum (),
-          inner_graph_render_future.progressMaximum ());
-        const auto write_to_file_task_additional_progress = static_cast<int> (
-          (render_task_progress_range.second - render_task_progress_range.first)
-          * 0.1);
-        promise.setProgressRange (
-          inner_graph_render_future.progressMinimum (),
-          inner_graph_render_future.progressMaximum ()
-            + write_to_file_task_additional_progress);
-        while (!inner_graph_render_future.isFinished ())
-          {
-            std::this_thread::sleep_for (5ms);
-            promise.setProgressValueAndText (
-              inner_graph_render_future.progressValue (),
-              inner_graph_render_future.progressText ());
-            if (promise.isCanceled ())
-              {
-                inner_graph_render_future.cancel ();
-              }
-          }
-
-        if (
-          inner_graph_render_future.isValid ()
-          && inner_graph_render_future.isResultReadyAt (0))
-          {
-            std::unordered_map<juce::String, juce::String> metadata;
-            metadata.emplace (
-              juce::String ("title"),
-              utils::Utf8String::from_qstring (title).to_juce_string ());
-            metadata.emplace (
-              juce::String ("software"), juce::String (PROGRAM_NAME));
-
-            juce::AudioFormatWriterOptions juce_writer_options;
-            juce_writer_options =
-              juce_writer_options.withSampleRate (sample_rate)
-                .withNumChannels (2)
-                .withBitsPerSample (
-                  utils::audio::bit_depth_enum_to_int (
-                    zrythm::utils::audio::BitDepth::BIT_DEPTH_16))
-                .withMetadataValues (metadata)
-                .withQualityOptionIndex (0);
-            utils::AudioFileWriter::WriteOptions write_options{
-              .writer_options_ = juce_writer_options,
-              .block_length_ = units::samples (4096)
-            };
-            const auto path =
-              exports_path
-              / (utils::Utf8String::from_qstring (title) + u8"- Mixdown.wav")
-                  .to_path ();
-            auto file_write_future = utils::AudioFileWriter::write_async (
-              write_options, path, inner_graph_render_future.takeResult ());
-
-            // Wait for task to establish its progress min/max
-            while (file_write_future.progressMaximum () <= 0)
-              {
-                std::this_thread::sleep_for (1ms);
-              }
-
-            const auto file_write_progress_range = std::make_pair (
-              file_write_future.progressMinimum (),
-              file_write_future.progressMaximum ());
-            while (!file_write_future.isFinished ())
-              {
-                std::this_thread::sleep_for (5ms);
-                const auto progress_in_file_write =
-                  file_write_future.progressValue ();
-                const auto current_progress_ratio_in_file_write =
-                  static_cast<double>(progress_in_file_write - file_write_progress_range.first) / (file_write_progress_range.second - file_write_progress_range.first);
-                promise.setProgressValueAndText (
-                  render_task_progress_range.second
-                    + static_cast<int> (
-                      write_to_file_task_additional_progress
-                      * current_progress_ratio_in_file_write),
-                  file_write_future.progressText ());
-                if (promise.isCanceled ())
-                  {
-                    file_write_future.cancel ();
-                    return;
-                  }
-              }
-            promise.addResult (
-              QStringList{ utils::Utf8String::from_path (path).to_qstring () });
-          }
-        else
-          {
-            z_debug ("cancelled or failed");
-            promise.future ().cancel ();
-          }
-      },
-      graph_render_future);
+  auto combined_future = QtConcurrent::run (
+    [loudness_analyzer, pipeline, paths] (
+      QPromise<QStringList>           &promise,
+      QFuture<juce::AudioSampleBuffer> inner_graph_render_future) {
+      // Wait for task to establish its progress min/max
+      while (inner_graph_render_future.progressMaximum () <= 0)
+        {
+          std::this_thread::sleep_for (1ms);
+        }
+
+      // Resampling, dithering and encoding run alongside the render, so the
+      // render progress is the export progress
+      promise.setProgressRange (
+        inner_graph_render_future.progressMinimum (),
+        inner_graph_render_future.progressMaximum ());
+      while (!inner_graph_render_future.isFinished ())
+        {
+          std::this_thread::sleep_for (5ms);
+          promise.setProgressValueAndText (
+            inner_graph_render_future.progressValue (),
+            inner_graph_render_future.progressText ());
+          if (promise.isCanceled ())
+            {
+              inner_graph_render_future.cancel ();
+            }
+        }
+
+      if (promise.isCanceled ())
+        {
+          z_debug ("cancelled");
+          pipeline->cancel ();
+          promise.future ().cancel ();
+          return;
+        }
+
+      // A failing stage (e.g., disk full) stops the render early, so report
+      // its error rather than the incomplete render
+      if (auto error = pipeline->error ())
+        {
+          pipeline->cancel ();
+          promise.setException (error);
+          return;
+        }
+
+      if (
+        !inner_graph_render_future.isValid ()
+        || !inner_graph_render_future.isResultReadyAt (0))
+        {
+          pipeline->cancel ();
+          try
+            {
+              // Rethrows the render's exception, if any
+              inner_graph_render_future.waitForFinished ();
+              throw utils::exceptions::ZrythmException ("Rendering failed");
+            }
+          catch (...)
+            {
+              promise.setException (std::current_exception ());
+            }
+          return;
+        }
+
+      // Wait for the stages to drain the blocks still queued
+      promise.setProgressValueAndText (
+        inner_graph_render_future.progressMaximum (),
+        QObject::tr ("Writing audio files..."));
+      try
+        {
+          pipeline->finish ();
+        }
+      catch (...)
+        {
+          promise.setException (std::current_exception ());
+          return;
+        }
+
+      const auto loudness = loudness_analyzer->finish ();
+      z_info (
+        "Exported {}: integrated {:.1f} LUFS, range {:.1f} LU, "
+        "true peak {:.1f} dBTP",
+        paths, loudness.integrated_lufs, loudness.loudness_range_lu,
+        loudness.true_peak_dbtp ());
+
+      promise.addResult (paths);
+    },
+    graph_render_future);
 
   const auto resume_engine = [engine = project->engine (), state] () {
     // FIXME: this is needed because node caches are not per-graph and
@@ -17,8 +17,22 @@ class ProjectExporter : public QObject
   QML_SINGLETON
 
 public:
+  /**
+   * @brief Renders the project once and writes it in each of @p formats.
+   *
+   * @param formats File extensions (wav, flac, ogg, aiff).
+   * @param bitDepth 8, 16, 24 or 32 (FLAC is capped at 24).
+   * @param dither Whether to dither when quantizing (ignored for OGG).
+   * @param sampleRate Output sample rate, or 0 to use the engine's.
+   *
+   * The future's result is the list of written files.
+   */
   Q_INVOKABLE static zrythm::gui::qquick::QFutureQmlWrapper * exportAudio (
     zrythm::structure::project::Project * project,
     const QString                        &exportDirectory,
-    const QString                        &projectTitle);
+    const QString                        &projectTitle,
+    const QStringList                    &formats = { QStringLiteral ("wav") },
+    int                                   bitDepth = 16,
+    bool                                  dither = true,
+    int                                   sampleRate = 0);
 };
@@ -31,6 +31,17 @@ ProjectManager::ProjectManager (
 {
   z_debug ("Initializing project manager...");
   init_templates ();
+
+  try
+    {
+      decoded_audio_cache_ = std::make_shared<utils::audio::DecodedAudioCache> (
+        utils::audio::DecodedAudioCache::default_dir (),
+        utils::audio::DecodedAudioCache::DEFAULT_MAX_SIZE_BYTES);
+    }
+  catch (const ZrythmException &e)
+    {
+      z_warning ("Decoded audio cache unavailable: {}", e.what ());
+    }
 }
 
 void
@@ -184,6 +195,7 @@ ProjectManager::create_default (
           },
           *zapp->controlRoom ()->metronome (),
           *zapp->controlRoom ()->monitorFader ());
+        prj->pool_->set_decoded_audio_cache (decoded_audio_cache_);
         project_session = utils::make_qobject_unique<ProjectSession> (
           app_settings_, std::move (prj));
       }
@@ -362,6 +374,7 @@ ProjectManager::loadProject (const QString &filepath)
                 },
                 *zapp->controlRoom ()->metronome (),
                 *zapp->controlRoom ()->monitorFader ());
+              prj->pool_->set_decoded_audio_cache (decoded_audio_cache_);
 
               promise.setProgressValueAndText (
                 kStage2End, tr ("Deserializing project data..."));
@@ -6,6 +6,7 @@
 #include "gui/backend/project_session.h"
 #include "gui/backend/recent_projects_model.h"
 #include "gui/qquick/qfuture_qml_wrapper.h"
+#include "utils/decoded_audio_cache.h"
 
 #include <QFutureWatcher>
 #include <QtQmlIntegration/qqmlintegration.h>
@@ -140,6 +141,14 @@ private:
    * This is used to notify the UI when the project is loaded.
    */
   QFutureWatcher<ProjectLoadResult> project_watcher_;
+
+  /**
+   * @brief Decoded audio shared by all projects, so that reopening a project
+   * maps its pool clips instead of decoding them again.
+   *
+   * Null if the cache directory could not be created.
+   */
+  std::shared_ptr<utils::audio::DecodedAudioCache> decoded_audio_cache_;
 };
 
 } /// namespace zrythm::gui
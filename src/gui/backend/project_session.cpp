@@ -81,6 +81,14 @@ ProjectSession::ProjectSession (
           *arranger_object_creator_,
           *track_creator_,
           this)),
+      audio_function_executor_ (
+        utils::make_qobject_unique<actions::AudioFunctionBatchExecutor> (
+          *undo_stack_,
+          *project_->arrangerObjectFactory (),
+          [pool = project_->pool_.get ()] (const dsp::FileAudioSource &source) {
+            pool->write_clip (&source, false, false);
+          },
+          this)),
       uuid_property_operator_ (
         utils::make_qobject_unique<actions::UuidPropertyOperator> (
           *undo_stack_,
@@ -90,7 +98,10 @@ ProjectSession::ProjectSession (
         utils::make_qobject_unique<controllers::TransportController> (
           *project_->transport_,
           *ui_state_->snapGridTimeline (),
-          this))
+          this)),
+      track_freezer_ (
+        utils::make_qobject_unique<
+          controllers::TrackFreezer> (*project_, *undo_stack_, this))
 {
   project_->setParent (this);
 
@@ -118,6 +129,39 @@ ProjectSession::ProjectSession (
     &structure::project::ProjectUiState::midiInputDeviceChanged, this,
     recalc_graph);
 
+  // Tracks are only processed ahead of the playhead while nothing needs them
+  // live (see ProjectGraphBuilder::can_anticipate_track())
+  const auto recalc_anticipated_tracks = [this] () {
+    if (
+      app_settings_.anticipativeProcessing ()
+      && project_->engine ()->activated ())
+      {
+        project_->engine ()->graph_dispatcher ().recalc_graph (false);
+      }
+  };
+  QObject::connect (
+    project_->tracklist ()->collection (),
+    &structure::tracks::TrackCollection::trackRecordingArmedChanged, this,
+    recalc_anticipated_tracks);
+  QObject::connect (
+    project_->tracklist ()->collection (),
+    &structure::tracks::TrackCollection::trackMonitorModeChanged, this,
+    recalc_anticipated_tracks);
+  QObject::connect (
+    project_->clipLauncher ()->scenes (),
+    &structure::scenes::SceneList::clipsChanged, this,
+    recalc_anticipated_tracks);
+  QObject::connect (
+    generic_plugin_ui_controller_.get (),
+    &qquick::GenericPluginUiController::pluginUiVisibleChanged, this,
+    recalc_anticipated_tracks);
+  QObject::connect (
+    &app_settings_, &utils::AppSettings::anticipativeProcessingChanged, this,
+    [this] () {
+      if (project_->engine ()->activated ())
+        project_->engine ()->graph_dispatcher ().recalc_graph (false);
+    });
+
   wire_midi_input_selections_to_tracks ();
   wire_chord_track_to_pad_bank ();
 
@@ -475,6 +519,12 @@ ProjectSession::fileImporter () const
   return file_importer_.get ();
 }
 
+actions::AudioFunctionBatchExecutor *
+ProjectSession::audioFunctionExecutor () const
+{
+  return audio_function_executor_.get ();
+}
+
 actions::UuidPropertyOperator *
 ProjectSession::uuidPropertyOperator () const
 {
@@ -487,6 +537,12 @@ ProjectSession::transportController () const
   return transport_controller_.get ();
 }
 
+controllers::TrackFreezer *
+ProjectSession::trackFreezer () const
+{
+  return track_freezer_.get ();
+}
+
 controllers::RecordingCoordinator *
 ProjectSession::recordingCoordinator () const
 {
@@ -5,6 +5,7 @@
 
 #include "actions/arranger_object_creator.h"
 #include "actions/arranger_object_selection_operator.h"
+#include "actions/audio_function_batch_executor.h"
 #include "actions/clip_operator.h"
 #include "actions/file_importer.h"
 #include "actions/plugin_importer.h"
@@ -13,6 +14,7 @@
 #include "actions/uuid_property_operator.h"
 #include "controllers/recording_coordinator.h"
 #include "controllers/recording_materializer.h"
+#include "controllers/track_freezer.h"
 #include "controllers/transport_controller.h"
 #include "gui/qquick/generic_plugin_ui_controller.h"
 #include "gui/qquick/qfuture_qml_wrapper.h"
@@ -70,12 +72,18 @@ class ProjectSession : public QObject
       READ genericPluginUiController CONSTANT FINAL)
   Q_PROPERTY (
     zrythm::actions::FileImporter * fileImporter READ fileImporter CONSTANT FINAL)
+  Q_PROPERTY (
+    zrythm::actions::AudioFunctionBatchExecutor * audioFunctionExecutor READ
+      audioFunctionExecutor CONSTANT FINAL)
   Q_PROPERTY (
     zrythm::actions::UuidPropertyOperator * uuidPropertyOperator READ
       uuidPropertyOperator CONSTANT FINAL)
   Q_PROPERTY (
     zrythm::controllers::TransportController * transportController READ
       transportController CONSTANT FINAL)
+  Q_PROPERTY (
+    zrythm::controllers::TrackFreezer * trackFreezer READ trackFreezer
+      CONSTANT FINAL)
   Q_PROPERTY (
     QString projectDirectory READ projectDirectory WRITE setProjectDirectory
       NOTIFY projectDirectoryChanged FINAL)
@@ -103,8 +111,10 @@ public:
   actions::PluginOperator *                pluginOperator () const;
   qquick::GenericPluginUiController *      genericPluginUiController () const;
   actions::FileImporter *                  fileImporter () const;
+  actions::AudioFunctionBatchExecutor *    audioFunctionExecutor () const;
   actions::UuidPropertyOperator *          uuidPropertyOperator () const;
   controllers::TransportController *       transportController () const;
+  controllers::TrackFreezer *              trackFreezer () const;
   controllers::RecordingCoordinator *      recordingCoordinator () const;
 
   Q_INVOKABLE actions::ArrangerObjectSelectionOperator *
@@ -186,8 +196,11 @@ private:
   utils::QObjectUniquePtr<actions::PluginImporter> plugin_importer_;
   utils::QObjectUniquePtr<actions::PluginOperator> plugin_operator_;
   utils::QObjectUniquePtr<actions::FileImporter>   file_importer_;
+  utils::QObjectUniquePtr<actions::AudioFunctionBatchExecutor>
+    audio_function_executor_;
   utils::QObjectUniquePtr<actions::UuidPropertyOperator> uuid_property_operator_;
   utils::QObjectUniquePtr<controllers::TransportController> transport_controller_;
+  utils::QObjectUniquePtr<controllers::TrackFreezer>        track_freezer_;
   utils::QObjectUniquePtr<controllers::RecordingCoordinator>
     recording_coordinator_;
   utils::QObjectUniquePtr<controllers::RecordingMaterializer>
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include "utils/format_qt.h"
+
+#include "gui/backend/waveform_thumbnail_scanner.h"
+#include "utils/exceptions.h"
+#include "utils/logger.h"
+#include "utils/utf8_string.h"
+
+#include <QPointer>
+#include <QtConcurrentRun>
+
+namespace zrythm::gui
+{
+
+WaveformThumbnailScanner::WaveformThumbnailScanner (
+  std::shared_ptr<utils::audio::WaveformThumbnailCache> cache,
+  QObject *                                             parent)
+    : QObject (parent), cache_ (std::move (cache)),
+      generation_ (std::make_shared<std::atomic<uint64_t>> (0))
+{
+  // One file at a time: decoding is I/O bound and the results are only
+  // cosmetic
+  pool_.setMaxThreadCount (1);
+  pool_.setThreadPriority (QThread::LowestPriority);
+}
+
+WaveformThumbnailScanner::~WaveformThumbnailScanner ()
+{
+  cancel_pending ();
+  pool_.waitForDone ();
+}
+
+const utils::audio::WaveformThumbnail *
+WaveformThumbnailScanner::thumbnail (const QString &path) const
+{
+  const auto it = thumbnails_.constFind (path);
+  return it != thumbnails_.cend () ? &it.value () : nullptr;
+}
+
+void
+WaveformThumbnailScanner::scan_files (const QStringList &paths)
+{
+  for (const auto &path : paths)
+    {
+      if (
+        thumbnails_.contains (path) || pending_.contains (path)
+        || failed_.contains (path))
+        continue;
+
+      pending_.insert (path);
+      QtConcurrent::run (
+        &pool_,
+        [cache = cache_, generation = generation_,
+         expected_generation = generation_->load (), path,
+         self = QPointer (this)] () {
+          if (generation->load () != expected_generation)
+            return;
+
+          std::optional<WaveformThumbnail> thumbnail;
+          try
+            {
+              thumbnail = cache->get_or_create (
+                utils::Utf8String::from_qstring (path).to_path ());
+            }
+          catch (const utils::exceptions::ZrythmException &e)
+            {
+              z_debug ("No waveform thumbnail for {}: {}", path, e.what ());
+            }
+          QMetaObject::invokeMethod (
+            self,
+            [self, path, thumbnail = std::move (thumbnail)] () mutable {
+              if (self)
+                self->on_thumbnail_computed (path, std::move (thumbnail));
+            },
+            Qt::QueuedConnection);
+        });
+    }
+}
+
+void
+WaveformThumbnailScanner::cancel_pending ()
+{
+  generation_->fetch_add (1);
+  pool_.clear ();
+  pending_.clear ();
+}
+
+void
+WaveformThumbnailScanner::on_thumbnail_computed (
+  const QString                   &path,
+  std::optional<WaveformThumbnail> thumbnail)
+{
+  pending_.remove (path);
+  if (!thumbnail)
+    {
+      failed_.insert (path);
+      return;
+    }
+
+  thumbnails_.insert (path, std::move (*thumbnail));
+  Q_EMIT thumbnailReady (path);
+}
+
+} // namespace zrythm::gui
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+
+#include "utils/waveform_thumbnail_cache.h"
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QThreadPool>
+
+namespace zrythm::gui
+{
+
+/**
+ * @brief Computes waveform thumbnails of audio files in the background.
+ *
+ * Files are processed one at a time on a lowest-priority thread so that
+ * scanning large sample libraries doesn't compete with the UI or the audio
+ * engine. Results are kept in memory and persisted in a
+ * utils::audio::WaveformThumbnailCache, so files that were scanned before
+ * (or have identical contents) are only decoded once.
+ */
+class WaveformThumbnailScanner : public QObject
+{
+  Q_OBJECT
+
+public:
+  using WaveformThumbnail = utils::audio::WaveformThumbnail;
+
+  explicit WaveformThumbnailScanner (
+    std::shared_ptr<utils::audio::WaveformThumbnailCache> cache,
+    QObject *                                             parent = nullptr);
+  ~WaveformThumbnailScanner () override;
+
+  /**
+   * @brief Returns the thumbnail of @p path if it was already computed.
+   */
+  const WaveformThumbnail * thumbnail (const QString &path) const;
+
+  /**
+   * @brief Queues computing the thumbnails of @p paths.
+   *
+   * Files that are already computed or queued are skipped.
+   */
+  void scan_files (const QStringList &paths);
+
+  /**
+   * @brief Drops all queued (but not yet started) files.
+   */
+  void cancel_pending ();
+
+  Q_SIGNAL void thumbnailReady (const QString &path);
+
+private:
+  void on_thumbnail_computed (
+    const QString                   &path,
+    std::optional<WaveformThumbnail> thumbnail);
+
+private:
+  std::shared_ptr<utils::audio::WaveformThumbnailCache> cache_;
+  QThreadPool                                           pool_;
+
+  /** Thumbnails computed so far. */
+  QHash<QString, WaveformThumbnail> thumbnails_;
+
+  /** Files queued or being processed. */
+  QSet<QString> pending_;
+
+  /** Files that could not be decoded, to avoid retrying them. */
+  QSet<QString> failed_;
+
+  /** Incremented to make queued jobs return early. */
+  std::shared_ptr<std::atomic<uint64_t>> generation_;
+};
+
+} // namespace zrythm::gui
@@ -6,6 +6,7 @@
 #include "utils/format_qt.h"
 #include <fmt/std.h>
 
+#include "dsp/freewheel_hardware_audio_interface.h"
 #include "dsp/juce_hardware_audio_interface.h"
 #include "engine/session/midi_mapping.h"
 #include "gui/backend/plugin_protocol_paths.h"
@@ -89,8 +90,12 @@ public:
 
   std::unique_ptr<dsp::IHardwareAudioInterface> hw_audio_interface_;
 
+  /** MIDI CC bindings for the active project. */
   std::unique_ptr<engine::session::MidiMappings> midi_mappings_;
 
+  /** Applies the values received by @ref midi_mappings_ on the main thread. */
+  utils::QObjectUniquePtr<QTimer> midi_mappings_flush_timer_;
+
   /** DSP context (disables denormals) for the main thread. */
   std::unique_ptr<DspContextRAII> dsp_context_;
 };
@@ -209,6 +214,8 @@ ZrythmApplication::ZrythmApplication (int &argc, char ** argv)
 
   setup_control_room ();
 
+  setup_midi_mappings ();
+
   setup_ui ();
 
   constexpr const char * copyright_line =
@@ -340,6 +347,45 @@ ZrythmApplication::setup_control_room ()
   }
 }
 
+void
+ZrythmApplication::setup_midi_mappings ()
+{
+  impl_->midi_mappings_flush_timer_ = utils::make_qobject_unique<QTimer> (this);
+  QObject::connect (
+    impl_->midi_mappings_flush_timer_.get (), &QTimer::timeout, this,
+    [this] () {
+      if (impl_->midi_mappings_)
+        impl_->midi_mappings_->flush_pending ();
+    });
+  impl_->midi_mappings_flush_timer_->start (20);
+
+  // The previous session (and its engine) is already gone when this fires, so
+  // the old mappings can be dropped without stopping the audio thread
+  QObject::connect (
+    impl_->project_manager_.get (), &ProjectManager::activeSessionChanged, this,
+    [this] (ProjectSession * session) {
+      impl_->midi_mappings_.reset ();
+      if (session == nullptr)
+        return;
+
+      auto * project = session->project ();
+      impl_->midi_mappings_ = std::make_unique<engine::session::MidiMappings> (
+        project->get_registry ());
+
+      // The engine calls this on the audio thread only, one device at a time,
+      // so apply_from_cc_events() never runs concurrently (apply() must not
+      // be called while the engine is running). The mappings outlive the
+      // engine, which is deactivated when the session is replaced or
+      // destroyed.
+      project->engine ()->set_midi_input_observer (
+        [mappings = impl_->midi_mappings_.get ()] (
+          const utils::Utf8String    &device_id,
+          const dsp::MidiEventBuffer &events) {
+          mappings->apply_from_cc_events (events, &device_id);
+        });
+    });
+}
+
 void
 ZrythmApplication::setup_device_manager ()
 {
@@ -376,11 +422,21 @@ ZrythmApplication::setup_device_manager ()
           z_warning ("Failed to write device setup file: {}", filepath);
         }
     });
-  impl_->device_manager_->initialize (2, 2, true);
 
   // Create hardware audio interface wrapper
-  impl_->hw_audio_interface_ =
-    dsp::JuceHardwareAudioInterface::create (impl_->device_manager_);
+  if (cmd_line_parser_.isSet (u"dummy"_s))
+    {
+      // No audio device is opened in this mode
+      z_info ("Using dummy audio interface");
+      impl_->hw_audio_interface_ =
+        dsp::FreewheelHardwareAudioInterface::create ();
+    }
+  else
+    {
+      impl_->device_manager_->initialize (2, 2, true);
+      impl_->hw_audio_interface_ =
+        dsp::JuceHardwareAudioInterface::create (impl_->device_manager_);
+    }
 }
 
 void
@@ -684,6 +740,7 @@ ZrythmApplication::~ZrythmApplication ()
   // Delete the project manager first to release project resources (engine,
   // tracks, etc.) before tearing down infrastructure.
   impl_->project_manager_.reset ();
+  impl_->midi_mappings_.reset ();
 
   if (impl_->socket_)
     {
@@ -97,6 +97,7 @@ private:
   void post_exec_initialization ();
   void setup_device_manager ();
   void setup_control_room ();
+  void setup_midi_mappings ();
 
 protected:
   bool notify (QObject * receiver, QEvent * event) override;
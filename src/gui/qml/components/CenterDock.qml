@@ -103,6 +103,7 @@ ColumnLayout {
           pinned: true
           portObservationManager: root.project.portObservationManager
           trackCollectionOperator: trackCollectionOperator
+          trackFreezer: root.session.trackFreezer
           trackSelectionModel: root.trackSelectionModel
           tracklist: root.project.tracklist
           undoStack: root.session.undoStack
@@ -117,6 +118,7 @@ ColumnLayout {
           pinned: false
           portObservationManager: root.project.portObservationManager
           trackCollectionOperator: trackCollectionOperator
+          trackFreezer: root.session.trackFreezer
           trackSelectionModel: root.trackSelectionModel
           tracklist: root.project.tracklist
           undoStack: root.session.undoStack
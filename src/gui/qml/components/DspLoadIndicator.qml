@@ -13,6 +13,7 @@ Control {
   property double loadValue: 0.0
   readonly property color lowLoadColor: palette.text //"#4CAF50"
   readonly property color mediumLoadColor: "#FF9800"
+  property int threads: 0
   property int xRuns: 0
 
   function getLoadColor(load) {
@@ -23,7 +24,7 @@ Control {
   implicitWidth: 8
 
   ToolTip {
-    text: qsTr("DSP Load: %1%\nXRun Count: %2").arg(Math.round(root.loadValue)).arg(root.xRuns)
+    text: qsTr("DSP Load: %1%\nXRun Count: %2\nDSP Threads: %3\nClick to open the DSP profiler").arg(Math.round(root.loadValue)).arg(root.xRuns).arg(root.threads)
   }
 
   // Vertical progress bar
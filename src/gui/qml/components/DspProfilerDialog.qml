@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+pragma ComponentBehavior: Bound
+
+import QtQuick
+import QtQuick.Controls
+import QtQuick.Dialogs
+import QtQuick.Layouts
+import Zrythm
+import ZrythmStyle
+
+Dialog {
+  id: root
+
+  required property AudioEngine engine
+
+  readonly property list<var> columns: [
+    {
+      "title": qsTr("Node"),
+      "role": DspProfilerModel.NodeNameRole,
+      "width": 220
+    },
+    {
+      "title": qsTr("Mean (µs)"),
+      "role": DspProfilerModel.MeanUsRole,
+      "width": 80
+    },
+    {
+      "title": qsTr("p99 (µs)"),
+      "role": DspProfilerModel.P99UsRole,
+      "width": 80
+    },
+    {
+      "title": qsTr("Max (µs)"),
+      "role": DspProfilerModel.MaxUsRole,
+      "width": 80
+    },
+    {
+      "title": qsTr("Thread"),
+      "role": DspProfilerModel.ThreadIdRole,
+      "width": 90
+    },
+    {
+      "title": qsTr("Critical"),
+      "role": DspProfilerModel.CriticalPathRole,
+      "width": 60
+    }
+  ]
+
+  modal: false
+  popupType: Popup.Window
+  standardButtons: Dialog.Close
+  title: qsTr("DSP Profiler")
+
+  contentItem: ColumnLayout {
+    spacing: ZrythmTheme.buttonPadding
+
+    RowLayout {
+      Layout.fillWidth: true
+
+      Repeater {
+        model: root.columns
+
+        ToolButton {
+          required property var modelData
+
+          Layout.preferredWidth: modelData.width
+          checked: profilerModel.sortRole === modelData.role
+          font.bold: true
+          text: modelData.title
+
+          onClicked: profilerModel.sortRole = modelData.role
+        }
+      }
+    }
+
+    ListView {
+      id: listView
+
+      Layout.fillWidth: true
+      Layout.preferredHeight: 360
+      boundsBehavior: Flickable.StopAtBounds
+      clip: true
+      model: profilerModel
+
+      ScrollBar.vertical: ScrollBar {
+      }
+      delegate: RowLayout {
+        id: row
+
+        required property double maxUs
+        required property double meanUs
+        required property string nodeName
+        required property bool onCriticalPath
+        required property double p99Us
+        required property int threadId
+        required property double threadShare
+
+        width: ListView.view.width
+
+        Label {
+          Layout.preferredWidth: root.columns[0].width
+          elide: Text.ElideRight
+          font.bold: row.onCriticalPath
+          text: row.nodeName
+        }
+
+        Label {
+          Layout.preferredWidth: root.columns[1].width
+          text: row.meanUs.toFixed(1)
+        }
+
+        Label {
+          Layout.preferredWidth: root.columns[2].width
+          text: row.p99Us.toFixed(1)
+        }
+
+        Label {
+          Layout.preferredWidth: root.columns[3].width
+          text: row.maxUs.toFixed(1)
+        }
+
+        Label {
+          Layout.preferredWidth: root.columns[4].width
+          text: (row.threadId < 0 ? qsTr("main") : row.threadId) + " (" + Math.round(row.threadShare * 100) + "%)"
+        }
+
+        Label {
+          Layout.preferredWidth: root.columns[5].width
+          text: row.onCriticalPath ? "●" : ""
+        }
+      }
+    }
+
+    RowLayout {
+      Layout.fillWidth: true
+
+      Label {
+        Layout.fillWidth: true
+        text: qsTr("Dropped timings: %1").arg(profilerModel.droppedCount)
+        visible: profilerModel.droppedCount > 0
+      }
+
+      Button {
+        text: qsTr("Reset")
+
+        onClicked: profilerModel.reset()
+      }
+
+      Button {
+        text: qsTr("Save JSON…")
+
+        onClicked: saveDialog.open()
+      }
+    }
+  }
+
+  DspProfilerModel {
+    id: profilerModel
+
+    active: root.visible
+    engine: root.engine
+  }
+
+  FileDialog {
+    id: saveDialog
+
+    defaultSuffix: "json"
+    fileMode: FileDialog.SaveFile
+    nameFilters: [qsTr("JSON files (*.json)")]
+
+    onAccepted: profilerModel.saveJson(selectedFile)
+  }
+}
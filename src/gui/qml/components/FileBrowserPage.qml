@@ -46,10 +46,12 @@ ColumnLayout {
       id: itemDelegate
 
       required property int column
+      required property real duration
       required property var fileInfo
       required property string fileName
       required property string filePath
       required property int index
+      required property var waveformPeaks
 
       Drag.active: false
       Drag.dragType: Drag.Automatic
@@ -70,6 +72,55 @@ ColumnLayout {
         }
       }
 
+      // Waveform preview and duration of audio files, once computed
+      RowLayout {
+        anchors.bottom: parent.bottom
+        anchors.right: parent.right
+        anchors.rightMargin: 4
+        anchors.top: parent.top
+        spacing: 4
+        visible: itemDelegate.duration >= 0
+
+        Canvas {
+          id: waveformCanvas
+
+          Layout.fillHeight: true
+          Layout.preferredWidth: 64
+
+          onPaint: {
+            const ctx = getContext("2d");
+            ctx.reset();
+            const peaks = itemDelegate.waveformPeaks;
+            if (!peaks || peaks.length === 0)
+              return;
+
+            ctx.fillStyle = itemDelegate.palette.text;
+            const mid = height / 2;
+            const barWidth = width / peaks.length;
+            for (let i = 0; i < peaks.length; ++i) {
+              const barHeight = Math.max(1, peaks[i] * height);
+              ctx.fillRect(i * barWidth, mid - barHeight / 2, Math.max(1, barWidth), barHeight);
+            }
+          }
+
+          Connections {
+            function onWaveformPeaksChanged() {
+              waveformCanvas.requestPaint();
+            }
+
+            target: itemDelegate
+          }
+        }
+
+        Label {
+          text: {
+            const total = Math.round(itemDelegate.duration);
+            const seconds = total % 60;
+            return Math.floor(total / 60) + ":" + (seconds < 10 ? "0" : "") + seconds;
+          }
+        }
+      }
+
       MouseArea {
         id: mouseArea
 
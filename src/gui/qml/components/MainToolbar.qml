@@ -55,7 +55,7 @@ ZrythmToolBar {
   rightItems: [
     SpectrumAnalyzer {
       Layout.preferredWidth: 60
-      fftSize: 512
+      fftSize: 8192
       portObservationManager: root.project.portObservationManager
       sampleRate: root.project.engine.sampleRate
       stereoPort: root.project.tracklist.singletonTracks.masterTrack.channel.audioOutPort
@@ -75,6 +75,10 @@ ZrythmToolBar {
     },
     DspLoadIndicator {
       id: dspLoadIndicator
+
+      TapHandler {
+        onTapped: dspProfilerDialog.open()
+      }
     },
     ToolSeparator {
     },
@@ -125,6 +129,12 @@ ZrythmToolBar {
     }
   ]
 
+  DspProfilerDialog {
+    id: dspProfilerDialog
+
+    engine: root.project.engine
+  }
+
   Timer {
     interval: 600
     repeat: true
@@ -133,6 +143,7 @@ ZrythmToolBar {
     onTriggered: {
       dspLoadIndicator.xRuns = root.project.engine.xRunCount();
       dspLoadIndicator.loadValue = root.project.engine.loadPercentage();
+      dspLoadIndicator.threads = root.project.engine.activeDspThreadCount();
     }
   }
 }
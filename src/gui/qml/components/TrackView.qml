@@ -8,6 +8,7 @@ import QtQuick.Controls
 import QtQuick.Controls.impl
 import QtQuick.Layouts
 import Zrythm
+import ZrythmControllers
 import ZrythmStyle
 
 Control {
@@ -30,6 +31,7 @@ Control {
   required property PortObservationManager portObservationManager
   required property Track track // connected automatically when used as a delegate for a Tracklist model
   required property TrackCollectionOperator trackCollectionOperator
+  required property TrackFreezer trackFreezer
   required property TrackSelectionModel trackSelectionModel
   required property Tracklist tracklist
   required property UndoStack undoStack
@@ -86,6 +88,18 @@ Control {
         root.trackCollectionOperator.deleteTracks(tracksToDelete);
       }
     }
+
+    MenuItem {
+      enabled: root.track.canFreeze
+      text: root.track.frozen ? qsTr("Unfreeze Track") : qsTr("Freeze Track")
+
+      onTriggered: {
+        if (root.track.frozen)
+          root.trackFreezer.unfreezeTrack(root.track);
+        else
+          root.trackFreezer.freezeTrack(root.track);
+      }
+    }
   }
   background: Rectangle {
     color: QmlUtils.getTrackBackground(root.palette.window, root.track.color, root.palette.windowText, selectionTracker.isSelected || bgTapHandler.pressed, root.hovered, false)
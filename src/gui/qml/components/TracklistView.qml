@@ -7,6 +7,7 @@ import QtQuick
 import QtQuick.Layouts
 import QtQml.Models
 import Zrythm
+import ZrythmControllers
 
 ListView {
   id: root
@@ -22,6 +23,7 @@ ListView {
   required property PortObservationManager portObservationManager
   required property bool pinned
   required property TrackCollectionOperator trackCollectionOperator
+  required property TrackFreezer trackFreezer
   required property TrackSelectionModel trackSelectionModel
   required property Tracklist tracklist
   required property UndoStack undoStack
@@ -45,6 +47,7 @@ ListView {
     listViewIsLast: index === ListView.view.count - 1
     portObservationManager: root.portObservationManager
     trackCollectionOperator: root.trackCollectionOperator
+    trackFreezer: root.trackFreezer
     trackSelectionModel: root.trackSelectionModel
     tracklist: root.tracklist
     undoStack: root.undoStack
@@ -252,7 +252,7 @@ Item {
   }
 
   function handleObjectSelection(sourceModel: var, index: int, mouse: var) {
-    const unifiedIndex = root.unifiedObjectsModel.mapFromSource(sourceModel.index(index, 0));
+    const unifiedIndex = root.unifiedObjectsModel.mapFromSource(root.objectListIndex(sourceModel, index));
 
     if (mouse.modifiers & Qt.ControlModifier) {
       // Defer toggle to release — on press, just ensure the object is
@@ -280,6 +280,13 @@ Item {
 
   // Centralized policy for which object types may be painted with Edit tool
   // Ctrl+drag (paintable = clips, notes/chords and automation points).
+  // Returns the index in the object list model for a row of an object
+  // repeater's model, which may be a viewport proxy over the list.
+  function objectListIndex(model: var, row: int): var {
+    const index = model.index(row, 0);
+    return model instanceof ArrangerObjectViewportProxyModel ? model.mapToSource(index) : index;
+  }
+
   function objectPaintingEnabledForType(objectType: int): bool {
     switch (objectType) {
     case ArrangerObject.MidiClip:
@@ -342,7 +349,7 @@ Item {
 
     // Select each found object
     hitChildren.forEach(arrangerObjectLoader => {
-      const sourceModelIndex = arrangerObjectLoader.model.index(arrangerObjectLoader.index, 0);
+      const sourceModelIndex = root.objectListIndex(arrangerObjectLoader.model, arrangerObjectLoader.index);
       const unifiedModelIndex = root.unifiedObjectsModel.mapFromSource(sourceModelIndex);
       arrangerObjectLoader.arrangerSelectionModel.select(unifiedModelIndex, ItemSelectionModel.Select);
     });
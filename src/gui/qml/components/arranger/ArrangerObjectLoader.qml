@@ -87,7 +87,11 @@ Loader {
   SelectionTracker {
     id: selectionTracker
 
-    modelIndexProvider: () => root.unifiedObjectsModel.mapFromSource(root.model.index(root.index, 0))
+    // The model may be a viewport proxy over the object list
+    modelIndexProvider: () => {
+      const index = root.model.index(root.index, 0);
+      return root.unifiedObjectsModel.mapFromSource(root.model instanceof ArrangerObjectViewportProxyModel ? root.model.mapToSource(index) : index);
+    }
     selectionModel: root.arrangerSelectionModel
   }
 }
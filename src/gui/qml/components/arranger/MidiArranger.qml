@@ -86,7 +86,16 @@ Arranger {
     id: midiNotesRepeater
 
     anchors.fill: parent
-    model: root.midiClip.midiNotes
+
+    // Only create delegates for notes in (or near) the visible area
+    model: ArrangerObjectViewportProxyModel {
+      keepAcceptedObjects: root.dragState.dragMode !== ArrangerDragState.DragMode.None
+      sourceModel: root.midiClip.midiNotes
+      viewportEndTicks: (root.scrollXPlusWidth + ZrythmTheme.scrollLoaderBufferPx) / root.ruler.pxPerTick
+      viewportMaxKey: 127 - (root.scrollY - ZrythmTheme.scrollLoaderBufferPx) / root.midiEditor.keyHeight
+      viewportMinKey: 127 - (root.scrollYPlusHeight + ZrythmTheme.scrollLoaderBufferPx) / root.midiEditor.keyHeight
+      viewportStartTicks: (root.scrollX - ZrythmTheme.scrollLoaderBufferPx) / root.ruler.pxPerTick
+    }
 
     delegate: ArrangerObjectLoader {
       id: midiNoteLoader
@@ -660,7 +660,9 @@ Arranger {
 
               required property TrackLane trackLane
 
-              model: trackDelegate.track.type === Track.Audio ? trackLane.audioClips : trackLane.midiClips
+              model: TimelineViewportProxyModel {
+                sourceModel: trackDelegate.track.type === Track.Audio ? mainTrackLaneClipsRepeater.trackLane.audioClips : mainTrackLaneClipsRepeater.trackLane.midiClips
+              }
 
               delegate: ArrangerObjectLoader {
                 id: mainTrackClipLoader
@@ -811,7 +813,9 @@ Arranger {
               id: automationClipsRepeater
 
               anchors.fill: parent
-              model: automationTrackItem.automationTrack.clips
+              model: TimelineViewportProxyModel {
+                sourceModel: automationTrackItem.automationTrack.clips
+              }
 
               delegate: ArrangerObjectLoader {
                 id: automationClipLoader
@@ -905,7 +909,7 @@ Arranger {
         dragMode: root.dragState.dragMode
         height: laneItem.trackLane.height
         isLoopResize: root.dragState.isLoopResize
-        model: arrangerObject.type === ArrangerObject.MidiClip ? laneItem.trackLane.midiClips : laneItem.trackLane.audioClips
+        model: arrangerObject.type === ArrangerObject.MidiClip ? laneMidiClipsRepeater.model : laneAudioClipsRepeater.model
         pxPerTick: root.ruler.pxPerTick
         scrollViewWidth: root.scrollViewWidth
         scrollX: root.scrollX
@@ -970,7 +974,10 @@ Arranger {
 
       anchors.fill: parent
       delegate: laneClipLoaderComponent
-      model: laneItem.trackLane.midiClips
+
+      model: TimelineViewportProxyModel {
+        sourceModel: laneItem.trackLane.midiClips
+      }
     }
 
     Repeater {
@@ -978,10 +985,21 @@ Arranger {
 
       anchors.fill: parent
       delegate: laneClipLoaderComponent
-      model: laneItem.trackLane.audioClips
+
+      model: TimelineViewportProxyModel {
+        sourceModel: laneItem.trackLane.audioClips
+      }
     }
   }
   component TrackRoleData: QtObject {
     required property Track track
   }
+
+  // Exposes only the clips in (or near) the visible time range. Tracks and
+  // lanes are already virtualized by their list views.
+  component TimelineViewportProxyModel: ArrangerObjectViewportProxyModel {
+    keepAcceptedObjects: root.dragState.dragMode !== ArrangerDragState.DragMode.None
+    viewportEndTicks: (root.scrollXPlusWidth + ZrythmTheme.scrollLoaderBufferPx) / root.ruler.pxPerTick
+    viewportStartTicks: (root.scrollX - ZrythmTheme.scrollLoaderBufferPx) / root.ruler.pxPerTick
+  }
 }
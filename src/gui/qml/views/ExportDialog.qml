@@ -25,7 +25,8 @@ Dialog {
     exportProgressDialog.resetValues();
     exportProgressDialog.open();
     root.exportFuture = ProjectExporter.exportAudio(root.project,
-    exportDirectory, session.title);
+    exportDirectory, session.title, audioFormatComboBox.currentValue,
+    parseInt(audioBitDepthComboBox.currentText), audioDitherSwitch.checked);
   }
 
   implicitHeight: 500
@@ -163,8 +164,30 @@ Dialog {
             title: qsTr("Format")
 
             ComboBox {
+              id: audioFormatComboBox
+
               Layout.fillWidth: true
-              model: ["WAV", "FLAC", "OGG Vorbis", "MP3"]
+              textRole: "text"
+              valueRole: "formats"
+
+              model: [
+                {
+                  text: "WAV",
+                  formats: ["wav"]
+                },
+                {
+                  text: "FLAC",
+                  formats: ["flac"]
+                },
+                {
+                  text: "OGG Vorbis",
+                  formats: ["ogg"]
+                },
+                {
+                  text: "WAV + FLAC",
+                  formats: ["wav", "flac"]
+                }
+              ]
             }
           }
 
@@ -173,6 +196,8 @@ Dialog {
             title: qsTr("Bit Depth")
 
             ComboBox {
+              id: audioBitDepthComboBox
+
               Layout.fillWidth: true
               model: ["16", "24", "32"]
             }
@@ -183,6 +208,8 @@ Dialog {
             title: qsTr("Dither")
 
             Switch {
+              id: audioDitherSwitch
+
               Layout.alignment: Qt.AlignRight
             }
           }
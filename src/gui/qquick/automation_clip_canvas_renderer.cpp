@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <ranges>
+#include <span>
 #include <unordered_set>
 #include <utility>
 
@@ -339,16 +341,24 @@ AutomationClipCanvasRenderer::paint (QCanvasPainter * painter)
         {
           // Curved segment — adaptive sampling of the source segment over its
           // t-subrange [seg_t_start, seg_t_max].
-          const int steps = std::clamp (static_cast<int> (seg_px * 0.5f), 4, 64);
+          constexpr int kMaxSteps = 64;
+          const int     steps =
+            std::clamp (static_cast<int> (seg_px * 0.5f), 4, kMaxSteps);
+          const double t_step =
+            (a.seg_t_max - a.seg_t_start) / static_cast<double> (steps);
+          std::array<float, kMaxSteps> vals{};
+          const auto                   vals_span =
+            std::span (vals).first (static_cast<size_t> (steps));
+          dsp::evaluate_curve_range (
+            a.seg_value_a, a.seg_value_b, a.curve_opts.algo_,
+            static_cast<float> (a.curve_opts.curviness_),
+            a.seg_t_start + t_step, t_step, vals_span);
           for (int s = 1; s <= steps; ++s)
             {
               const float f = static_cast<float> (s) / steps;
-              const float t = a.seg_t_start + f * (a.seg_t_max - a.seg_t_start);
-              const float val = dsp::evaluate_curve (
-                a.seg_value_a, a.seg_value_b, a.curve_opts.algo_,
-                static_cast<float> (a.curve_opts.curviness_), t);
               sample_xs.push_back (a.px + f * seg_px);
-              sample_ys.push_back (canvas_height_ * (1.0f - val));
+              sample_ys.push_back (
+                canvas_height_ * (1.0f - vals_span[static_cast<size_t> (s - 1)]));
             }
         }
 
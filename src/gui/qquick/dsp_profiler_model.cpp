@@ -0,0 +1,273 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+
+#include "gui/qquick/dsp_profiler_model.h"
+#include "utils/exceptions.h"
+#include "utils/io_utils.h"
+#include "utils/logger.h"
+
+#include <nlohmann/json.hpp>
+
+namespace zrythm::gui::qquick
+{
+
+DspProfilerModel::DspProfilerModel (QObject * parent)
+    : QAbstractListModel (parent)
+{
+  refresh_timer_.setInterval (kRefreshInterval);
+  QObject::connect (
+    &refresh_timer_, &QTimer::timeout, this, &DspProfilerModel::refresh);
+}
+
+DspProfilerModel::~DspProfilerModel ()
+{
+  update_profiler_enabled (false);
+}
+
+void
+DspProfilerModel::setEngine (dsp::AudioEngine * engine)
+{
+  if (engine_ == engine)
+    return;
+
+  update_profiler_enabled (false);
+  engine_ = engine;
+  update_profiler_enabled (active_);
+  Q_EMIT engineChanged ();
+}
+
+void
+DspProfilerModel::setActive (bool active)
+{
+  if (active_ == active)
+    return;
+
+  active_ = active;
+  update_profiler_enabled (active);
+  if (active)
+    {
+      refresh_timer_.start ();
+    }
+  else
+    {
+      refresh_timer_.stop ();
+    }
+  Q_EMIT activeChanged (active);
+}
+
+void
+DspProfilerModel::setSortRole (int role)
+{
+  if (sort_role_ == role)
+    return;
+
+  sort_role_ = role;
+  Q_EMIT sortRoleChanged ();
+
+  if (!rows_.empty ())
+    {
+      sort_rows ();
+      Q_EMIT dataChanged (index (0), index (rowCount () - 1));
+    }
+}
+
+QHash<int, QByteArray>
+DspProfilerModel::roleNames () const
+{
+  return {
+    { NodeNameRole,     "nodeName"       },
+    { NumRunsRole,      "numRuns"        },
+    { MeanUsRole,       "meanUs"         },
+    { P99UsRole,        "p99Us"          },
+    { MaxUsRole,        "maxUs"          },
+    { ThreadIdRole,     "threadId"       },
+    { ThreadShareRole,  "threadShare"    },
+    { CriticalPathRole, "onCriticalPath" },
+  };
+}
+
+int
+DspProfilerModel::rowCount (const QModelIndex &parent) const
+{
+  if (parent.isValid ())
+    return 0;
+  return static_cast<int> (rows_.size ());
+}
+
+QVariant
+DspProfilerModel::data (const QModelIndex &index, int role) const
+{
+  if (
+    !index.isValid () || index.row () < 0
+    || index.row () >= static_cast<int> (rows_.size ()))
+    return {};
+
+  const auto &row = rows_[index.row ()];
+  switch (role)
+    {
+    case NodeNameRole:
+      return row.name.to_qstring ();
+    case NumRunsRole:
+      return static_cast<int> (row.num_runs);
+    case MeanUsRole:
+      return row.mean_us;
+    case P99UsRole:
+      return row.p99_us;
+    case MaxUsRole:
+      return row.max_us;
+    case ThreadIdRole:
+      return row.thread_id;
+    case ThreadShareRole:
+      return row.thread_share;
+    case CriticalPathRole:
+      return row.on_critical_path;
+    }
+  return {};
+}
+
+void
+DspProfilerModel::refresh ()
+{
+  auto * prof = profiler ();
+  if (prof == nullptr)
+    {
+      if (!rows_.empty ())
+        {
+          beginResetModel ();
+          rows_.clear ();
+          endResetModel ();
+        }
+      return;
+    }
+
+  // The graph may have been created after activating
+  if (active_)
+    prof->set_enabled (true);
+
+  auto rows = prof->snapshot ();
+  dropped_count_ = prof->dropped_count ();
+  if (rows.size () == rows_.size ())
+    {
+      // Avoid resetting views when only the timings changed
+      rows_ = std::move (rows);
+      sort_rows ();
+      if (!rows_.empty ())
+        {
+          Q_EMIT dataChanged (index (0), index (rowCount () - 1));
+        }
+    }
+  else
+    {
+      beginResetModel ();
+      rows_ = std::move (rows);
+      sort_rows ();
+      endResetModel ();
+    }
+  Q_EMIT refreshed ();
+}
+
+void
+DspProfilerModel::reset ()
+{
+  if (auto * prof = profiler ())
+    {
+      prof->reset ();
+    }
+  refresh ();
+}
+
+bool
+DspProfilerModel::saveJson (const QUrl &file_url) const
+{
+  const auto path = utils::Utf8String::from_qurl (file_url).to_path ();
+  const auto json_str = to_json ().dump (2);
+  z_info ("Writing DSP profile to {}", path);
+  try
+    {
+      utils::io::set_file_contents (
+        path, utils::Utf8String::from_utf8_encoded_string (json_str));
+    }
+  catch (const utils::exceptions::ZrythmException &e)
+    {
+      z_warning ("Failed to write DSP profile: {}", e.what ());
+      return false;
+    }
+  return true;
+}
+
+void
+DspProfilerModel::set_profiler_provider (ProfilerProvider provider)
+{
+  update_profiler_enabled (false);
+  profiler_provider_ = std::move (provider);
+  update_profiler_enabled (active_);
+}
+
+nlohmann::json
+DspProfilerModel::to_json () const
+{
+  return nlohmann::json{
+    { "droppedCount", dropped_count_ },
+    { "nodes",        rows_          },
+  };
+}
+
+dsp::graph::GraphProfiler *
+DspProfilerModel::profiler () const
+{
+  if (profiler_provider_)
+    return profiler_provider_ ();
+  if (engine_ != nullptr)
+    return engine_->graph_dispatcher ().profiler ();
+  return nullptr;
+}
+
+void
+DspProfilerModel::update_profiler_enabled (bool enabled)
+{
+  if (auto * prof = profiler ())
+    {
+      prof->set_enabled (enabled);
+    }
+}
+
+void
+DspProfilerModel::sort_rows ()
+{
+  using NodeStats = dsp::graph::GraphProfiler::NodeStats;
+  const auto sort_desc = [this] (auto proj) {
+    std::ranges::stable_sort (rows_, std::ranges::greater{}, proj);
+  };
+  switch (sort_role_)
+    {
+    case NodeNameRole:
+      std::ranges::stable_sort (rows_, {}, &NodeStats::name);
+      break;
+    case NumRunsRole:
+      sort_desc (&NodeStats::num_runs);
+      break;
+    case P99UsRole:
+      sort_desc (&NodeStats::p99_us);
+      break;
+    case MaxUsRole:
+      sort_desc (&NodeStats::max_us);
+      break;
+    case ThreadIdRole:
+      std::ranges::stable_sort (rows_, {}, &NodeStats::thread_id);
+      break;
+    case ThreadShareRole:
+      sort_desc (&NodeStats::thread_share);
+      break;
+    case CriticalPathRole:
+      sort_desc (&NodeStats::on_critical_path);
+      break;
+    case MeanUsRole:
+    default:
+      sort_desc (&NodeStats::mean_us);
+      break;
+    }
+}
+
+} // namespace zrythm::gui::qquick
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+#include "dsp/engine.h"
+#include "dsp/graph_profiler.h"
+
+#include <QAbstractListModel>
+#include <QPointer>
+#include <QTimer>
+#include <QUrl>
+#include <QtQmlIntegration/qqmlintegration.h>
+
+#include <nlohmann/json_fwd.hpp>
+
+namespace zrythm::gui::qquick
+{
+
+/**
+ * @brief Lists the per-node processing times of the engine's graph.
+ *
+ * Profiling is only enabled while the model is active, and the rows are
+ * refreshed periodically from dsp::graph::GraphProfiler snapshots.
+ */
+class DspProfilerModel : public QAbstractListModel
+{
+  Q_OBJECT
+  Q_PROPERTY (
+    zrythm::dsp::AudioEngine * engine READ engine WRITE setEngine NOTIFY
+      engineChanged)
+  Q_PROPERTY (bool active READ active WRITE setActive NOTIFY activeChanged)
+  Q_PROPERTY (
+    int sortRole READ sortRole WRITE setSortRole NOTIFY sortRoleChanged)
+  Q_PROPERTY (int droppedCount READ droppedCount NOTIFY refreshed)
+  QML_ELEMENT
+
+public:
+  enum Roles
+  {
+    NodeNameRole = Qt::UserRole + 1,
+    NumRunsRole,
+    MeanUsRole,
+    P99UsRole,
+    MaxUsRole,
+    ThreadIdRole,
+    ThreadShareRole,
+    CriticalPathRole,
+  };
+  Q_ENUM (Roles)
+
+  using ProfilerProvider = std::function<dsp::graph::GraphProfiler * ()>;
+
+  explicit DspProfilerModel (QObject * parent = nullptr);
+  ~DspProfilerModel () override;
+
+  // ========================================================================
+  // QML Interface
+  // ========================================================================
+
+  dsp::AudioEngine * engine () const { return engine_; }
+  void               setEngine (dsp::AudioEngine * engine);
+  Q_SIGNAL void      engineChanged ();
+
+  bool          active () const { return active_; }
+  void          setActive (bool active);
+  Q_SIGNAL void activeChanged (bool active);
+
+  /**
+   * @brief The role to sort rows by.
+   *
+   * Names are sorted in ascending order and everything else in descending
+   * order, so the most expensive nodes come first.
+   */
+  int           sortRole () const { return sort_role_; }
+  void          setSortRole (int role);
+  Q_SIGNAL void sortRoleChanged ();
+
+  int droppedCount () const { return static_cast<int> (dropped_count_); }
+
+  QHash<int, QByteArray> roleNames () const override;
+  int rowCount (const QModelIndex &parent = QModelIndex ()) const override;
+  QVariant
+  data (const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+  /**
+   * @brief Updates the rows from a new profiler snapshot.
+   */
+  Q_INVOKABLE void refresh ();
+
+  /**
+   * @brief Clears the collected timings.
+   */
+  Q_INVOKABLE void reset ();
+
+  /**
+   * @brief Writes the current rows to a JSON file.
+   *
+   * @return Whether the file was written.
+   */
+  Q_INVOKABLE bool saveJson (const QUrl &file_url) const;
+
+  /** Emitted after the rows are refreshed. */
+  Q_SIGNAL void refreshed ();
+
+  // ========================================================================
+
+  /**
+   * @brief Overrides where the profiler is taken from (used in tests).
+   */
+  void set_profiler_provider (ProfilerProvider provider);
+
+  /**
+   * @brief Returns the rows as JSON.
+   */
+  nlohmann::json to_json () const;
+
+  static constexpr auto kRefreshInterval = std::chrono::milliseconds (500);
+
+private:
+  dsp::graph::GraphProfiler * profiler () const;
+  void                        update_profiler_enabled (bool enabled);
+  void                        sort_rows ();
+
+private:
+  QPointer<dsp::AudioEngine>                        engine_;
+  ProfilerProvider                                  profiler_provider_;
+  bool                                              active_{};
+  int                                               sort_role_{ MeanUsRole };
+  std::vector<dsp::graph::GraphProfiler::NodeStats> rows_;
+  size_t                                            dropped_count_{};
+  QTimer                                            refresh_timer_;
+};
+
+} // namespace zrythm::gui::qquick
@@ -27,7 +27,12 @@ GenericPluginUiController::trackPluginUiVisibility (plugins::Plugin * plugin)
   tracked_plugins_.insert (plugin);
 
   const auto reevaluate = [this, plugin] { evaluate (plugin); };
-  connect (plugin, &plugins::Plugin::uiVisibleChanged, this, reevaluate);
+  connect (
+    plugin, &plugins::Plugin::uiVisibleChanged, this,
+    [this, plugin] (bool visible) {
+      evaluate (plugin);
+      Q_EMIT pluginUiVisibleChanged (plugin, visible);
+    });
   connect (plugin, &plugins::Plugin::hasNativeUiChanged, this, reevaluate);
   connect (plugin, &plugins::Plugin::instantiationFinished, this, reevaluate);
   connect (plugin, &QObject::destroyed, this, [this, plugin] {
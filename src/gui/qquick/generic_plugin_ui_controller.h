@@ -51,6 +51,12 @@ public:
    */
   Q_INVOKABLE plugins::Plugin * pluginAt (int row) const;
 
+  /**
+   * @brief Emitted when the UI of a tracked plugin is shown or hidden (native
+   * or generic).
+   */
+  Q_SIGNAL void pluginUiVisibleChanged (plugins::Plugin * plugin, bool visible);
+
   QHash<int, QByteArray> roleNames () const override;
   int      rowCount (const QModelIndex &parent = QModelIndex ()) const override;
   QVariant data (const QModelIndex &index, int role) const override;
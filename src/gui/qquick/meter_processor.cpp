@@ -2,14 +2,13 @@
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
 #include <algorithm>
+#include <cmath>
+#include <ranges>
 #include <utility>
 
-#include "dsp/kmeter_dsp.h"
 #include "dsp/midi_event.h"
-#include "dsp/peak_dsp.h"
 #include "dsp/port.h"
 #include "dsp/port_observation_token.h"
-#include "dsp/true_peak_dsp.h"
 #include "gui/qquick/meter_processor.h"
 #include "utils/logger.h"
 #include "utils/math_utils.h"
@@ -27,15 +26,6 @@ struct MeterProcessor::Impl
 
   std::optional<dsp::ObservationToken> observation_token_;
 
-  std::unique_ptr<zrythm::dsp::TruePeakDsp> true_peak_processor_;
-  std::unique_ptr<zrythm::dsp::TruePeakDsp> true_peak_max_processor_;
-
-  float true_peak_ = 0.f;
-  float true_peak_max_ = 0.f;
-
-  std::unique_ptr<zrythm::dsp::KMeterDsp> kmeter_processor_;
-  std::unique_ptr<zrythm::dsp::PeakDsp>   peak_processor_;
-
   MeterAlgorithm algorithm_ = MeterAlgorithm::Auto;
 
   float prev_max_ = 0.f;
@@ -100,30 +90,9 @@ MeterProcessor::setAlgorithm (MeterAlgorithm algo)
     return;
   impl_->algorithm_ = algo;
 
-  impl_->kmeter_processor_.reset ();
-  impl_->peak_processor_.reset ();
-  impl_->true_peak_processor_.reset ();
-  impl_->true_peak_max_processor_.reset ();
-
-  switch (impl_->algorithm_)
-    {
-    case MeterAlgorithm::K:
-      impl_->kmeter_processor_ = std::make_unique<zrythm::dsp::KMeterDsp> ();
-      impl_->kmeter_processor_->init (impl_->sample_rate_);
-      break;
-    case MeterAlgorithm::TruePeak:
-      impl_->true_peak_processor_ =
-        std::make_unique<zrythm::dsp::TruePeakDsp> ();
-      impl_->true_peak_processor_->init (impl_->sample_rate_);
-      break;
-    case MeterAlgorithm::RMS:
-    case MeterAlgorithm::DigitalPeak:
-      impl_->peak_processor_ = std::make_unique<zrythm::dsp::PeakDsp> ();
-      impl_->peak_processor_->init (impl_->sample_rate_);
-      break;
-    case MeterAlgorithm::Auto:
-      break;
-    }
+  // The observer computes the readings for the algorithm
+  if (impl_->observation_token_)
+    try_create_token ();
 
   Q_EMIT algorithmChanged ();
 }
@@ -152,12 +121,6 @@ MeterProcessor::setSampleRate (int rate)
   if (impl_->sample_rate_ == rate)
     return;
   impl_->sample_rate_ = rate;
-  if (impl_->kmeter_processor_)
-    impl_->kmeter_processor_->init (impl_->sample_rate_);
-  if (impl_->peak_processor_)
-    impl_->peak_processor_->init (impl_->sample_rate_);
-  if (impl_->true_peak_processor_)
-    impl_->true_peak_processor_->init (impl_->sample_rate_);
   Q_EMIT sampleRateChanged ();
 }
 
@@ -173,8 +136,29 @@ MeterProcessor::try_create_token ()
 {
   if (impl_->port_ == nullptr || impl_->observation_manager_ == nullptr)
     return;
-  impl_->observation_token_.emplace (
-    *impl_->observation_manager_, *impl_->port_);
+
+  // Only meter readings are needed for audio/CV (computed on the realtime
+  // thread), so no raw samples are requested
+  const auto kinds = [this] () {
+    switch (impl_->algorithm_)
+      {
+      case MeterAlgorithm::TruePeak:
+        return dsp::ObservationKinds::TruePeak;
+      case MeterAlgorithm::K:
+        return dsp::ObservationKinds::KMeter;
+      case MeterAlgorithm::Auto:
+      case MeterAlgorithm::DigitalPeak:
+      case MeterAlgorithm::RMS:
+      default:
+        return dsp::ObservationKinds::DigitalPeak;
+      }
+  }();
+
+  // Register the new request before dropping the previous one, so the
+  // observer is kept
+  dsp::ObservationToken token (
+    *impl_->observation_manager_, *impl_->port_, kinds);
+  impl_->observation_token_ = std::move (token);
 }
 
 void
@@ -196,14 +180,14 @@ MeterProcessor::setPort (dsp::Port * port)
 
       z_trace ("setting port to {}", impl_->port_->get_label ());
 
-      try_create_token ();
-
       if (impl_->algorithm_ == MeterAlgorithm::Auto)
         {
           if (impl_->port_->is_audio () || impl_->port_->is_cv ())
             setAlgorithm (MeterAlgorithm::DigitalPeak);
         }
 
+      try_create_token ();
+
       impl_->timer_ = utils::make_qobject_unique<QTimer> (this);
       impl_->timer_->setInterval (1000 / 60);
       connect (
@@ -267,62 +251,62 @@ MeterProcessor::get_value (AudioValueFormat format, float &val, float &max)
 
   auto &cache = impl_->observation_token_->cache ();
 
-  if (impl_->port_->is_audio ())
+  if (impl_->port_->is_audio () || impl_->port_->is_cv ())
     {
       // The cache only gains channels once the graph prepares the observer,
       // so the requested channel may not exist yet
+      const auto channel = impl_->port_->is_cv () ? 0 : impl_->channel_;
       const bool channel_available =
-        impl_->channel_ >= 0
-        && std::cmp_less (impl_->channel_, cache.audio.size ());
+        channel >= 0 && std::cmp_less (channel, cache.meters.size ());
       if (!channel_available)
         {
           amp = 0.f;
           max_amp = 0.f;
         }
       else if (
-        auto &channel_data = cache.audio[static_cast<size_t> (impl_->channel_)];
-        !channel_data.empty ())
+        const auto &records = cache.meters[static_cast<size_t> (channel)];
+        !records.empty ())
         {
-          auto   buf_sz = static_cast<int> (channel_data.size ());
-          auto * buf = channel_data.data ();
+          // Combine the per-block readings since the last update
+          const auto max_of = [&records] (auto member) {
+            return std::ranges::max (records | std::views::transform (member));
+          };
           switch (impl_->algorithm_)
             {
             case MeterAlgorithm::RMS:
-              z_warn_if_reached ();
-              amp = utils::math::calculate_rms_amp (buf, buf_sz);
+              {
+                z_warn_if_reached ();
+                amp = 0.f;
+                double   sum_squares = 0.0;
+                uint64_t num_frames = 0;
+                for (const auto &record : records)
+                  {
+                    sum_squares += static_cast<double> (record.rms)
+                                   * record.rms * record.num_frames;
+                    num_frames += record.num_frames;
+                  }
+                if (num_frames > 0)
+                  {
+                    amp = static_cast<float> (std::sqrt (
+                      sum_squares / static_cast<double> (num_frames)));
+                  }
+              }
               break;
             case MeterAlgorithm::TruePeak:
-              impl_->true_peak_processor_->process (buf, buf_sz);
-              amp = impl_->true_peak_processor_->read_f ();
+              amp = max_of (&dsp::MeterRecord::true_peak);
               break;
             case MeterAlgorithm::K:
-              impl_->kmeter_processor_->process (buf, buf_sz);
-              std::tie (amp, max_amp) = impl_->kmeter_processor_->read ();
+              amp = max_of (&dsp::MeterRecord::k_rms);
+              max_amp = records.back ().k_peak;
               break;
             case MeterAlgorithm::DigitalPeak:
-              impl_->peak_processor_->process (buf, buf_sz);
-              std::tie (amp, max_amp) = impl_->peak_processor_->read ();
+              amp = max_of (&dsp::MeterRecord::digital_value);
+              max_amp = records.back ().digital_peak;
               break;
             default:
               break;
             }
-          cache.clear_audio ();
-        }
-      else
-        {
-          amp = 0.f;
-          max_amp = 0.f;
-        }
-    }
-  else if (impl_->port_->is_cv ())
-    {
-      if (!cache.audio.empty () && !cache.audio[0].empty ())
-        {
-          auto &channel_data = cache.audio[0];
-          auto  buf_sz = static_cast<int> (channel_data.size ());
-          impl_->peak_processor_->process (channel_data.data (), buf_sz);
-          std::tie (amp, max_amp) = impl_->peak_processor_->read ();
-          cache.clear_audio ();
+          cache.clear_meters ();
         }
       else
         {
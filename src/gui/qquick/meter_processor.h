@@ -23,7 +23,9 @@ namespace zrythm::gui::qquick
  *
  * The meter processor is associated with a port, which can be either an
  * AudioPort or a MidiPort. The meter values are updated based on the data
- * from the associated port.
+ * from the associated port. For audio and CV ports, the port's observer runs
+ * the meter algorithm on the realtime thread and only per-block readings are
+ * passed to this class (see dsp::MeterRecord).
  *
  * The meter processor emits the `valuesChanged` signal whenever the meter
  * values are updated, allowing the GUI to update the display accordingly.
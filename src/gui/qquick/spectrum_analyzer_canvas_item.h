@@ -8,8 +8,6 @@
 #include <QtCanvasPainter/qcanvaspainteritem.h>
 #include <QtQmlIntegration/qqmlintegration.h>
 
-#include <kiss_fft.h>
-
 namespace zrythm::dsp
 {
 class AudioPort;
@@ -61,19 +59,12 @@ public:
   void setSampleRate (float rate);
   void setSpectrumColor (const QColor &color);
 
-  Q_INVOKABLE float getScaledFrequency (
-    int   bin,
-    int   num_bins,
-    float min_frequency,
-    float max_frequency) const;
-  Q_INVOKABLE float getFrequencyForBin (int bin, int num_bins) const;
-
-  static float scaled_frequency (
-    float sample_rate,
-    int   bin,
-    int   num_bins,
-    float min_frequency,
-    float max_frequency);
+  /**
+   * @brief Returns the center frequency of the given band in spectrumData().
+   *
+   * Bands are logarithmically spaced, so they can be drawn at equal widths.
+   */
+  Q_INVOKABLE float getBandFrequency (int band) const;
 
   const QVector<float> &spectrumData () const;
   uint64_t              spectrumGeneration () const;
@@ -88,7 +79,7 @@ Q_SIGNALS:
 private:
   void process_audio ();
   void try_create_token ();
-  void init_fft (int size);
+  void init_analyzer ();
 
   struct Impl;
   std::unique_ptr<Impl> impl_;
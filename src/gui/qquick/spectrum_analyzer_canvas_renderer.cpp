@@ -6,7 +6,6 @@
 
 #include "gui/qquick/spectrum_analyzer_canvas_item.h"
 #include "gui/qquick/spectrum_analyzer_canvas_renderer.h"
-#include "utils/math_utils.h"
 #include "utils/tracy.h"
 
 namespace zrythm::gui::qquick
@@ -18,7 +17,6 @@ SpectrumAnalyzerCanvasRenderer::synchronize (QCanvasPainterItem * item)
   auto * spectrum_item = static_cast<SpectrumAnalyzerCanvasItem *> (item);
 
   spectrum_color_ = spectrum_item->spectrumColor ();
-  sample_rate_ = spectrum_item->sampleRate ();
   canvas_width_ = static_cast<float> (spectrum_item->width ());
   canvas_height_ = static_cast<float> (spectrum_item->height ());
 
@@ -43,55 +41,29 @@ SpectrumAnalyzerCanvasRenderer::paint (QCanvasPainter * painter)
   if (w <= 0.f || h <= 0.f)
     return;
 
-  constexpr float min_freq = 40.0f;
-  const float     max_freq = sample_rate_ / 2.0f;
-
   painter->setRenderHint (QCanvasPainter::RenderHint::Antialiasing, true);
   painter->setFillStyle (spectrum_color_);
 
-  for (int i = 0; i < bin_count - 1; ++i)
+  // Bands are already logarithmically spaced, so they map linearly to x
+  if (bin_count == 1)
     {
-      const float freq_pos =
-        SpectrumAnalyzerCanvasItem::scaled_frequency (
-          sample_rate_, i, bin_count, min_freq, max_freq)
-        * w;
-      const float next_freq_pos =
-        SpectrumAnalyzerCanvasItem::scaled_frequency (
-          sample_rate_, i + 1, bin_count, min_freq, max_freq)
-        * w;
-
-      const float power = spectrum_data_[i];
-      const float next_power = spectrum_data_[i + 1];
-
-      const float freq_delta = next_freq_pos - freq_pos;
-
-      const int start_px = static_cast<int> (std::floor (freq_pos));
-      const int end_px = static_cast<int> (std::floor (next_freq_pos));
-
-      for (int j = start_px; j < end_px; ++j)
-        {
-          const float t =
-            (freq_delta > 0.f)
-              ? (static_cast<float> (j) - freq_pos) / freq_delta
-              : 0.f;
-          const float interpolated = power * (1.0f - t) + next_power * t;
-          const float bar_height = h * interpolated;
-          painter->fillRect (
-            static_cast<float> (j), h - bar_height, 1.0f, bar_height);
-        }
+      const float bar_height = h * spectrum_data_[0];
+      painter->fillRect (0.f, h - bar_height, w, bar_height);
+      return;
     }
 
-  // Last bin
-  if (bin_count > 0)
+  const float px_per_band = w / static_cast<float> (bin_count - 1);
+  const int   width_px = static_cast<int> (std::ceil (w));
+  for (int j = 0; j < width_px; ++j)
     {
-      const float last_freq_pos =
-        SpectrumAnalyzerCanvasItem::scaled_frequency (
-          sample_rate_, bin_count - 1, bin_count, min_freq, max_freq)
-        * w;
-      const float last_power = spectrum_data_[bin_count - 1];
-      const float last_bar_height = h * last_power;
+      const float band_pos = static_cast<float> (j) / px_per_band;
+      const int   band = std::min (static_cast<int> (band_pos), bin_count - 2);
+      const float t = band_pos - static_cast<float> (band);
+      const float interpolated =
+        spectrum_data_[band] * (1.0f - t) + spectrum_data_[band + 1] * t;
+      const float bar_height = h * interpolated;
       painter->fillRect (
-        last_freq_pos, h - last_bar_height, 1.0f, last_bar_height);
+        static_cast<float> (j), h - bar_height, 1.0f, bar_height);
     }
 }
 
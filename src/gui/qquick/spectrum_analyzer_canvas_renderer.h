@@ -27,7 +27,6 @@ private:
   float          canvas_width_ = 0.0f;
   float          canvas_height_ = 0.0f;
   QVector<float> spectrum_data_;
-  float          sample_rate_ = 44100.0f;
   uint64_t       prev_generation_ = 0;
 };
 
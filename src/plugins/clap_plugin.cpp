@@ -36,6 +36,7 @@
 #include "zrythm-config.h"
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -262,6 +263,9 @@ private:
   std::unique_ptr<IPluginHostWindow> editor_;
 
   units::sample_u32_t latency_;
+
+  /** Tail reported on activation (see get_tail_length_seconds()). */
+  double tail_seconds_{};
 };
 
 ClapPlugin::ClapPlugin (
@@ -758,6 +762,18 @@ ClapPlugin::prepare_plugin_for_processing (
     {
       pimpl_->latency_ = units::samples (pimpl_->plugin_->latencyGet ());
     }
+
+  // The tail may only be queried while active. Values of INT32_MAX and above
+  // mean an infinite tail
+  pimpl_->tail_seconds_ = 0.0;
+  if (pimpl_->plugin_->canUseTail ())
+    {
+      const auto tail = pimpl_->plugin_->tailGet ();
+      pimpl_->tail_seconds_ =
+        tail >= static_cast<uint32_t> (std::numeric_limits<int32_t>::max ())
+          ? std::numeric_limits<double>::infinity ()
+          : static_cast<double> (tail) / sample_rate.in (units::sample_rate);
+    }
 }
 
 void
@@ -919,6 +935,12 @@ ClapPlugin::get_single_playback_latency () const
   return pimpl_->latency_;
 }
 
+double
+ClapPlugin::get_tail_length_seconds () const
+{
+  return pimpl_->tail_seconds_;
+}
+
 bool
 ClapPlugin::load_plugin (
   const std::filesystem::path &path,
@@ -1887,6 +1909,10 @@ ClapPlugin::save_state_to_byte_array () const
 std::string
 ClapPlugin::save_state_impl () const
 {
+  // Not instantiated yet (e.g., deferred): keep the state to be applied
+  if ((!pimpl_ || !pimpl_->plugin_) && state_to_apply_.has_value ())
+    return zrythm::utils::to_std_string (state_to_apply_->toBase64 ());
+
   auto data = save_state_to_byte_array ();
   return zrythm::utils::to_std_string (data.toBase64 ());
 }
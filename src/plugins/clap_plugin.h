@@ -116,6 +116,7 @@ public:
   // ============================================================================
 
   units::sample_u32_t get_single_playback_latency () const override;
+  double              get_tail_length_seconds () const override;
 
   bool hasNativeUi () const override;
 
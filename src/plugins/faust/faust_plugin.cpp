@@ -255,6 +255,12 @@ FaustPlugin::push_all_params_to_zones ()
     }
 }
 
+double
+FaustPlugin::get_tail_length_seconds () const
+{
+  return is_instrument_ ? voice_release_seconds_ : 0.0;
+}
+
 void
 FaustPlugin::prepare_plugin_for_processing (
   units::sample_rate_t sample_rate,
@@ -41,6 +41,11 @@ protected:
   void process_impl (dsp::graph::ProcessBlockInfo time_info) noexcept
     [[clang::nonblocking]] override;
 
+  /**
+   * @brief Instruments report their voice release tail; effects report none.
+   */
+  double get_tail_length_seconds () const override;
+
   std::string save_state_impl () const override { return {}; }
   void        load_state_impl (const std::string &) override { }
 
@@ -376,6 +376,16 @@ JucePlugin::get_single_playback_latency () const
   return units::samples (0);
 }
 
+double
+JucePlugin::get_tail_length_seconds () const
+{
+  if (juce_plugin_ && juce_initialized_)
+    {
+      return juce_plugin_->getTailLengthSeconds ();
+    }
+  return 0.0;
+}
+
 void
 JucePlugin::prepare_plugin_for_processing (
   units::sample_rate_t sample_rate,
@@ -659,7 +669,12 @@ std::string
 JucePlugin::save_state_impl () const
 {
   if (!juce_plugin_)
-    return {};
+    {
+      // Not instantiated yet (e.g., deferred): keep the state to be applied
+      return state_to_apply_.has_value ()
+               ? state_to_apply_->toBase64Encoding ().toStdString ()
+               : std::string{};
+    }
 
   juce::MemoryBlock state_data;
   juce_plugin_->getStateInformation (state_data);
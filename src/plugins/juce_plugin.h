@@ -64,6 +64,8 @@ protected:
 
   void process_impl (dsp::graph::ProcessBlockInfo time_info) noexcept override;
 
+  double get_tail_length_seconds () const override;
+
   std::string save_state_impl () const override;
   void        load_state_impl (const std::string &base64_state) override;
 
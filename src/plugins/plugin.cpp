@@ -1,5 +1,8 @@
 // SPDX-FileCopyrightText: © 2018-2026 Alexandros Theodotou <alex@zrythm.org>
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
+#include <algorithm>
+#include <cmath>
+
 #include "plugins/plugin.h"
 #include "utils/enum_utils.h"
 #include "utils/logger.h"
@@ -26,6 +29,13 @@ Plugin::Plugin (utils::IObjectRegistry &registry, QObject * parent)
         successful ? InstantiationStatus::Successful : InstantiationStatus::Failed;
       Q_EMIT instantiationStatusChanged (instantiation_status_);
     });
+
+  // Showing the UI requires an instance
+  QObject::connect (
+    this, &Plugin::uiVisibleChanged, this, [this] (bool visible) {
+      if (visible)
+        instantiate_deferred ();
+    });
 }
 
 dsp::ProcessorParameter *
@@ -93,6 +103,18 @@ Plugin::set_configuration (const PluginConfiguration &setting)
   Q_EMIT configurationChanged (configuration_.get (), generate_new);
 }
 
+void
+Plugin::instantiate_deferred ()
+{
+  if (instantiation_status_ != InstantiationStatus::Deferred)
+    return;
+
+  z_debug ("instantiating deferred plugin {}", get_name ());
+  instantiation_status_ = InstantiationStatus::Pending;
+  Q_EMIT instantiationStatusChanged (instantiation_status_);
+  set_configuration (*configuration_);
+}
+
 // ============================================================================
 // IProcessable Interface
 // ============================================================================
@@ -103,9 +125,38 @@ Plugin::custom_prepare_for_processing (
   units::sample_rate_t          sample_rate,
   units::sample_u32_t           max_block_length)
 {
+  if (instantiation_status_ == InstantiationStatus::Successful)
+    awaiting_instance_.store (false, std::memory_order_release);
+
   init_param_caches ();
   param_sync_.prepare (get_parameters ().size ());
   prepare_plugin_for_processing (sample_rate, max_block_length);
+
+  // Auto-suspend caches
+  {
+    auto &state = auto_suspend_;
+    state.output_silent_samples = 0;
+    state.suspended.store (false, std::memory_order_relaxed);
+
+    const double tail_seconds = get_tail_length_seconds ();
+    if (!std::isfinite (tail_seconds) || !cv_in_ports_.empty ())
+      {
+        state.required_silent_samples = 0;
+      }
+    else
+      {
+        state.required_silent_samples = static_cast<uint64_t> (std::ceil (
+          (std::max (tail_seconds, 0.0) + kAutoSuspendMinHoldSeconds)
+          * sample_rate.in (units::sample_rate)));
+      }
+
+    size_t num_input_channels = 0;
+    for (const auto * port : audio_in_ports_)
+      num_input_channels += port->num_channels ();
+    state.pre_roll_audio.resize (
+      num_input_channels * max_block_length.in (units::samples));
+  }
+
   param_flush_timer_->start (std::chrono::milliseconds (20));
 }
 
@@ -121,13 +172,172 @@ Plugin::custom_process_block (
   if (instantiation_failed_)
     return;
 
-  if (!currently_enabled_rt ())
+  if (
+    !currently_enabled_rt ()
+    || awaiting_instance_.load (std::memory_order_acquire))
     {
       process_passthrough_impl (time_nfo, transport, tempo_map);
       return;
     }
 
+  if (auto_suspend_enabled_.load (std::memory_order_relaxed))
+    {
+      process_with_auto_suspend_rt (time_nfo);
+      return;
+    }
+
+  if (auto_suspend_.suspended.load (std::memory_order_relaxed))
+    {
+      // Auto-suspend was turned off while suspended
+      resume_from_auto_suspend_rt (time_nfo);
+    }
+  process_impl (time_nfo);
+}
+
+void
+Plugin::process_with_auto_suspend_rt (
+  const dsp::graph::ProcessBlockInfo time_nfo) noexcept
+{
+  auto      &state = auto_suspend_;
+  const bool has_activity = has_input_activity_rt (time_nfo);
+
+  if (state.suspended.load (std::memory_order_relaxed))
+    {
+      if (!has_activity)
+        {
+          const auto offset = time_nfo.buffer_offset_.in (units::samples);
+          const auto nframes = time_nfo.nframes_.in (units::samples);
+          for (auto * port : audio_out_ports_)
+            port->clear_buffer (offset, nframes);
+          if (midi_out_port_ != nullptr)
+            midi_out_port_->clear_buffer (offset, nframes);
+          return;
+        }
+
+      resume_from_auto_suspend_rt (time_nfo);
+    }
+
   process_impl (time_nfo);
+
+  if (has_activity)
+    {
+      state.output_silent_samples = 0;
+      return;
+    }
+
+  // Input activity resets the count, so this also requires the input to have
+  // been silent for as long
+  if (outputs_silent_rt (time_nfo))
+    state.output_silent_samples += time_nfo.nframes_.in (units::samples);
+  else
+    state.output_silent_samples = 0;
+
+  if (
+    state.required_silent_samples > 0
+    && state.output_silent_samples >= state.required_silent_samples)
+    {
+      state.suspended.store (true, std::memory_order_relaxed);
+    }
+}
+
+bool
+Plugin::has_input_activity_rt (
+  const dsp::graph::ProcessBlockInfo time_nfo) const noexcept
+{
+  if (midi_in_port_ != nullptr && !midi_in_port_->buffer_.empty ())
+    return true;
+
+  if (!change_tracker ().changes ().empty ())
+    return true;
+
+  const auto offset = time_nfo.buffer_offset_.in<int> (units::samples);
+  const auto nframes = time_nfo.nframes_.in<int> (units::samples);
+  for (const auto * port : audio_in_ports_)
+    {
+      const auto &buf = *port->buffers ();
+      for (int ch = 0; ch < buf.getNumChannels (); ++ch)
+        {
+          if (
+            buf.getMagnitude (ch, offset, nframes)
+            > kAutoSuspendSilenceThreshold)
+            return true;
+        }
+    }
+
+  return false;
+}
+
+bool
+Plugin::outputs_silent_rt (
+  const dsp::graph::ProcessBlockInfo time_nfo) const noexcept
+{
+  if (midi_out_port_ != nullptr && !midi_out_port_->buffer_.empty ())
+    return false;
+
+  const auto offset = time_nfo.buffer_offset_.in<int> (units::samples);
+  const auto nframes = time_nfo.nframes_.in<int> (units::samples);
+  for (const auto * port : audio_out_ports_)
+    {
+      const auto &buf = *port->buffers ();
+      for (int ch = 0; ch < buf.getNumChannels (); ++ch)
+        {
+          if (
+            buf.getMagnitude (ch, offset, nframes)
+            > kAutoSuspendSilenceThreshold)
+            return false;
+        }
+    }
+
+  return true;
+}
+
+void
+Plugin::resume_from_auto_suspend_rt (
+  const dsp::graph::ProcessBlockInfo time_nfo) noexcept
+{
+  auto &state = auto_suspend_;
+  state.suspended.store (false, std::memory_order_relaxed);
+  state.output_silent_samples = 0;
+
+  // Stash the real inputs and present silence to the plugin
+  const auto offset = time_nfo.buffer_offset_.in<int> (units::samples);
+  const auto nframes = time_nfo.nframes_.in<int> (units::samples);
+  float *    stash = state.pre_roll_audio.data ();
+  for (auto * port : audio_in_ports_)
+    {
+      auto &buf = *port->buffers ();
+      for (int ch = 0; ch < buf.getNumChannels (); ++ch)
+        {
+          std::copy_n (buf.getReadPointer (ch, offset), nframes, stash);
+          buf.clear (ch, offset, nframes);
+          stash += nframes;
+        }
+    }
+  if (midi_in_port_ != nullptr)
+    midi_in_port_->buffer_.swap (state.pre_roll_midi);
+
+  // The pre-roll covers the span just before the block (the caller processes
+  // the block itself), so no span of the timeline is processed twice. Its
+  // output is overwritten by the real pass
+  auto       pre_roll_nfo = time_nfo;
+  const auto position = time_nfo.transport_position_.in (units::samples);
+  pre_roll_nfo.transport_position_ = units::samples (
+    position - std::min (position, static_cast<uint64_t> (nframes)));
+  process_impl (pre_roll_nfo);
+
+  // Restore the real inputs
+  if (midi_in_port_ != nullptr)
+    midi_in_port_->buffer_.swap (state.pre_roll_midi);
+  stash = state.pre_roll_audio.data ();
+  for (auto * port : audio_in_ports_)
+    {
+      auto &buf = *port->buffers ();
+      for (int ch = 0; ch < buf.getNumChannels (); ++ch)
+        {
+          std::copy_n (stash, nframes, buf.getWritePointer (ch, offset));
+          stash += nframes;
+        }
+    }
 }
 
 void
@@ -221,6 +431,7 @@ to_json (nlohmann::json &j, const Plugin &p)
     }
   j[Plugin::kProtocolKey] = p.get_protocol ();
   j[Plugin::kVisibleKey] = p.visible_;
+  j[Plugin::kAutoSuspendKey] = p.autoSuspend ();
 }
 
 void
@@ -234,10 +445,10 @@ from_json (const nlohmann::json &j, Plugin &p)
       p.program_index_ = j[Plugin::kProgramIndexKey].get<int> ();
     }
   j.at (Plugin::kVisibleKey).get_to (p.visible_);
-
-  if (p.configuration_)
+  if (j.contains (Plugin::kAutoSuspendKey))
     {
-      p.set_configuration (*p.configuration_);
+      p.auto_suspend_enabled_.store (
+        j[Plugin::kAutoSuspendKey].get<bool> (), std::memory_order_relaxed);
     }
 
   p.gain_id_.reset ();
@@ -261,6 +472,21 @@ from_json (const nlohmann::json &j, Plugin &p)
       if (p.gain_id_.has_value () && p.bypass_id_.has_value ())
         break;
     }
+
+  if (p.configuration_)
+    {
+      if (p.defer_instantiation_)
+        {
+          p.set_name (p.get_name ());
+          p.awaiting_instance_.store (true, std::memory_order_release);
+          p.instantiation_status_ = Plugin::InstantiationStatus::Deferred;
+          Q_EMIT p.instantiationStatusChanged (p.instantiation_status_);
+        }
+      else
+        {
+          p.set_configuration (*p.configuration_);
+        }
+    }
 }
 
 Plugin::~Plugin () = default;
@@ -57,6 +57,9 @@ class Plugin : public utils::UuidIdentifiableObject<Plugin>, public dsp::Process
   Q_PROPERTY (
     bool uiVisible READ uiVisible WRITE setUiVisible NOTIFY uiVisibleChanged)
   Q_PROPERTY (bool hasNativeUi READ hasNativeUi NOTIFY hasNativeUiChanged)
+  Q_PROPERTY (
+    bool autoSuspend READ autoSuspend WRITE setAutoSuspend NOTIFY
+      autoSuspendChanged)
   Q_PROPERTY (
     InstantiationStatus instantiationStatus READ instantiationStatus NOTIFY
       instantiationStatusChanged)
@@ -69,7 +72,8 @@ public:
   {
     Pending,    ///< Instantiation underway
     Successful, ///< Instantiation successful
-    Failed      ///< Instantiation failed
+    Failed,     ///< Instantiation failed
+    Deferred,   ///< Postponed until the plugin is activated
   };
   Q_ENUM (InstantiationStatus)
 
@@ -157,6 +161,31 @@ public:
    */
   Q_SIGNAL void hasNativeUiChanged ();
 
+  /**
+   * @brief Whether the plugin may be suspended while its input is silent.
+   *
+   * When enabled, the plugin stops being processed once its inputs have been
+   * silent and its output has stayed below the silence threshold for longer
+   * than its tail (see get_tail_length_seconds()). It resumes, after a silent
+   * pre-roll pass, as soon as audio or MIDI input arrives or a parameter
+   * changes.
+   *
+   * Plugins with CV inputs are never suspended.
+   */
+  bool autoSuspend () const
+  {
+    return auto_suspend_enabled_.load (std::memory_order_relaxed);
+  }
+  void setAutoSuspend (bool enabled)
+  {
+    if (enabled == autoSuspend ())
+      return;
+
+    auto_suspend_enabled_.store (enabled, std::memory_order_relaxed);
+    Q_EMIT autoSuspendChanged (enabled);
+  }
+  Q_SIGNAL void autoSuspendChanged (bool enabled);
+
   InstantiationStatus instantiationStatus () const
   {
     return instantiation_status_;
@@ -202,6 +231,24 @@ public:
    */
   void set_configuration (const PluginConfiguration &setting);
 
+  /**
+   * @brief Makes from_json() restore the plugin without instantiating it.
+   *
+   * The plugin is then kept in InstantiationStatus::Deferred and passed
+   * through until instantiate_deferred() is called (or its UI is shown).
+   */
+  void set_defer_instantiation (bool defer) { defer_instantiation_ = defer; }
+
+  /**
+   * @brief Starts instantiating a plugin whose instantiation was deferred.
+   *
+   * Does nothing unless the status is InstantiationStatus::Deferred.
+   *
+   * The plugin keeps being passed through until it is prepared for
+   * processing again after instantiationFinished.
+   */
+  void instantiate_deferred ();
+
   // ============================================================================
   // IProcessable Interface
   // ============================================================================
@@ -235,6 +282,17 @@ public:
     return !bypass->range ().isToggled (bypass->currentValue ());
   }
 
+  /**
+   * @brief Returns whether processing is currently skipped because of
+   * auto-suspend (see autoSuspend()).
+   *
+   * Safe to call from any thread.
+   */
+  bool auto_suspended () const
+  {
+    return auto_suspend_.suspended.load (std::memory_order_relaxed);
+  }
+
   // ============================================================================
   // Implementation Interface
   // ============================================================================
@@ -272,6 +330,16 @@ private:
 
   virtual void release_resources_impl () { }
 
+  /**
+   * @brief Returns how long (in seconds) the plugin keeps producing output
+   * after its input goes silent (e.g. reverb or delay tails).
+   *
+   * Used by auto-suspend. Return infinity if the plugin never stops producing
+   * output on its own. Called on the main thread during
+   * prepare_for_processing().
+   */
+  virtual double get_tail_length_seconds () const { return 0.0; }
+
   /**
    * @brief Processes the plugin by passing through the input to its output.
    *
@@ -298,6 +366,34 @@ private:
    */
   void init_param_caches ();
 
+  /**
+   * @brief Processes the block, or skips it if auto-suspend decides the
+   * plugin is idle.
+   */
+  void process_with_auto_suspend_rt (
+    dsp::graph::ProcessBlockInfo time_nfo) noexcept [[clang::nonblocking]];
+
+  /**
+   * @brief Returns whether there is any audio/MIDI input or parameter change
+   * in the given block.
+   */
+  bool has_input_activity_rt (dsp::graph::ProcessBlockInfo time_nfo)
+    const noexcept [[clang::nonblocking]];
+
+  bool outputs_silent_rt (dsp::graph::ProcessBlockInfo time_nfo) const noexcept
+    [[clang::nonblocking]];
+
+  /**
+   * @brief Leaves the suspended state.
+   *
+   * Runs the plugin once over silence for the span just before the block, so
+   * that parameter smoothers and other internal state catch up with anything
+   * that changed while it was suspended before the first real input reaches
+   * it. The caller processes the block normally afterwards.
+   */
+  void resume_from_auto_suspend_rt (
+    dsp::graph::ProcessBlockInfo time_nfo) noexcept [[clang::nonblocking]];
+
 protected:
   /**
    * Creates/initializes a plugin and its internal plugin (LV2, etc.) using
@@ -324,6 +420,7 @@ private:
   static constexpr auto kProgramIndexKey = "programIndex"sv;
   static constexpr auto kProtocolKey = "protocol"sv;
   static constexpr auto kVisibleKey = "visible"sv;
+  static constexpr auto kAutoSuspendKey = "autoSuspend"sv;
   friend void           to_json (nlohmann::json &j, const Plugin &p);
   friend void           from_json (const nlohmann::json &j, Plugin &p);
 
@@ -433,12 +530,68 @@ private:
    */
   bool set_configuration_called_{};
 
+  /** Whether from_json() should defer instantiation. */
+  bool defer_instantiation_{};
+
+  /**
+   * @brief Whether the plugin was deferred and has not been prepared with its
+   * instance yet.
+   *
+   * The plugin is passed through while this is set.
+   */
+  std::atomic<bool> awaiting_instance_{};
+
   /**
    * @brief Timer that flushes plugin→host param changes on the main thread.
    * Started in custom_prepare_for_processing(), stopped in
    * custom_release_resources().
    */
   utils::QObjectUniquePtr<QTimer> param_flush_timer_;
+
+  // ============================================================================
+  // Auto-suspend
+  // ============================================================================
+
+  /** Peak level (-90 dBFS) below which a block counts as silent. */
+  static constexpr float kAutoSuspendSilenceThreshold = 3.1623e-5f;
+
+  /**
+   * @brief Minimum silence (in seconds) before suspending, on top of the
+   * plugin's reported tail (many plugins under-report their tail).
+   */
+  static constexpr double kAutoSuspendMinHoldSeconds = 0.2;
+
+  std::atomic<bool> auto_suspend_enabled_{ false };
+
+  struct AutoSuspendState
+  {
+    /**
+     * Consecutive samples of silent output while the input was silent. Audio
+     * thread only.
+     */
+    uint64_t output_silent_samples{};
+
+    /**
+     * Samples of silent input and output required before suspending, or 0 if
+     * the plugin must never be suspended. Set in
+     * custom_prepare_for_processing().
+     */
+    uint64_t required_silent_samples{};
+
+    /** Written on the audio thread only. */
+    std::atomic<bool> suspended{ false };
+
+    /**
+     * Real input samples of all audio input ports, stashed during the
+     * pre-roll pass.
+     */
+    std::vector<float> pre_roll_audio;
+
+    /** Empty buffer swapped into the MIDI input during the pre-roll pass. */
+    dsp::MidiEventBuffer pre_roll_midi;
+  };
+
+  AutoSuspendState auto_suspend_;
 };
 
 class CarlaNativePlugin;
@@ -105,6 +105,31 @@ PluginGroup::insert_plugin (plugins::PluginUuidReference plugin_ref, int index)
   endInsertRows ();
 }
 
+PluginGroup *
+PluginGroup::insert_group (
+  utils::QObjectUniquePtr<PluginGroup> group,
+  int                                  index)
+{
+  index = std::clamp (index, -1, rowCount ());
+  auto * group_ptr = group.get ();
+
+  if (index == -1)
+    {
+      beginInsertRows ({}, rowCount (), rowCount ());
+      pimpl_->devices_.emplace_back (std::move (group));
+    }
+  else
+    {
+      beginInsertRows ({}, index, index);
+      pimpl_->devices_.insert (
+        std::ranges::next (pimpl_->devices_.begin (), index),
+        std::move (group));
+    }
+  endInsertRows ();
+
+  return group_ptr;
+}
+
 plugins::PluginUuidReference
 PluginGroup::remove_plugin (const plugins::Plugin::Uuid &plugin_id)
 {
@@ -158,6 +183,25 @@ PluginGroup::get_plugins (
     }
 }
 
+std::vector<PluginGroup::Element>
+PluginGroup::elements () const
+{
+  std::vector<Element> ret;
+  ret.reserve (pimpl_->devices_.size ());
+  for (const auto &var : pimpl_->devices_)
+    {
+      if (var.index () == 0)
+        {
+          ret.emplace_back (std::get<0> (var).get ());
+        }
+      else
+        {
+          ret.emplace_back (std::get<1> (var));
+        }
+    }
+  return ret;
+}
+
 void
 to_json (nlohmann::json &j, const PluginGroup &l)
 {
@@ -176,6 +220,8 @@ to_json (nlohmann::json &j, const PluginGroup &l)
     }
   j[PluginGroup::kDeviceGroupsKey] = device_groups_json;
   j[PluginGroup::kFaderKey] = *l.fader_;
+  j[PluginGroup::kProcessingTypeKey] = l.processing_type_;
+  j[PluginGroup::kTypeKey] = l.type_;
 }
 void
 from_json (const nlohmann::json &j, PluginGroup &l)
@@ -191,9 +237,14 @@ from_json (const nlohmann::json &j, PluginGroup &l)
         }
       else
         {
+          // The types of this group are set by its owner; nested groups
+          // are created here, so restore theirs
           auto group = utils::make_qobject_unique<PluginGroup> (
-            l.registry_, PluginGroup::DeviceGroupType::Audio,
-            PluginGroup::ProcessingTypeHint::Parallel);
+            l.registry_,
+            device_group_json.at (PluginGroup::kTypeKey)
+              .get<PluginGroup::DeviceGroupType> (),
+            device_group_json.at (PluginGroup::kProcessingTypeKey)
+              .get<PluginGroup::ProcessingTypeHint> ());
           device_group_json.get_to (*group);
           l.pimpl_->devices_.emplace_back (std::move (group));
         }
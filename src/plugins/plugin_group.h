@@ -125,15 +125,44 @@ public:
   plugins::PluginUuidReference
   remove_plugin (const plugins::Plugin::Uuid &plugin_id);
 
+  /**
+   * @brief Inserts a nested group (e.g., a layer of a parallel rack).
+   *
+   * @return The inserted group.
+   */
+  PluginGroup *
+  insert_group (utils::QObjectUniquePtr<PluginGroup> group, int index = -1);
+
   QVariant element_at_idx (size_t idx) const;
 
   void get_plugins (
     std::vector<plugins::PluginUuidReference> &plugins,
     bool                                       recursive = true) const;
 
+  /**
+   * @brief A direct element of the group: a nested group or a plugin.
+   */
+  using Element = std::variant<PluginGroup *, plugins::PluginUuidReference>;
+
+  /**
+   * @brief Returns the direct elements of the group, in order.
+   */
+  std::vector<Element> elements () const;
+
+  ProcessingTypeHint processing_type () const { return processing_type_; }
+  DeviceGroupType    type () const { return type_; }
+
+  /**
+   * @brief Fader the outputs of the elements are summed into (for parallel
+   * groups).
+   */
+  dsp::Fader &fader () const { return *fader_; }
+
 private:
   static constexpr auto kDeviceGroupsKey = "deviceGroups"sv;
   static constexpr auto kFaderKey = "fader"sv;
+  static constexpr auto kProcessingTypeKey = "processingType"sv;
+  static constexpr auto kTypeKey = "type"sv;
   friend void           to_json (nlohmann::json &j, const PluginGroup &l);
   friend void           from_json (const nlohmann::json &j, PluginGroup &l);
 
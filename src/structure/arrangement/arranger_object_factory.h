@@ -369,6 +369,20 @@ public:
     return create_audio_clip_with_clip (std::move (clip), startTicks);
   }
 
+  /**
+   * @brief Creates and registers an AudioSourceObject for @p source.
+   *
+   * Used to swap the material of an existing AudioClip (e.g., after applying
+   * an audio function).
+   */
+  auto
+  create_audio_source_object (dsp::FileAudioSourceUuidReference source) const
+  {
+    return utils::create_object<structure::arrangement::AudioSourceObject> (
+      dependencies_.registry_, dependencies_.tempo_map_,
+      dependencies_.registry_, std::move (source));
+  }
+
   /**
    * @brief Creates and registers a new AudioClip and then creates and returns
    * an AudioClip from it.
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+#include <limits>
+
+#include "structure/arrangement/arranger_object_spatial_index.h"
+
+namespace zrythm::structure::arrangement
+{
+
+void
+ArrangerObjectSpatialIndex::rebuild (std::vector<Entry> entries)
+{
+  entries_ = std::move (entries);
+  std::ranges::sort (entries_, {}, &Entry::start_ticks);
+  max_end_.resize (entries_.size ());
+  build_subtree (0, entries_.size ());
+}
+
+double
+ArrangerObjectSpatialIndex::build_subtree (size_t lo, size_t hi)
+{
+  if (lo >= hi)
+    return std::numeric_limits<double>::lowest ();
+
+  const auto mid = lo + ((hi - lo) / 2);
+  max_end_[mid] = std::max (
+    { entries_[mid].end_ticks, build_subtree (lo, mid),
+      build_subtree (mid + 1, hi) });
+  return max_end_[mid];
+}
+
+void
+ArrangerObjectSpatialIndex::query (
+  double                               start_ticks,
+  double                               end_ticks,
+  double                               min_key,
+  double                               max_key,
+  std::vector<const ArrangerObject *> &out) const
+{
+  query_subtree (
+    0, entries_.size (), start_ticks, end_ticks, min_key, max_key, out);
+}
+
+void
+ArrangerObjectSpatialIndex::query_subtree (
+  size_t                               lo,
+  size_t                               hi,
+  double                               start_ticks,
+  double                               end_ticks,
+  double                               min_key,
+  double                               max_key,
+  std::vector<const ArrangerObject *> &out) const
+{
+  if (lo >= hi)
+    return;
+
+  const auto mid = lo + ((hi - lo) / 2);
+
+  // Everything in this subtree ends before the area
+  if (max_end_[mid] < start_ticks)
+    return;
+
+  query_subtree (lo, mid, start_ticks, end_ticks, min_key, max_key, out);
+
+  // This entry and the ones after it start after the area
+  const auto &entry = entries_[mid];
+  if (entry.start_ticks > end_ticks)
+    return;
+
+  if (
+    entry.end_ticks >= start_ticks && entry.max_key >= min_key
+    && entry.min_key <= max_key)
+    {
+      out.push_back (entry.object);
+    }
+
+  query_subtree (mid + 1, hi, start_ticks, end_ticks, min_key, max_key, out);
+}
+
+} // namespace zrythm::structure::arrangement
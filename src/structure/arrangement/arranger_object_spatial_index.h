@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <vector>
+
+#include "structure/arrangement/arranger_object.h"
+
+namespace zrythm::structure::arrangement
+{
+
+/**
+ * @brief Static 2D interval index over arranger objects (time × key).
+ *
+ * The time axis is an augmented interval tree stored implicitly in a vector
+ * sorted by start: each node is the middle entry of its range and tracks the
+ * maximum end of its subtree. The key axis (e.g., pitch or track index) is
+ * checked per entry, since it has a small range compared to time.
+ *
+ * Building is O(n log n) and a query is O(log n + k) for k results, so callers
+ * can rebuild the index after changes and query it on every viewport change.
+ */
+class ArrangerObjectSpatialIndex
+{
+public:
+  struct Entry
+  {
+    double start_ticks{};
+    double end_ticks{};
+    double min_key{};
+    double max_key{};
+
+    const ArrangerObject * object{};
+  };
+
+  /**
+   * @brief Replaces the contents of the index with @p entries.
+   */
+  void rebuild (std::vector<Entry> entries);
+
+  void clear ()
+  {
+    entries_.clear ();
+    max_end_.clear ();
+  }
+
+  size_t size () const { return entries_.size (); }
+
+  /**
+   * @brief Appends the objects intersecting the given area to @p out.
+   *
+   * Ranges are inclusive, so objects touching the edges of the area are
+   * included.
+   */
+  void query (
+    double                               start_ticks,
+    double                               end_ticks,
+    double                               min_key,
+    double                               max_key,
+    std::vector<const ArrangerObject *> &out) const;
+
+private:
+  double build_subtree (size_t lo, size_t hi);
+
+  void query_subtree (
+    size_t                               lo,
+    size_t                               hi,
+    double                               start_ticks,
+    double                               end_ticks,
+    double                               min_key,
+    double                               max_key,
+    std::vector<const ArrangerObject *> &out) const;
+
+private:
+  /** Entries sorted by start. */
+  std::vector<Entry> entries_;
+
+  /** Maximum end of the subtree rooted at each entry. */
+  std::vector<double> max_end_;
+};
+
+} // namespace zrythm::structure::arrangement
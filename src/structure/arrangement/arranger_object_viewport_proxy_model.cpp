@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <ranges>
+
+#include "structure/arrangement/arranger_object_all.h"
+#include "structure/arrangement/arranger_object_list_model.h"
+#include "structure/arrangement/arranger_object_viewport_proxy_model.h"
+#include "utils/math_utils.h"
+
+namespace zrythm::structure::arrangement
+{
+
+ArrangerObjectViewportProxyModel::ArrangerObjectViewportProxyModel (
+  QObject * parent)
+    : QSortFilterProxyModel (parent)
+{
+  QObject::connect (
+    this, &ArrangerObjectViewportProxyModel::viewportChanged, this,
+    &ArrangerObjectViewportProxyModel::handle_viewport_change);
+}
+
+void
+ArrangerObjectViewportProxyModel::setViewportStartTicks (double ticks)
+{
+  if (utils::math::floats_equal (start_ticks_, ticks))
+    return;
+  start_ticks_ = ticks;
+  Q_EMIT viewportChanged ();
+}
+
+void
+ArrangerObjectViewportProxyModel::setViewportEndTicks (double ticks)
+{
+  if (utils::math::floats_equal (end_ticks_, ticks))
+    return;
+  end_ticks_ = ticks;
+  Q_EMIT viewportChanged ();
+}
+
+void
+ArrangerObjectViewportProxyModel::setViewportMinKey (double key)
+{
+  if (utils::math::floats_equal (min_key_, key))
+    return;
+  min_key_ = key;
+  Q_EMIT viewportChanged ();
+}
+
+void
+ArrangerObjectViewportProxyModel::setViewportMaxKey (double key)
+{
+  if (utils::math::floats_equal (max_key_, key))
+    return;
+  max_key_ = key;
+  Q_EMIT viewportChanged ();
+}
+
+void
+ArrangerObjectViewportProxyModel::setKeepAcceptedObjects (bool keep)
+{
+  if (keep_accepted_ == keep)
+    return;
+  keep_accepted_ = keep;
+  Q_EMIT keepAcceptedObjectsChanged (keep);
+
+  // Drop the objects that were only kept
+  if (!keep)
+    handle_viewport_change ();
+}
+
+void
+ArrangerObjectViewportProxyModel::setSourceModel (
+  QAbstractItemModel * source_model)
+{
+  for (const auto &conn : source_connections_)
+    {
+      QObject::disconnect (conn);
+    }
+  source_connections_.clear ();
+  index_dirty_ = true;
+
+  // Mark the index dirty before the base class filters new rows
+  if (source_model != nullptr)
+    {
+      const auto mark_dirty = [this] () { index_dirty_ = true; };
+      source_connections_.push_back (
+        QObject::connect (
+          source_model, &QAbstractItemModel::rowsAboutToBeInserted, this,
+          mark_dirty));
+      source_connections_.push_back (
+        QObject::connect (
+          source_model, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+          mark_dirty));
+      source_connections_.push_back (
+        QObject::connect (
+          source_model, &QAbstractItemModel::modelAboutToBeReset, this,
+          mark_dirty));
+    }
+
+  QSortFilterProxyModel::setSourceModel (source_model);
+
+  // Objects moved or resized
+  if (
+    auto * list_model = qobject_cast<ArrangerObjectListModel *> (source_model))
+    {
+      source_connections_.push_back (
+        QObject::connect (
+          list_model, &ArrangerObjectListModel::contentChanged, this,
+          [this] (utils::ExpandableTickRange) { schedule_rebuild (); }));
+    }
+}
+
+bool
+ArrangerObjectViewportProxyModel::filterAcceptsRow (
+  int                source_row,
+  const QModelIndex &source_parent) const
+{
+  if (index_dirty_)
+    {
+      rebuild_index ();
+    }
+
+  const auto * obj =
+    sourceModel ()
+      ->index (source_row, 0, source_parent)
+      .data (ArrangerObjectListModel::ArrangerObjectPtrRole)
+      .value<ArrangerObject *> ();
+  return visible_objects_.contains (obj);
+}
+
+void
+ArrangerObjectViewportProxyModel::rebuild_index () const
+{
+  index_dirty_ = false;
+  auto * list_model = qobject_cast<ArrangerObjectListModel *> (sourceModel ());
+  if (list_model == nullptr)
+    {
+      index_.clear ();
+      visible_objects_.clear ();
+      return;
+    }
+
+  std::vector<ArrangerObjectSpatialIndex::Entry> entries;
+  entries.reserve (static_cast<size_t> (list_model->rowCount ()));
+  for (const auto row : std::views::iota (0, list_model->rowCount ()))
+    {
+      const auto * obj = list_model->object_at (static_cast<size_t> (row));
+      const auto [start, end] = get_object_tick_range (obj);
+      auto min_key = std::numeric_limits<double>::lowest ();
+      auto max_key = std::numeric_limits<double>::max ();
+      if (const auto * mn = qobject_cast<const MidiNote *> (obj))
+        {
+          min_key = mn->pitch ();
+          max_key = mn->pitch ();
+        }
+      entries.emplace_back (start, end, min_key, max_key, obj);
+    }
+
+  // Forget kept objects that no longer exist
+  if (keep_accepted_)
+    {
+      std::unordered_set<const ArrangerObject *> kept;
+      for (const auto &entry : entries)
+        {
+          if (visible_objects_.contains (entry.object))
+            kept.insert (entry.object);
+        }
+      visible_objects_ = std::move (kept);
+    }
+
+  index_.rebuild (std::move (entries));
+  update_visible_objects ();
+}
+
+void
+ArrangerObjectViewportProxyModel::update_visible_objects () const
+{
+  if (!keep_accepted_)
+    {
+      visible_objects_.clear ();
+    }
+
+  std::vector<const ArrangerObject *> objects;
+  index_.query (start_ticks_, end_ticks_, min_key_, max_key_, objects);
+  visible_objects_.insert (objects.begin (), objects.end ());
+}
+
+void
+ArrangerObjectViewportProxyModel::schedule_rebuild ()
+{
+  index_dirty_ = true;
+  if (refilter_pending_)
+    return;
+
+  refilter_pending_ = true;
+  QMetaObject::invokeMethod (
+    this,
+    [this] () {
+      refilter_pending_ = false;
+      invalidateRowsFilter ();
+    },
+    Qt::QueuedConnection);
+}
+
+void
+ArrangerObjectViewportProxyModel::handle_viewport_change ()
+{
+  if (index_dirty_)
+    {
+      rebuild_index ();
+    }
+  else
+    {
+      update_visible_objects ();
+    }
+  invalidateRowsFilter ();
+}
+
+} // namespace zrythm::structure::arrangement
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <unordered_set>
+
+#include "structure/arrangement/arranger_object_spatial_index.h"
+
+#include <QSortFilterProxyModel>
+#include <QtQmlIntegration/qqmlintegration.h>
+
+namespace zrythm::structure::arrangement
+{
+
+/**
+ * @brief Exposes only the objects of an ArrangerObjectListModel that intersect
+ * a viewport.
+ *
+ * Arrangers use this as the model of their object repeaters, so the number of
+ * delegates depends on the visible area rather than on the number of objects.
+ *
+ * The viewport is given in timeline ticks and keys, where the key of a MIDI
+ * note is its pitch. Other objects span all keys, so only the time range
+ * applies to them. Callers are expected to add a margin to the visible area
+ * to avoid creating delegates at the edges while scrolling.
+ *
+ * Lookups go through an ArrangerObjectSpatialIndex that is rebuilt lazily
+ * after the source model changes.
+ */
+class ArrangerObjectViewportProxyModel : public QSortFilterProxyModel
+{
+  Q_OBJECT
+  Q_PROPERTY (
+    double viewportStartTicks READ viewportStartTicks WRITE
+      setViewportStartTicks NOTIFY viewportChanged)
+  Q_PROPERTY (
+    double viewportEndTicks READ viewportEndTicks WRITE setViewportEndTicks
+      NOTIFY viewportChanged)
+  Q_PROPERTY (
+    double viewportMinKey READ viewportMinKey WRITE setViewportMinKey NOTIFY
+      viewportChanged)
+  Q_PROPERTY (
+    double viewportMaxKey READ viewportMaxKey WRITE setViewportMaxKey NOTIFY
+      viewportChanged)
+  Q_PROPERTY (
+    bool keepAcceptedObjects READ keepAcceptedObjects WRITE
+      setKeepAcceptedObjects NOTIFY keepAcceptedObjectsChanged)
+  QML_ELEMENT
+
+public:
+  ArrangerObjectViewportProxyModel (QObject * parent = nullptr);
+
+  // ========================================================================
+  // QML Interface
+  // ========================================================================
+
+  double viewportStartTicks () const { return start_ticks_; }
+  void   setViewportStartTicks (double ticks);
+  double viewportEndTicks () const { return end_ticks_; }
+  void   setViewportEndTicks (double ticks);
+  double viewportMinKey () const { return min_key_; }
+  void   setViewportMinKey (double key);
+  double viewportMaxKey () const { return max_key_; }
+  void   setViewportMaxKey (double key);
+  Q_SIGNAL void viewportChanged ();
+
+  /**
+   * @brief Whether objects already exposed stay exposed when they leave the
+   * viewport.
+   *
+   * Set while dragging objects, so that their delegates are not destroyed
+   * when the viewport scrolls away from their original position. Objects
+   * entering the viewport are still added.
+   */
+  bool          keepAcceptedObjects () const { return keep_accepted_; }
+  void          setKeepAcceptedObjects (bool keep);
+  Q_SIGNAL void keepAcceptedObjectsChanged (bool keep);
+
+  // ========================================================================
+
+  void setSourceModel (QAbstractItemModel * source_model) override;
+
+protected:
+  bool filterAcceptsRow (int source_row, const QModelIndex &source_parent)
+    const override;
+
+private:
+  /**
+   * @brief Rebuilds the spatial index from the source model.
+   */
+  void rebuild_index () const;
+
+  /**
+   * @brief Updates the set of objects intersecting the viewport.
+   */
+  void update_visible_objects () const;
+
+  /**
+   * @brief Marks the index as dirty and schedules re-filtering.
+   *
+   * Changes are coalesced, so that moving many objects at once only rebuilds
+   * the index once.
+   */
+  void schedule_rebuild ();
+
+  void handle_viewport_change ();
+
+private:
+  double start_ticks_{ std::numeric_limits<double>::lowest () };
+  double end_ticks_{ std::numeric_limits<double>::max () };
+  double min_key_{ std::numeric_limits<double>::lowest () };
+  double max_key_{ std::numeric_limits<double>::max () };
+  bool   keep_accepted_{};
+
+  mutable ArrangerObjectSpatialIndex index_;
+
+  /** Objects intersecting the viewport. */
+  mutable std::unordered_set<const ArrangerObject *> visible_objects_;
+
+  /** Whether the index must be rebuilt before the next lookup. */
+  mutable bool index_dirty_{ true };
+
+  /** Whether re-filtering is already scheduled. */
+  bool refilter_pending_{};
+
+  std::vector<QMetaObject::Connection> source_connections_;
+};
+
+} // namespace zrythm::structure::arrangement
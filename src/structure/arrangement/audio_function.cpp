@@ -1,31 +1,19 @@
-// SPDX-FileCopyrightText: © 2020-2024 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-FileCopyrightText: © 2020-2026 Alexandros Theodotou <alex@zrythm.org>
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
+#include <cmath>
+#include <cstring>
+
+#include "dsp/loudness_analysis_service.h"
 #include "structure/arrangement/audio_function.h"
 #include "utils/enum_utils.h"
+#include "utils/exceptions.h"
+#include "utils/float_ranges.h"
 #include "utils/utf8_string.h"
 
+#include <rubberband/RubberBandStretcher.h>
 #include <rubberband/rubberband-c.h>
 
-DEFINE_ENUM_FORMATTER (
-  zrythm::structure::arrangement::AudioFunctionType,
-  AudioFunctionType,
-  QT_TR_NOOP_UTF8 ("Invert"),
-  QT_TR_NOOP_UTF8 ("Normalize peak"),
-  QT_TR_NOOP_UTF8 ("Normalize RMS"),
-  QT_TR_NOOP_UTF8 ("Normalize LUFS"),
-  QT_TR_NOOP_UTF8 ("Linear fade in"),
-  QT_TR_NOOP_UTF8 ("Linear fade out"),
-  QT_TR_NOOP_UTF8 ("Nudge left"),
-  QT_TR_NOOP_UTF8 ("Nudge right"),
-  QT_TR_NOOP_UTF8 ("Reverse"),
-  QT_TR_NOOP_UTF8 ("Pitch shift"),
-  QT_TR_NOOP_UTF8 ("Copy L to R"),
-  QT_TR_NOOP_UTF8 ("External program"),
-  QT_TR_NOOP_UTF8 ("Guile script"),
-  QT_TR_NOOP_UTF8 ("Custom plugin"),
-  QT_TR_NOOP_UTF8 ("Invalid"));
-
 namespace zrythm::structure::arrangement
 {
 
@@ -80,6 +68,234 @@ audio_function_get_icon_name_for_type (AudioFunctionType type)
   z_return_val_if_reached ({});
 }
 
+bool
+audio_function_is_batchable (AudioFunctionType type)
+{
+  switch (type)
+    {
+    case AudioFunctionType::Invert:
+    case AudioFunctionType::NormalizePeak:
+    case AudioFunctionType::NormalizeRMS:
+    case AudioFunctionType::NormalizeLUFS:
+    case AudioFunctionType::LinearFadeIn:
+    case AudioFunctionType::LinearFadeOut:
+    case AudioFunctionType::NudgeLeft:
+    case AudioFunctionType::NudgeRight:
+    case AudioFunctionType::Reverse:
+    case AudioFunctionType::PitchShift:
+    case AudioFunctionType::CopyLtoR:
+      return true;
+    default:
+      return false;
+    }
+}
+
+/**
+ * Pitch-shifts @p frames by @p pitch_scale, keeping the duration.
+ */
+static void
+pitch_shift (
+  utils::audio::AudioBuffer &frames,
+  units::sample_rate_t       sample_rate,
+  double                     pitch_scale)
+{
+  using RBS = RubberBand::RubberBandStretcher;
+
+  if (!(pitch_scale > 0.0))
+    {
+      throw ZrythmException (
+        fmt::format ("rubberband: invalid pitch scale {}", pitch_scale));
+    }
+
+  const int    channels = frames.getNumChannels ();
+  const size_t num_frames = static_cast<size_t> (frames.getNumSamples ());
+
+  // Single-threaded: batch callers already process one clip per worker
+  RBS stretcher (
+    static_cast<size_t> (sample_rate.in (units::sample_rate)),
+    static_cast<size_t> (channels),
+    RBS::OptionProcessOffline | RBS::OptionEngineFiner
+      | RBS::OptionPitchHighQuality | RBS::OptionFormantPreserved
+      | RBS::OptionThreadingNever | RBS::OptionChannelsApart,
+    1.0, pitch_scale);
+  stretcher.setExpectedInputDuration (num_frames);
+
+  std::vector<const float *> read_ptrs (static_cast<size_t> (channels));
+  std::vector<float *>       write_ptrs (static_cast<size_t> (channels));
+  const auto                 set_read_ptrs = [&] (size_t offset) {
+    for (int c = 0; c < channels; ++c)
+      read_ptrs[static_cast<size_t> (c)] =
+        frames.getReadPointer (c) + static_cast<int> (offset);
+  };
+
+  set_read_ptrs (0);
+  stretcher.study (read_ptrs.data (), num_frames, true);
+
+  utils::audio::AudioBuffer output (channels, static_cast<int> (num_frames));
+  size_t                    retrieved_total = 0;
+  const auto                drain = [&] () {
+    while (retrieved_total < num_frames)
+      {
+        const int avail = stretcher.available ();
+        if (avail <= 0)
+          return;
+        const size_t want = std::min (
+          static_cast<size_t> (avail), num_frames - retrieved_total);
+        for (int c = 0; c < channels; ++c)
+          write_ptrs[static_cast<size_t> (c)] =
+            output.getWritePointer (c) + static_cast<int> (retrieved_total);
+        const size_t got = stretcher.retrieve (write_ptrs.data (), want);
+        if (got == 0)
+          return;
+        retrieved_total += got;
+      }
+  };
+
+  for (size_t offset = 0; offset < num_frames;)
+    {
+      const size_t required =
+        std::min (stretcher.getSamplesRequired (), num_frames - offset);
+      const bool final = offset + required == num_frames;
+      set_read_ptrs (offset);
+      stretcher.process (read_ptrs.data (), required, final);
+      drain ();
+      offset += required;
+    }
+  drain ();
+
+  // Rubberband may return slightly fewer frames than it was fed; the remainder
+  // is left silent
+  if (retrieved_total < num_frames)
+    {
+      output.clear (
+        static_cast<int> (retrieved_total),
+        static_cast<int> (num_frames - retrieved_total));
+    }
+
+  frames = std::move (output);
+}
+
+void
+audio_function_process (
+  AudioFunctionType          type,
+  const AudioFunctionOpts   &opts,
+  utils::audio::AudioBuffer &frames,
+  units::sample_rate_t       sample_rate)
+{
+  const auto channels = frames.getNumChannels ();
+  const auto num_frames = frames.getNumSamples ();
+
+  const auto nudge = [&] (bool left) {
+    const auto nudge_frames = static_cast<int> (std::lround (opts.amount_));
+    if (nudge_frames <= 0 || nudge_frames >= num_frames)
+      {
+        throw ZrythmException (
+          fmt::format (
+            "Invalid nudge of {} frames for {} frames", nudge_frames,
+            num_frames));
+      }
+    const auto num_frames_excl_nudge = num_frames - nudge_frames;
+    for (int ch = 0; ch < channels; ++ch)
+      {
+        auto * data = frames.getWritePointer (ch);
+        if (left)
+          {
+            std::memmove (
+              data, data + nudge_frames,
+              static_cast<size_t> (num_frames_excl_nudge) * sizeof (float));
+            utils::float_ranges::fill (
+              { data + num_frames_excl_nudge,
+                static_cast<size_t> (nudge_frames) },
+              0.f);
+          }
+        else
+          {
+            std::memmove (
+              data + nudge_frames, data,
+              static_cast<size_t> (num_frames_excl_nudge) * sizeof (float));
+            utils::float_ranges::fill (
+              { data, static_cast<size_t> (nudge_frames) }, 0.f);
+          }
+      }
+  };
+
+  switch (type)
+    {
+    case AudioFunctionType::Invert:
+      frames.invert_phase ();
+      break;
+    case AudioFunctionType::NormalizePeak:
+      frames.normalize_peak ();
+      break;
+    case AudioFunctionType::NormalizeRMS:
+      {
+        double sum_of_squares = 0.0;
+        for (int ch = 0; ch < channels; ++ch)
+          {
+            const auto * data = frames.getReadPointer (ch);
+            for (int i = 0; i < num_frames; ++i)
+              {
+                sum_of_squares += static_cast<double> (data[i]) * data[i];
+              }
+          }
+        const auto num_samples = static_cast<double> (channels) * num_frames;
+        if (num_samples > 0 && sum_of_squares > 0)
+          {
+            const auto rms_db =
+              10.0 * std::log10 (sum_of_squares / num_samples);
+            frames.applyGain (
+              static_cast<float> (
+                std::pow (10.0, (opts.amount_ - rms_db) / 20.0)));
+          }
+      }
+      break;
+    case AudioFunctionType::NormalizeLUFS:
+      {
+        const auto loudness =
+          dsp::LoudnessAnalysisService::analyze_blocking (frames, sample_rate);
+        if (std::isfinite (loudness.integrated_lufs))
+          {
+            frames.applyGain (
+              static_cast<float> (std::pow (
+                10.0, (opts.amount_ - loudness.integrated_lufs) / 20.0)));
+          }
+      }
+      break;
+    case AudioFunctionType::LinearFadeIn:
+      frames.applyGainRamp (0, num_frames, 0.f, 1.f);
+      break;
+    case AudioFunctionType::LinearFadeOut:
+      frames.applyGainRamp (0, num_frames, 1.f, 0.f);
+      break;
+    case AudioFunctionType::NudgeLeft:
+      nudge (true);
+      break;
+    case AudioFunctionType::NudgeRight:
+      nudge (false);
+      break;
+    case AudioFunctionType::Reverse:
+      frames.reverse (0, num_frames);
+      break;
+    case AudioFunctionType::PitchShift:
+      pitch_shift (frames, sample_rate, opts.amount_);
+      break;
+    case AudioFunctionType::CopyLtoR:
+      if (channels != 2)
+        {
+          throw ZrythmException (
+            fmt::format (
+              "copy_lto_r: expected 2 channels but got {}", channels));
+        }
+      frames.copyFrom (1, 0, frames, 0, 0, num_frames);
+      break;
+    default:
+      throw ZrythmException (
+        fmt::format (
+          "Audio function '{}' can't be applied in batch",
+          AudioFunctionType_to_string (type)));
+    }
+}
+
 #if 0
 /**
  * @param frames Interleaved frames.
@@ -353,7 +569,18 @@ audio_function_apply (
       /* TODO rms-normalize */
       break;
     case AudioFunctionType::NormalizeLUFS:
-      /* TODO lufs-normalize */
+      {
+        /* amount is the target integrated loudness in LUFS */
+        const auto loudness =
+          dsp::LoudnessAnalysisService::analyze_blocking (
+            src_frames, AUDIO_ENGINE->get_sample_rate ());
+        if (std::isfinite (loudness.integrated_lufs))
+          {
+            dest_frames.applyGain (
+              static_cast<float> (std::pow (
+                10.0, (opts.amount_ - loudness.integrated_lufs) / 20.0)));
+          }
+      }
       break;
     case AudioFunctionType::LinearFadeIn:
       dest_frames.applyGainRamp (0, num_frames, 0.f, 1.f);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "structure/arrangement/arranger_object.h"
+#include "utils/audio.h"
 
 namespace zrythm::structure::arrangement
 {
@@ -40,6 +41,11 @@ class AudioFunctionOpts
 public:
   /**
    * Amount related to the current function (e.g. pitch shift).
+   *
+   * - PitchShift: pitch scale (e.g., 2.0 for an octave up).
+   * - NormalizeRMS: target RMS level in dBFS.
+   * - NormalizeLUFS: target integrated loudness in LUFS.
+   * - NudgeLeft/NudgeRight: nudge distance in samples.
    */
   double amount_ = 0;
 };
@@ -63,6 +69,32 @@ audio_function_get_detailed_action_for_type (
 utils::Utf8String
 audio_function_get_icon_name_for_type (AudioFunctionType type);
 
+/**
+ * Returns whether @p type can be applied by audio_function_process().
+ *
+ * Functions that need user interaction or external resources (external
+ * programs, scripts, plugins) cannot.
+ */
+bool
+audio_function_is_batchable (AudioFunctionType type);
+
+/**
+ * @brief Applies @p type in place to @p frames.
+ *
+ * Only touches @p frames, so it is safe to call from any thread (e.g., to
+ * process several clips in parallel). The length of @p frames is preserved.
+ *
+ * @param sample_rate Sample rate of @p frames.
+ * @throw ZrythmException if the function can't be applied to @p frames, or
+ * if @p type is not batchable.
+ */
+void
+audio_function_process (
+  AudioFunctionType          type,
+  const AudioFunctionOpts   &opts,
+  utils::audio::AudioBuffer &frames,
+  units::sample_rate_t       sample_rate);
+
 /**
  * Applies the given action to the given selections.
  *
@@ -81,4 +113,23 @@ audio_function_apply (
   AudioFunctionType                                       type,
   AudioFunctionOpts                                       opts,
   std::optional<utils::Utf8String>                        uri);
-}
+} // namespace zrythm::structure::arrangement
+
+DEFINE_ENUM_FORMATTER (
+  zrythm::structure::arrangement::AudioFunctionType,
+  AudioFunctionType,
+  QT_TR_NOOP_UTF8 ("Invert"),
+  QT_TR_NOOP_UTF8 ("Normalize peak"),
+  QT_TR_NOOP_UTF8 ("Normalize RMS"),
+  QT_TR_NOOP_UTF8 ("Normalize LUFS"),
+  QT_TR_NOOP_UTF8 ("Linear fade in"),
+  QT_TR_NOOP_UTF8 ("Linear fade out"),
+  QT_TR_NOOP_UTF8 ("Nudge left"),
+  QT_TR_NOOP_UTF8 ("Nudge right"),
+  QT_TR_NOOP_UTF8 ("Reverse"),
+  QT_TR_NOOP_UTF8 ("Pitch shift"),
+  QT_TR_NOOP_UTF8 ("Copy L to R"),
+  QT_TR_NOOP_UTF8 ("External program"),
+  QT_TR_NOOP_UTF8 ("Guile script"),
+  QT_TR_NOOP_UTF8 ("Custom plugin"),
+  QT_TR_NOOP_UTF8 ("Invalid"));
@@ -496,6 +496,14 @@ ClipRenderer::serialize_to_buffer (
   const AudioClip             &clip,
   juce::AudioSampleBuffer     &buffer,
   std::optional<TimelineRange> timeline_range_ticks)
+{
+  render_audio (prepare_audio_render (clip, timeline_range_ticks), buffer);
+}
+
+ClipRenderer::AudioRenderJob
+ClipRenderer::prepare_audio_render (
+  const AudioClip             &clip,
+  std::optional<TimelineRange> timeline_range_ticks)
 {
   const LoopParameters loop_params (clip);
 
@@ -513,6 +521,8 @@ ClipRenderer::serialize_to_buffer (
         clip.get_tempo_map ().tick_to_samples (clip.position ()->asTick ()));
     }
 
+  AudioRenderJob job;
+
   // Check constraint overlap up front (before rendering) using tick bounds.
   const auto &tempo_map = clip.get_tempo_map ();
   const auto  clip_start_tick = clip.position ()->asTick ();
@@ -523,9 +533,7 @@ ClipRenderer::serialize_to_buffer (
       const auto &constraint_end = timeline_range_ticks->second;
       if (clip_end_tick <= constraint_start || clip_start_tick >= constraint_end)
         {
-          buffer.setSize (2, 0);
-          buffer.clear ();
-          return;
+          return job;
         }
     }
 
@@ -551,16 +559,14 @@ ClipRenderer::serialize_to_buffer (
   // points. This unified path handles both musical-mode cases: identity warp
   // (musical ON → stretch to project tempo) and tempo-derived warp (musical
   // OFF → native speed). The stretch decision is based on sample-space anchors.
-  bool             needs_stretch = false;
-  units::sample_t  timeline_clip_len = native_clip_len;
-  dsp::TimeWarpMap warp;
+  units::sample_t timeline_clip_len = native_clip_len;
   if (source_bpm > units::bpm (0.0) && native_clip_len > units::samples (0))
     {
       auto warp_points = clip.contentWarp ()->warpPoints ();
-      warp = dsp::to_time_warp_map (
+      job.warp = dsp::to_time_warp_map (
         warp_points, tempo_map, clip_start_tick, source_bpm, native_clip_len);
-      needs_stretch = !dsp::is_sample_space_identity (warp.anchors);
-      timeline_clip_len = warp.output_length;
+      job.needs_stretch = !dsp::is_sample_space_identity (job.warp.anchors);
+      timeline_clip_len = job.warp.output_length;
     }
 
   // Size the output buffer and compute where the clip's audio lands in it.
@@ -580,51 +586,36 @@ ClipRenderer::serialize_to_buffer (
         clip_start_sample.in (units::samples) -constraint_start_sample.in (
           units::samples);
     }
-  buffer.setSize (2, static_cast<int> (std::max (int64_t{ 0 }, buf_size)));
-  buffer.clear ();
+  job.buffer_size = static_cast<int> (std::max (int64_t{ 0 }, buf_size));
 
   // The clip-audio indices that overlap the buffer.
   const auto out0 = std::max (int64_t{ 0 }, -clip_buf_offset);
   const auto out1 = std::min (
     timeline_clip_len.in<int64_t> (units::samples), buf_size - clip_buf_offset);
-  const auto dst_start = std::max (int64_t{ 0 }, clip_buf_offset);
-  const auto copy_len = std::max (int64_t{ 0 }, out1 - out0);
-  if (copy_len > 0)
+  job.dst_start = static_cast<int> (std::max (int64_t{ 0 }, clip_buf_offset));
+  job.copy_len = static_cast<int> (std::max (int64_t{ 0 }, out1 - out0));
+  if (job.copy_len > 0)
     {
-      utils::audio::AudioBuffer content;
-      if (needs_stretch)
+      if (job.needs_stretch)
         {
-          // Genuine musical stretch: render the FULL clip (offline RubberBand
-          // needs the whole input for a seamless result) then slice the range.
-          // Note: unlike the no-stretch branch below, this is O(full clip)
-          // even for a sub-range request — unavoidable for offline quality.
-          auto full_b1 = build_native_looped_buffer (
+          // Genuine musical stretch: snapshot the FULL clip (offline
+          // RubberBand needs the whole input for a seamless result) and slice
+          // the range after stretching. Note: unlike the no-stretch branch
+          // below, this is O(full clip) even for a sub-range request —
+          // unavoidable for offline quality.
+          job.content = build_native_looped_buffer (
             clip, units::samples (0), native_clip_len);
-          dsp::StretchOptions stretch_opts;
-          stretch_opts.algorithm = clip.effectiveStretchAlgorithm ();
-          auto engine = dsp::create_default_timestretch_engine (
-            stretch_opts,
-            au::round_as<int> (units::sample_rate, tempo_map.get_sample_rate ()));
-          content = engine->stretch (full_b1, warp, stretch_opts);
-          const int chans =
-            std::min (buffer.getNumChannels (), content.getNumChannels ());
-          for (int c = 0; c < chans; ++c)
-            buffer.copyFrom (
-              c, static_cast<int> (dst_start), content, c,
-              static_cast<int> (out0), static_cast<int> (copy_len));
+          job.content_offset = static_cast<int> (out0);
+          job.stretch_options.algorithm = clip.effectiveStretchAlgorithm ();
+          job.sample_rate = au::round_as<int> (
+            units::sample_rate, tempo_map.get_sample_rate ());
         }
       else
         {
           // No stretch needed: read ONLY the requested range directly from the
           // clip (O(range)) — this is the recording / incremental-update path.
-          content = build_native_looped_buffer (
+          job.content = build_native_looped_buffer (
             clip, units::samples (out0), units::samples (out1));
-          const int chans =
-            std::min (buffer.getNumChannels (), content.getNumChannels ());
-          for (int c = 0; c < chans; ++c)
-            buffer.copyFrom (
-              c, static_cast<int> (dst_start), content, c, 0,
-              static_cast<int> (copy_len));
         }
     }
 
@@ -632,11 +623,69 @@ ClipRenderer::serialize_to_buffer (
     {
       z_debug (
         "Buffer setup: timeline_clip_len={}, buffer samples={}, stretch={}",
-        timeline_clip_len, buffer.getNumSamples (), needs_stretch);
+        timeline_clip_len, job.buffer_size, job.needs_stretch);
+    }
+
+  job.gain = clip.gain ();
+
+  // TODO: Fades are always in project ticks (follow tempo). For non-musical
+  // clips, a fade stored in beats will change in wall-clock time when tempo
+  // changes (e.g., 50ms at 120 BPM → ~43ms at 140 BPM). Consider adding a
+  // fadeTimeUnit="seconds" option for fixed-duration micro-fades.
+  const auto * fade_range = clip.fadeRange ();
+  const auto   offset_to_frames = [&tempo_map] (const dsp::Position * pos) {
+    return static_cast<int> (
+      tempo_map
+        .tick_to_samples_rounded (
+          dsp::TimelineTick{ units::ticks (pos->ticks ()) })
+        .in (units::samples));
+  };
+  job.clip_length_frames = static_cast<int> (
+    clip.get_end_position_samples (true).in (units::samples)
+    - clip_start_sample.in (units::samples));
+  job.fade_in_frames = offset_to_frames (fade_range->startOffset ());
+  job.fade_out_frames = offset_to_frames (fade_range->endOffset ());
+  job.fade_out_pos_frames = job.clip_length_frames - job.fade_out_frames;
+  job.fade_in_opts = dsp::CurveOptions (
+    fade_range->fadeInCurveOpts ()->curviness (),
+    fade_range->fadeInCurveOpts ()->algorithm ());
+  job.fade_out_opts = dsp::CurveOptions (
+    fade_range->fadeOutCurveOpts ()->curviness (),
+    fade_range->fadeOutCurveOpts ()->algorithm ());
+
+  job.builtin_fade_frames = AudioClip::BUILTIN_FADE_FRAMES;
+
+  return job;
+}
+
+void
+ClipRenderer::render_audio (
+  const AudioRenderJob    &job,
+  juce::AudioSampleBuffer &buffer)
+{
+  buffer.setSize (2, job.buffer_size);
+  buffer.clear ();
+
+  if (job.copy_len > 0)
+    {
+      utils::audio::AudioBuffer stretched;
+      if (job.needs_stretch)
+        {
+          auto engine = dsp::create_default_timestretch_engine (
+            job.stretch_options, job.sample_rate);
+          stretched =
+            engine->stretch (job.content, job.warp, job.stretch_options);
+        }
+      const auto &content = job.needs_stretch ? stretched : job.content;
+      const int   chans =
+        std::min (buffer.getNumChannels (), content.getNumChannels ());
+      for (int c = 0; c < chans; ++c)
+        buffer.copyFrom (
+          c, job.dst_start, content, c, job.content_offset, job.copy_len);
     }
 
   // Second pass: apply gain to the entire buffer
-  apply_gain_pass (clip, buffer);
+  apply_gain_pass (job.gain, buffer);
 
   if constexpr (CLIP_SERIALIZER_DEBUG)
     {
@@ -652,7 +701,7 @@ ClipRenderer::serialize_to_buffer (
     }
 
   // Third pass: apply clip fades (object fades)
-  apply_clip_fades_pass (clip, buffer);
+  apply_clip_fades_pass (job, buffer);
 
   if constexpr (CLIP_SERIALIZER_DEBUG)
     {
@@ -668,7 +717,7 @@ ClipRenderer::serialize_to_buffer (
     }
 
   // Fourth pass: apply built-in fades
-  apply_builtin_fades_pass (clip, buffer, AudioClip::BUILTIN_FADE_FRAMES);
+  apply_builtin_fades_pass (buffer, job.builtin_fade_frames);
 
   if constexpr (CLIP_SERIALIZER_DEBUG)
     {
@@ -688,25 +737,21 @@ ClipRenderer::serialize_to_buffer (
  * Applies gain to the entire audio buffer as a separate pass.
  */
 void
-ClipRenderer::apply_gain_pass (
-  const AudioClip         &clip,
-  juce::AudioSampleBuffer &buffer)
+ClipRenderer::apply_gain_pass (float gain, juce::AudioSampleBuffer &buffer)
 {
-  const auto current_gain = clip.gain ();
-
   if constexpr (CLIP_SERIALIZER_DEBUG)
     {
-      z_debug ("apply_gain_pass: gain={}", current_gain);
+      z_debug ("apply_gain_pass: gain={}", gain);
     }
 
-  if (!utils::math::floats_equal (current_gain, 1.f))
+  if (!utils::math::floats_equal (gain, 1.f))
     {
-      buffer.applyGain (current_gain);
+      buffer.applyGain (gain);
 
       if constexpr (CLIP_SERIALIZER_DEBUG)
         {
           z_debug (
-            "Applied gain {}: first sample L={}, R={}", current_gain,
+            "Applied gain {}: first sample L={}, R={}", gain,
             buffer.getSample (0, 0), buffer.getSample (1, 0));
         }
     }
@@ -724,40 +769,14 @@ ClipRenderer::apply_gain_pass (
  */
 void
 ClipRenderer::apply_clip_fades_pass (
-  const AudioClip         &clip,
+  const AudioRenderJob    &job,
   juce::AudioSampleBuffer &buffer)
 {
-  // TODO: Fades are always in project ticks (follow tempo). For non-musical
-  // clips, a fade stored in beats will change in wall-clock time when tempo
-  // changes (e.g., 50ms at 120 BPM → ~43ms at 140 BPM). Consider adding a
-  // fadeTimeUnit="seconds" option for fixed-duration micro-fades.
-  const auto &tempo_map = clip.get_tempo_map ();
-  const auto  clip_length_in_frames = static_cast<int> (
-    clip.get_end_position_samples (true)
-      .in (units::samples) -tempo_map
-      .tick_to_samples_rounded (clip.position ()->asTick ())
-      .in (units::samples));
-  const auto fade_in_pos_in_frames = static_cast<int> (
-    tempo_map
-      .tick_to_samples_rounded (
-        dsp::TimelineTick{
-          units::ticks (clip.fadeRange ()->startOffset ()->ticks ()) })
-      .in (units::samples));
-  const auto fade_out_pos_in_frames =
-    clip_length_in_frames
-    - static_cast<int> (
-      tempo_map
-        .tick_to_samples_rounded (
-          dsp::TimelineTick{
-            units::ticks (clip.fadeRange ()->endOffset ()->ticks ()) })
-        .in (units::samples));
+  const auto clip_length_in_frames = job.clip_length_frames;
+  const auto fade_in_pos_in_frames = job.fade_in_frames;
+  const auto fade_out_pos_in_frames = job.fade_out_pos_frames;
   const auto num_frames_in_fade_in_area = fade_in_pos_in_frames;
-  const auto num_frames_in_fade_out_area = static_cast<int> (
-    tempo_map
-      .tick_to_samples_rounded (
-        dsp::TimelineTick{
-          units::ticks (clip.fadeRange ()->endOffset ()->ticks ()) })
-      .in (units::samples));
+  const auto num_frames_in_fade_out_area = job.fade_out_frames;
 
   if constexpr (CLIP_SERIALIZER_DEBUG)
     {
@@ -796,11 +815,11 @@ ClipRenderer::apply_clip_fades_pass (
           // Ensure we don't divide by zero
           if (num_frames_in_fade_in_area > 0)
             {
-              auto fade_in = static_cast<
-                float> (clip.fadeRange ()->get_normalized_y_for_fade (
-                static_cast<double> (clip_local_frame)
-                  / static_cast<double> (num_frames_in_fade_in_area),
-                true));
+              auto fade_in =
+                static_cast<float> (job.fade_in_opts.get_normalized_y (
+                  static_cast<double> (clip_local_frame)
+                    / static_cast<double> (num_frames_in_fade_in_area),
+                  false));
 
               left_channel[j] *= fade_in;
               right_channel[j] *= fade_in;
@@ -825,11 +844,11 @@ ClipRenderer::apply_clip_fades_pass (
             num_frames_from_fade_out_start <= num_frames_in_fade_out_area
             && num_frames_in_fade_out_area > 0)
             {
-              auto fade_out = static_cast<
-                float> (clip.fadeRange ()->get_normalized_y_for_fade (
-                static_cast<double> (num_frames_from_fade_out_start)
-                  / static_cast<double> (num_frames_in_fade_out_area),
-                false));
+              auto fade_out =
+                static_cast<float> (job.fade_out_opts.get_normalized_y (
+                  static_cast<double> (num_frames_from_fade_out_start)
+                    / static_cast<double> (num_frames_in_fade_out_area),
+                  true));
 
               left_channel[j] *= fade_out;
               right_channel[j] *= fade_out;
@@ -861,7 +880,6 @@ ClipRenderer::apply_clip_fades_pass (
  */
 void
 ClipRenderer::apply_builtin_fades_pass (
-  const AudioClip         &clip,
   juce::AudioSampleBuffer &buffer,
   int                      builtin_fade_frames)
 {
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include "dsp/curve.h"
 #include "dsp/tick_types.h"
+#include "dsp/time_warp_map.h"
+#include "dsp/timestretch_engine.h"
 #include "structure/arrangement/arranger_object_all.h"
 #include "structure/arrangement/loop_segment_iterator.h"
 #include "utils/audio.h"
@@ -72,6 +75,68 @@ public:
     juce::AudioSampleBuffer     &buffer,
     std::optional<TimelineRange> timeline_range_ticks = std::nullopt);
 
+  /**
+   * @brief Self-contained snapshot of everything needed to render an Audio
+   * clip.
+   *
+   * Holds no references to the clip or any other QObject, so it can be
+   * rendered on any thread while the project keeps being edited.
+   */
+  struct AudioRenderJob
+  {
+    /**
+     * Native looped content. This is the whole clip when @ref needs_stretch is
+     * set (offline stretching needs the full input), otherwise only the
+     * requested range.
+     */
+    utils::audio::AudioBuffer content;
+
+    bool                needs_stretch = false;
+    dsp::TimeWarpMap    warp;
+    dsp::StretchOptions stretch_options;
+    int                 sample_rate = 0;
+
+    /** Output buffer size and where the content lands in it. */
+    int buffer_size = 0;
+    int dst_start = 0;
+    int content_offset = 0;
+    int copy_len = 0;
+
+    float gain = 1.f;
+
+    /** Clip (object) fade geometry, in output frames. */
+    int               clip_length_frames = 0;
+    int               fade_in_frames = 0;
+    int               fade_out_pos_frames = 0;
+    int               fade_out_frames = 0;
+    dsp::CurveOptions fade_in_opts;
+    dsp::CurveOptions fade_out_opts;
+
+    int builtin_fade_frames = 0;
+  };
+
+  /**
+   * @brief Snapshots an Audio clip for rendering with render_audio().
+   *
+   * Must be called from the thread that owns the clip. Only copies the source
+   * samples; the expensive work (time-stretching and the gain/fade passes) is
+   * left to render_audio().
+   *
+   * serialize_to_buffer() is equivalent to this followed by render_audio().
+   */
+  static AudioRenderJob prepare_audio_render (
+    const AudioClip             &clip,
+    std::optional<TimelineRange> timeline_range_ticks = std::nullopt);
+
+  /**
+   * @brief Renders a job created by prepare_audio_render().
+   *
+   * Thread-safe: only touches @p job and @p buffer.
+   */
+  static void render_audio (
+    const AudioRenderJob    &job,
+    juce::AudioSampleBuffer &buffer) [[clang::blocking]];
+
   /**
    * @brief A single control point in a rendered automation curve.
    *
@@ -195,20 +260,19 @@ private:
   /**
    * Applies gain to the entire audio buffer as a separate pass.
    */
-  static void
-  apply_gain_pass (const AudioClip &clip, juce::AudioSampleBuffer &buffer);
+  static void apply_gain_pass (float gain, juce::AudioSampleBuffer &buffer);
 
   /**
    * Applies clip (object) fades to the audio buffer as a separate pass.
    */
-  static void
-  apply_clip_fades_pass (const AudioClip &clip, juce::AudioSampleBuffer &buffer);
+  static void apply_clip_fades_pass (
+    const AudioRenderJob    &job,
+    juce::AudioSampleBuffer &buffer);
 
   /**
    * Applies built-in fades to the audio buffer as a separate pass.
    */
   static void apply_builtin_fades_pass (
-    const AudioClip         &clip,
     juce::AudioSampleBuffer &buffer,
     int                      builtin_fade_frames);
 };
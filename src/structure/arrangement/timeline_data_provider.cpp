@@ -13,6 +13,8 @@
 #include "structure/arrangement/clip.h"
 #include "structure/arrangement/timeline_data_provider.h"
 
+#include <QtConcurrentMap>
+
 namespace zrythm::structure::arrangement
 {
 
@@ -133,6 +135,17 @@ AudioTimelineDataProvider::clear_all_caches ()
   rt_clips->clear ();
 }
 
+void
+AudioTimelineDataProvider::set_rendered_audio (
+  IntervalType                   interval,
+  const juce::AudioSampleBuffer &frames)
+{
+  audio_cache_->clear ();
+  audio_cache_->add_audio_clip (interval, frames);
+  audio_cache_->finalize_changes ();
+  set_audio_clips (audio_cache_->audio_clips ());
+}
+
 void
 AudioTimelineDataProvider::cache_audio_clip (const arrangement::AudioClip &clip)
 {
@@ -150,6 +163,75 @@ AudioTimelineDataProvider::cache_audio_clip (const arrangement::AudioClip &clip)
     *audio_buffer);
 }
 
+void
+AudioTimelineDataProvider::submit_audio_render (
+  std::shared_ptr<PendingAudioRender> render)
+{
+  pending_renders_.push_back (render);
+  if (pending_renders_.size () == 1)
+    Q_EMIT pendingRendersChanged ();
+
+  // The functor holds a reference to the request so the items outlive the
+  // map even if this provider is destroyed mid-render.
+  QtConcurrent::map (
+    render->items,
+    [render] (PendingAudioRender::Item &item) {
+      try
+        {
+          ClipRenderer::render_audio (item.job, item.buffer);
+        }
+      catch (const std::exception &e)
+        {
+          z_warning ("Failed to render audio clip: {}", e.what ());
+          item.buffer.setSize (2, 0);
+        }
+
+      // The snapshot can be as large as the clip, so drop it right away
+      item.job.content = {};
+    })
+    .then (this, [this, render] () {
+      render->rendered = true;
+      publish_rendered_audio ();
+    });
+}
+
+void
+AudioTimelineDataProvider::publish_rendered_audio ()
+{
+  std::vector<utils::ExpandableTickRange> published_ranges;
+  while (!pending_renders_.empty () && pending_renders_.front ()->rendered)
+    {
+      const auto render = std::move (pending_renders_.front ());
+      pending_renders_.pop_front ();
+
+      if (render->affected_range.is_full_content ())
+        {
+          audio_cache_->clear ();
+        }
+      else
+        {
+          audio_cache_->remove_sequences_matching_interval (
+            render->sample_interval);
+        }
+      for (const auto &item : render->items)
+        {
+          audio_cache_->add_audio_clip (item.interval, item.buffer);
+        }
+      audio_cache_->finalize_changes ();
+      published_ranges.push_back (render->affected_range);
+    }
+
+  if (published_ranges.empty ())
+    return;
+
+  set_audio_clips (audio_cache_->audio_clips ());
+
+  for (const auto &range : published_ranges)
+    Q_EMIT audioEventsGenerated (range);
+  if (pending_renders_.empty ())
+    Q_EMIT pendingRendersChanged ();
+}
+
 void
 AudioTimelineDataProvider::remove_sequences_matching_interval_from_all_caches (
   IntervalType interval)
@@ -438,28 +520,45 @@ eval_segment (
 }
 } // namespace
 
-std::optional<float>
-AutomationTimelineDataProvider::evaluate_at_sample (
+AutomationTimelineDataProvider::EvaluationRun
+AutomationTimelineDataProvider::find_evaluation_run (
   const std::vector<dsp::AutomationTimelineDataCache::AutomationCacheEntry>
                  &sequences,
   units::sample_t sample_position) noexcept [[clang::nonblocking]]
 {
   using Seg = dsp::AutomationTimelineDataCache::CachedAutomationSegment;
 
-  std::optional<float> last_known_value;
+  EvaluationRun run{
+    .end_sample = units::samples (std::numeric_limits<int64_t>::max ())
+  };
+
+  // Every entry/segment boundary after the sample may change which segment
+  // (or latched value) wins, so the run ends at the nearest one.
+  const auto limit_run = [&] (units::sample_t boundary) {
+    if (boundary > sample_position && boundary < run.end_sample)
+      run.end_sample = boundary;
+  };
 
   for (const auto &entry : sequences)
     {
+      limit_run (entry.start_sample);
+      limit_run (entry.end_sample);
+
       if (
         sample_position >= entry.start_sample
         && sample_position < entry.end_sample)
         {
           if (entry.segments.empty ())
-            return std::nullopt;
+            {
+              run.value.reset ();
+              return run;
+            }
 
           // Binary search: find the last segment whose start_sample <= query.
           auto it = std::ranges::upper_bound (
             entry.segments, sample_position, {}, &Seg::start_sample);
+          if (it != entry.segments.end ())
+            limit_run (it->start_sample);
           if (it != entry.segments.begin ())
             --it;
 
@@ -467,21 +566,9 @@ AutomationTimelineDataProvider::evaluate_at_sample (
             it != entry.segments.end () && sample_position >= it->start_sample
             && sample_position < it->end_sample)
             {
-              const auto &seg = *it;
-              const auto  seg_samples = static_cast<double> (
-                (seg.end_sample - seg.start_sample).in (units::samples));
-              if (seg_samples <= 0.0)
-                return seg.point_a_value;
-
-              const double sub_ratio = std::clamp (
-                static_cast<double> (
-                  (sample_position - seg.start_sample).in (units::samples))
-                  / seg_samples,
-                0.0, 1.0);
-              const double full_ratio =
-                seg.ratio_start + (seg.ratio_end - seg.ratio_start) * sub_ratio;
-
-              return eval_segment (seg, full_ratio);
+              limit_run (it->end_sample);
+              run.segment = &*it;
+              return run;
             }
         }
 
@@ -489,11 +576,38 @@ AutomationTimelineDataProvider::evaluate_at_sample (
       if (entry.end_sample <= sample_position && !entry.segments.empty ())
         {
           const auto &last_seg = entry.segments.back ();
-          last_known_value = eval_segment (last_seg, last_seg.ratio_end);
+          run.value = eval_segment (last_seg, last_seg.ratio_end);
         }
     }
 
-  return last_known_value;
+  return run;
+}
+
+std::optional<float>
+AutomationTimelineDataProvider::evaluate_at_sample (
+  const std::vector<dsp::AutomationTimelineDataCache::AutomationCacheEntry>
+                 &sequences,
+  units::sample_t sample_position) noexcept [[clang::nonblocking]]
+{
+  const auto run = find_evaluation_run (sequences, sample_position);
+  if (run.segment == nullptr)
+    return run.value;
+
+  const auto &seg = *run.segment;
+  const auto  seg_samples =
+    static_cast<double> ((seg.end_sample - seg.start_sample).in (units::samples));
+  if (seg_samples <= 0.0)
+    return seg.point_a_value;
+
+  const double sub_ratio = std::clamp (
+    static_cast<double> (
+      (sample_position - seg.start_sample).in (units::samples))
+      / seg_samples,
+    0.0, 1.0);
+  const double full_ratio =
+    seg.ratio_start + (seg.ratio_end - seg.ratio_start) * sub_ratio;
+
+  return eval_segment (seg, full_ratio);
 }
 
 std::optional<float>
@@ -524,12 +638,49 @@ AutomationTimelineDataProvider::process_automation_events (
               sequences{ active_automation_sequences_ };
   const auto &seq_ref = *sequences;
 
-  for (const auto i : std::views::iota (0zu, nframes.in (units::samples)))
+  // Render the block in runs of samples that share a segment, so each run
+  // costs one search plus a batch curve evaluation.
+  const auto total = nframes.in (units::samples);
+  size_t     i = 0;
+  while (i < total)
     {
       const auto sample_position = start_frame + units::samples (i);
-      const auto automation_value =
-        evaluate_at_sample (seq_ref, sample_position);
-      output_values[i] = automation_value.value_or (-1.f);
+      const auto run = find_evaluation_run (seq_ref, sample_position);
+      const auto run_len = std::min (
+        total - i,
+        static_cast<size_t> (
+          (run.end_sample - sample_position).in (units::samples)));
+      auto run_output = output_values.subspan (i, run_len);
+
+      if (run.segment == nullptr)
+        {
+          std::ranges::fill (run_output, run.value.value_or (-1.f));
+        }
+      else
+        {
+          const auto &seg = *run.segment;
+          const auto  seg_samples = static_cast<double> (
+            (seg.end_sample - seg.start_sample).in (units::samples));
+          if (seg_samples <= 0.0)
+            {
+              std::ranges::fill (run_output, seg.point_a_value);
+            }
+          else
+            {
+              const double ratio_per_sample =
+                (seg.ratio_end - seg.ratio_start) / seg_samples;
+              const double ratio_start =
+                seg.ratio_start
+                + ratio_per_sample
+                    * static_cast<double> (
+                      (sample_position - seg.start_sample).in (units::samples));
+              dsp::evaluate_curve_range (
+                seg.point_a_value, seg.point_b_value, seg.curve_algo,
+                seg.curve_curviness, ratio_start, ratio_per_sample, run_output);
+            }
+        }
+
+      i += run_len;
     }
 }
 
@@ -669,13 +820,15 @@ build_segments_for_pair (
   splits.push_back (tl_b);
   std::ranges::sort (splits);
 
+  dsp::TempoMap::Cursor tempo_cursor (tempo_map);
+  auto                  sb = tempo_cursor.tick_to_samples_rounded (splits[0]);
   for (size_t i = 0; i + 1 < splits.size (); ++i)
     {
       const auto &ta = splits[i];
       const auto &tb = splits[i + 1];
 
-      const auto sa = tempo_map.tick_to_samples_rounded (ta);
-      const auto sb = tempo_map.tick_to_samples_rounded (tb);
+      const auto sa = sb;
+      sb = tempo_cursor.tick_to_samples_rounded (tb);
       if (sb <= sa)
         continue;
 
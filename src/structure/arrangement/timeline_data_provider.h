@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <deque>
+#include <memory>
+
 #include "dsp/graph_node.h"
 #include "dsp/itransport.h"
 #include "dsp/midi_event_buffer.h"
@@ -56,21 +59,8 @@ public:
     utils::ExpandableTickRange            affected_range)
   {
     // Convert tick range to sample range
-    const auto sample_interval = [&affected_range, &tempo_map] ()
-      -> std::pair<units::sample_t, units::sample_t> {
-      if (!affected_range.is_full_content ())
-        {
-          const auto tick_range = affected_range.range ().value ();
-          return std::make_pair (
-            tempo_map.tick_to_samples_rounded (
-              dsp::TimelineTick{ units::ticks (tick_range.first) }),
-            tempo_map.tick_to_samples_rounded (
-              dsp::TimelineTick{ units::ticks (tick_range.second) }));
-        }
-      return std::make_pair (
-        units::samples (static_cast<int64_t> (0)),
-        units::samples (std::numeric_limits<int64_t>::max ()));
-    }();
+    const auto sample_interval =
+      to_sample_interval (tempo_map, affected_range);
 
     // Remove existing caches at given interval (or all caches if no interval
     // given)
@@ -130,6 +120,28 @@ public:
 
 protected:
   virtual dsp::TimelineDataCache * get_base_cache () = 0;
+
+  /**
+   * @brief Converts @p affected_range to a sample interval (the whole timeline
+   * if it covers the full content).
+   */
+  static IntervalType to_sample_interval (
+    const dsp::TempoMap              &tempo_map,
+    const utils::ExpandableTickRange &affected_range)
+  {
+    if (!affected_range.is_full_content ())
+      {
+        const auto tick_range = affected_range.range ().value ();
+        return std::make_pair (
+          tempo_map.tick_to_samples_rounded (
+            dsp::TimelineTick{ units::ticks (tick_range.first) }),
+          tempo_map.tick_to_samples_rounded (
+            dsp::TimelineTick{ units::ticks (tick_range.second) }));
+      }
+    return std::make_pair (
+      units::samples (static_cast<int64_t> (0)),
+      units::samples (std::numeric_limits<int64_t>::max ()));
+  }
   /** Last transport state we've seen */
   dsp::ITransport::PlayState last_seen_transport_state_{
     dsp::ITransport::PlayState::Paused
@@ -233,11 +245,13 @@ private:
     clip_seq.addTimeToMessages (clip.position ()->ticks ());
 
     // Convert JUCE sequence to native events with sample timestamps
+    // (events are sorted by time, so a cursor avoids tempo lookups)
     std::vector<dsp::SampleBasedMidiEvent> native_events;
     native_events.reserve (clip_seq.getNumEvents ());
+    dsp::TempoMap::Cursor tempo_cursor (tempo_map);
     for (const auto &event : clip_seq)
       {
-        const auto sample_time = tempo_map.tick_to_samples_rounded (
+        const auto sample_time = tempo_cursor.tick_to_samples_rounded (
           dsp::TimelineTick{ units::ticks (event->message.getTimeStamp ()) });
         const auto * raw = event->message.getRawData ();
         const auto   raw_size =
@@ -278,6 +292,7 @@ private:
  */
 class AudioTimelineDataProvider : public TimelineDataProvider
 {
+  Q_OBJECT
   friend class TimelineDataProvider;
 
 public:
@@ -324,6 +339,80 @@ public:
     set_audio_clips (audio_cache_->audio_clips ());
   }
 
+  /**
+   * @brief Asynchronous variant of generate_audio_events().
+   *
+   * Snapshots the affected clips on the calling thread (see
+   * ClipRenderer::prepare_audio_render()) and renders them on the global
+   * thread pool. Back on this object's thread, the results replace the cached
+   * clips in the affected range and are published for realtime access, after
+   * which audioEventsGenerated() is emitted.
+   *
+   * Requests are published in the order they were made, even if a later one
+   * finishes rendering first. Should not be mixed with generate_audio_events()
+   * while renders are pending.
+   *
+   * @param tempo_map The tempo map for timing conversion.
+   * @param audio_clips The audio clips to process.
+   * @param affected_range The range of ticks to process.
+   */
+  void generate_audio_events_async (
+    const dsp::TempoMap                                &tempo_map,
+    utils::RangeOf<const arrangement::AudioClip *> auto audio_clips,
+    utils::ExpandableTickRange                          affected_range)
+  {
+    auto render = std::make_shared<PendingAudioRender> ();
+    render->affected_range = affected_range;
+    render->sample_interval = to_sample_interval (tempo_map, affected_range);
+    for (const auto * clip : audio_clips)
+      {
+        // Skip muted clips
+        if (clip->mute ()->muted ())
+          continue;
+        if (
+          !affected_range.is_full_content ()
+          && !clip->is_hit_by_range (render->sample_interval))
+          continue;
+
+        render->items.push_back (
+          PendingAudioRender::Item{
+            .interval = std::make_pair (
+              tempo_map.tick_to_samples_rounded (clip->position ()->asTick ()),
+              clip->get_end_position_samples (true)),
+            .job = ClipRenderer::prepare_audio_render (*clip),
+            .buffer = {} });
+      }
+    submit_audio_render (std::move (render));
+  }
+
+  /**
+   * @brief Replaces the cached audio with @p frames, played at @p interval.
+   *
+   * For audio that is not backed by clips, such as a frozen track's render.
+   * To be called from the UI thread.
+   */
+  void set_rendered_audio (
+    IntervalType                   interval,
+    const juce::AudioSampleBuffer &frames);
+
+  /**
+   * @brief Whether any generate_audio_events_async() request has not been
+   * published yet.
+   */
+  bool has_pending_renders () const { return !pending_renders_.empty (); }
+
+Q_SIGNALS:
+  /**
+   * @brief Emitted after the results of a generate_audio_events_async()
+   * request have been published for realtime access.
+   */
+  void audioEventsGenerated (utils::ExpandableTickRange affectedRange);
+
+  /**
+   * @brief Emitted when has_pending_renders() changes.
+   */
+  void pendingRendersChanged ();
+
 protected:
   dsp::TimelineDataCache * get_base_cache () override
   {
@@ -331,11 +420,41 @@ protected:
   }
 
 private:
+  /**
+   * @brief A generate_audio_events_async() request.
+   */
+  struct PendingAudioRender
+  {
+    struct Item
+    {
+      IntervalType                 interval;
+      ClipRenderer::AudioRenderJob job;
+      juce::AudioSampleBuffer      buffer;
+    };
+
+    utils::ExpandableTickRange affected_range;
+    IntervalType               sample_interval;
+    std::vector<Item>          items;
+
+    /** Set on this object's thread once all items are rendered. */
+    bool rendered = false;
+  };
+
   /**
    * Caches an AudioClip to the audio cache.
    */
   void cache_audio_clip (const arrangement::AudioClip &clip);
 
+  /**
+   * Renders @p render on the thread pool and queues it for publishing.
+   */
+  void submit_audio_render (std::shared_ptr<PendingAudioRender> render);
+
+  /**
+   * Publishes rendered requests from the front of the queue, in order.
+   */
+  void publish_rendered_audio ();
+
   /**
    * @brief Set the audio clips for realtime access.
    *
@@ -350,6 +469,9 @@ private:
     std::vector<dsp::AudioTimelineDataCache::AudioClipEntry>,
     farbot::RealtimeObjectOptions::nonRealtimeMutatable>
     active_audio_clips_;
+
+  /** Requests not published yet, in submission order. */
+  std::deque<std::shared_ptr<PendingAudioRender>> pending_renders_;
 };
 
 /**
@@ -432,6 +554,35 @@ private:
                    &sequences,
     units::sample_t sample_position) noexcept [[clang::nonblocking]];
 
+  /**
+   * @brief A range of consecutive samples that all evaluate against the same
+   * cached segment (or the same fallback value).
+   */
+  struct EvaluationRun
+  {
+    /** Segment covering the run, or nullptr if @ref value applies. */
+    const dsp::AutomationTimelineDataCache::CachedAutomationSegment * segment{};
+
+    /** Value for the whole run when there is no segment (latched or none). */
+    std::optional<float> value;
+
+    /** Exclusive end of the run. */
+    units::sample_t end_sample;
+  };
+
+  /**
+   * @brief Finds the run starting at @p sample_position.
+   *
+   * Evaluating any sample inside the returned run with @ref
+   * evaluate_at_sample gives the same result as evaluating the run's
+   * segment, so @ref process_automation_events can render whole runs with
+   * dsp::evaluate_curve_range() instead of searching per sample.
+   */
+  static EvaluationRun find_evaluation_run (
+    const std::vector<dsp::AutomationTimelineDataCache::AutomationCacheEntry>
+                   &sequences,
+    units::sample_t sample_position) noexcept [[clang::nonblocking]];
+
   /**
    * Caches an AutomationClip to the automation cache.
    */
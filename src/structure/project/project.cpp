@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: © 2018-2026 Alexandros Theodotou <alex@zrythm.org>
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
+#include <unordered_map>
 #include <utility>
 
 #include "utils/format_qt.h"
@@ -18,6 +19,8 @@
 #include "utils/app_settings.h"
 #include "utils/logger.h"
 
+#include <QPointer>
+
 #include <juce_audio_processors/juce_audio_processors.h>
 
 namespace zrythm::structure::project
@@ -146,7 +149,9 @@ Project::Project (
       playback_graph_endpoints_ (fixed_graph_endpoints_),
       graph_dispatcher_ (
         std::unique_ptr<dsp::graph::IGraphBuilder> (
-          new ProjectGraphBuilder (*this, metronome, monitor_fader)),
+          new ProjectGraphBuilder (
+            *this, metronome, monitor_fader,
+            [this] () { return app_settings_.anticipativeProcessing (); })),
         [this] () { return std::span (playback_graph_endpoints_); },
         hw_interface_,
         [this] (const std::function<void ()> &callable) {
@@ -282,6 +287,78 @@ Project::get_final_track_dependencies ()
   };
 }
 
+void
+Project::instantiate_active_plugins ()
+{
+  std::unordered_map<plugins::Plugin *, structure::tracks::Track *>
+    plugin_tracks;
+  for (const auto &track_ref : tracklist_->collection ()->tracks ())
+    {
+      std::vector<plugins::PluginUuidReference> plugins;
+      track_ref.get ()->collect_plugins (plugins);
+      for (const auto &pl_ref : plugins)
+        plugin_tracks.emplace (pl_ref.get (), track_ref.get ());
+    }
+
+  size_t num_deferred = 0;
+  project_registry_.for_each_matching<plugins::Plugin> (
+    [&] (plugins::Plugin &plugin) {
+      if (
+        plugin.instantiationStatus ()
+        != plugins::Plugin::InstantiationStatus::Deferred)
+        return;
+
+      auto * const plugin_ptr = &plugin;
+      const QPointer<structure::tracks::Track> track = [&] ()
+        -> structure::tracks::Track * {
+        const auto it = plugin_tracks.find (plugin_ptr);
+        return it != plugin_tracks.end () ? it->second : nullptr;
+      }();
+      const auto activate_if_in_use = [plugin_ptr, track] () {
+        if (
+          plugin_ptr->currently_enabled ()
+          && (track == nullptr || track->enabled ()))
+          {
+            plugin_ptr->instantiate_deferred ();
+          }
+      };
+
+      activate_if_in_use ();
+      if (plugin.uiVisible ())
+        plugin.instantiate_deferred ();
+      if (
+        plugin.instantiationStatus ()
+        != plugins::Plugin::InstantiationStatus::Deferred)
+        return;
+
+      ++num_deferred;
+      QObject::connect (
+        plugin.bypassParameter (), &dsp::ProcessorParameter::baseValueChanged,
+        &plugin, activate_if_in_use);
+      if (track != nullptr)
+        {
+          QObject::connect (
+            track, &structure::tracks::Track::enabledChanged, &plugin,
+            activate_if_in_use);
+        }
+
+      // The graph was built with the plugin passed through, so it only needs
+      // to be prepared again once it has an instance
+      QObject::connect (
+        &plugin, &plugins::Plugin::instantiationFinished, this,
+        [this, plugin_ptr] (bool successful) {
+          if (successful)
+            graph_dispatcher_.reprepare_processable (*plugin_ptr);
+        },
+        Qt::SingleShotConnection);
+    });
+
+  if (num_deferred > 0)
+    {
+      z_info ("Deferred instantiation of {} inactive plugins", num_deferred);
+    }
+}
+
 void
 Project::add_default_tracks ()
 {
@@ -500,6 +577,8 @@ from_json (const nlohmann::json &j, Project &project)
       j.at (Project::kClipLauncherKey).get_to (*project.clip_launcher_);
     }
 
+  project.instantiate_active_plugins ();
+
   /* chord track MIDI expansion wiring is done in ProjectSession after
    * ProjectUiState is deserialized. */
 }
@@ -187,6 +187,18 @@ public:
     structure::tracks::TrackRecordingCallback callback);
 
 private:
+  /**
+   * @brief Instantiates the deserialized plugins that are currently in use.
+   *
+   * Plugins on disabled tracks or with their bypass on keep only their
+   * serialized state (InstantiationStatus::Deferred) and get instantiated the
+   * first time they are activated, after which they join the running graph
+   * without rebuilding it.
+   *
+   * To be called once after deserialization.
+   */
+  void instantiate_active_plugins ();
+
   static constexpr auto kTempoMapKey = "tempoMap"sv;
   static constexpr auto kRegistryKey = "registry"sv;
   static constexpr auto kTransportKey = "transport"sv;
@@ -13,6 +13,8 @@
 #include "utils/registry_utils.h"
 #include "utils/variant_helpers.h"
 
+#include <unordered_set>
+
 namespace zrythm::structure::project
 {
 
@@ -27,6 +29,19 @@ process_track_connections (
   dsp::MidiPanicProcessor   &midi_panic_processor,
   dsp::Fader *               monitor_fader)
 {
+  /* frozen and anticipated tracks only play their rendered audio */
+  dsp::ProcessorBase * rendered_audio_player = tr->frozen_audio_player ();
+  if (rendered_audio_player == nullptr)
+    rendered_audio_player = self.lookahead_processor_for_track (*tr);
+  if (rendered_audio_player != nullptr)
+    {
+      dsp::ProcessorGraphBuilder::add_connections (
+        graph, *rendered_audio_player);
+      initial_processor_node->connect_to (
+        *graph.get_nodes ().find_node_for_processable (*rendered_audio_player));
+      return;
+    }
+
   /* connect the track processor */
   auto *       track_processor = tr->get_track_processor ();
   auto * const track_processor_node =
@@ -158,12 +173,51 @@ ProjectGraphBuilder::build_graph_impl (dsp::graph::Graph &graph)
       dsp::ProcessorGraphBuilder::add_nodes (graph, *mip);
     }
 
+  /* pick the tracks to process ahead of the playhead */
+  ++build_count_;
+  anticipated_tracks_.clear ();
+  if (anticipation_enabled_provider_ && anticipation_enabled_provider_ ())
+    {
+      for (const auto &cur_tr : tracklist->collection ()->tracks ())
+        {
+          auto * tr = cur_tr.get ();
+          if (!can_anticipate_track (*tr))
+            continue;
+
+          auto &entry = lookahead_processors_[tr->get_uuid ()];
+          if (entry.processor == nullptr)
+            {
+              entry.processor =
+                utils::make_qobject_unique<dsp::LookaheadProcessor> (
+                  lookahead_registry_);
+            }
+          entry.processor->set_name (tr->get_name () + u8" (Lookahead)");
+          entry.last_build = build_count_;
+          anticipated_tracks_.push_back (tr);
+        }
+    }
+  std::erase_if (lookahead_processors_, [this] (const auto &id_and_entry) {
+    return id_and_entry.second.last_build + 1 < build_count_;
+  });
+
   /* add each track */
   for (const auto &cur_tr : tracklist->collection ()->tracks ())
     {
       auto * tr = cur_tr.get ();
+      auto * lookahead_processor = lookahead_processor_for_track (*tr);
 
-      if (auto * tp = tr->get_track_processor ())
+      if (auto * player = tr->frozen_audio_player ())
+        {
+          /* add the frozen audio player in place of the track processor */
+          dsp::ProcessorGraphBuilder::add_nodes (graph, *player);
+        }
+      else if (lookahead_processor != nullptr)
+        {
+          /* the track processor and plugins are processed ahead of time (see
+           * build_lookahead_graph_impl()) */
+          dsp::ProcessorGraphBuilder::add_nodes (graph, *lookahead_processor);
+        }
+      else if (auto * tp = tr->get_track_processor ())
         {
           /* add the track processor */
           dsp::ProcessorGraphBuilder::add_nodes (graph, *tp);
@@ -190,7 +244,9 @@ ProjectGraphBuilder::build_graph_impl (dsp::graph::Graph &graph)
 
       if (auto * channel = tr->channel ())
         {
-          structure::tracks::ChannelSubgraphBuilder::add_nodes (graph, *channel);
+          structure::tracks::ChannelSubgraphBuilder::add_nodes (
+            graph, *channel,
+            !tr->frozen () && lookahead_processor == nullptr);
         }
     }
 
@@ -302,7 +358,7 @@ ProjectGraphBuilder::build_graph_impl (dsp::graph::Graph &graph)
           const auto &sel_provider = project->audio_input_selection_provider ();
           if (
             tr->input_signal_type () == dsp::PortType::Audio && sel_provider
-            && (engine->audio_input_processor () != nullptr))
+            && (engine->audio_input_processor () != nullptr) && !tr->frozen ())
             {
               if (auto * sel = sel_provider (tr->get_uuid ()))
                 {
@@ -355,7 +411,8 @@ ProjectGraphBuilder::build_graph_impl (dsp::graph::Graph &graph)
           const auto &midi_sel_provider =
             project->midi_input_selection_provider ();
           if (
-            tr->input_signal_type () == dsp::PortType::Midi && midi_sel_provider)
+            tr->input_signal_type () == dsp::PortType::Midi && midi_sel_provider
+            && !tr->frozen ())
             {
               if (auto * sel = midi_sel_provider (tr->get_uuid ()))
                 {
@@ -393,9 +450,16 @@ ProjectGraphBuilder::build_graph_impl (dsp::graph::Graph &graph)
           // connect the channel
           if (auto * ch = tr->channel ())
             {
+              dsp::ProcessorBase * rendered_audio_player =
+                tr->frozen_audio_player ();
+              if (rendered_audio_player == nullptr)
+                rendered_audio_player = lookahead_processor_for_track (*tr);
               structure::tracks::ChannelSubgraphBuilder::add_connections (
                 graph, *ch,
-                tr->get_track_processor ()->get_output_ports ().front ());
+                rendered_audio_player != nullptr
+                  ? rendered_audio_player->get_output_ports ().front ()
+                  : tr->get_track_processor ()->get_output_ports ().front (),
+                rendered_audio_player == nullptr);
 
               // connect to target track
               auto route_target =
@@ -403,7 +467,15 @@ ProjectGraphBuilder::build_graph_impl (dsp::graph::Graph &graph)
               if (route_target.has_value ())
                 {
                   auto * output_track = route_target.value ().get ();
-                  if (output_track->input_signal_type () == dsp::PortType::Audio)
+                  if (output_track->frozen ())
+                    {
+                      // the target's inputs are not part of its frozen audio
+                      z_debug (
+                        "Not routing track {} to frozen track {}",
+                        tr->get_name (), output_track->get_name ());
+                    }
+                  else if (
+                    output_track->input_signal_type () == dsp::PortType::Audio)
                     {
                       connect_ports (
                         ch->get_audio_post_fader ().get_audio_out_port (),
@@ -476,7 +548,10 @@ ProjectGraphBuilder::build_graph_impl (dsp::graph::Graph &graph)
                   graph.get_nodes ().find_node_for_processable (*src_port);
                 auto * dest_node =
                   graph.get_nodes ().find_node_for_processable (*dest_port);
-                src_node->connect_to (*dest_node);
+                // ports of frozen tracks' processors and plugins are not in
+                // the graph
+                if (src_node != nullptr && dest_node != nullptr)
+                  src_node->connect_to (*dest_node);
               }
           },
           src_port_var, dest_port_var);
@@ -501,6 +576,127 @@ ProjectGraphBuilder::build_graph_impl (dsp::graph::Graph &graph)
     }
 }
 
+void
+ProjectGraphBuilder::build_lookahead_graph_impl (dsp::graph::Graph &graph)
+{
+  for (auto * tr : anticipated_tracks_)
+    {
+      auto * tp = tr->get_track_processor ();
+      auto * ch = tr->channel ();
+      dsp::ProcessorGraphBuilder::add_nodes (graph, *tp);
+      tracks::ChannelSubgraphBuilder::add_plugin_nodes (graph, *ch);
+      auto &capture_port =
+        lookahead_processor_for_track (*tr)->get_capture_port ();
+      graph.add_node_for_processable (capture_port);
+
+      dsp::ProcessorGraphBuilder::add_connections (graph, *tp);
+      tracks::ChannelSubgraphBuilder::add_insert_connections (
+        graph, *ch, tp->get_output_ports ().front (), capture_port);
+    }
+}
+
+dsp::LookaheadProcessor *
+ProjectGraphBuilder::lookahead_processor_for_track (
+  const tracks::Track &track) const
+{
+  if (!std::ranges::contains (anticipated_tracks_, &track))
+    return nullptr;
+
+  return lookahead_processors_.at (track.get_uuid ()).processor.get ();
+}
+
+bool
+ProjectGraphBuilder::can_anticipate_track (const tracks::Track &track) const
+{
+  if (!track.can_freeze () || track.frozen ())
+    return false;
+
+  // tracks recording or listening to devices need live input
+  const auto * tp = track.get_track_processor ();
+  if (tp->is_recording_armed () || tp->is_monitoring_input ())
+    return false;
+  if (const auto &sel_provider = project_->audio_input_selection_provider ())
+    {
+      const auto * sel = sel_provider (track.get_uuid ());
+      if (sel != nullptr && !sel->deviceName ().isEmpty ())
+        return false;
+    }
+  if (
+    const auto &midi_sel_provider = project_->midi_input_selection_provider ())
+    {
+      const auto * sel = midi_sel_provider (track.get_uuid ());
+      if (sel != nullptr && !sel->deviceIdentifier ().isEmpty ())
+        return false;
+    }
+
+  // clips can be launched at any time
+  for (const auto &scene : project_->clipLauncher ()->scenes ()->scenes ())
+    {
+      if (scene->clipSlots ()->clipSlotForTrack (&track)->clip () != nullptr)
+        return false;
+    }
+
+  // collect the ports of the chain (including parameter modulation inputs)
+  std::unordered_set<dsp::PortUuid> chain_ports;
+  const auto add_chain_ports = [&chain_ports] (
+                                 const dsp::ProcessorBase &processor) {
+    for (const auto &port_ref : processor.get_input_ports ())
+      chain_ports.insert (port_ref.id ());
+    for (const auto &port_ref : processor.get_output_ports ())
+      chain_ports.insert (port_ref.id ());
+    for (const auto &param_ref : processor.get_parameters ())
+      {
+        chain_ports.insert (
+          param_ref.get_object_as<dsp::ProcessorParameter> ()
+            ->get_modulation_input_port_ref ()
+            .id ());
+      }
+  };
+  add_chain_ports (*tp);
+  std::vector<plugins::PluginUuidReference> plugins;
+  track.channel ()->get_plugins (plugins);
+  for (const auto &pl_ref : plugins)
+    {
+      // plugin UIs are for tweaking parameters live
+      if (pl_ref.get ()->uiVisible ())
+        return false;
+
+      add_chain_ports (*pl_ref.get ());
+    }
+
+  // tracks fed by other tracks (routes or sends)
+  auto * tracklist = project_->tracklist ();
+  for (const auto &other_ref : tracklist->collection ()->tracks ())
+    {
+      const auto route_target =
+        tracklist->get_track_route_target (other_ref.id ());
+      if (route_target.has_value () && route_target->id () == track.get_uuid ())
+        return false;
+
+      if (const auto * other_ch = other_ref.get ()->channel ())
+        {
+          const auto sends_to_chain = [&] (const auto &sends) {
+            return std::ranges::any_of (sends, [&] (const auto &send) {
+              const auto dest = send->destination_port ();
+              return dest.has_value () && chain_ports.contains (dest->id ());
+            });
+          };
+          if (
+            sends_to_chain (other_ch->pre_fader_sends ())
+            || sends_to_chain (other_ch->post_fader_sends ()))
+            return false;
+        }
+    }
+
+  // custom connections to or from the chain
+  return std::ranges::none_of (
+    project_->port_connections_manager_->connections (),
+    [&] (const auto &conn) {
+      return chain_ports.contains (conn->src_id_)
+             || chain_ports.contains (conn->dest_id_);
+    });
+}
+
 bool
 ProjectGraphBuilder::can_ports_be_connected (
   Project         &project,
@@ -3,8 +3,15 @@
 
 #pragma once
 
+#include <functional>
+#include <unordered_map>
+
 #include "dsp/graph_builder.h"
+#include "dsp/lookahead_processor.h"
 #include "dsp/port.h"
+#include "structure/tracks/track_fwd.h"
+#include "utils/object_registry.h"
+#include "utils/qt.h"
 
 namespace zrythm::dsp
 {
@@ -20,12 +27,26 @@ class Project;
 class ProjectGraphBuilder final : public dsp::graph::IGraphBuilder
 {
 public:
+  /**
+   * @brief Returns whether tracks that don't need live input should be
+   * processed ahead of the playhead (see build_lookahead_graph()).
+   */
+  using AnticipationEnabledProvider = std::function<bool ()>;
+
+  /**
+   * @param anticipation_enabled_provider Queried on each build. If not set,
+   * nothing is processed ahead of the playhead. Only meant for the engine's
+   * live graph.
+   */
   ProjectGraphBuilder (
-    Project        &project,
-    dsp::Metronome &metronome,
-    dsp::Fader     &monitor_fader)
+    Project                    &project,
+    dsp::Metronome             &metronome,
+    dsp::Fader                 &monitor_fader,
+    AnticipationEnabledProvider anticipation_enabled_provider = {})
       : project_ (&project), metronome_ (&metronome),
-        monitor_fader_ (&monitor_fader)
+        monitor_fader_ (&monitor_fader),
+        anticipation_enabled_provider_ (
+          std::move (anticipation_enabled_provider))
   {
   }
 
@@ -41,12 +62,66 @@ public:
     const dsp::Port &src,
     const dsp::Port &dest);
 
+  /**
+   * @brief Returns the processor playing @p track's pre-rendered chain if the
+   * track was processed ahead of time in the last build, or nullptr.
+   */
+  dsp::LookaheadProcessor *
+  lookahead_processor_for_track (const tracks::Track &track) const;
+
 private:
   void build_graph_impl (dsp::graph::Graph &graph) override;
 
+  /**
+   * @brief Adds the processors and plugins of the tracks anticipated in the
+   * last build_graph().
+   */
+  void build_lookahead_graph_impl (dsp::graph::Graph &graph) override;
+
+  /**
+   * @brief Returns whether @p track's processor and plugins can be processed
+   * ahead of the playhead.
+   *
+   * This is the case for tracks whose chain only depends on the timeline: no
+   * recording or input monitoring, no device inputs, no other tracks routed to
+   * it and no custom connections to or from the chain.
+   *
+   * Tracks that are likely to be changed live are also excluded, since changes
+   * are heard late on anticipated tracks: tracks with clips in the clip
+   * launcher and tracks with an open plugin UI.
+   */
+  bool can_anticipate_track (const tracks::Track &track) const;
+
 private:
-  Project *        project_{};
-  dsp::Metronome * metronome_{};
-  dsp::Fader *     monitor_fader_{};
+  Project *                   project_{};
+  dsp::Metronome *            metronome_{};
+  dsp::Fader *                monitor_fader_{};
+  AnticipationEnabledProvider anticipation_enabled_provider_;
+
+  /** Registry for the lookahead processors' ports. */
+  utils::ObjectRegistry lookahead_registry_;
+
+  struct LookaheadProcessorEntry
+  {
+    utils::QObjectUniquePtr<dsp::LookaheadProcessor> processor;
+
+    /** Last build the processor was used in. */
+    uint64_t last_build{};
+  };
+
+  /**
+   * @brief Lookahead processors per track.
+   *
+   * Kept until they are no longer used by the last 2 builds, since the graph
+   * from the previous build is still processed until it is replaced.
+   */
+  std::unordered_map<tracks::TrackUuid, LookaheadProcessorEntry>
+    lookahead_processors_;
+
+  /** Number of build_graph() calls so far. */
+  uint64_t build_count_{};
+
+  /** Tracks anticipated in the last build. */
+  std::vector<tracks::Track *> anticipated_tracks_;
 };
 }
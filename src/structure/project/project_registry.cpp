@@ -14,6 +14,7 @@
 #include "structure/project/project_registry.h"
 #include "structure/tracks/track_factory.h"
 #include "structure/tracks/track_fwd.h"
+#include "utils/meta_type_index.h"
 #include "utils/serialization.h"
 #include "utils/traits.h"
 #include "utils/variant_helpers.h"
@@ -65,6 +66,9 @@ struct ProjectRegistry::Impl
   boost::unordered::unordered_flat_map<QUuid, Category> uuid_to_category_;
   boost::unordered::unordered_flat_map<QUuid, int>      ref_counts_;
 
+  /// Secondary index by concrete meta type, for for_each_matching().
+  utils::MetaTypeIndex type_index_;
+
   std::optional<DeserializationDependencies> deserialization_dependencies_;
 };
 
@@ -105,6 +109,7 @@ ProjectRegistry::register_object_impl (utils::UuidIdentifiableBase &base)
       impl_->ports_.emplace (uuid, var);
       impl_->uuid_to_category_.emplace (uuid, Impl::Category::Port);
       qobj->setParent (this);
+      impl_->type_index_.insert (base);
       return;
     }
 
@@ -113,6 +118,7 @@ ProjectRegistry::register_object_impl (utils::UuidIdentifiableBase &base)
       impl_->params_.emplace (uuid, param);
       impl_->uuid_to_category_.emplace (uuid, Impl::Category::Param);
       qobj->setParent (this);
+      impl_->type_index_.insert (base);
       return;
     }
 
@@ -123,6 +129,7 @@ ProjectRegistry::register_object_impl (utils::UuidIdentifiableBase &base)
       impl_->plugins_.emplace (uuid, var);
       impl_->uuid_to_category_.emplace (uuid, Impl::Category::Plugin);
       qobj->setParent (this);
+      impl_->type_index_.insert (base);
       return;
     }
 
@@ -133,6 +140,7 @@ ProjectRegistry::register_object_impl (utils::UuidIdentifiableBase &base)
       impl_->tracks_.emplace (uuid, var);
       impl_->uuid_to_category_.emplace (uuid, Impl::Category::Track);
       qobj->setParent (this);
+      impl_->type_index_.insert (base);
       return;
     }
 
@@ -143,6 +151,7 @@ ProjectRegistry::register_object_impl (utils::UuidIdentifiableBase &base)
       impl_->arranger_objects_.emplace (uuid, var);
       impl_->uuid_to_category_.emplace (uuid, Impl::Category::ArrangerObject);
       qobj->setParent (this);
+      impl_->type_index_.insert (base);
       return;
     }
 
@@ -151,6 +160,7 @@ ProjectRegistry::register_object_impl (utils::UuidIdentifiableBase &base)
       impl_->file_audio_sources_.emplace (uuid, fas);
       impl_->uuid_to_category_.emplace (uuid, Impl::Category::FileAudioSource);
       qobj->setParent (this);
+      impl_->type_index_.insert (base);
       return;
     }
 
@@ -245,49 +255,7 @@ ProjectRegistry::for_each_matching_impl (
   const QMetaObject &meta_type,
   ObjectVisitor      visitor) const
 {
-  auto visit_if_matching = [&] (utils::UuidIdentifiableBase &obj) {
-    if (obj.metaObject ()->inherits (&meta_type))
-      visitor (obj);
-  };
-
-  if (meta_type.inherits (&dsp::FileAudioSource::staticMetaObject))
-    {
-      for (const auto &[uuid, ptr] : impl_->file_audio_sources_)
-        visit_if_matching (*ptr);
-      return;
-    }
-  if (
-    meta_type.inherits (
-      &structure::arrangement::ArrangerObject::staticMetaObject))
-    {
-      for (const auto &[uuid, var] : impl_->arranger_objects_)
-        std::visit ([&] (auto * p) { visit_if_matching (*p); }, var);
-      return;
-    }
-  if (meta_type.inherits (&structure::tracks::Track::staticMetaObject))
-    {
-      for (const auto &[uuid, var] : impl_->tracks_)
-        std::visit ([&] (auto * p) { visit_if_matching (*p); }, var);
-      return;
-    }
-  if (meta_type.inherits (&plugins::Plugin::staticMetaObject))
-    {
-      for (const auto &[uuid, var] : impl_->plugins_)
-        std::visit ([&] (auto * p) { visit_if_matching (*p); }, var);
-      return;
-    }
-  if (meta_type.inherits (&dsp::ProcessorParameter::staticMetaObject))
-    {
-      for (const auto &[uuid, ptr] : impl_->params_)
-        visit_if_matching (*ptr);
-      return;
-    }
-  if (meta_type.inherits (&dsp::Port::staticMetaObject))
-    {
-      for (const auto &[uuid, var] : impl_->ports_)
-        std::visit ([&] (auto * p) { visit_if_matching (*p); }, var);
-      return;
-    }
+  impl_->type_index_.for_each_matching (meta_type, visitor);
 }
 
 // ============================================================================
@@ -301,10 +269,11 @@ ProjectRegistry::delete_object_by_id (const QUuid &id)
   if (cat_it == impl_->uuid_to_category_.end ())
     return;
 
-  QObject * raw = nullptr;
+  utils::UuidIdentifiableBase * raw = nullptr;
 
-  auto extract = [] (const auto &var) -> QObject * {
-    return std::visit ([] (auto * p) -> QObject * { return p; }, var);
+  auto extract = [] (const auto &var) -> utils::UuidIdentifiableBase * {
+    return std::visit (
+      [] (auto * p) -> utils::UuidIdentifiableBase * { return p; }, var);
   };
 
   switch (cat_it->second)
@@ -373,6 +342,8 @@ ProjectRegistry::delete_object_by_id (const QUuid &id)
 
   impl_->uuid_to_category_.erase (id);
   impl_->ref_counts_.erase (id);
+  if (raw != nullptr)
+    impl_->type_index_.erase (*raw);
   delete raw;
 }
 
@@ -467,7 +438,10 @@ struct PluginBuilder
   plugins::PluginFactory                  &factory;
   template <typename T> std::unique_ptr<T> build () const
   {
-    return factory.build_for_deserialization<T> ();
+    // Project decides which plugins to instantiate once the tracks are loaded
+    auto plugin = factory.build_for_deserialization<T> ();
+    plugin->set_defer_instantiation (true);
+    return plugin;
   }
 };
 
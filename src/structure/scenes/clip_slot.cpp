@@ -59,11 +59,7 @@ ClipSlotList::ClipSlotList (
   // Initialize clip slots to match existing tracks
   for (size_t i = 0; i < track_collection.track_count (); ++i)
     {
-      auto   slot = utils::make_qobject_unique<ClipSlot> (registry_, this);
-      auto * track = track_collection.get_track_at_index (i);
-      if (track != nullptr)
-        slot->setTimebaseProvider (track->timebaseProvider ());
-      clip_slots_.emplace_back (std::move (slot));
+      clip_slots_.emplace_back (make_clip_slot (i));
     }
 
   // Connect to track collection changes to keep clip slots synced
@@ -74,12 +70,9 @@ ClipSlotList::ClipSlotList (
       beginInsertRows (parentIndex, first, last);
       for (int i = first; i <= last; ++i)
         {
-          auto   slot = utils::make_qobject_unique<ClipSlot> (registry_, this);
-          auto * track =
-            track_collection_.get_track_at_index (static_cast<size_t> (i));
-          if (track != nullptr)
-            slot->setTimebaseProvider (track->timebaseProvider ());
-          clip_slots_.insert (clip_slots_.begin () + i, std::move (slot));
+          clip_slots_.insert (
+            clip_slots_.begin () + i,
+            make_clip_slot (static_cast<size_t> (i)));
         }
       endInsertRows ();
     });
@@ -130,6 +123,19 @@ ClipSlotList::ClipSlotList (
     });
 }
 
+utils::QObjectUniquePtr<ClipSlot>
+ClipSlotList::make_clip_slot (size_t track_index)
+{
+  auto   slot = utils::make_qobject_unique<ClipSlot> (registry_, this);
+  auto * track = track_collection_.get_track_at_index (track_index);
+  if (track != nullptr)
+    slot->setTimebaseProvider (track->timebaseProvider ());
+  QObject::connect (
+    slot.get (), &ClipSlot::clipObjectChanged, this,
+    &ClipSlotList::clipsChanged);
+  return slot;
+}
+
 // ============================================================================
 // Serialization
 // ============================================================================
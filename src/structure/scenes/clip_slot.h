@@ -153,7 +153,14 @@ public:
 
   auto &clip_slots () const { return clip_slots_; }
 
+  /**
+   * @brief Emitted when a clip is set on (or cleared from) any of the slots.
+   */
+  Q_SIGNAL void clipsChanged ();
+
 private:
+  utils::QObjectUniquePtr<ClipSlot> make_clip_slot (size_t track_index);
+
   friend void to_json (nlohmann::json &j, const ClipSlotList &list);
   friend void from_json (const nlohmann::json &j, ClipSlotList &list);
 
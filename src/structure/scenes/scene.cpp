@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: © 2025-2026 Alexandros Theodotou <alex@zrythm.org>
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
+#include <algorithm>
+
 #include "structure/scenes/scene.h"
 #include "utils/qt.h"
 
@@ -52,20 +54,34 @@ SceneList::SceneList (
 void
 SceneList::insert_scene (utils::QObjectUniquePtr<Scene> scene, int index)
 {
+  connect_scene (*scene);
   beginInsertRows ({}, index, index);
   scenes_.insert (scenes_.begin () + index, std::move (scene));
   endInsertRows ();
 }
 
+void
+SceneList::connect_scene (const Scene &scene)
+{
+  QObject::connect (
+    scene.clipSlots (), &ClipSlotList::clipsChanged, this,
+    &SceneList::clipsChanged);
+}
+
 void
 SceneList::removeScene (int index)
 {
   if (index < 0 || index >= static_cast<int> (scenes_.size ()))
     return;
 
+  const bool had_clips = std::ranges::any_of (
+    scenes_.at (index)->clip_slots (),
+    [] (const auto &slot) { return slot->clip () != nullptr; });
   beginRemoveRows ({}, index, index);
   scenes_.erase (scenes_.begin () + index);
   endRemoveRows ();
+  if (had_clips)
+    Q_EMIT clipsChanged ();
 }
 
 void
@@ -150,6 +166,7 @@ from_json (const nlohmann::json &j, SceneList &list)
           auto scene = utils::make_qobject_unique<Scene> (
             list.registry_, list.track_collection_, &list);
           from_json (scene_json, *scene);
+          list.connect_scene (*scene);
           list.scenes_.push_back (std::move (scene));
         }
     }
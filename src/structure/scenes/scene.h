@@ -82,6 +82,12 @@ public:
 
   auto &scenes () const { return scenes_; }
 
+  /**
+   * @brief Emitted when a clip is set on (or cleared from) a slot of any
+   * scene, or a scene with clips is removed.
+   */
+  Q_SIGNAL void clipsChanged ();
+
   // ========================================================================
   // QML Interface
   // ========================================================================
@@ -115,6 +121,8 @@ public:
   // ========================================================================
 
 private:
+  void connect_scene (const Scene &scene);
+
   friend void to_json (nlohmann::json &j, const SceneList &list);
   friend void from_json (const nlohmann::json &j, SceneList &list);
 
@@ -5,8 +5,231 @@
 
 namespace zrythm::structure::tracks
 {
+
+/**
+ * @brief Output of the part of the plugin chain connected so far: the track
+ * processor output (before any processor) or the last processor.
+ */
+using ChainOutput = std::variant<dsp::PortUuidReference, dsp::ProcessorBase *>;
+
+// Connects the outputs of @p src to the inputs of @p dest.
+static void
+connect_to_processor (
+  dsp::graph::Graph  &graph,
+  const ChainOutput  &src,
+  dsp::ProcessorBase &dest)
+{
+  const auto connect_ports =
+    [&] (
+      const dsp::FinalPortSubclass auto &src_port,
+      const dsp::FinalPortSubclass auto &dest_port) {
+      ChannelSubgraphBuilder::add_connection_for_ports (
+        graph, src_port, dest_port);
+    };
+
+  if (
+    const auto * processor_output = std::get_if<dsp::PortUuidReference> (&src))
+    {
+      // connect processor outputs to plugin inputputs
+      std::array<dsp::PortUuidReference, 1> processor_outputs{
+        *processor_output
+      };
+      bool connection_made = ChannelSubgraphBuilder::connect_like_ports (
+        graph, processor_outputs, dest.get_input_ports ());
+
+      // if no connection was made (plugin had no matching inputs), connect
+      // the track processor outputs directly to the plugin processor
+      if (!connection_made)
+        {
+          graph.get_nodes ()
+            .find_node_for_processable (*processor_output->get ())
+            ->connect_to (*graph.get_nodes ().find_node_for_processable (dest));
+        }
+      return;
+    }
+
+  // connect last processor to this processor
+  auto &src_processor = *std::get<dsp::ProcessorBase *> (src);
+  using utils::views::qobject_cast_and_filter;
+  auto src_audio_outs = src_processor.get_output_ports ()
+                        | std::views::transform (&dsp::PortUuidReference::get)
+                        | qobject_cast_and_filter<dsp::AudioPort>;
+  auto dest_audio_ins = dest.get_input_ports ()
+                        | std::views::transform (&dsp::PortUuidReference::get)
+                        | qobject_cast_and_filter<dsp::AudioPort>;
+
+  const size_t num_src_outs = std::ranges::distance (src_audio_outs);
+  const size_t num_dest_ins = std::ranges::distance (dest_audio_ins);
+
+  // Handle audio connections
+  if (num_src_outs > 0 && num_dest_ins > 0)
+    {
+      if (num_src_outs == 1 && num_dest_ins == 1)
+        {
+          // 1:1 connection
+          connect_ports (*src_audio_outs.front (), *dest_audio_ins.front ());
+        }
+      else if (num_src_outs == 1)
+        {
+          // 1:N connection - mono to stereo/multi
+          for (auto * in_port : dest_audio_ins)
+            {
+              connect_ports (*src_audio_outs.front (), *in_port);
+            }
+        }
+      else if (num_dest_ins == 1)
+        {
+          // N:1 connection - stereo/multi to mono
+          connect_ports (*src_audio_outs.front (), *dest_audio_ins.front ());
+        }
+      else
+        {
+          // N:N connection - connect min(N,M) ports
+          for (
+            const auto &[src_audio_out, dest_audio_in] :
+            std::views::zip (src_audio_outs, dest_audio_ins))
+            {
+              connect_ports (*src_audio_out, *dest_audio_in);
+            }
+        }
+    }
+
+  // Handle MIDI connections
+  auto src_midi_outs = src_processor.get_output_ports ()
+                       | std::views::transform (&dsp::PortUuidReference::get)
+                       | qobject_cast_and_filter<dsp::MidiPort>;
+  auto dest_midi_ins = dest.get_input_ports ()
+                       | std::views::transform (&dsp::PortUuidReference::get)
+                       | qobject_cast_and_filter<dsp::MidiPort>;
+
+  if (!src_midi_outs.empty () && !dest_midi_ins.empty ())
+    {
+      // Connect first MIDI out to all MIDI ins
+      auto * midi_out = src_midi_outs.front ();
+      for (auto * midi_in : dest_midi_ins)
+        {
+          connect_ports (*midi_out, *midi_in);
+        }
+    }
+}
+
+/**
+ * @brief Connects the elements of @p group after @p input.
+ *
+ * Elements of serial groups are chained. Elements of parallel groups become
+ * independent branches fed by @p input and summed into the group's fader, so
+ * they can be processed concurrently.
+ *
+ * @return The output of the group (@p input if the group is empty).
+ */
+static ChainOutput
+add_plugin_group_connections (
+  dsp::graph::Graph          &graph,
+  const plugins::PluginGroup &group,
+  const ChainOutput          &input)
+{
+  const auto add_element_connections =
+    [&graph] (
+      const plugins::PluginGroup::Element &element,
+      const ChainOutput                   &element_input) -> ChainOutput {
+    if (
+      const auto * pl_ref =
+        std::get_if<plugins::PluginUuidReference> (&element))
+      {
+        auto * pl = pl_ref->get ();
+        dsp::ProcessorGraphBuilder::add_connections (graph, *pl);
+        connect_to_processor (graph, element_input, *pl);
+        return static_cast<dsp::ProcessorBase *> (pl);
+      }
+    return add_plugin_group_connections (
+      graph, *std::get<plugins::PluginGroup *> (element), element_input);
+  };
+
+  const auto elements = group.elements ();
+  if (
+    group.processing_type ()
+    != plugins::PluginGroup::ProcessingTypeHint::Parallel)
+    {
+      ChainOutput output = input;
+      for (const auto &element : elements)
+        {
+          output = add_element_connections (element, output);
+        }
+      return output;
+    }
+
+  if (elements.empty ())
+    return input;
+
+  auto &fader = group.fader ();
+  dsp::ProcessorGraphBuilder::add_connections (graph, fader);
+  for (const auto &element : elements)
+    {
+      connect_to_processor (
+        graph, add_element_connections (element, input), fader);
+    }
+  return static_cast<dsp::ProcessorBase *> (&fader);
+}
+
+// Connects the track processor output through the channel's plugin groups.
+static ChainOutput
+add_plugin_chain_connections (
+  dsp::graph::Graph            &graph,
+  const Channel                &ch,
+  const dsp::PortUuidReference &track_processor_output)
+{
+  ChainOutput output = track_processor_output;
+  for (const auto * group : { ch.midiFx (), ch.instruments (), ch.inserts () })
+    {
+      output = add_plugin_group_connections (graph, *group, output);
+    }
+  return output;
+}
+
+// Adds the plugins of @p group and the faders of its parallel groups.
+static void
+add_plugin_group_nodes (
+  dsp::graph::Graph          &graph,
+  const plugins::PluginGroup &group)
+{
+  const auto elements = group.elements ();
+  using ProcessingTypeHint = plugins::PluginGroup::ProcessingTypeHint;
+  if (
+    group.processing_type () == ProcessingTypeHint::Parallel
+    && !elements.empty ())
+    {
+      dsp::ProcessorGraphBuilder::add_nodes (graph, group.fader ());
+    }
+  for (const auto &element : elements)
+    {
+      if (
+        const auto * pl_ref =
+          std::get_if<plugins::PluginUuidReference> (&element))
+        {
+          dsp::ProcessorGraphBuilder::add_nodes (graph, *pl_ref->get ());
+        }
+      else
+        {
+          add_plugin_group_nodes (
+            graph, *std::get<plugins::PluginGroup *> (element));
+        }
+    }
+}
+
+void
+ChannelSubgraphBuilder::add_plugin_nodes (dsp::graph::Graph &graph, Channel &ch)
+{
+  for (const auto * group : { ch.midiFx (), ch.instruments (), ch.inserts () })
+    {
+      add_plugin_group_nodes (graph, *group);
+    }
+}
+
 void
-ChannelSubgraphBuilder::add_nodes (dsp::graph::Graph &graph, Channel &ch)
+ChannelSubgraphBuilder::add_nodes (
+  dsp::graph::Graph &graph,
+  Channel           &ch,
+  bool               include_plugins)
 {
   // prefader & post-fader
   if (ch.is_audio ())
@@ -26,12 +249,8 @@ ChannelSubgraphBuilder::add_nodes (dsp::graph::Graph &graph, Channel &ch)
   }
 
   // plugins
-  std::vector<plugins::PluginUuidReference> plugins;
-  ch.get_plugins (plugins);
-  for (const auto &pl_ref : plugins)
-    {
-      dsp::ProcessorGraphBuilder::add_nodes (graph, *pl_ref.get ());
-    }
+  if (include_plugins)
+    add_plugin_nodes (graph, ch);
 
   // sends
   for (const auto &send : ch.pre_fader_sends ())
@@ -48,7 +267,8 @@ void
 ChannelSubgraphBuilder::add_connections (
   dsp::graph::Graph           &graph,
   Channel                     &ch,
-  const dsp::PortUuidReference track_processor_output)
+  const dsp::PortUuidReference track_processor_output,
+  bool                         include_plugins)
 {
   if (
     graph.get_nodes ().find_node_for_processable (*track_processor_output.get ())
@@ -79,112 +299,16 @@ ChannelSubgraphBuilder::add_connections (
   const auto channel_output_type =
     ch.fader ()->is_midi () ? dsp::PortType::Midi : dsp::PortType::Audio;
 
-  std::vector<plugins::PluginUuidReference> plugins;
-  ch.get_plugins (plugins);
-  plugins::Plugin * last_plugin = nullptr;
-  for (
-    auto * const pl :
-    plugins | std::views::transform (&plugins::PluginUuidReference::get))
-    {
-      dsp::ProcessorGraphBuilder::add_connections (graph, *pl);
-      if (last_plugin == nullptr)
-        {
-          // connect processor outputs to plugin inputputs
-          std::array<dsp::PortUuidReference, 1> processor_outputs{
-            track_processor_output
-          };
-          bool connection_made = connect_like_ports (
-            graph, processor_outputs, pl->get_input_ports ());
-
-          // if no connection was made (plugin had no matching inputs), connect
-          // the track processor outputs directly to the plugin processor
-          if (!connection_made)
-            {
-              graph.get_nodes ()
-                .find_node_for_processable (*track_processor_output.get ())
-                ->connect_to (
-                  *graph.get_nodes ().find_node_for_processable (*pl));
-            }
-        }
-      else // else if last processed plugin exists
-        {
-          // connect last plugin to this plugin
-          const auto connect_plugins =
-            [&] (plugins::Plugin &src, plugins::Plugin &dest) {
-              using utils::views::qobject_cast_and_filter;
-              auto src_audio_outs =
-                src.get_output_ports ()
-                | std::views::transform (&dsp::PortUuidReference::get)
-                | qobject_cast_and_filter<dsp::AudioPort>;
-              auto dest_audio_ins =
-                dest.get_input_ports ()
-                | std::views::transform (&dsp::PortUuidReference::get)
-                | qobject_cast_and_filter<dsp::AudioPort>;
-
-              const size_t num_src_outs = std::ranges::distance (src_audio_outs);
-              const size_t num_dest_ins = std::ranges::distance (dest_audio_ins);
-
-              // Handle audio connections
-              if (num_src_outs > 0 && num_dest_ins > 0)
-                {
-                  if (num_src_outs == 1 && num_dest_ins == 1)
-                    {
-                      // 1:1 connection
-                      connect_ports (
-                        *src_audio_outs.front (), *dest_audio_ins.front ());
-                    }
-                  else if (num_src_outs == 1)
-                    {
-                      // 1:N connection - mono to stereo/multi
-                      for (auto * in_port : dest_audio_ins)
-                        {
-                          connect_ports (*src_audio_outs.front (), *in_port);
-                        }
-                    }
-                  else if (num_dest_ins == 1)
-                    {
-                      // N:1 connection - stereo/multi to mono
-                      connect_ports (
-                        *src_audio_outs.front (), *dest_audio_ins.front ());
-                    }
-                  else
-                    {
-                      // N:N connection - connect min(N,M) ports
-                      for (
-                        const auto &[src_audio_out, dest_audio_in] :
-                        std::views::zip (src_audio_outs, dest_audio_ins))
-                        {
-                          connect_ports (*src_audio_out, *dest_audio_in);
-                        }
-                    }
-                }
+  const ChainOutput chain_output =
+    include_plugins
+      ? add_plugin_chain_connections (graph, ch, track_processor_output)
+      : ChainOutput{ track_processor_output };
+  auto * const last_processor =
+    std::holds_alternative<dsp::ProcessorBase *> (chain_output)
+      ? std::get<dsp::ProcessorBase *> (chain_output)
+      : nullptr;
 
-              // Handle MIDI connections
-              auto src_midi_outs =
-                src.get_output_ports ()
-                | std::views::transform (&dsp::PortUuidReference::get)
-                | qobject_cast_and_filter<dsp::MidiPort>;
-              auto dest_midi_ins =
-                dest.get_input_ports ()
-                | std::views::transform (&dsp::PortUuidReference::get)
-                | qobject_cast_and_filter<dsp::MidiPort>;
-
-              if (!src_midi_outs.empty () && !dest_midi_ins.empty ())
-                {
-                  // Connect first MIDI out to all MIDI ins
-                  auto * midi_out = src_midi_outs.front ();
-                  for (auto * midi_in : dest_midi_ins)
-                    {
-                      connect_ports (*midi_out, *midi_in);
-                    }
-                }
-            };
-          connect_plugins (*last_plugin, *pl);
-        }
-      last_plugin = pl;
-    }
-
-  if (plugins.empty ())
+  if (last_processor == nullptr)
     {
       // connect processor outs to channel prefader
       if (channel_output_type == dsp::PortType::Audio)
@@ -210,8 +334,8 @@ ChannelSubgraphBuilder::add_connections (
     }
   else // else if there is at least 1 plugin
     {
-      // connect plugin outputs to channel prefader
-      auto * last_pl = plugins.back ().get ();
+      // connect plugin (or parallel group fader) outputs to channel prefader
+      auto * last_pl = last_processor;
       if (channel_output_type == dsp::PortType::Audio)
         {
           using utils::views::qobject_cast_and_filter;
@@ -382,4 +506,29 @@ ChannelSubgraphBuilder::add_connections (
         ch.get_audio_post_fader ().get_audio_in_port ());
     }
 }
+
+void
+ChannelSubgraphBuilder::add_insert_connections (
+  dsp::graph::Graph           &graph,
+  Channel                     &ch,
+  const dsp::PortUuidReference track_processor_output,
+  dsp::AudioPort              &audio_destination)
+{
+  const auto chain_output =
+    add_plugin_chain_connections (graph, ch, track_processor_output);
+
+  using utils::views::qobject_cast_and_filter;
+  auto audio_outs =
+    (std::holds_alternative<dsp::PortUuidReference> (chain_output)
+       ? std::span (&track_processor_output, 1)
+       : std::span (
+           std::get<dsp::ProcessorBase *> (chain_output)->get_output_ports ()))
+    | std::views::transform (&dsp::PortUuidReference::get)
+    | qobject_cast_and_filter<dsp::AudioPort>;
+  if (!audio_outs.empty ())
+    {
+      add_connection_for_ports (graph, *audio_outs.front (), audio_destination);
+    }
+}
+
 }
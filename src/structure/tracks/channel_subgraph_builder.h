@@ -16,13 +16,34 @@ namespace zrythm::structure::tracks
 class ChannelSubgraphBuilder
 {
 public:
-  static void add_nodes (dsp::graph::Graph &graph, Channel &ch);
+  /**
+   * @brief Adds the channel's nodes to the graph.
+   *
+   * @param include_plugins Whether to add the channel's plugins (plugins are
+   * left out when the track is frozen).
+   */
+  static void add_nodes (
+    dsp::graph::Graph &graph,
+    Channel           &ch,
+    bool               include_plugins = true);
+
+  /**
+   * @brief Adds the nodes of the channel's plugins.
+   *
+   * Also adds the faders of (non-empty) parallel plugin groups, which sum the
+   * outputs of the group's elements (see add_connections()).
+   */
+  static void add_plugin_nodes (dsp::graph::Graph &graph, Channel &ch);
 
   /**
    * @brief Adds connections for the nodes already in the graph.
    *
    * This requires add_nodes() to be called beforehand.
    *
+   * Plugins in serial groups are chained in order. Each element of a parallel
+   * group becomes a separate branch fed by the previous output and summed
+   * into the group's fader, so that layers can be processed concurrently.
+   *
    * @note @p track_processor_output must be added to the graph before calling
    * this.
    *
@@ -30,11 +51,28 @@ public:
    * @param ch
    * @param track_processor_output Track processor output to connect to the
    * channel's input (or the first plugin).
+   * @param include_plugins Whether the plugins were added in add_nodes(). If
+   * false, @p track_processor_output is connected straight to the pre-fader.
    */
   static void add_connections (
     dsp::graph::Graph     &graph,
     Channel               &ch,
-    dsp::PortUuidReference track_processor_output);
+    dsp::PortUuidReference track_processor_output,
+    bool                   include_plugins = true);
+
+  /**
+   * @brief Connects @p track_processor_output through the channel's plugins
+   * to @p audio_destination, leaving out the rest of the channel.
+   *
+   * Used to process the chain separately from the channel (see
+   * dsp::LookaheadProcessor). The plugins, @p track_processor_output and
+   * @p audio_destination must be added to the graph beforehand.
+   */
+  static void add_insert_connections (
+    dsp::graph::Graph     &graph,
+    Channel               &ch,
+    dsp::PortUuidReference track_processor_output,
+    dsp::AudioPort        &audio_destination);
 
   /**
    * @brief Adds a connection to the graph for the given ports.
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include "structure/tracks/frozen_audio_player.h"
+#include "utils/registry_utils.h"
+
+namespace zrythm::structure::tracks
+{
+
+FrozenAudioPlayer::FrozenAudioPlayer (
+  utils::IObjectRegistry &registry,
+  EnabledProvider         enabled_provider,
+  QObject *               parent)
+    : QObject (parent), dsp::ProcessorBase (registry, u8"Frozen Audio"),
+      enabled_provider_ (std::move (enabled_provider)),
+      data_provider_ (
+        utils::make_qobject_unique<arrangement::AudioTimelineDataProvider> (
+          this))
+{
+  auto port_ref = utils::create_object<dsp::AudioPort> (
+    registry, u8"Frozen Audio Out", dsp::PortFlow::Output,
+    dsp::AudioPort::BusLayout::Stereo, 2);
+  port_ref.get_object_as<dsp::AudioPort> ()->set_symbol (
+    u8"frozen_audio_stereo_out");
+  add_output_port (port_ref);
+}
+
+FrozenAudioPlayer::~FrozenAudioPlayer () = default;
+
+void
+FrozenAudioPlayer::set_source (const dsp::FileAudioSource &source)
+{
+  QObject::disconnect (source_connection_);
+  source_connection_ = QObject::connect (
+    &source, &dsp::FileAudioSource::samplesChanged, this,
+    [this, &source] () { update_from_source (source); });
+  update_from_source (source);
+}
+
+void
+FrozenAudioPlayer::update_from_source (const dsp::FileAudioSource &source)
+{
+  const auto &frames = source.get_samples ();
+  if (frames.getNumSamples () == 0)
+    {
+      // Not loaded yet
+      data_provider_->clear_all_caches ();
+      return;
+    }
+
+  data_provider_->set_rendered_audio (
+    std::make_pair (
+      units::samples (static_cast<int64_t> (0)),
+      units::samples (static_cast<int64_t> (frames.getNumSamples ()))),
+    frames);
+}
+
+void
+FrozenAudioPlayer::custom_prepare_for_processing (
+  const dsp::graph::GraphNode * node,
+  units::sample_rate_t          sample_rate,
+  units::sample_u32_t           max_block_length)
+{
+  audio_out_rt_ = &get_stereo_out_port ();
+}
+
+void
+FrozenAudioPlayer::custom_process_block (
+  dsp::graph::ProcessBlockInfo time_nfo,
+  const dsp::ITransport       &transport,
+  const dsp::TempoMap         &tempo_map) noexcept
+{
+  // Output ports are already cleared by ProcessorBase::process_block.
+
+  if (!enabled_provider_ ())
+    return;
+
+  const auto &out_buf = audio_out_rt_->buffers ();
+  data_provider_->process_audio_events (
+    time_nfo, transport.get_play_state (),
+    std::span (out_buf->getWritePointer (0), out_buf->getNumSamples ()),
+    std::span (out_buf->getWritePointer (1), out_buf->getNumSamples ()));
+}
+
+void
+FrozenAudioPlayer::custom_release_resources ()
+{
+  audio_out_rt_ = nullptr;
+}
+
+void
+to_json (nlohmann::json &j, const FrozenAudioPlayer &player)
+{
+  to_json (j, static_cast<const dsp::ProcessorBase &> (player));
+}
+
+void
+from_json (const nlohmann::json &j, FrozenAudioPlayer &player)
+{
+  from_json (j, static_cast<dsp::ProcessorBase &> (player));
+}
+
+} // namespace zrythm::structure::tracks
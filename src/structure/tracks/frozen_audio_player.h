@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include "dsp/file_audio_source.h"
+#include "dsp/processor_base.h"
+#include "structure/arrangement/timeline_data_provider.h"
+
+namespace zrythm::structure::tracks
+{
+
+/**
+ * @brief Plays the rendered audio of a frozen track.
+ *
+ * Takes the place of the track's processor and plugins in the DSP graph,
+ * feeding the channel's pre-fader with the audio rendered when the track was
+ * frozen (starting at the beginning of the timeline).
+ */
+class FrozenAudioPlayer final : public QObject, public dsp::ProcessorBase
+{
+  Q_OBJECT
+  Q_DISABLE_COPY_MOVE (FrozenAudioPlayer)
+
+public:
+  /**
+   * @brief Returns whether the track is enabled.
+   *
+   * Disabled tracks produce silence.
+   */
+  using EnabledProvider = std::function<bool ()>;
+
+  FrozenAudioPlayer (
+    utils::IObjectRegistry &registry,
+    EnabledProvider         enabled_provider,
+    QObject *               parent = nullptr);
+  ~FrozenAudioPlayer () override;
+
+  dsp::AudioPort &get_stereo_out_port () const
+  {
+    return *get_output_ports ().front ().get_object_as<dsp::AudioPort> ();
+  }
+
+  /**
+   * @brief Plays the frames of @p source, following its changes (e.g., when
+   * the pool finishes loading it).
+   */
+  void set_source (const dsp::FileAudioSource &source);
+
+  // ============================================================================
+  // ProcessorBase Interface
+  // ============================================================================
+
+  void custom_prepare_for_processing (
+    const dsp::graph::GraphNode * node,
+    units::sample_rate_t          sample_rate,
+    units::sample_u32_t           max_block_length) override;
+
+  void custom_process_block (
+    dsp::graph::ProcessBlockInfo time_nfo,
+    const dsp::ITransport       &transport,
+    const dsp::TempoMap         &tempo_map) noexcept override;
+
+  void custom_release_resources () override;
+
+  // ============================================================================
+
+private:
+  friend void to_json (nlohmann::json &j, const FrozenAudioPlayer &player);
+  friend void from_json (const nlohmann::json &j, FrozenAudioPlayer &player);
+
+  void update_from_source (const dsp::FileAudioSource &source);
+
+private:
+  const EnabledProvider enabled_provider_;
+
+  utils::QObjectUniquePtr<arrangement::AudioTimelineDataProvider>
+    data_provider_;
+
+  QMetaObject::Connection source_connection_;
+
+  dsp::AudioPort * audio_out_rt_{};
+};
+
+} // namespace zrythm::structure::tracks
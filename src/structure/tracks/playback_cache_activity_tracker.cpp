@@ -28,12 +28,13 @@ PlaybackCacheActivityTracker::PlaybackCacheActivityTracker (
   QObject::connect (
     scheduler, &utils::PlaybackCacheScheduler::isPendingChanged, this,
     [this, scheduler] () {
-      pending_ = scheduler->isPending ();
-      Q_EMIT pendingChanged ();
+      scheduler_pending_ = scheduler->isPending ();
+      updatePending ();
     });
 
   // Sync initial state in case the scheduler is already pending
-  pending_ = scheduler->isPending ();
+  scheduler_pending_ = scheduler->isPending ();
+  pending_ = scheduler_pending_;
 
   // Connect to cache's cachedRangesChanged signal
   QObject::connect (
@@ -53,6 +54,20 @@ PlaybackCacheActivityTracker::PlaybackCacheActivityTracker (
     });
 }
 
+void
+PlaybackCacheActivityTracker::setRenderPending (bool renderPending)
+{
+  render_pending_ = renderPending;
+  updatePending ();
+}
+
+void
+PlaybackCacheActivityTracker::updatePending ()
+{
+  pending_ = scheduler_pending_ || render_pending_;
+  Q_EMIT pendingChanged ();
+}
+
 QVariantList
 PlaybackCacheActivityTracker::entries () const
 {
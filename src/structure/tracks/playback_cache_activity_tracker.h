@@ -103,6 +103,15 @@ public:
    */
   void onRegenerationComplete (utils::ExpandableTickRange affectedRange);
 
+  /**
+   * @brief Marks whether regenerated content is still being rendered in the
+   * background.
+   *
+   * The tracker reports pending while either the scheduler or a background
+   * render is pending.
+   */
+  void setRenderPending (bool renderPending);
+
   [[nodiscard]] bool         isPending () const { return pending_; }
   [[nodiscard]] QVariantList entries () const;
   [[nodiscard]] size_t       entryCount () const { return entries_.size (); }
@@ -116,7 +125,11 @@ Q_SIGNALS:
 private:
   void sweepExpiredEntries ();
 
+  void updatePending ();
+
   bool                                    pending_ = false;
+  bool                                    scheduler_pending_ = false;
+  bool                                    render_pending_ = false;
   std::vector<PlaybackCacheActivityEntry> entries_;
   std::vector<CachedTickRange>            cached_ranges_;
   qint64                                  next_id_ = 0;
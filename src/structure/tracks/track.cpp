@@ -89,6 +89,12 @@ init_from (Track &obj, const Track &other, utils::ObjectCloneType clone_type)
   obj.out_signal_type_ = other.out_signal_type_;
   obj.comment_ = other.comment_;
   obj.frozen_clip_id_ = other.frozen_clip_id_;
+  if (other.frozen_audio_player_)
+    {
+      obj.frozen_audio_player_ = obj.make_frozen_audio_player ();
+      obj.frozen_audio_player_->set_source (
+        *obj.frozen_clip_id_->get_object_as<dsp::FileAudioSource> ());
+    }
   if (other.timebase_provider_->hasOverride ())
     obj.timebase_provider_->setOverride (
       *other.timebase_provider_->overrideValue ());
@@ -254,6 +260,13 @@ Track::make_modulators ()
     plugins::PluginGroup::ProcessingTypeHint::Custom, this);
 }
 
+utils::QObjectUniquePtr<FrozenAudioPlayer>
+Track::make_frozen_audio_player ()
+{
+  return utils::make_qobject_unique<FrozenAudioPlayer> (
+    base_dependencies_.registry_, [this] () { return enabled (); }, this);
+}
+
 utils::QObjectUniquePtr<TrackLaneList>
 Track::make_lanes ()
 {
@@ -338,6 +351,25 @@ Track::init_playback_cache_activity_tracker (TrackProcessor &proc)
         },
         this);
     }
+
+  // Audio caches are rendered in the background, so completion is reported
+  // when the provider publishes them rather than when the request is made
+  if (playback_cache_activity_tracker_ && proc.is_audio ())
+    {
+      auto &provider = proc.timeline_audio_data_provider ();
+      QObject::connect (
+        &provider,
+        &arrangement::AudioTimelineDataProvider::audioEventsGenerated,
+        playback_cache_activity_tracker_.get (),
+        &PlaybackCacheActivityTracker::onRegenerationComplete);
+      QObject::connect (
+        &provider,
+        &arrangement::AudioTimelineDataProvider::pendingRendersChanged,
+        playback_cache_activity_tracker_.get (), [this, &provider] () {
+          playback_cache_activity_tracker_->setRenderPending (
+            provider.has_pending_renders ());
+        });
+    }
 }
 
 utils::QObjectUniquePtr<PianoRollTrackMixin>
@@ -511,6 +543,7 @@ void
 Track::regeneratePlaybackCaches (utils::ExpandableTickRange affectedRange)
 {
   ZoneScoped;
+  bool       audio_render_submitted = false;
   const auto generate_events_for_clip_type = [&]<arrangement::ClipObject ClipT> () {
     z_debug (
       "Arranger object contents changed for track '{}' - regenerating caches for range [{}]",
@@ -543,9 +576,11 @@ Track::regeneratePlaybackCaches (utils::ExpandableTickRange affectedRange)
         if (processor_->is_audio () && lanes_)
           {
             auto all_clips = get_all_lane_clips ();
-            processor_->timeline_audio_data_provider ().generate_audio_events (
-              base_dependencies_.tempo_map_.get_tempo_map (), all_clips,
-              affectedRange);
+            processor_->timeline_audio_data_provider ()
+              .generate_audio_events_async (
+                base_dependencies_.tempo_map_.get_tempo_map (), all_clips,
+                affectedRange);
+            audio_render_submitted = true;
           }
       }
   };
@@ -565,7 +600,9 @@ Track::regeneratePlaybackCaches (utils::ExpandableTickRange affectedRange)
         }
     }
 
-  if (playback_cache_activity_tracker_)
+  // Background audio renders report completion themselves (see
+  // init_playback_cache_activity_tracker())
+  if (playback_cache_activity_tracker_ && !audio_render_submitted)
     playback_cache_activity_tracker_->onRegenerationComplete (affectedRange);
 }
 
@@ -636,6 +673,34 @@ Track::collect_timeline_objects (
   collect_additional_timeline_objects (objects);
 }
 
+void
+Track::set_frozen_audio (
+  std::optional<dsp::FileAudioSourceUuidReference> source)
+{
+  if (source && !can_freeze ())
+    {
+      throw ZrythmException (
+        fmt::format ("Track '{}' cannot be frozen", get_name ()));
+    }
+
+  const bool was_frozen = frozen ();
+  if (source)
+    {
+      if (!frozen_audio_player_)
+        frozen_audio_player_ = make_frozen_audio_player ();
+      frozen_audio_player_->set_source (
+        *source->get_object_as<dsp::FileAudioSource> ());
+    }
+  else
+    {
+      frozen_audio_player_.reset ();
+    }
+  frozen_clip_id_ = std::move (source);
+
+  if (was_frozen != frozen ())
+    Q_EMIT frozenChanged (frozen ());
+}
+
 void
 to_json (nlohmann::json &j, const Track &track)
 {
@@ -650,7 +715,11 @@ to_json (nlohmann::json &j, const Track &track)
   // j[Track::kInputSignalTypeKey] = track.in_signal_type_;
   // j[Track::kOutputSignalTypeKey] = track.out_signal_type_;
   j[Track::kCommentKey] = track.comment_;
-  // j[Track::kFrozenClipIdKey] = track.frozen_clip_id_;
+  if (track.frozen_clip_id_)
+    {
+      j[Track::kFrozenClipIdKey] = *track.frozen_clip_id_;
+      j[Track::kFrozenAudioPlayerKey] = *track.frozen_audio_player_;
+    }
   if (track.processor_)
     {
       j[Track::kProcessorKey] = track.processor_;
@@ -697,8 +766,15 @@ from_json (const nlohmann::json &j, Track &track)
   // j.at (Track::kInputSignalTypeKey).get_to (track.in_signal_type_);
   // j.at (Track::kOutputSignalTypeKey).get_to (track.out_signal_type_);
   j.at (Track::kCommentKey).get_to (track.comment_);
-  // TODO
-  // j.at (Track::kFrozenClipIdKey).get_to (track.frozen_clip_id_);
+  if (j.contains (Track::kFrozenClipIdKey))
+    {
+      track.frozen_clip_id_ = { track.base_dependencies_.registry_ };
+      j.at (Track::kFrozenClipIdKey).get_to (*track.frozen_clip_id_);
+      track.frozen_audio_player_ = track.make_frozen_audio_player ();
+      j.at (Track::kFrozenAudioPlayerKey).get_to (*track.frozen_audio_player_);
+      track.frozen_audio_player_->set_source (
+        *track.frozen_clip_id_->get_object_as<dsp::FileAudioSource> ());
+    }
   if (track.channel_)
     {
       j.at (Track::kChannelKey).get_to (*track.channel_);
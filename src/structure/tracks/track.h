@@ -7,6 +7,7 @@
 #include "dsp/timebase.h"
 #include "structure/tracks/automation_tracklist.h"
 #include "structure/tracks/channel.h"
+#include "structure/tracks/frozen_audio_player.h"
 #include "structure/tracks/piano_roll_track.h"
 #include "structure/tracks/playback_cache_activity_tracker.h"
 #include "structure/tracks/track_fwd.h"
@@ -70,6 +71,8 @@ class Track : public utils::UuidIdentifiableObject<Track>
   Q_PROPERTY (QString icon READ icon WRITE setIcon NOTIFY iconChanged)
   Q_PROPERTY (bool visible READ visible WRITE setVisible NOTIFY visibleChanged)
   Q_PROPERTY (bool enabled READ enabled WRITE setEnabled NOTIFY enabledChanged)
+  Q_PROPERTY (bool frozen READ frozen NOTIFY frozenChanged)
+  Q_PROPERTY (bool canFreeze READ can_freeze CONSTANT)
   Q_PROPERTY (bool isDeletable READ is_deletable CONSTANT)
   Q_PROPERTY (double height READ height WRITE setHeight NOTIFY heightChanged)
   Q_PROPERTY (
@@ -416,6 +419,9 @@ public:
   }
   Q_SIGNAL void enabledChanged (bool enabled);
 
+  bool          frozen () const { return frozen_clip_id_.has_value (); }
+  Q_SIGNAL void frozenChanged (bool frozen);
+
   double height () const { return main_height_; }
   void   setHeight (double height)
   {
@@ -481,6 +487,8 @@ public:
    * like MIDI or audio events.
    *
    * This will request new caches to be generated for the track processor.
+   * Audio caches are rendered on the global thread pool and published when
+   * ready; MIDI caches are generated immediately.
    */
   Q_INVOKABLE void
   regeneratePlaybackCaches (utils::ExpandableTickRange affectedRange);
@@ -580,6 +588,45 @@ public:
 
   TrackProcessor * get_track_processor () const { return processor_.get (); }
 
+  /**
+   * @brief Whether the track's processing chain can be rendered and replaced
+   * by its audio (see set_frozen_audio()).
+   */
+  bool can_freeze () const
+  {
+    return channel_ && processor_ && channel_->is_audio () && !is_master ();
+  }
+
+  /**
+   * @brief Pool file the track is frozen with, if frozen.
+   */
+  const std::optional<dsp::FileAudioSourceUuidReference> &frozen_audio () const
+  {
+    return frozen_clip_id_;
+  }
+
+  /**
+   * @brief Player of the frozen audio, if the track is frozen.
+   */
+  FrozenAudioPlayer * frozen_audio_player () const
+  {
+    return frozen_audio_player_.get ();
+  }
+
+  /**
+   * @brief Freezes the track with the given rendered audio, or unfreezes it
+   * if nullopt is passed.
+   *
+   * While frozen, the track's processor and plugins are left out of the DSP
+   * graph and the channel is fed by frozen_audio_player() instead, so the
+   * graph must be recalculated after calling this.
+   *
+   * @param source Pool file holding the audio of the track's pre-fader,
+   * starting at the beginning of the timeline.
+   */
+  void
+  set_frozen_audio (std::optional<dsp::FileAudioSourceUuidReference> source);
+
   auto get_icon_name () const { return icon_name_; }
 
 protected:
@@ -626,6 +673,7 @@ private:
   static constexpr auto kOutputSignalTypeKey = "outSignalType"sv;
   static constexpr auto kCommentKey = "comment"sv;
   static constexpr auto kFrozenClipIdKey = "frozenClipId"sv;
+  static constexpr auto kFrozenAudioPlayerKey = "frozenAudioPlayer"sv;
   static constexpr auto kProcessorKey = "processor"sv;
   static constexpr auto kAutomationTracklistKey = "automationTracklist"sv;
   static constexpr auto kChannelKey = "channel"sv;
@@ -644,6 +692,8 @@ private:
   [[nodiscard]] utils::QObjectUniquePtr<plugins::PluginGroup>
                                                        make_modulators ();
   [[nodiscard]] utils::QObjectUniquePtr<TrackLaneList> make_lanes ();
+  [[nodiscard]] utils::QObjectUniquePtr<FrozenAudioPlayer>
+  make_frozen_audio_player ();
   [[nodiscard]] utils::QObjectUniquePtr<PianoRollTrackMixin>
   make_piano_roll_track_mixin ();
 
@@ -713,11 +763,14 @@ protected:
 
   /**
    * @brief Pool ID of the clip if track is frozen (unset if not frozen).
-   *
-   * Currently unused.
    */
   std::optional<dsp::FileAudioSourceUuidReference> frozen_clip_id_;
 
+  /**
+   * @brief Plays the frozen clip in place of the processing chain, if frozen.
+   */
+  utils::QObjectUniquePtr<FrozenAudioPlayer> frozen_audio_player_;
+
   /**
    * @brief Automation tracks, if track is automatable.
    */
@@ -59,6 +59,18 @@ TrackCollection::TrackCollection (
                 recording_param->range ().isToggled (
                   recording_param->baseValue ()));
             }
+
+          if (auto * monitor_param = track->monitorParam ())
+            {
+              monitor_param_connections_[track->get_uuid ()] =
+                QObject::connect (
+                  monitor_param, &dsp::ProcessorParameter::baseValueChanged,
+                  this, [this, track_ptr = QPointer<Track> (track)] () {
+                    if (track_ptr.isNull ())
+                      return;
+                    Q_EMIT trackMonitorModeChanged (track_ptr);
+                  });
+            }
         }
       Q_EMIT numSoloedTracksChanged ();
       Q_EMIT numMutedTracksChanged ();
@@ -88,11 +100,16 @@ TrackCollection::TrackCollection (
             }
 
           auto track_id = track->get_uuid ();
-          auto conn_it = recording_param_connections_.find (track_id);
-          if (conn_it != recording_param_connections_.end ())
+          for (
+            auto * connections :
+            { &recording_param_connections_, &monitor_param_connections_ })
             {
-              QObject::disconnect (conn_it->second);
-              recording_param_connections_.erase (conn_it);
+              auto conn_it = connections->find (track_id);
+              if (conn_it != connections->end ())
+                {
+                  QObject::disconnect (conn_it->second);
+                  connections->erase (conn_it);
+                }
             }
         }
     });
@@ -115,6 +115,12 @@ public:
 
   Q_SIGNAL void trackRecordingArmedChanged (Track * track, bool armed);
 
+  /**
+   * @brief Emitted when the monitor mode of a track with a monitor parameter
+   * changes.
+   */
+  Q_SIGNAL void trackMonitorModeChanged (Track * track);
+
   // ========================================================================
   // Track Management
   // ========================================================================
@@ -349,6 +355,8 @@ private:
 
   std::unordered_map<Track::Uuid, QMetaObject::Connection>
     recording_param_connections_;
+  std::unordered_map<Track::Uuid, QMetaObject::Connection>
+    monitor_param_connections_;
 
   bool move_in_progress_ = false;
 };
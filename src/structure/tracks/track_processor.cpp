@@ -340,6 +340,18 @@ TrackProcessor::is_recording_armed_rt () const noexcept
   return param.range ().isToggled (param.currentValue ());
 }
 
+bool
+TrackProcessor::is_monitoring_input () const
+{
+  if (!impl_->monitor_audio_id_.has_value ())
+    return false;
+  const auto &param = get_monitor_audio_param ();
+  const auto  mode =
+    param.range ().template enum_value<MonitorMode> (param.baseValue ());
+  return mode == MonitorMode::On
+         || (mode == MonitorMode::Auto && is_recording_armed ());
+}
+
 void
 TrackProcessor::set_recording_armed (bool armed)
 {
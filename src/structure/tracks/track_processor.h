@@ -218,6 +218,14 @@ public:
   bool is_recording_armed_rt () const noexcept [[clang::nonblocking]];
   void set_recording_armed (bool armed);
 
+  /**
+   * @brief Returns whether audio from the track's inputs is currently passed
+   * through to its output (monitor On, or Auto while armed).
+   *
+   * Always false for tracks without a monitor parameter.
+   */
+  bool is_monitoring_input () const;
+
   /**
    * MIDI in Port.
    *
@@ -129,6 +129,9 @@ class AppSettings : public QObject
   DEFINE_SETTING_PROPERTY (QString, rtAudioAudioDeviceName, {})
   DEFINE_SETTING_PROPERTY (int, sampleRate, 3)         // 48000
   DEFINE_SETTING_PROPERTY (int, audioBufferSize, 5)    // 512
+  // render playback-only tracks ahead of the playhead (live changes on those
+  // tracks are heard with a delay)
+  DEFINE_SETTING_PROPERTY (bool, anticipativeProcessing, false)
   DEFINE_SETTING_PROPERTY (int, bounceTailLength, 100) // 100ms
   DEFINE_SETTING_PROPERTY (bool, bounceWithParents, 100)
   DEFINE_SETTING_PROPERTY (int, bounceStep, 2) // post-fader
@@ -37,6 +37,19 @@ public:
     const std::filesystem::path &file_path,
     juce::AudioSampleBuffer    &&buffer);
 
+  /**
+   * @brief Creates a writer for @p file_path, picking the format from its
+   * extension.
+   *
+   * Parent directories are created if needed.
+   *
+   * @throw std::runtime_error if the format is unsupported or the file cannot
+   * be opened.
+   */
+  static std::unique_ptr<juce::AudioFormatWriter> create_writer (
+    const juce::AudioFormatWriterOptions &writer_options,
+    const std::filesystem::path          &file_path);
+
 private:
   /**
    * @brief Writes the audio buffer to file.
@@ -0,0 +1,246 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace zrythm::utils
+{
+
+/**
+ * @brief Bounded multiple-producer multiple-consumer lock-free queue.
+ *
+ * This follows Dmitry Vyukov's bounded MPMC queue design, see
+ * http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ *
+ * Each slot carries a sequence number that tells producers and consumers
+ * whether the slot is ready for them, so a push or pop only needs a single
+ * CAS on the shared position.
+ *
+ * Compared to MPMCQueue:
+ * - Each slot occupies its own cache line, so threads working on adjacent
+ *   slots don't invalidate each other's caches.
+ * - push_back_bulk() and pop_front_bulk() claim a run of consecutive slots
+ *   with a single CAS.
+ *
+ * All operations except reserve() and clear() are lock-free and
+ * realtime-safe.
+ */
+template <typename T> class BoundedMPMCQueue
+{
+  static_assert (std::is_nothrow_copy_assignable_v<T>);
+  static_assert (std::is_default_constructible_v<T>);
+
+public:
+  /**
+   * @brief Assumed cache line size.
+   *
+   * std::hardware_destructive_interference_size is not used because its
+   * value may differ between compilers and compiler flags.
+   */
+  static constexpr size_t kCacheLineSize = 64;
+
+  /**
+   * @param capacity Minimum capacity (rounded up to a power of 2).
+   */
+  explicit BoundedMPMCQueue (size_t capacity = 8) { reserve (capacity); }
+
+  BoundedMPMCQueue (const BoundedMPMCQueue &) = delete;
+  BoundedMPMCQueue &operator= (const BoundedMPMCQueue &) = delete;
+  BoundedMPMCQueue (BoundedMPMCQueue &&) = delete;
+  BoundedMPMCQueue &operator= (BoundedMPMCQueue &&) = delete;
+  ~BoundedMPMCQueue () = default;
+
+  size_t capacity () const { return mask_ + 1; }
+
+  /**
+   * @brief Ensures the queue can hold at least @p capacity elements.
+   *
+   * Clears the queue if it needs to grow.
+   *
+   * @warning Not thread-safe.
+   */
+  void reserve (size_t capacity)
+  {
+    capacity = std::bit_ceil (std::max (capacity, size_t{ 2 }));
+    if (slots_ && capacity <= this->capacity ())
+      return;
+
+    slots_ = std::make_unique<Slot[]> (capacity);
+    mask_ = capacity - 1;
+    clear ();
+  }
+
+  /**
+   * @brief Removes all elements.
+   *
+   * @warning Not thread-safe.
+   */
+  void clear ()
+  {
+    for (size_t i = 0; i <= mask_; ++i)
+      {
+        slots_[i].sequence.store (i, std::memory_order_relaxed);
+      }
+    enqueue_pos_.store (0, std::memory_order_relaxed);
+    dequeue_pos_.store (0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns the number of elements in the queue.
+   *
+   * The result is only approximate while other threads use the queue.
+   */
+  size_t size_approx () const
+  {
+    const auto enqueue_pos = enqueue_pos_.load (std::memory_order_relaxed);
+    const auto dequeue_pos = dequeue_pos_.load (std::memory_order_relaxed);
+    return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+  }
+
+  /**
+   * @brief Appends an element.
+   *
+   * @return Whether the element was added (false if the queue is full).
+   */
+  bool push_back (const T &value)
+  {
+    return push_back_bulk (std::span<const T> (&value, 1)) == 1;
+  }
+
+  /**
+   * @brief Removes the first element.
+   *
+   * @return Whether an element was removed (false if the queue is empty).
+   */
+  bool pop_front (T &value)
+  {
+    return pop_front_bulk (std::span<T> (&value, 1)) == 1;
+  }
+
+  /**
+   * @brief Appends as many of the given elements as there is room for.
+   *
+   * The elements are added in order and without being interleaved with
+   * elements from other producers.
+   *
+   * @return The number of elements added (from the start of @p values).
+   */
+  size_t push_back_bulk (std::span<const T> values)
+  {
+    if (values.empty ())
+      return 0;
+
+    size_t pos = enqueue_pos_.load (std::memory_order_relaxed);
+    size_t count = 0;
+    for (;;)
+      {
+        // A slot is free for position `p` when its sequence equals `p`
+        const auto first_dif = sequence_dif (pos, 0);
+        if (first_dif < 0)
+          return 0; // full
+        if (first_dif > 0)
+          {
+            pos = enqueue_pos_.load (std::memory_order_relaxed);
+            continue;
+          }
+
+        count = 1;
+        while (count < values.size () && sequence_dif (pos + count, 0) == 0)
+          {
+            ++count;
+          }
+
+        if (
+          enqueue_pos_.compare_exchange_weak (
+            pos, pos + count, std::memory_order_relaxed))
+          break;
+      }
+
+    for (size_t i = 0; i < count; ++i)
+      {
+        auto &slot = slots_[(pos + i) & mask_];
+        slot.value = values[i];
+        slot.sequence.store (pos + i + 1, std::memory_order_release);
+      }
+    return count;
+  }
+
+  /**
+   * @brief Removes up to `out.size()` elements from the front.
+   *
+   * @return The number of elements written to the start of @p out.
+   */
+  size_t pop_front_bulk (std::span<T> out)
+  {
+    if (out.empty ())
+      return 0;
+
+    size_t pos = dequeue_pos_.load (std::memory_order_relaxed);
+    size_t count = 0;
+    for (;;)
+      {
+        // A slot is ready for position `p` when its sequence equals `p + 1`
+        const auto first_dif = sequence_dif (pos, 1);
+        if (first_dif < 0)
+          return 0; // empty
+        if (first_dif > 0)
+          {
+            pos = dequeue_pos_.load (std::memory_order_relaxed);
+            continue;
+          }
+
+        count = 1;
+        while (count < out.size () && sequence_dif (pos + count, 1) == 0)
+          {
+            ++count;
+          }
+
+        if (
+          dequeue_pos_.compare_exchange_weak (
+            pos, pos + count, std::memory_order_relaxed))
+          break;
+      }
+
+    for (size_t i = 0; i < count; ++i)
+      {
+        auto &slot = slots_[(pos + i) & mask_];
+        out[i] = slot.value;
+        slot.sequence.store (pos + i + mask_ + 1, std::memory_order_release);
+      }
+    return count;
+  }
+
+private:
+  struct alignas (kCacheLineSize) Slot
+  {
+    std::atomic<size_t> sequence;
+    T                   value{};
+  };
+
+  /**
+   * @brief Returns the difference between the sequence of the slot at @p pos
+   * and the sequence expected for it (`pos + offset`).
+   */
+  intptr_t sequence_dif (size_t pos, size_t offset) const
+  {
+    const auto seq =
+      slots_[pos & mask_].sequence.load (std::memory_order_acquire);
+    return static_cast<intptr_t> (seq) - static_cast<intptr_t> (pos + offset);
+  }
+
+  std::unique_ptr<Slot[]> slots_;
+  size_t                  mask_{};
+  alignas (kCacheLineSize) std::atomic<size_t> enqueue_pos_{ 0 };
+  alignas (kCacheLineSize) std::atomic<size_t> dequeue_pos_{ 0 };
+};
+
+} // namespace zrythm::utils
@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstring>
+
+#include <fmt/std.h>
+
+#include "utils/decoded_audio_cache.h"
+#include "utils/logger.h"
+#include "utils/utf8_string.h"
+
+#include <QSaveFile>
+#include <QStandardPaths>
+
+namespace zrythm::utils::audio
+{
+
+namespace
+{
+
+constexpr std::array<char, 8> ENTRY_MAGIC{ 'Z', 'P', 'C', 'M', 0, 0, 0, 0 };
+constexpr uint32_t            ENTRY_VERSION = 1;
+constexpr auto                ENTRY_EXTENSION = ".pcm";
+constexpr auto                HASH_INDEX_FILENAME = "file-hashes";
+
+/**
+ * @brief Header of an entry, followed by the planar frames.
+ *
+ * 64 bytes so that the frames stay aligned.
+ */
+struct EntryHeader
+{
+  std::array<char, 8>  magic{};
+  uint32_t             version{};
+  uint32_t             num_channels{};
+  uint64_t             num_frames{};
+  uint64_t             file_hash{};
+  int64_t              sample_rate{};
+  std::array<char, 24> reserved{};
+};
+static_assert (sizeof (EntryHeader) == 64);
+
+qint64
+expected_entry_size (const EntryHeader &header)
+{
+  return static_cast<qint64> (sizeof (EntryHeader))
+         + (static_cast<qint64> (header.num_channels)
+            * static_cast<qint64> (header.num_frames)
+            * static_cast<qint64> (sizeof (float)));
+}
+
+} // namespace
+
+DecodedAudioCache::MappedEntry::~MappedEntry ()
+{
+  if (data_ != nullptr)
+    file_.unmap (data_);
+}
+
+void
+DecodedAudioCache::MappedEntry::refer_to (AudioBuffer &buffer) const
+{
+  buffer.setDataToReferTo (channels_.data (), num_channels (), num_frames_);
+}
+
+DecodedAudioCache::DecodedAudioCache (
+  std::filesystem::path dir,
+  std::uintmax_t        max_size_bytes)
+    : dir_ (std::move (dir)), max_size_bytes_ (max_size_bytes),
+      hash_index_ (dir_ / HASH_INDEX_FILENAME)
+{
+}
+
+std::filesystem::path
+DecodedAudioCache::default_dir ()
+{
+  return Utf8String::from_qstring (
+           QStandardPaths::writableLocation (QStandardPaths::CacheLocation))
+           .to_path ()
+         / "decoded-audio";
+}
+
+auto
+DecodedAudioCache::key_for (
+  const std::filesystem::path &source_path,
+  units::sample_rate_t         sample_rate) -> Key
+{
+  return {
+    .file_hash = hash_index_.get_file_hash (source_path),
+    .sample_rate = sample_rate
+  };
+}
+
+std::filesystem::path
+DecodedAudioCache::entry_path (const Key &key) const
+{
+  return dir_
+         / fmt::format (
+           "{}-{}{}", hash::to_string (key.file_hash),
+           key.sample_rate.in (units::sample_rate), ENTRY_EXTENSION);
+}
+
+std::shared_ptr<const DecodedAudioCache::MappedEntry>
+DecodedAudioCache::map (const Key &key)
+{
+  const auto path = entry_path (key);
+
+  // Entries are replaced atomically, so no lock is needed for reading
+  std::shared_ptr<MappedEntry> entry (new MappedEntry ());
+  entry->file_.setFileName (Utf8String::from_path (path).to_qstring ());
+  if (!entry->file_.open (QIODevice::ReadOnly))
+    return nullptr;
+
+  const auto  file_size = entry->file_.size ();
+  EntryHeader header;
+  const auto  corrupt = [&] (std::string_view reason) {
+    z_warning ("Removing corrupt decoded audio entry {}: {}", path, reason);
+    entry.reset ();
+    std::error_code ec;
+    std::filesystem::remove (path, ec);
+    return nullptr;
+  };
+  constexpr auto header_size = static_cast<qint64> (sizeof (EntryHeader));
+  if (
+    entry->file_.read (reinterpret_cast<char *> (&header), header_size)
+    != header_size)
+    {
+      return corrupt ("truncated header");
+    }
+  if (header.magic != ENTRY_MAGIC || header.version != ENTRY_VERSION)
+    return corrupt ("unknown format");
+  if (
+    header.file_hash != key.file_hash
+    || header.sample_rate != key.sample_rate.in (units::sample_rate))
+    {
+      return corrupt ("key mismatch");
+    }
+  if (
+    header.num_channels == 0 || header.num_frames == 0
+    || header.num_frames > static_cast<uint64_t> (INT_MAX)
+    || file_size != expected_entry_size (header))
+    {
+      return corrupt ("size mismatch");
+    }
+
+  entry->data_ = entry->file_.map (0, file_size, QFileDevice::MapPrivateOption);
+  if (entry->data_ == nullptr)
+    {
+      z_warning (
+        "Failed to map decoded audio entry {}: {}", path,
+        entry->file_.errorString ());
+      return nullptr;
+    }
+
+  entry->num_frames_ = static_cast<int> (header.num_frames);
+  auto * frames = reinterpret_cast<float *> (entry->data_ + sizeof (header));
+  for (uint32_t ch = 0; ch < header.num_channels; ++ch)
+    {
+      entry->channels_.push_back (
+        frames + (static_cast<size_t> (ch) * header.num_frames));
+    }
+
+  // Mark as recently used
+  std::error_code ec;
+  std::filesystem::last_write_time (
+    path, std::filesystem::file_time_type::clock::now (), ec);
+
+  return entry;
+}
+
+void
+DecodedAudioCache::store (const Key &key, const AudioBuffer &frames)
+{
+  if (frames.getNumChannels () == 0 || frames.getNumSamples () == 0)
+    return;
+
+  const auto  path = entry_path (key);
+  EntryHeader header{
+    .magic = ENTRY_MAGIC,
+    .version = ENTRY_VERSION,
+    .num_channels = static_cast<uint32_t> (frames.getNumChannels ()),
+    .num_frames = static_cast<uint64_t> (frames.getNumSamples ()),
+    .file_hash = key.file_hash,
+    .sample_rate = key.sample_rate.in (units::sample_rate),
+  };
+
+  {
+    std::scoped_lock lock (dir_mutex_);
+
+    // Written to a temporary file and renamed on commit, so readers never
+    // see a partial entry
+    QSaveFile file (Utf8String::from_path (path).to_qstring ());
+    if (!file.open (QIODevice::WriteOnly))
+      {
+        z_warning (
+          "Failed to create decoded audio entry {}: {}", path,
+          file.errorString ());
+        return;
+      }
+    constexpr auto header_size = static_cast<qint64> (sizeof (header));
+    bool           ok =
+      file.write (reinterpret_cast<const char *> (&header), header_size)
+      == header_size;
+    const auto channel_bytes = static_cast<qint64> (
+      static_cast<size_t> (frames.getNumSamples ()) * sizeof (float));
+    for (int ch = 0; ok && ch < frames.getNumChannels (); ++ch)
+      {
+        ok =
+          file.write (
+            reinterpret_cast<const char *> (frames.getReadPointer (ch)),
+            channel_bytes)
+          == channel_bytes;
+      }
+    if (!ok || !file.commit ())
+      {
+        z_warning (
+          "Failed to write decoded audio entry {}: {}", path,
+          file.errorString ());
+        return;
+      }
+  }
+
+  z_debug (
+    "Stored {} frames ({} channels) in decoded audio entry {}",
+    header.num_frames, header.num_channels, path);
+  evict ();
+}
+
+std::uintmax_t
+DecodedAudioCache::size_bytes () const
+{
+  std::scoped_lock lock (dir_mutex_);
+  std::uintmax_t   total = 0;
+  std::error_code  ec;
+  for (const auto &file : std::filesystem::directory_iterator (dir_, ec))
+    {
+      if (file.path ().extension () == ENTRY_EXTENSION)
+        total += file.file_size (ec);
+    }
+  return total;
+}
+
+void
+DecodedAudioCache::evict ()
+{
+  struct EntryInfo
+  {
+    std::filesystem::path           path;
+    std::uintmax_t                  size;
+    std::filesystem::file_time_type last_used;
+  };
+
+  std::scoped_lock       lock (dir_mutex_);
+  std::vector<EntryInfo> entries;
+  std::uintmax_t         total = 0;
+  std::error_code        ec;
+  for (const auto &file : std::filesystem::directory_iterator (dir_, ec))
+    {
+      if (file.path ().extension () != ENTRY_EXTENSION)
+        continue;
+      const auto size = file.file_size (ec);
+      if (ec)
+        continue;
+      entries.push_back (
+        { .path = file.path (),
+          .size = size,
+          .last_used = file.last_write_time (ec) });
+      total += size;
+    }
+  if (total <= max_size_bytes_)
+    return;
+
+  std::ranges::sort (entries, {}, &EntryInfo::last_used);
+  for (const auto &entry : entries)
+    {
+      if (total <= max_size_bytes_)
+        break;
+
+      // Existing mappings of the entry stay valid on POSIX systems. Elsewhere
+      // the removal fails and is retried on the next store
+      if (std::filesystem::remove (entry.path, ec))
+        {
+          z_debug ("Evicted decoded audio entry {}", entry.path);
+          total -= entry.size;
+        }
+    }
+}
+
+} // namespace zrythm::utils::audio
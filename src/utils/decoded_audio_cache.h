@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "utils/audio.h"
+#include "utils/file_hash_index.h"
+#include "utils/hash.h"
+#include "utils/units.h"
+
+#include <QFile>
+
+namespace zrythm::utils::audio
+{
+
+/**
+ * @brief On-disk cache of decoded (and resampled) audio files.
+ *
+ * Each entry holds the planar float32 frames of one source file at one sample
+ * rate, so loading the same file again only needs to map the entry instead of
+ * decoding and resampling it.
+ *
+ * Entries are keyed by the hash of the source file's contents, so they stay
+ * valid when a project is copied or saved elsewhere, and are evicted (least
+ * recently used first) once the cache grows past its size limit. The hashes
+ * are remembered in a hash::FileHashIndex next to the entries, so a hit does
+ * not need to read the source file.
+ *
+ * Thread-safe.
+ */
+class DecodedAudioCache
+{
+public:
+  /**
+   * @brief A mapped cache entry.
+   *
+   * The frames are mapped copy-on-write, so they can be edited in place
+   * without affecting the entry on disk or other mappings of it.
+   */
+  class MappedEntry
+  {
+  public:
+    MappedEntry (const MappedEntry &) = delete;
+    MappedEntry &operator= (const MappedEntry &) = delete;
+    MappedEntry (MappedEntry &&) = delete;
+    MappedEntry &operator= (MappedEntry &&) = delete;
+    ~MappedEntry ();
+
+    int num_channels () const { return static_cast<int> (channels_.size ()); }
+    int num_frames () const { return num_frames_; }
+
+    /**
+     * @brief Points @p buffer to the mapped frames.
+     *
+     * The buffer must not be used after this entry is destroyed, unless it was
+     * resized or assigned to in the meantime.
+     */
+    void refer_to (AudioBuffer &buffer) const;
+
+  private:
+    friend class DecodedAudioCache;
+    MappedEntry () = default;
+
+    QFile                file_;
+    uchar *              data_{};
+    std::vector<float *> channels_;
+    int                  num_frames_{};
+  };
+
+  struct Key
+  {
+    hash::HashT          file_hash{};
+    units::sample_rate_t sample_rate;
+  };
+
+  /**
+   * @param dir Directory to keep the entries in. Created if missing.
+   * @param max_size_bytes Size above which the least recently used entries are
+   * evicted.
+   */
+  DecodedAudioCache (std::filesystem::path dir, std::uintmax_t max_size_bytes);
+
+  /**
+   * @brief Default location in the user's cache directory.
+   */
+  static std::filesystem::path default_dir ();
+
+  static constexpr std::uintmax_t DEFAULT_MAX_SIZE_BYTES = 4ULL << 30;
+
+  /**
+   * @brief Returns the key for @p source_path decoded at @p sample_rate.
+   *
+   * The file is only read if it changed since its key was last requested.
+   *
+   * @throw ZrythmException if the file cannot be read.
+   */
+  Key key_for (
+    const std::filesystem::path &source_path,
+    units::sample_rate_t         sample_rate);
+
+  /**
+   * @brief Maps the entry for @p key, if any.
+   *
+   * Returns nullptr if there is no entry, or if it is corrupt (in which case
+   * it is removed).
+   */
+  std::shared_ptr<const MappedEntry> map (const Key &key);
+
+  /**
+   * @brief Stores @p frames as the entry for @p key.
+   *
+   * Failures are logged and otherwise ignored, since the cache is only an
+   * optimization.
+   */
+  void store (const Key &key, const AudioBuffer &frames);
+
+  /**
+   * @brief Total size of the entries in bytes.
+   */
+  std::uintmax_t size_bytes () const;
+
+private:
+  std::filesystem::path entry_path (const Key &key) const;
+
+  /** Evicts entries until the cache fits in @ref max_size_bytes_. */
+  void evict ();
+
+private:
+  std::filesystem::path dir_;
+  std::uintmax_t        max_size_bytes_;
+  hash::FileHashIndex   hash_index_;
+
+  /** Serializes eviction with other writes to the directory. */
+  mutable std::mutex dir_mutex_;
+};
+
+} // namespace zrythm::utils::audio
@@ -0,0 +1,203 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <charconv>
+#include <string_view>
+
+#include <fmt/std.h>
+
+#include "utils/exceptions.h"
+#include "utils/file_hash_index.h"
+#include "utils/io_utils.h"
+#include "utils/logger.h"
+#include "utils/utf8_string.h"
+
+#include <QFile>
+#include <QSaveFile>
+
+using zrythm::utils::exceptions::ZrythmException;
+
+namespace zrythm::utils::hash
+{
+
+namespace
+{
+
+/**
+ * @brief Records that may be outdated before the index file gets compacted.
+ */
+constexpr size_t MAX_OUTDATED_RECORDS = 1024;
+
+/**
+ * @brief Parses the next space-terminated number of @p line and removes it
+ * (and the space) from @p line.
+ */
+template <typename T>
+bool
+consume_number (std::string_view &line, T &value)
+{
+  const auto space = line.find (' ');
+  if (space == std::string_view::npos)
+    return false;
+  const auto * end = line.data () + space;
+  const auto [ptr, ec] = std::from_chars (line.data (), end, value);
+  if (ec != std::errc{} || ptr != end)
+    return false;
+  line.remove_prefix (space + 1);
+  return true;
+}
+
+} // namespace
+
+FileHashIndex::FileHashIndex (std::filesystem::path index_file)
+    : index_file_ (std::move (index_file))
+{
+  if (index_file_.has_parent_path ())
+    utils::io::mkdir (index_file_.parent_path ());
+  load ();
+}
+
+HashT
+FileHashIndex::get_file_hash (const std::filesystem::path &path)
+{
+  std::error_code ec;
+  Record          record{ .size = std::filesystem::file_size (path, ec) };
+  if (!ec)
+    {
+      const auto mtime = std::filesystem::last_write_time (path, ec);
+      record.mtime = mtime.time_since_epoch ().count ();
+    }
+  if (ec)
+    {
+      throw ZrythmException (
+        fmt::format ("Failed to stat '{}': {}", path, ec.message ()));
+    }
+
+  auto key = Utf8String::from_path (path).str ();
+  {
+    std::scoped_lock lock (mutex_);
+    const auto       it = records_.find (key);
+    if (
+      it != records_.end () && it->second.size == record.size
+      && it->second.mtime == record.mtime)
+      {
+        return it->second.hash;
+      }
+  }
+
+  // Hashed without holding the lock, since it reads the whole file
+  record.hash = utils::hash::get_file_hash (path);
+  if (record.hash == 0)
+    {
+      throw ZrythmException (fmt::format ("Failed to hash '{}'", path));
+    }
+
+  std::scoped_lock lock (mutex_);
+  auto [it, inserted] = records_.try_emplace (std::move (key), record);
+  if (!inserted)
+    {
+      if (it->second == record)
+        return record.hash;
+      it->second = record;
+    }
+  append (it->first, record);
+  return record.hash;
+}
+
+size_t
+FileHashIndex::size () const
+{
+  std::scoped_lock lock (mutex_);
+  return records_.size ();
+}
+
+void
+FileHashIndex::load ()
+{
+  QFile file (Utf8String::from_path (index_file_).to_qstring ());
+  if (!file.open (QIODevice::ReadOnly))
+    return;
+
+  // One "<size> <mtime> <hash> <path>" record per line, later records
+  // replacing earlier ones
+  size_t num_records = 0;
+  while (!file.atEnd ())
+    {
+      const auto       bytes = file.readLine ();
+      std::string_view line (bytes.constData (), bytes.size ());
+      if (!line.ends_with ('\n'))
+        break;
+      line.remove_suffix (1);
+      ++num_records;
+
+      Record record;
+      if (
+        !consume_number (line, record.size)
+        || !consume_number (line, record.mtime)
+        || !consume_number (line, record.hash) || line.empty ())
+        {
+          z_warning ("Ignoring malformed record in {}", index_file_);
+          continue;
+        }
+      records_.insert_or_assign (std::string (line), record);
+    }
+  file.close ();
+
+  if (num_records > records_.size () + MAX_OUTDATED_RECORDS)
+    compact ();
+}
+
+void
+FileHashIndex::append (const std::string &path, const Record &record)
+{
+  // Such paths can't be stored one per line
+  if (path.contains ('\n'))
+    return;
+
+  QFile file (Utf8String::from_path (index_file_).to_qstring ());
+  const auto line = fmt::format (
+    "{} {} {} {}\n", record.size, record.mtime, record.hash, path);
+  if (
+    !file.open (QIODevice::WriteOnly | QIODevice::Append)
+    || file.write (line.data (), static_cast<qint64> (line.size ()))
+         != static_cast<qint64> (line.size ()))
+    {
+      z_warning (
+        "Failed to update file hash index {}: {}", index_file_,
+        file.errorString ());
+    }
+}
+
+void
+FileHashIndex::compact ()
+{
+  // Files that no longer exist are dropped as well
+  std::erase_if (records_, [] (const auto &entry) {
+    std::error_code ec;
+    return !std::filesystem::exists (
+      Utf8String::from_utf8_encoded_string (entry.first).to_path (), ec);
+  });
+
+  QSaveFile file (Utf8String::from_path (index_file_).to_qstring ());
+  bool      ok = file.open (QIODevice::WriteOnly);
+  for (const auto &[path, record] : records_)
+    {
+      if (!ok)
+        break;
+      if (path.contains ('\n'))
+        continue;
+      const auto line = fmt::format (
+        "{} {} {} {}\n", record.size, record.mtime, record.hash, path);
+      ok =
+        file.write (line.data (), static_cast<qint64> (line.size ()))
+        == static_cast<qint64> (line.size ());
+    }
+  if (!ok || !file.commit ())
+    {
+      z_warning (
+        "Failed to compact file hash index {}: {}", index_file_,
+        file.errorString ());
+    }
+}
+
+} // namespace zrythm::utils::hash
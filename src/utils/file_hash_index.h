@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "utils/hash.h"
+
+namespace zrythm::utils::hash
+{
+
+/**
+ * @brief Persisted index of file content hashes, keyed by path, size and
+ * modification time.
+ *
+ * Lets caches keyed by content hash skip reading files that have not changed
+ * since they were last hashed.
+ *
+ * Records are appended to the index file as files get hashed, and the file is
+ * compacted when loaded if it holds many outdated records.
+ *
+ * Thread-safe.
+ */
+class FileHashIndex
+{
+public:
+  /**
+   * @param index_file File to persist the index in. Created if missing.
+   */
+  explicit FileHashIndex (std::filesystem::path index_file);
+
+  /**
+   * @brief Returns the content hash of @p path.
+   *
+   * The file is only read if its size or modification time differ from the
+   * ones it was last hashed with.
+   *
+   * @throw ZrythmException if the file cannot be read.
+   */
+  HashT get_file_hash (const std::filesystem::path &path);
+
+  /**
+   * @brief Number of files in the index.
+   */
+  size_t size () const;
+
+private:
+  struct Record
+  {
+    std::uintmax_t size{};
+
+    /** Modification time, in file clock ticks. */
+    int64_t mtime{};
+
+    HashT hash{};
+
+    bool operator== (const Record &) const = default;
+  };
+
+  void load ();
+  void append (const std::string &path, const Record &record);
+
+  /** Rewrites the index file with only the current records. */
+  void compact ();
+
+private:
+  std::filesystem::path index_file_;
+
+  /** Records keyed by path. */
+  std::unordered_map<std::string, Record> records_;
+
+  mutable std::mutex mutex_;
+};
+
+} // namespace zrythm::utils::hash
@@ -72,8 +72,8 @@ public:
   // Type-filtered iteration (NVI pattern)
   //
   // Public templated API delegates to private virtual _impl methods.
-  // ProjectRegistry optimizes via internal type buckets.
-  // ObjectRegistry falls back to iterating all objects with a type check.
+  // Both ProjectRegistry and ObjectRegistry maintain a MetaTypeIndex, so
+  // iteration cost is proportional to the number of matching objects.
   // ============================================================================
 
   template <typename T>
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include "utils/uuid_identifiable.h"
+
+#include <QMetaObject>
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_flat_set.hpp>
+
+namespace zrythm::utils
+{
+
+/**
+ * @brief Secondary index that buckets registered objects by their most-derived
+ * QMetaObject.
+ *
+ * Used by registries to answer type-filtered queries (e.g. "all
+ * FileAudioSource's") in time proportional to the number of matching objects
+ * instead of the total number of registered objects. A query only checks
+ * inheritance once per distinct meta type (a few dozen at most), not once per
+ * object.
+ *
+ * Objects must be inserted after construction has completed and erased before
+ * destruction starts, since the bucket is looked up via
+ * QObject::metaObject().
+ */
+class MetaTypeIndex
+{
+public:
+  void insert (UuidIdentifiableBase &obj)
+  {
+    const auto * meta = obj.metaObject ();
+    auto         it = buckets_.find (meta);
+    if (it == buckets_.end ())
+      {
+        it = buckets_.emplace (meta, Bucket{}).first;
+        meta_types_.push_back (meta);
+      }
+    [[maybe_unused]] const auto inserted = it->second.insert (&obj).second;
+    assert (inserted);
+  }
+
+  void erase (UuidIdentifiableBase &obj)
+  {
+    const auto it = buckets_.find (obj.metaObject ());
+    if (it == buckets_.end ())
+      return;
+    it->second.erase (&obj);
+  }
+
+  void clear ()
+  {
+    buckets_.clear ();
+    meta_types_.clear ();
+  }
+
+  /**
+   * @brief Calls @p visitor for every indexed object whose type is (or
+   * inherits) @p meta_type.
+   *
+   * The index must not be modified while iterating.
+   */
+  template <typename Visitor>
+  void for_each_matching (const QMetaObject &meta_type, Visitor &&visitor) const
+  {
+    for (const auto * meta : meta_types_)
+      {
+        if (!meta->inherits (&meta_type))
+          continue;
+        for (auto * obj : buckets_.at (meta))
+          visitor (*obj);
+      }
+  }
+
+  [[nodiscard]] size_t count_matching (const QMetaObject &meta_type) const
+  {
+    size_t count = 0;
+    for (const auto * meta : meta_types_)
+      {
+        if (meta->inherits (&meta_type))
+          count += buckets_.at (meta).size ();
+      }
+    return count;
+  }
+
+private:
+  using Bucket = boost::unordered::unordered_flat_set<UuidIdentifiableBase *>;
+
+  boost::unordered::unordered_flat_map<const QMetaObject *, Bucket> buckets_;
+
+  /// Distinct meta types seen so far, in insertion order (avoids iterating the
+  /// bucket map when matching).
+  std::vector<const QMetaObject *> meta_types_;
+};
+
+} // namespace zrythm::utils
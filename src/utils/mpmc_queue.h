@@ -60,6 +60,9 @@
  * TODO: maybe replace with
  * https://github.com/erez-strauss/lockfree_mpmc_queue
  * ?
+ *
+ * @see zrythm::utils::BoundedMPMCQueue for a variant with cache-line-padded
+ * slots and bulk operations (compared in mpmc_queue_bench).
  */
 template <typename T> class MPMCQueue
 {
@@ -3,6 +3,7 @@
 
 #include "utils/format_qt.h"
 
+#include "utils/meta_type_index.h"
 #include "utils/object_registry.h"
 #include "utils/qt.h"
 
@@ -17,6 +18,7 @@ struct ObjectRegistry::Impl
     unordered_flat_map<QUuid, QObjectUniquePtr<utils::UuidIdentifiableBase>>
                                                    objects_by_id_;
   boost::unordered::unordered_flat_map<QUuid, int> ref_counts_;
+  MetaTypeIndex                                    type_index_;
 };
 
 ObjectRegistry::ObjectRegistry (QObject * parent)
@@ -38,6 +40,7 @@ ObjectRegistry::register_object_impl (utils::UuidIdentifiableBase &obj)
       fmt::format ("duplicate UUID: {}", id.toString ()));
   obj.setParent (this);
   impl_->objects_by_id_.emplace (id, &obj);
+  impl_->type_index_.insert (obj);
 }
 
 void
@@ -80,12 +83,7 @@ ObjectRegistry::for_each_matching_impl (
   const QMetaObject &meta_type,
   ObjectVisitor      visitor) const
 {
-  for (const auto &[id, obj_ptr] : impl_->objects_by_id_)
-    {
-      auto * obj = obj_ptr.get ();
-      if (obj->metaObject ()->inherits (&meta_type))
-        visitor (*obj);
-    }
+  impl_->type_index_.for_each_matching (meta_type, visitor);
 }
 
 void
@@ -94,6 +92,7 @@ ObjectRegistry::delete_object_by_id (const QUuid &id)
   const auto it = impl_->objects_by_id_.find (id);
   if (it == impl_->objects_by_id_.end ())
     return;
+  impl_->type_index_.erase (*it->second);
   impl_->objects_by_id_.erase (it);
   impl_->ref_counts_.erase (id);
 }
@@ -15,6 +15,9 @@ namespace zrythm::utils
  *
  * Stores UUID-identifiable objects in a flat map. When an object's ref count
  * drops to zero (via release_reference), the object is deleted.
+ *
+ * Objects are additionally bucketed by meta type (see MetaTypeIndex) so
+ * for_each_matching() only visits matching objects.
  */
 class ObjectRegistry : public QObject, public utils::IObjectRegistry
 {
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: © 2023-2024 Alexandros Theodotou <alex@zrythm.org>
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
+#include <cmath>
+
 #include "utils/audio.h"
 #include "utils/debug.h"
 #include "utils/exceptions.h"
@@ -264,3 +266,159 @@ Resampler::get_out_frames () const
   // resize because we might have allocated more frames than needed
   return pimpl_->get_out_frames ();
 }
+
+class StreamingResampler::Impl
+{
+public:
+  Impl (
+    int                num_channels,
+    double             input_rate,
+    double             output_rate,
+    Resampler::Quality quality)
+      : num_channels_ (num_channels), ratio_ (output_rate / input_rate)
+  {
+    unsigned long quality_recipe = SOXR_VHQ;
+    switch (quality)
+      {
+      case Resampler::Quality::Quick:
+        quality_recipe = SOXR_QQ;
+        break;
+      case Resampler::Quality::Low:
+        quality_recipe = SOXR_LQ;
+        break;
+      case Resampler::Quality::Medium:
+        quality_recipe = SOXR_MQ;
+        break;
+      case Resampler::Quality::High:
+        quality_recipe = SOXR_HQ;
+        break;
+      case Resampler::Quality::VeryHigh:
+        break;
+      }
+    soxr_quality_spec_t quality_spec = soxr_quality_spec (quality_recipe, 0);
+    auto io_spec = soxr_io_spec (SOXR_FLOAT32_I, SOXR_FLOAT32_I);
+
+    soxr_error_t serror;
+    priv_ = soxr_create (
+      input_rate, output_rate, static_cast<unsigned int> (num_channels),
+      &serror, &io_spec, &quality_spec, nullptr);
+    if (serror)
+      {
+        throw ZrythmException (
+          fmt::format (
+            "Failed to create soxr instance: {}", std::string{ serror }));
+      }
+  }
+
+  ~Impl () { soxr_delete (priv_); }
+
+  /**
+   * Runs soxr on @p num_frames interleaved input frames (nullptr to flush)
+   * and appends the output to @p out.
+   */
+  void run (
+    const float *                      in,
+    size_t                             num_frames,
+    zrythm::utils::audio::AudioBuffer &out)
+  {
+    const auto channels = static_cast<size_t> (num_channels_);
+    const auto out_capacity =
+      static_cast<size_t> (std::ceil (
+        static_cast<double> (std::max<size_t> (num_frames, 1024)) * ratio_))
+      + 64;
+    interleaved_out_.resize (out_capacity * channels);
+
+    size_t in_consumed = 0;
+    int    out_frames = 0;
+    out.setSize (num_channels_, 0, false, false, true);
+    while (true)
+      {
+        size_t idone = 0;
+        size_t odone = 0;
+        const auto serror = soxr_process (
+          priv_, in != nullptr ? in + in_consumed * channels : nullptr,
+          num_frames - in_consumed, &idone, interleaved_out_.data (),
+          out_capacity, &odone);
+        if (serror)
+          {
+            throw ZrythmException (
+              fmt::format ("soxr_process() error: {}", serror));
+          }
+        in_consumed += idone;
+
+        out.setSize (
+          num_channels_, out_frames + static_cast<int> (odone), true, false,
+          true);
+        for (size_t i = 0; i < odone; ++i)
+          {
+            for (const auto channel : std::views::iota (0, num_channels_))
+              {
+                out.setSample (
+                  channel, out_frames + static_cast<int> (i),
+                  interleaved_out_
+                    [i * channels + static_cast<size_t> (channel)]);
+              }
+          }
+        out_frames += static_cast<int> (odone);
+
+        // When flushing, keep draining until soxr has nothing left. Otherwise
+        // stop once all input was accepted and the output buffer wasn't full
+        const bool done =
+          in == nullptr
+            ? odone == 0
+            : in_consumed == num_frames && odone < out_capacity;
+        if (done)
+          break;
+      }
+  }
+
+  soxr_t priv_ = nullptr;
+  int    num_channels_;
+  double ratio_;
+
+  std::vector<float> interleaved_in_;
+  std::vector<float> interleaved_out_;
+};
+
+StreamingResampler::StreamingResampler (
+  int                num_channels,
+  double             input_rate,
+  double             output_rate,
+  Resampler::Quality quality)
+    : pimpl_ (
+        std::make_unique<Impl> (num_channels, input_rate, output_rate, quality))
+{
+}
+
+StreamingResampler::~StreamingResampler () = default;
+
+void
+StreamingResampler::process (
+  const juce::AudioSampleBuffer     &in,
+  int                                num_frames,
+  zrythm::utils::audio::AudioBuffer &out)
+{
+  const auto channels = static_cast<size_t> (pimpl_->num_channels_);
+  auto      &interleaved = pimpl_->interleaved_in_;
+  interleaved.resize (static_cast<size_t> (num_frames) * channels);
+  for (const auto channel : std::views::iota (0, pimpl_->num_channels_))
+    {
+      if (channel >= in.getNumChannels ())
+        {
+          for (size_t i = 0; i < static_cast<size_t> (num_frames); ++i)
+            interleaved[i * channels + static_cast<size_t> (channel)] = 0.f;
+          continue;
+        }
+      const auto * src = in.getReadPointer (channel);
+      for (size_t i = 0; i < static_cast<size_t> (num_frames); ++i)
+        interleaved[i * channels + static_cast<size_t> (channel)] = src[i];
+    }
+
+  pimpl_->run (interleaved.data (), static_cast<size_t> (num_frames), out);
+}
+
+void
+StreamingResampler::flush (zrythm::utils::audio::AudioBuffer &out)
+{
+  pimpl_->run (nullptr, 0, out);
+}
@@ -75,6 +75,50 @@ private:
   std::unique_ptr<Impl> pimpl_;
 };
 
+/**
+ * Resampler for audio that arrives in blocks (e.g., during export).
+ *
+ * Unlike Resampler, the input doesn't need to be available up front. Output
+ * is produced as soon as the filter has enough input, so the number of output
+ * frames per call varies.
+ */
+class StreamingResampler
+{
+public:
+  /**
+   * @throw ZrythmException on error.
+   */
+  StreamingResampler (
+    int                num_channels,
+    double             input_rate,
+    double             output_rate,
+    Resampler::Quality quality);
+
+  ~StreamingResampler ();
+
+  /**
+   * Resamples the first @p num_frames frames of @p in.
+   *
+   * @param out Resized to the number of frames produced.
+   * @throw ZrythmException on error.
+   */
+  void process (
+    const juce::AudioSampleBuffer     &in,
+    int                                num_frames,
+    zrythm::utils::audio::AudioBuffer &out);
+
+  /**
+   * Signals the end of the input and returns the remaining output.
+   *
+   * @throw ZrythmException on error.
+   */
+  void flush (zrythm::utils::audio::AudioBuffer &out);
+
+private:
+  class Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
 /**
  * @}
  */
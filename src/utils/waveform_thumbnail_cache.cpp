@@ -0,0 +1,418 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <ranges>
+
+#include <fmt/std.h>
+
+#include "utils/audio_file.h"
+#include "utils/exceptions.h"
+#include "utils/logger.h"
+#include "utils/utf8_string.h"
+#include "utils/waveform_thumbnail_cache.h"
+
+#include <QFile>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+using zrythm::utils::exceptions::ZrythmException;
+
+namespace zrythm::utils::audio
+{
+
+namespace
+{
+
+constexpr std::array<char, 8> ENTRY_MAGIC{ 'Z', 'P', 'E', 'A', 'K', 0, 0, 0 };
+constexpr uint32_t            ENTRY_VERSION = 1;
+constexpr auto                ENTRY_EXTENSION = ".peaks";
+constexpr auto                HASH_INDEX_FILENAME = "file-hashes";
+
+/** Number of frames decoded at a time when computing thumbnails of files. */
+constexpr int64_t DECODE_BLOCK_FRAMES = 1 << 16;
+
+/**
+ * @brief Header of an entry, followed by the planar peaks.
+ */
+struct EntryHeader
+{
+  std::array<char, 8>  magic{};
+  uint32_t             version{};
+  uint32_t             num_channels{};
+  uint64_t             num_peaks{};
+  uint64_t             file_hash{};
+  int64_t              sample_rate{};
+  int64_t              num_frames{};
+  std::array<char, 16> reserved{};
+};
+static_assert (sizeof (EntryHeader) == 64);
+
+/**
+ * @brief Accumulates peaks of consecutive blocks of frames.
+ */
+class PeakAccumulator
+{
+public:
+  PeakAccumulator (
+    WaveformThumbnail &thumbnail,
+    int                num_channels,
+    size_t             num_peaks)
+      : thumbnail_ (thumbnail)
+  {
+    // At least one frame per peak
+    num_peaks_ = std::min (
+      static_cast<int64_t> (num_peaks),
+      std::max (thumbnail_.num_frames, int64_t{ 0 }));
+    thumbnail_.peaks.assign (
+      static_cast<size_t> (num_channels),
+      std::vector<float> (static_cast<size_t> (num_peaks_)));
+    if (num_peaks_ > 0)
+      bucket_end_ = bucket_start (1);
+  }
+
+  /**
+   * @brief Adds the next @p count frames.
+   *
+   * @param get_sample Returns the sample of the given channel at the given
+   * frame (relative to the start of the block).
+   */
+  template <typename GetSample>
+  void add (int64_t count, GetSample &&get_sample)
+  {
+    if (num_peaks_ == 0)
+      return;
+
+    for (int64_t i = 0; i < count && frame_ < thumbnail_.num_frames;
+         ++i, ++frame_)
+      {
+        while (frame_ >= bucket_end_)
+          {
+            ++bucket_;
+            bucket_end_ = bucket_start (bucket_ + 1);
+          }
+        for (const auto ch : std::views::iota (0uz, thumbnail_.peaks.size ()))
+          {
+            auto &peak = thumbnail_.peaks[ch][static_cast<size_t> (bucket_)];
+            peak = std::max (
+              peak, std::abs (get_sample (static_cast<int> (ch), i)));
+          }
+      }
+  }
+
+private:
+  int64_t bucket_start (int64_t bucket) const
+  {
+    return bucket * thumbnail_.num_frames / num_peaks_;
+  }
+
+  WaveformThumbnail &thumbnail_;
+  int64_t            num_peaks_{};
+  int64_t            bucket_{};
+  int64_t            bucket_end_{};
+  int64_t            frame_{};
+};
+
+} // namespace
+
+std::vector<float>
+WaveformThumbnail::mixed_peaks () const
+{
+  std::vector<float> ret;
+  for (const auto &channel : peaks)
+    {
+      ret.resize (std::max (ret.size (), channel.size ()));
+      for (const auto i : std::views::iota (0uz, channel.size ()))
+        {
+          ret[i] = std::max (ret[i], channel[i]);
+        }
+    }
+  return ret;
+}
+
+WaveformThumbnail
+WaveformThumbnail::from_frames (
+  const AudioBuffer &frames,
+  int                sample_rate,
+  size_t             num_peaks)
+{
+  WaveformThumbnail ret{
+    .sample_rate = sample_rate,
+    .num_frames = frames.getNumSamples (),
+    .peaks = {},
+  };
+  PeakAccumulator accumulator (ret, frames.getNumChannels (), num_peaks);
+  accumulator.add (ret.num_frames, [&] (int ch, int64_t frame) {
+    return frames.getSample (ch, static_cast<int> (frame));
+  });
+  return ret;
+}
+
+WaveformThumbnail
+WaveformThumbnail::from_file (
+  const std::filesystem::path &path,
+  size_t                       num_peaks)
+{
+  AudioFile  file (path);
+  const auto metadata = file.read_metadata ();
+  if (metadata.channels <= 0)
+    {
+      throw ZrythmException (fmt::format ("No audio channels in '{}'", path));
+    }
+
+  WaveformThumbnail ret{
+    .sample_rate = metadata.samplerate,
+    .num_frames = metadata.num_frames,
+    .peaks = {},
+  };
+  PeakAccumulator    accumulator (ret, metadata.channels, num_peaks);
+  std::vector<float> block (
+    static_cast<size_t> (DECODE_BLOCK_FRAMES * metadata.channels));
+  for (int64_t start = 0; start < ret.num_frames; start += DECODE_BLOCK_FRAMES)
+    {
+      const auto count = std::min (DECODE_BLOCK_FRAMES, ret.num_frames - start);
+      file.read_samples_interleaved (
+        true, block.data (), static_cast<size_t> (start),
+        static_cast<size_t> (count));
+      accumulator.add (count, [&] (int ch, int64_t frame) {
+        return block[static_cast<size_t> ((frame * metadata.channels) + ch)];
+      });
+    }
+  return ret;
+}
+
+WaveformThumbnailCache::WaveformThumbnailCache (
+  std::filesystem::path dir,
+  std::uintmax_t        max_size_bytes)
+    : dir_ (std::move (dir)), max_size_bytes_ (max_size_bytes),
+      hash_index_ (dir_ / HASH_INDEX_FILENAME)
+{
+
+  std::error_code ec;
+  for (const auto &file : std::filesystem::directory_iterator (dir_, ec))
+    {
+      if (file.path ().extension () != ENTRY_EXTENSION)
+        continue;
+      const auto size = file.file_size (ec);
+      if (!ec)
+        size_bytes_ += size;
+    }
+}
+
+std::filesystem::path
+WaveformThumbnailCache::default_dir ()
+{
+  return Utf8String::from_qstring (
+           QStandardPaths::writableLocation (QStandardPaths::CacheLocation))
+           .to_path ()
+         / "waveform-thumbnails";
+}
+
+std::filesystem::path
+WaveformThumbnailCache::entry_path (hash::HashT file_hash) const
+{
+  return dir_
+         / fmt::format ("{}{}", hash::to_string (file_hash), ENTRY_EXTENSION);
+}
+
+std::optional<WaveformThumbnail>
+WaveformThumbnailCache::load (hash::HashT file_hash)
+{
+  const auto path = entry_path (file_hash);
+
+  // Entries are replaced atomically, so no lock is needed for reading
+  QFile file (Utf8String::from_path (path).to_qstring ());
+  if (!file.open (QIODevice::ReadOnly))
+    return std::nullopt;
+
+  const auto corrupt = [&] (std::string_view reason) {
+    z_warning ("Removing corrupt waveform thumbnail {}: {}", path, reason);
+    const auto entry_size = static_cast<std::uintmax_t> (file.size ());
+    file.close ();
+    std::scoped_lock lock (dir_mutex_);
+    std::error_code  ec;
+    if (std::filesystem::remove (path, ec))
+      size_bytes_ -= std::min (size_bytes_, entry_size);
+    return std::nullopt;
+  };
+
+  EntryHeader    header;
+  constexpr auto header_size = static_cast<qint64> (sizeof (EntryHeader));
+  if (
+    file.read (reinterpret_cast<char *> (&header), header_size) != header_size)
+    {
+      return corrupt ("truncated header");
+    }
+  if (header.magic != ENTRY_MAGIC || header.version != ENTRY_VERSION)
+    return corrupt ("unknown format");
+  if (header.file_hash != file_hash)
+    return corrupt ("key mismatch");
+  const auto peaks_size = static_cast<qint64> (
+    header.num_channels * header.num_peaks * sizeof (float));
+  if (
+    header.num_channels == 0 || header.num_peaks > (1U << 20)
+    || file.size () != header_size + peaks_size)
+    {
+      return corrupt ("size mismatch");
+    }
+
+  WaveformThumbnail ret{
+    .sample_rate = static_cast<int> (header.sample_rate),
+    .num_frames = header.num_frames,
+    .peaks = std::vector<std::vector<float>> (
+      header.num_channels,
+      std::vector<float> (static_cast<size_t> (header.num_peaks))),
+  };
+  const auto channel_bytes =
+    static_cast<qint64> (header.num_peaks * sizeof (float));
+  for (auto &channel : ret.peaks)
+    {
+      if (
+        file.read (reinterpret_cast<char *> (channel.data ()), channel_bytes)
+        != channel_bytes)
+        {
+          return corrupt ("truncated peaks");
+        }
+    }
+
+  // Mark as recently used
+  std::error_code ec;
+  std::filesystem::last_write_time (
+    path, std::filesystem::file_time_type::clock::now (), ec);
+
+  return ret;
+}
+
+void
+WaveformThumbnailCache::store (
+  hash::HashT              file_hash,
+  const WaveformThumbnail &thumbnail)
+{
+  if (thumbnail.peaks.empty ())
+    return;
+
+  const auto  path = entry_path (file_hash);
+  EntryHeader header{
+    .magic = ENTRY_MAGIC,
+    .version = ENTRY_VERSION,
+    .num_channels = static_cast<uint32_t> (thumbnail.num_channels ()),
+    .num_peaks = thumbnail.peaks.front ().size (),
+    .file_hash = file_hash,
+    .sample_rate = thumbnail.sample_rate,
+    .num_frames = thumbnail.num_frames,
+  };
+
+  {
+    std::scoped_lock lock (dir_mutex_);
+
+    // Size of the entry being replaced, if any
+    std::error_code ec;
+    auto            old_size = std::filesystem::file_size (path, ec);
+    if (ec)
+      old_size = 0;
+
+    // Written to a temporary file and renamed on commit, so readers never
+    // see a partial entry
+    QSaveFile file (Utf8String::from_path (path).to_qstring ());
+    if (!file.open (QIODevice::WriteOnly))
+      {
+        z_warning (
+          "Failed to create waveform thumbnail {}: {}", path,
+          file.errorString ());
+        return;
+      }
+    constexpr auto header_size = static_cast<qint64> (sizeof (header));
+    bool           ok =
+      file.write (reinterpret_cast<const char *> (&header), header_size)
+      == header_size;
+    const auto channel_bytes =
+      static_cast<qint64> (header.num_peaks * sizeof (float));
+    for (const auto &channel : thumbnail.peaks)
+      {
+        ok = ok && channel.size () == header.num_peaks
+             && file.write (
+                  reinterpret_cast<const char *> (channel.data ()),
+                  channel_bytes)
+                  == channel_bytes;
+      }
+    if (!ok || !file.commit ())
+      {
+        z_warning (
+          "Failed to write waveform thumbnail {}: {}", path,
+          file.errorString ());
+        return;
+      }
+    size_bytes_ = size_bytes_ - std::min (size_bytes_, old_size)
+                  + static_cast<std::uintmax_t> (
+                    header_size + (channel_bytes * header.num_channels));
+  }
+
+  evict ();
+}
+
+WaveformThumbnail
+WaveformThumbnailCache::get_or_create (const std::filesystem::path &path)
+{
+  const auto file_hash = hash_index_.get_file_hash (path);
+  if (auto thumbnail = load (file_hash))
+    return *thumbnail;
+
+  auto thumbnail = WaveformThumbnail::from_file (path);
+  store (file_hash, thumbnail);
+  return thumbnail;
+}
+
+std::uintmax_t
+WaveformThumbnailCache::size_bytes () const
+{
+  std::scoped_lock lock (dir_mutex_);
+  return size_bytes_;
+}
+
+void
+WaveformThumbnailCache::evict ()
+{
+  struct EntryInfo
+  {
+    std::filesystem::path           path;
+    std::uintmax_t                  size;
+    std::filesystem::file_time_type last_used;
+  };
+
+  std::scoped_lock lock (dir_mutex_);
+  if (size_bytes_ <= max_size_bytes_)
+    return;
+
+  // Resynchronizes the running total with the directory, in case entries were
+  // added or removed by other instances
+  std::vector<EntryInfo> entries;
+  std::uintmax_t         total = 0;
+  std::error_code        ec;
+  for (const auto &file : std::filesystem::directory_iterator (dir_, ec))
+    {
+      if (file.path ().extension () != ENTRY_EXTENSION)
+        continue;
+      const auto size = file.file_size (ec);
+      if (ec)
+        continue;
+      entries.push_back (
+        { .path = file.path (),
+          .size = size,
+          .last_used = file.last_write_time (ec) });
+      total += size;
+    }
+
+  std::ranges::sort (entries, {}, &EntryInfo::last_used);
+  for (const auto &entry : entries)
+    {
+      if (total <= max_size_bytes_)
+        break;
+      if (std::filesystem::remove (entry.path, ec))
+        total -= entry.size;
+    }
+  size_bytes_ = total;
+}
+
+} // namespace zrythm::utils::audio
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "utils/audio.h"
+#include "utils/file_hash_index.h"
+#include "utils/hash.h"
+
+namespace zrythm::utils::audio
+{
+
+/**
+ * @brief Downsampled peaks of an audio file, for drawing a preview of its
+ * waveform without decoding it.
+ */
+struct WaveformThumbnail
+{
+  static constexpr size_t DEFAULT_NUM_PEAKS = 256;
+
+  /** Sample rate of the file. */
+  int sample_rate{};
+
+  /** Number of frames in the file. */
+  int64_t num_frames{};
+
+  /**
+   * @brief Per-channel peaks (maximum absolute sample value) of evenly sized
+   * ranges of frames.
+   */
+  std::vector<std::vector<float>> peaks;
+
+  int num_channels () const { return static_cast<int> (peaks.size ()); }
+
+  double duration_seconds () const
+  {
+    if (sample_rate <= 0)
+      return 0.0;
+    return static_cast<double> (num_frames) / static_cast<double> (sample_rate);
+  }
+
+  /**
+   * @brief Returns the peaks of all channels combined.
+   */
+  std::vector<float> mixed_peaks () const;
+
+  /**
+   * @brief Computes the thumbnail of @p frames.
+   */
+  static WaveformThumbnail from_frames (
+    const AudioBuffer &frames,
+    int                sample_rate,
+    size_t             num_peaks = DEFAULT_NUM_PEAKS);
+
+  /**
+   * @brief Computes the thumbnail of an audio file.
+   *
+   * The file is decoded in blocks, so large files don't need to fit in memory.
+   *
+   * @throw ZrythmException if the file cannot be decoded.
+   */
+  static WaveformThumbnail from_file (
+    const std::filesystem::path &path,
+    size_t                       num_peaks = DEFAULT_NUM_PEAKS);
+};
+
+/**
+ * @brief On-disk cache of waveform thumbnails.
+ *
+ * Like DecodedAudioCache, entries are keyed by the hash of the source file's
+ * contents, so renamed or copied files reuse the same entry, and the least
+ * recently used entries are evicted once the cache grows past its size limit.
+ * The hashes are remembered in a hash::FileHashIndex next to the entries, so
+ * unchanged files are not read again to find their entry.
+ *
+ * Thread-safe.
+ */
+class WaveformThumbnailCache
+{
+public:
+  /**
+   * @param dir Directory to keep the entries in. Created if missing.
+   * @param max_size_bytes Size above which the least recently used entries are
+   * evicted.
+   */
+  WaveformThumbnailCache (
+    std::filesystem::path dir,
+    std::uintmax_t        max_size_bytes);
+
+  /**
+   * @brief Default location in the user's cache directory.
+   */
+  static std::filesystem::path default_dir ();
+
+  static constexpr std::uintmax_t DEFAULT_MAX_SIZE_BYTES = 64ULL << 20;
+
+  /**
+   * @brief Returns the entry for @p file_hash, if any.
+   *
+   * Corrupt entries are removed.
+   */
+  std::optional<WaveformThumbnail> load (hash::HashT file_hash);
+
+  /**
+   * @brief Stores @p thumbnail as the entry for @p file_hash.
+   *
+   * Failures are logged and otherwise ignored, since the cache is only an
+   * optimization.
+   */
+  void store (hash::HashT file_hash, const WaveformThumbnail &thumbnail);
+
+  /**
+   * @brief Returns the thumbnail of @p path, computing and storing it if it is
+   * not cached yet.
+   *
+   * The file is only read if it changed since it was last looked up.
+   *
+   * @throw ZrythmException if the file cannot be read or decoded.
+   */
+  WaveformThumbnail get_or_create (const std::filesystem::path &path);
+
+  /**
+   * @brief Total size of the entries in bytes.
+   */
+  std::uintmax_t size_bytes () const;
+
+private:
+  std::filesystem::path entry_path (hash::HashT file_hash) const;
+
+  /**
+   * @brief Evicts entries until the cache fits in @ref max_size_bytes_.
+   *
+   * Only walks the directory if @ref size_bytes_ exceeds the limit.
+   */
+  void evict ();
+
+private:
+  std::filesystem::path dir_;
+  std::uintmax_t        max_size_bytes_;
+
+  /**
+   * @brief Running total of the entries' sizes.
+   *
+   * Computed at construction and kept up to date by store() and evict(), so
+   * that storing an entry doesn't need to stat the whole directory.
+   */
+  std::uintmax_t size_bytes_{};
+
+  hash::FileHashIndex hash_index_;
+
+  /** Serializes eviction with other writes to the directory. */
+  mutable std::mutex dir_mutex_;
+};
+
+} // namespace zrythm::utils::audio
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <vector>
+
+#include "dsp/curve.h"
+
+#include <benchmark/benchmark.h>
+
+namespace zrythm::dsp
+{
+
+static void
+BM_CurveScalar (benchmark::State &state)
+{
+  const auto algo = static_cast<CurveOptions::Algorithm> (state.range (0));
+  const auto size = static_cast<size_t> (state.range (1));
+  const CurveOptions opts (0.6, algo);
+  const double       step = 1.0 / static_cast<double> (size);
+  std::vector<float> out (size);
+  for (auto _ : state)
+    {
+      for (size_t i = 0; i < size; ++i)
+        {
+          out[i] = static_cast<float> (
+            opts.get_normalized_y (static_cast<double> (i) * step, false));
+        }
+      benchmark::DoNotOptimize (out.data ());
+    }
+  state.SetItemsProcessed (
+    static_cast<int64_t> (state.iterations ()) * static_cast<int64_t> (size));
+}
+
+static void
+BM_CurveBatch (benchmark::State &state)
+{
+  const auto algo = static_cast<CurveOptions::Algorithm> (state.range (0));
+  const auto size = static_cast<size_t> (state.range (1));
+  const CurveOptions opts (0.6, algo);
+  const double       step = 1.0 / static_cast<double> (size);
+  std::vector<float> out (size);
+  for (auto _ : state)
+    {
+      opts.get_normalized_y_range (0.0, step, false, out);
+      benchmark::DoNotOptimize (out.data ());
+    }
+  state.SetItemsProcessed (
+    static_cast<int64_t> (state.iterations ()) * static_cast<int64_t> (size));
+}
+
+// Args: algorithm, number of points
+BENCHMARK (BM_CurveScalar)
+  ->ArgsProduct ({ { 0, 1, 2, 3, 4 }, { 64, 1024, 8192 } });
+BENCHMARK (BM_CurveBatch)
+  ->ArgsProduct ({ { 0, 1, 2, 3, 4 }, { 64, 1024, 8192 } });
+
+} // namespace zrythm::dsp
@@ -64,7 +64,9 @@ protected:
   }
 
   // Helper to create a configured processable
-  std::unique_ptr<MockProcessable> create_processable ()
+  //
+  // @param work_iterations Number of times to repeat the simulated work.
+  std::unique_ptr<MockProcessable> create_processable (int work_iterations = 1)
   {
     auto proc = std::make_unique<MockProcessable> ();
 
@@ -78,21 +80,24 @@ protected:
 
     // Simulate actual processing work
     ON_CALL (*proc, process_block (_, _, _))
-      .WillByDefault ([] (auto, auto &, auto &) {
-        // Simulate typical DSP operations on a small buffer
-        // constexpr size_t buffer_size = 64;
-        std::array<float, 64> buffer{};
+      .WillByDefault ([work_iterations] (auto, auto &, auto &) {
+        for (int i = 0; i < work_iterations; ++i)
+          {
+            // Simulate typical DSP operations on a small buffer
+            // constexpr size_t buffer_size = 64;
+            std::array<float, 64> buffer{};
 
-        // Fill with test signal
-        zrythm::utils::float_ranges::fill (buffer, 0.5f);
+            // Fill with test signal
+            zrythm::utils::float_ranges::fill (buffer, 0.5f);
 
-        // Apply common DSP operations
-        zrythm::utils::float_ranges::mul_k2 (buffer, 0.8f);
-        zrythm::utils::float_ranges::clip (buffer, -1.0f, 1.0f);
+            // Apply common DSP operations
+            zrythm::utils::float_ranges::mul_k2 (buffer, 0.8f);
+            zrythm::utils::float_ranges::clip (buffer, -1.0f, 1.0f);
 
-        // Get peak for metering
-        float peak = zrythm::utils::float_ranges::abs_max (buffer);
-        benchmark::DoNotOptimize (peak);
+            // Get peak for metering
+            float peak = zrythm::utils::float_ranges::abs_max (buffer);
+            benchmark::DoNotOptimize (peak);
+          }
       });
 
     // silence GMock warnings
@@ -106,6 +111,20 @@ protected:
     return proc;
   }
 
+  // Helper to append a node for a new processable to @p collection
+  //
+  // @param work_iterations See create_processable().
+  GraphNode * add_node (GraphNodeCollection &collection, int work_iterations)
+  {
+    auto proc = create_processable (work_iterations);
+    auto node =
+      std::make_unique<GraphNode> (collection.graph_nodes_.size (), *proc);
+    auto * node_ptr = node.get ();
+    collection.graph_nodes_.push_back (std::move (node));
+    processables_.push_back (std::move (proc));
+    return node_ptr;
+  }
+
   GraphNodeCollection create_linear_chain (size_t num_nodes)
   {
     GraphNodeCollection                     collection;
@@ -161,6 +180,68 @@ protected:
     return collection;
   }
 
+  // Simulates a layered instrument rack: an input node feeding the layers and
+  // a summing node. With @p parallel the layers are independent branches (like
+  // PluginGroup::ProcessingTypeHint::Parallel groups in the project graph),
+  // otherwise they run as a serial chain.
+  GraphNodeCollection
+  create_layer_rack (size_t num_layers, int work_per_layer, bool parallel)
+  {
+    GraphNodeCollection collection;
+
+    auto *      input = add_node (collection, 1);
+    auto *      sum = add_node (collection, 1);
+    GraphNode * prev = input;
+    for (size_t i = 0; i < num_layers; i++)
+      {
+        auto * layer = add_node (collection, work_per_layer);
+        if (parallel)
+          {
+            input->connect_to (*layer);
+            layer->connect_to (*sum);
+          }
+        else
+          {
+            prev->connect_to (*layer);
+            prev = layer;
+          }
+      }
+    if (!parallel)
+      {
+        prev->connect_to (*sum);
+      }
+
+    collection.finalize_nodes ();
+    return collection;
+  }
+
+  // Simulates a mixer where a long plugin chain becomes ready at the same time
+  // as many cheap nodes (like meters). The cheap nodes are connected first so
+  // that a FIFO scheduler queues them ahead of the chain.
+  GraphNodeCollection create_uneven_branches (
+    size_t num_cheap_nodes,
+    size_t chain_length,
+    int    work_per_chain_node)
+  {
+    GraphNodeCollection collection;
+
+    auto * input = add_node (collection, 1);
+    for (size_t i = 0; i < num_cheap_nodes; i++)
+      {
+        input->connect_to (*add_node (collection, work_per_chain_node / 10));
+      }
+    GraphNode * prev = input;
+    for (size_t i = 0; i < chain_length; i++)
+      {
+        auto * node = add_node (collection, work_per_chain_node);
+        prev->connect_to (*node);
+        prev = node;
+      }
+
+    collection.finalize_nodes ();
+    return collection;
+  }
+
   GraphNodeCollection
   create_complex_graph (size_t num_nodes, float connectivity_factor)
   {
@@ -292,6 +373,65 @@ BENCHMARK_DEFINE_F (GraphSchedulerBenchmark, ComplexGraph)
   state.counters["Nodes/Thread"] = double (num_nodes) / double (num_threads);
 }
 
+BENCHMARK_DEFINE_F (GraphSchedulerBenchmark, LayerRack)
+(benchmark::State &state)
+{
+  const auto num_layers = state.range (0);
+  const auto block_size = state.range (1);
+  const auto num_threads = state.range (2);
+  const bool parallel = state.range (3) != 0;
+
+  // Each layer costs roughly as much as a light instrument voice stack
+  constexpr int work_per_layer = 200;
+  scheduler_->rechain_from_node_collection (
+    create_layer_rack (num_layers, work_per_layer, parallel), sample_rate_,
+    max_block_length_);
+  scheduler_->start_threads (num_threads);
+
+  const auto time_info = dsp::graph::ProcessBlockInfo::from_position_and_nframes (
+    units::samples (0), units::samples (block_size));
+
+  for (auto _ : state)
+    {
+      scheduler_->run_cycle (
+        time_info, units::samples (0), *transport_, *tempo_map_);
+    }
+
+  scheduler_->terminate_threads ();
+  state.SetLabel (parallel ? "parallel" : "serial");
+}
+
+BENCHMARK_DEFINE_F (GraphSchedulerBenchmark, UnevenBranches)
+(benchmark::State &state)
+{
+  const auto num_cheap_nodes = state.range (0);
+  const auto chain_length = state.range (1);
+  const auto num_threads = state.range (2);
+  const bool critical_path = state.range (3) != 0;
+
+  constexpr int work_per_chain_node = 100;
+  scheduler_->rechain_from_node_collection (
+    create_uneven_branches (num_cheap_nodes, chain_length, work_per_chain_node),
+    sample_rate_, max_block_length_);
+  scheduler_->set_scheduling_mode (
+    critical_path
+      ? GraphScheduler::SchedulingMode::CriticalPath
+      : GraphScheduler::SchedulingMode::Fifo);
+  scheduler_->start_threads (num_threads);
+
+  const auto time_info = dsp::graph::ProcessBlockInfo::from_position_and_nframes (
+    units::samples (0), units::samples (256));
+
+  for (auto _ : state)
+    {
+      scheduler_->run_cycle (
+        time_info, units::samples (0), *transport_, *tempo_map_);
+    }
+
+  scheduler_->terminate_threads ();
+  state.SetLabel (critical_path ? "critical-path" : "fifo");
+}
+
 // Register linear chain benchmarks
 BENCHMARK_REGISTER_F (GraphSchedulerBenchmark, LinearChain)
   // Format: {num_nodes, block_size, num_threads}
@@ -325,6 +465,33 @@ BENCHMARK_REGISTER_F (GraphSchedulerBenchmark, SplitChain)
   ->Args ({ 40, 25, 256, 4 }) // More shorter branches
   ->Complexity ();
 
+// Register layer rack benchmarks (serial vs parallel layers)
+BENCHMARK_REGISTER_F (GraphSchedulerBenchmark, LayerRack)
+  // Format: {num_layers, block_size, num_threads, parallel}
+  ->Args ({ 4, 256, 4, 0 })
+  ->Args ({ 4, 256, 4, 1 })
+  ->Args ({ 8, 256, 4, 0 })
+  ->Args ({ 8, 256, 4, 1 })
+  ->Args ({ 16, 256, 4, 0 })
+  ->Args ({ 16, 256, 4, 1 })
+  // Thread scaling
+  ->Args ({ 16, 256, 8, 0 })
+  ->Args ({ 16, 256, 8, 1 })
+  ->Args ({ 16, 256, 14, 1 });
+
+// Register uneven branch benchmarks (FIFO vs critical-path scheduling)
+BENCHMARK_REGISTER_F (GraphSchedulerBenchmark, UnevenBranches)
+  // Format: {num_cheap_nodes, chain_length, num_threads, critical_path}
+  ->Args ({ 32, 8, 2, 0 })
+  ->Args ({ 32, 8, 2, 1 })
+  ->Args ({ 64, 8, 4, 0 })
+  ->Args ({ 64, 8, 4, 1 })
+  ->Args ({ 128, 16, 4, 0 })
+  ->Args ({ 128, 16, 4, 1 })
+  // Thread scaling
+  ->Args ({ 128, 16, 8, 0 })
+  ->Args ({ 128, 16, 8, 1 });
+
 // Register complex graph benchmarks
 BENCHMARK_REGISTER_F (GraphSchedulerBenchmark, ComplexGraph)
   // Format: {num_nodes, block_size, num_threads, connectivity_percentage}
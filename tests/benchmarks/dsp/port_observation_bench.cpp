@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <memory>
+#include <vector>
+
+#include "dsp/audio_port.h"
+#include "dsp/port_observation_manager.h"
+#include "dsp/port_observation_token.h"
+#include "dsp/port_observer.h"
+#include "dsp/tempo_map.h"
+#include "utils/object_registry.h"
+#include "utils/registry_utils.h"
+
+#include <QCoreApplication>
+
+#include "../tests/unit/dsp/graph_helpers.h"
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+namespace zrythm::dsp
+{
+
+class PortObservationBenchmark : public benchmark::Fixture
+{
+protected:
+  using MockTransport = testing::NiceMock<graph_test::MockTransport>;
+
+  void SetUp (benchmark::State &state) override
+  {
+    int     argc = 0;
+    char ** argv = nullptr;
+    app_ = std::make_unique<QCoreApplication> (argc, argv);
+    registry_ = std::make_unique<utils::ObjectRegistry> ();
+    manager_ = std::make_unique<PortObservationManager> (*registry_);
+    transport_ = std::make_unique<MockTransport> ();
+    tempo_map_ = std::make_unique<TempoMap> (sample_rate_);
+
+    const auto num_ports = static_cast<size_t> (state.range (0));
+    const auto requesters_per_port = static_cast<size_t> (state.range (1));
+    for (size_t i = 0; i < num_ports; ++i)
+      {
+        auto port_ref = utils::create_object<AudioPort> (
+          *registry_, u8"Bench", PortFlow::Output,
+          AudioPort::BusLayout::Stereo, 2);
+        auto * port = port_ref.get_object_as<AudioPort> ();
+        port->prepare_for_processing (nullptr, sample_rate_, block_length_);
+        for (size_t j = 0; j < requesters_per_port; ++j)
+          {
+            tokens_.push_back (
+              std::make_unique<ObservationToken> (*manager_, *port));
+          }
+        auto * observer = manager_->get_observer (*port);
+        observer->prepare_for_processing (nullptr, sample_rate_, block_length_);
+        port_refs_.push_back (std::move (port_ref));
+      }
+  }
+
+  void TearDown (benchmark::State &) override
+  {
+    tokens_.clear ();
+    port_refs_.clear ();
+    manager_.reset ();
+    registry_.reset ();
+    transport_.reset ();
+    tempo_map_.reset ();
+    app_.reset ();
+  }
+
+  // Simulates the audio thread filling the observer rings for one drain
+  // interval
+  void process_blocks ()
+  {
+    const graph::ProcessBlockInfo time_nfo{
+      .transport_position_ = units::samples (0),
+      .buffer_offset_ = units::samples (0),
+      .nframes_ = block_length_,
+    };
+    for (auto * observer : manager_->observers ())
+      {
+        for (int i = 0; i < kBlocksPerDrain; ++i)
+          {
+            observer->process_block (time_nfo, *transport_, *tempo_map_);
+          }
+      }
+  }
+
+  // 60 fps drain interval at 48 kHz with 256-sample blocks
+  static constexpr int kBlocksPerDrain = 3;
+
+  units::sample_rate_t sample_rate_{ units::sample_rate (48000) };
+  units::sample_u32_t  block_length_{ units::samples (256u) };
+
+  std::unique_ptr<QCoreApplication>                 app_;
+  std::unique_ptr<utils::ObjectRegistry>            registry_;
+  std::unique_ptr<PortObservationManager>           manager_;
+  std::unique_ptr<MockTransport>                    transport_;
+  std::unique_ptr<TempoMap>                         tempo_map_;
+  std::vector<utils::TypedUuidReference<AudioPort>> port_refs_;
+  std::vector<std::unique_ptr<ObservationToken>>    tokens_;
+};
+
+// Measures the GUI thread cost of one drain pass, optionally followed by all
+// requesters reading and clearing their caches (like waveform views do).
+BENCHMARK_DEFINE_F (PortObservationBenchmark, DrainAll)
+(benchmark::State &state)
+{
+  const bool read_caches = state.range (2) != 0;
+  for (auto _ : state)
+    {
+      state.PauseTiming ();
+      process_blocks ();
+      state.ResumeTiming ();
+
+      manager_->drain_all ();
+      if (read_caches)
+        {
+          for (auto &token : tokens_)
+            {
+              auto &cache = token->cache ();
+              benchmark::DoNotOptimize (cache.audio.data ());
+              cache.clear_audio ();
+            }
+        }
+    }
+  state.SetItemsProcessed (
+    static_cast<int64_t> (state.iterations ()) * state.range (0));
+}
+
+// Args: number of ports, requesters per port, whether requesters read
+BENCHMARK_REGISTER_F (PortObservationBenchmark, DrainAll)
+  ->ArgsProduct ({ { 1, 16, 256 }, { 1, 4 }, { 0, 1 } })
+  ->Unit (benchmark::kMicrosecond);
+
+} // namespace zrythm::dsp
@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <vector>
+
+#include "dsp/tempo_map.h"
+
+#include <benchmark/benchmark.h>
+
+namespace zrythm::dsp
+{
+
+namespace
+{
+constexpr int64_t kTimelineBars = 512;
+
+// Creates a tempo map with @p num_events events spread evenly over the
+// timeline, alternating between constant and linear segments.
+TempoMap
+create_tempo_map (int64_t num_events)
+{
+  TempoMap   tempo_map (units::sample_rate (48000.0));
+  const auto ticks_per_bar = 4 * TempoMap::get_ppq ().in (units::ticks);
+  for (int64_t i = 0; i < num_events; ++i)
+    {
+      tempo_map.add_tempo_event (
+        units::ticks (i * kTimelineBars * ticks_per_bar / num_events),
+        units::bpm (100.0 + static_cast<double> (i % 7) * 10.0),
+        i % 2 == 0 ? TempoMap::CurveType::Constant
+                   : TempoMap::CurveType::Linear);
+    }
+  return tempo_map;
+}
+
+// Ascending positions spread over the whole timeline, as when generating the
+// events of a long clip.
+std::vector<TimelineTick>
+create_positions (size_t num_positions)
+{
+  const auto total_ticks = static_cast<double> (
+    kTimelineBars * 4 * TempoMap::get_ppq ().in (units::ticks));
+  std::vector<TimelineTick> positions;
+  positions.reserve (num_positions);
+  for (size_t i = 0; i < num_positions; ++i)
+    {
+      positions.emplace_back (
+        units::ticks (
+          total_ticks * static_cast<double> (i)
+          / static_cast<double> (num_positions)));
+    }
+  return positions;
+}
+} // namespace
+
+static void
+BM_TickToSamplesPerCall (benchmark::State &state)
+{
+  const auto tempo_map = create_tempo_map (state.range (0));
+  const auto positions =
+    create_positions (static_cast<size_t> (state.range (1)));
+  std::vector<units::precise_sample_t> out (positions.size ());
+  for (auto _ : state)
+    {
+      for (size_t i = 0; i < positions.size (); ++i)
+        {
+          out[i] = tempo_map.tick_to_samples (positions[i]);
+        }
+      benchmark::DoNotOptimize (out.data ());
+    }
+  state.SetItemsProcessed (
+    static_cast<int64_t> (state.iterations ()) * state.range (1));
+}
+
+static void
+BM_TickToSamplesCursor (benchmark::State &state)
+{
+  const auto tempo_map = create_tempo_map (state.range (0));
+  const auto positions =
+    create_positions (static_cast<size_t> (state.range (1)));
+  std::vector<units::precise_sample_t> out (positions.size ());
+  for (auto _ : state)
+    {
+      TempoMap::Cursor cursor (tempo_map);
+      for (size_t i = 0; i < positions.size (); ++i)
+        {
+          out[i] = cursor.tick_to_samples (positions[i]);
+        }
+      benchmark::DoNotOptimize (out.data ());
+    }
+  state.SetItemsProcessed (
+    static_cast<int64_t> (state.iterations ()) * state.range (1));
+}
+
+static void
+BM_TickToSamplesBatch (benchmark::State &state)
+{
+  const auto tempo_map = create_tempo_map (state.range (0));
+  const auto positions =
+    create_positions (static_cast<size_t> (state.range (1)));
+  std::vector<units::precise_sample_t> out (positions.size ());
+  for (auto _ : state)
+    {
+      tempo_map.ticks_to_samples (positions, out);
+      benchmark::DoNotOptimize (out.data ());
+    }
+  state.SetItemsProcessed (
+    static_cast<int64_t> (state.iterations ()) * state.range (1));
+}
+
+static void
+BM_SamplesToTickPerCall (benchmark::State &state)
+{
+  const auto tempo_map = create_tempo_map (state.range (0));
+  const auto positions =
+    create_positions (static_cast<size_t> (state.range (1)));
+  std::vector<units::precise_sample_t> samples (positions.size ());
+  tempo_map.ticks_to_samples (positions, samples);
+  std::vector<TimelineTick> out (samples.size ());
+  for (auto _ : state)
+    {
+      for (size_t i = 0; i < samples.size (); ++i)
+        {
+          out[i] = tempo_map.samples_to_tick (samples[i]);
+        }
+      benchmark::DoNotOptimize (out.data ());
+    }
+  state.SetItemsProcessed (
+    static_cast<int64_t> (state.iterations ()) * state.range (1));
+}
+
+static void
+BM_SamplesToTickBatch (benchmark::State &state)
+{
+  const auto tempo_map = create_tempo_map (state.range (0));
+  const auto positions =
+    create_positions (static_cast<size_t> (state.range (1)));
+  std::vector<units::precise_sample_t> samples (positions.size ());
+  tempo_map.ticks_to_samples (positions, samples);
+  std::vector<TimelineTick> out (samples.size ());
+  for (auto _ : state)
+    {
+      tempo_map.samples_to_ticks (samples, out);
+      benchmark::DoNotOptimize (out.data ());
+    }
+  state.SetItemsProcessed (
+    static_cast<int64_t> (state.iterations ()) * state.range (1));
+}
+
+// Args: number of tempo events, number of positions
+BENCHMARK (BM_TickToSamplesPerCall)
+  ->ArgsProduct ({ { 0, 16, 256 }, { 64, 4096 } });
+BENCHMARK (BM_TickToSamplesCursor)
+  ->ArgsProduct ({ { 0, 16, 256 }, { 64, 4096 } });
+BENCHMARK (BM_TickToSamplesBatch)
+  ->ArgsProduct ({ { 0, 16, 256 }, { 64, 4096 } });
+BENCHMARK (BM_SamplesToTickPerCall)
+  ->ArgsProduct ({ { 0, 16, 256 }, { 64, 4096 } });
+BENCHMARK (BM_SamplesToTickBatch)
+  ->ArgsProduct ({ { 0, 16, 256 }, { 64, 4096 } });
+
+} // namespace zrythm::dsp
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <array>
+#include <span>
+
+#include "utils/bounded_mpmc_queue.h"
+#include "utils/mpmc_queue.h"
+
+#include <benchmark/benchmark.h>
+
+namespace zrythm::utils
+{
+
+namespace
+{
+
+// Enough room for every thread to have a full batch in flight
+constexpr size_t kQueueCapacity = 4096;
+constexpr size_t kBatchSize = 16;
+
+template <typename Queue>
+Queue &
+shared_queue ()
+{
+  static Queue queue (kQueueCapacity);
+  return queue;
+}
+
+template <typename Queue>
+void
+push_batch (Queue &queue, std::span<const int> values)
+{
+  if constexpr (requires { queue.push_back_bulk (values); })
+    {
+      while (!values.empty ())
+        {
+          values = values.subspan (queue.push_back_bulk (values));
+        }
+    }
+  else
+    {
+      for (const auto value : values)
+        {
+          while (!queue.push_back (value))
+            ;
+        }
+    }
+}
+
+template <typename Queue>
+void
+pop_batch (Queue &queue, std::span<int> out)
+{
+  if constexpr (requires { queue.pop_front_bulk (out); })
+    {
+      while (!out.empty ())
+        {
+          out = out.subspan (queue.pop_front_bulk (out));
+        }
+    }
+  else
+    {
+      for (auto &value : out)
+        {
+          // May transiently fail while another thread is mid-push
+          while (!queue.pop_front (value))
+            ;
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Every thread pushes an element and pops one, so all threads contend
+ * on both ends of the queue.
+ */
+template <typename Queue>
+static void
+BM_PushPop (benchmark::State &state)
+{
+  auto &queue = shared_queue<Queue> ();
+  if (state.thread_index () == 0)
+    queue.clear ();
+
+  int value = state.thread_index ();
+  for (auto _ : state)
+    {
+      while (!queue.push_back (value))
+        ;
+      while (!queue.pop_front (value))
+        ;
+      benchmark::DoNotOptimize (value);
+    }
+  state.SetItemsProcessed (state.iterations ());
+}
+
+/**
+ * @brief Every thread pushes and pops batches of elements, similar to the
+ * graph scheduler queueing all children of a node at once.
+ *
+ * Uses the bulk operations where available.
+ */
+template <typename Queue>
+static void
+BM_BatchPushPop (benchmark::State &state)
+{
+  auto &queue = shared_queue<Queue> ();
+  if (state.thread_index () == 0)
+    queue.clear ();
+
+  std::array<int, kBatchSize> batch{};
+  batch.fill (state.thread_index ());
+  for (auto _ : state)
+    {
+      push_batch (queue, batch);
+      pop_batch (queue, batch);
+      benchmark::DoNotOptimize (batch);
+    }
+  state.SetItemsProcessed (
+    state.iterations () * static_cast<int64_t> (kBatchSize));
+}
+
+BENCHMARK_TEMPLATE (BM_PushPop, MPMCQueue<int>)
+  ->ThreadRange (2, 64)
+  ->UseRealTime ();
+BENCHMARK_TEMPLATE (BM_PushPop, BoundedMPMCQueue<int>)
+  ->ThreadRange (2, 64)
+  ->UseRealTime ();
+BENCHMARK_TEMPLATE (BM_BatchPushPop, MPMCQueue<int>)
+  ->ThreadRange (2, 64)
+  ->UseRealTime ();
+BENCHMARK_TEMPLATE (BM_BatchPushPop, BoundedMPMCQueue<int>)
+  ->ThreadRange (2, 64)
+  ->UseRealTime ();
+
+} // namespace zrythm::utils
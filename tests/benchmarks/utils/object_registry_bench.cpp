@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <vector>
+
+#include "utils/object_registry.h"
+#include "utils/qt.h"
+
+#include <benchmark/benchmark.h>
+
+namespace zrythm::utils
+{
+
+// Stand-ins for the object kinds found in a typical project. Notes vastly
+// outnumber everything else, while pool files are comparatively rare.
+
+class BenchNote : public UuidIdentifiableBase
+{
+  Q_OBJECT
+};
+
+class BenchAutomationPoint : public UuidIdentifiableBase
+{
+  Q_OBJECT
+};
+
+class BenchPort : public UuidIdentifiableBase
+{
+  Q_OBJECT
+};
+
+class BenchPoolFile : public UuidIdentifiableBase
+{
+  Q_OBJECT
+};
+
+namespace
+{
+
+/**
+ * @brief Populates a registry with @p total objects: ~80% notes, ~15%
+ * automation points, ~5% ports and 1 pool file per 1000 objects.
+ */
+template <typename Func>
+void
+populate (size_t total, Func &&register_func)
+{
+  for (size_t i = 0; i < total; ++i)
+    {
+      if (i % 1000 == 0)
+        register_func (new BenchPoolFile ());
+      else if (i % 20 == 1)
+        register_func (new BenchPort ());
+      else if (i % 7 == 2)
+        register_func (new BenchAutomationPoint ());
+      else
+        register_func (new BenchNote ());
+    }
+}
+
+} // namespace
+
+static void
+BM_ForEachMatching_Indexed (benchmark::State &state)
+{
+  const auto     total = static_cast<size_t> (state.range (0));
+  ObjectRegistry registry;
+  populate (total, [&] (UuidIdentifiableBase * obj) {
+    registry.register_object (*obj);
+  });
+
+  for (auto _ : state)
+    {
+      size_t count = 0;
+      registry.for_each_matching<BenchPoolFile> ([&] (BenchPoolFile &) {
+        ++count;
+      });
+      benchmark::DoNotOptimize (count);
+    }
+  state.SetComplexityN (static_cast<int64_t> (total));
+}
+BENCHMARK (BM_ForEachMatching_Indexed)
+  ->RangeMultiplier (4)
+  ->Range (1 << 10, 1 << 18)
+  ->Complexity ();
+
+// Baseline: the previous approach of scanning every object with an
+// inherits() check.
+static void
+BM_ForEachMatching_LinearScan (benchmark::State &state)
+{
+  const auto total = static_cast<size_t> (state.range (0));
+  std::vector<QObjectUniquePtr<UuidIdentifiableBase>> objects;
+  objects.reserve (total);
+  populate (total, [&] (UuidIdentifiableBase * obj) {
+    objects.emplace_back (obj);
+  });
+
+  for (auto _ : state)
+    {
+      size_t count = 0;
+      for (const auto &obj : objects)
+        {
+          if (obj->metaObject ()->inherits (&BenchPoolFile::staticMetaObject))
+            ++count;
+        }
+      benchmark::DoNotOptimize (count);
+    }
+  state.SetComplexityN (static_cast<int64_t> (total));
+}
+BENCHMARK (BM_ForEachMatching_LinearScan)
+  ->RangeMultiplier (4)
+  ->Range (1 << 10, 1 << 18)
+  ->Complexity ();
+
+static void
+BM_RegisterAndRelease (benchmark::State &state)
+{
+  const auto total = static_cast<size_t> (state.range (0));
+  for (auto _ : state)
+    {
+      ObjectRegistry     registry;
+      std::vector<QUuid> ids;
+      ids.reserve (total);
+      populate (total, [&] (UuidIdentifiableBase * obj) {
+        registry.register_object (*obj);
+        registry.acquire_reference (obj->raw_uuid ());
+        ids.push_back (obj->raw_uuid ());
+      });
+      for (const auto &id : ids)
+        registry.release_reference (id);
+      benchmark::DoNotOptimize (registry.count_matching<BenchNote> ());
+    }
+  state.SetComplexityN (static_cast<int64_t> (total));
+}
+BENCHMARK (BM_RegisterAndRelease)
+  ->RangeMultiplier (8)
+  ->Range (1 << 10, 1 << 16)
+  ->Complexity ();
+
+} // namespace zrythm::utils
+
+#include "object_registry_bench.moc"
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <mutex>
+
+#include "actions/audio_function_batch_executor.h"
+#include "structure/arrangement/arranger_object_factory.h"
+#include "undo/undo_stack.h"
+#include "utils/object_registry.h"
+#include "utils/registry_utils.h"
+
+#include <QSignalSpy>
+
+#include "helpers/scoped_qcoreapplication.h"
+
+#include <gtest/gtest.h>
+
+namespace zrythm::actions
+{
+
+using namespace structure::arrangement;
+
+class AudioFunctionBatchExecutorTest : public ::testing::Test
+{
+protected:
+  static constexpr int NUM_FRAMES = 1024;
+
+  void SetUp () override
+  {
+    tempo_map_ = std::make_unique<dsp::TempoMap> (units::sample_rate (44100.0));
+    tempo_map_wrapper_ = std::make_unique<dsp::TempoMapWrapper> (*tempo_map_);
+    factory_ = std::make_unique<ArrangerObjectFactory> (
+      ArrangerObjectFactory::Dependencies{
+        .tempo_map_ = *tempo_map_wrapper_,
+        .registry_ = registry_,
+        .last_timeline_obj_len_provider_ = [] () { return 100.0; },
+        .last_editor_obj_len_provider_ = [] () { return 50.0; },
+        .automation_curve_algorithm_provider_ =
+          [] () { return dsp::CurveOptions::Algorithm::Exponent; } },
+      [] () { return units::sample_rate (44100); },
+      [] () { return units::bpm (120.0); });
+    undo_stack_ = std::make_unique<undo::UndoStack> (
+      [] (const std::function<void ()> &action, bool) { action (); });
+    executor_ = std::make_unique<AudioFunctionBatchExecutor> (
+      *undo_stack_, *factory_, [this] (const dsp::FileAudioSource &source) {
+        std::scoped_lock lock (written_mutex_);
+        written_.push_back (source.get_uuid ());
+      });
+  }
+
+  void TearDown () override
+  {
+    executor_.reset ();
+    clips_.clear ();
+  }
+
+  AudioClip * add_clip (float value)
+  {
+    utils::audio::AudioBuffer buf (2, NUM_FRAMES);
+    for (int ch = 0; ch < 2; ++ch)
+      {
+        for (int i = 0; i < NUM_FRAMES; ++i)
+          buf.setSample (ch, i, value);
+      }
+    clips_.push_back (factory_->create_audio_clip_from_audio_buffer (
+      buf, utils::audio::BitDepth::BIT_DEPTH_32, u8"clip",
+      units::ticks (0.0)));
+    return clips_.back ().get_object_as<AudioClip> ();
+  }
+
+  AudioClip * add_clip_sharing_source (const AudioClip &other)
+  {
+    const auto source_ref =
+      other.get_children_view ().front ()->audio_source_ref ();
+    clips_.push_back (
+      factory_->create_audio_clip_with_clip (source_ref, units::ticks (0.0)));
+    return clips_.back ().get_object_as<AudioClip> ();
+  }
+
+  static float first_sample (const AudioClip &clip)
+  {
+    return clip.get_children_view ()
+      .front ()
+      ->file_audio_source ()
+      .get_samples ()
+      .getSample (0, 0);
+  }
+
+  test_helpers::ScopedQCoreApplication              app_;
+  utils::ObjectRegistry                             registry_;
+  std::unique_ptr<dsp::TempoMap>                    tempo_map_;
+  std::unique_ptr<dsp::TempoMapWrapper>             tempo_map_wrapper_;
+  std::unique_ptr<ArrangerObjectFactory>            factory_;
+  std::unique_ptr<undo::UndoStack>                  undo_stack_;
+  std::unique_ptr<AudioFunctionBatchExecutor>       executor_;
+  std::vector<utils::TypedUuidReference<AudioClip>> clips_;
+  std::mutex                                        written_mutex_;
+  std::vector<dsp::FileAudioSource::Uuid>           written_;
+};
+
+TEST_F (AudioFunctionBatchExecutorTest, AppliesToAllClipsInOneUndoStep)
+{
+  auto * a = add_clip (0.5f);
+  auto * b = add_clip (0.25f);
+  auto * c = add_clip_sharing_source (*a);
+
+  QSignalSpy finished_spy (
+    executor_.get (), &AudioFunctionBatchExecutor::finished);
+  ASSERT_TRUE (executor_->apply ({ a, b, c }, AudioFunctionType::Invert, {}));
+  EXPECT_TRUE (executor_->running ());
+  EXPECT_EQ (executor_->progressMaximum (), 4);
+
+  // Nothing changes until the batch is committed
+  EXPECT_FLOAT_EQ (first_sample (*a), 0.5f);
+
+  ASSERT_TRUE (finished_spy.wait (5000));
+  EXPECT_TRUE (finished_spy.front ().front ().toBool ());
+  EXPECT_FALSE (executor_->running ());
+
+  // The shared source was processed and written once
+  EXPECT_EQ (written_.size (), 2u);
+  EXPECT_FLOAT_EQ (first_sample (*a), -0.5f);
+  EXPECT_FLOAT_EQ (first_sample (*b), -0.25f);
+  EXPECT_FLOAT_EQ (first_sample (*c), -0.5f);
+  EXPECT_EQ (
+    a->get_children_view ().front ()->audio_source_ref ().id (),
+    c->get_children_view ().front ()->audio_source_ref ().id ());
+
+  EXPECT_EQ (undo_stack_->count (), 1);
+  undo_stack_->undo ();
+  EXPECT_FLOAT_EQ (first_sample (*a), 0.5f);
+  EXPECT_FLOAT_EQ (first_sample (*b), 0.25f);
+  EXPECT_FLOAT_EQ (first_sample (*c), 0.5f);
+
+  undo_stack_->redo ();
+  EXPECT_FLOAT_EQ (first_sample (*b), -0.25f);
+}
+
+TEST_F (AudioFunctionBatchExecutorTest, CancelLeavesClipsUntouched)
+{
+  auto * a = add_clip (0.5f);
+
+  QSignalSpy finished_spy (
+    executor_.get (), &AudioFunctionBatchExecutor::finished);
+  ASSERT_TRUE (executor_->apply ({ a }, AudioFunctionType::Invert, {}));
+  executor_->cancel ();
+
+  ASSERT_TRUE (finished_spy.wait (5000));
+  EXPECT_FALSE (finished_spy.front ().front ().toBool ());
+  EXPECT_FLOAT_EQ (first_sample (*a), 0.5f);
+  EXPECT_EQ (undo_stack_->count (), 0);
+}
+
+TEST_F (AudioFunctionBatchExecutorTest, FailureInOneClipCommitsNothing)
+{
+  auto * a = add_clip (0.5f);
+  auto * b = add_clip (0.25f);
+
+  // Nudging by more than the clip length fails
+  QSignalSpy finished_spy (
+    executor_.get (), &AudioFunctionBatchExecutor::finished);
+  ASSERT_TRUE (executor_->apply (
+    { a, b }, AudioFunctionType::NudgeRight, { .amount_ = NUM_FRAMES * 2 }));
+
+  ASSERT_TRUE (finished_spy.wait (5000));
+  EXPECT_FALSE (finished_spy.front ().front ().toBool ());
+  EXPECT_TRUE (written_.empty ());
+  EXPECT_EQ (undo_stack_->count (), 0);
+}
+
+TEST_F (AudioFunctionBatchExecutorTest, RejectsUnsupportedInput)
+{
+  auto * a = add_clip (0.5f);
+  EXPECT_FALSE (executor_->apply ({ a }, AudioFunctionType::CustomPlugin, {}));
+  EXPECT_FALSE (executor_->apply ({}, AudioFunctionType::Invert, {}));
+  EXPECT_FALSE (executor_->running ());
+}
+
+} // namespace zrythm::actions
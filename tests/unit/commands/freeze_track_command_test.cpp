@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include "commands/freeze_track_command.h"
+#include "utils/registry_utils.h"
+
+#include "unit/structure/tracks/mock_track.h"
+#include <gtest/gtest.h>
+
+namespace zrythm::commands
+{
+class FreezeTrackCommandTest : public ::testing::Test
+{
+protected:
+  void SetUp () override
+  {
+    track = mock_track_factory.createMockTrack (
+      structure::tracks::Track::Type::Audio);
+  }
+
+  dsp::FileAudioSourceUuidReference create_source ()
+  {
+    utils::audio::AudioBuffer buf (2, 256);
+    buf.clear ();
+    return utils::create_object<dsp::FileAudioSource> (
+      *mock_track_factory.registry_, buf, utils::audio::BitDepth::BIT_DEPTH_32,
+      units::sample_rate (48000), units::bpm (120.0), u8"Frozen");
+  }
+
+  structure::tracks::MockTrackFactory           mock_track_factory;
+  std::unique_ptr<structure::tracks::MockTrack> track;
+};
+
+TEST_F (FreezeTrackCommandTest, FreezeRedoAndUndo)
+{
+  auto               source = create_source ();
+  FreezeTrackCommand command (*track, source);
+  EXPECT_EQ (command.text (), QObject::tr ("Freeze Track"));
+  EXPECT_FALSE (track->frozen ());
+
+  command.redo ();
+  ASSERT_TRUE (track->frozen ());
+  EXPECT_EQ (track->frozen_audio ()->id (), source.id ());
+  EXPECT_NE (track->frozen_audio_player (), nullptr);
+
+  command.undo ();
+  EXPECT_FALSE (track->frozen ());
+  EXPECT_EQ (track->frozen_audio_player (), nullptr);
+
+  command.redo ();
+  EXPECT_TRUE (track->frozen ());
+}
+
+TEST_F (FreezeTrackCommandTest, UnfreezeRestoresPreviousAudio)
+{
+  auto source = create_source ();
+  track->set_frozen_audio (source);
+
+  FreezeTrackCommand command (*track, std::nullopt);
+  EXPECT_EQ (command.text (), QObject::tr ("Unfreeze Track"));
+
+  command.redo ();
+  EXPECT_FALSE (track->frozen ());
+
+  command.undo ();
+  ASSERT_TRUE (track->frozen ());
+  EXPECT_EQ (track->frozen_audio ()->id (), source.id ());
+}
+
+TEST_F (FreezeTrackCommandTest, CommandId)
+{
+  FreezeTrackCommand command (*track, std::nullopt);
+  EXPECT_EQ (command.id (), FreezeTrackCommand::CommandId);
+}
+
+} // namespace zrythm::commands
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include "controllers/track_freezer.h"
+#include "dsp/graph.h"
+#include "plugins/internal_plugin_base.h"
+#include "plugins/plugin_configuration.h"
+#include "project_json_serializer_test.h"
+#include "structure/project/project_graph_builder.h"
+#include "structure/tracks/audio_track.h"
+#include "utils/registry_utils.h"
+
+#include "helpers/qt_helpers.h"
+
+namespace zrythm::controllers
+{
+
+class TrackFreezerTest : public ProjectSerializationTest
+{
+protected:
+  void SetUp () override
+  {
+    ProjectSerializationTest::SetUp ();
+    project_ = create_minimal_project ();
+    create_ui_state_and_undo_stack (*project_);
+    freezer_ = std::make_unique<TrackFreezer> (*project_, *undo_stack);
+
+    auto track_ref = project_->track_factory_->create_empty_track<
+      structure::tracks::AudioTrack> ();
+    track_ = track_ref.get_object_as<structure::tracks::AudioTrack> ();
+    track_->setName (u8"Audio Track");
+    project_->tracklist ()->collection ()->add_track (track_ref);
+
+    // A clip of constant audio at the start of the timeline
+    utils::audio::AudioBuffer buf (2, 4800);
+    for (int ch = 0; ch < buf.getNumChannels (); ++ch)
+      {
+        for (int i = 0; i < buf.getNumSamples (); ++i)
+          buf.setSample (ch, i, 0.5f);
+      }
+    auto clip_ref =
+      project_->arrangerObjectFactory ()->create_audio_clip_from_audio_buffer (
+        buf, utils::audio::BitDepth::BIT_DEPTH_32, u8"Clip", units::ticks (0));
+    track_->lanes ()->at (0)->structure::arrangement::ArrangerObjectOwner<
+      structure::arrangement::AudioClip>::add_object (clip_ref);
+
+    // A pass-through insert
+    plugin_ref_.emplace (utils::create_object<plugins::InternalPluginBase> (
+      project_->get_registry (), project_->get_registry ()));
+    auto * plugin = plugin_ref_->get_object_as<plugins::InternalPluginBase> ();
+    plugins::PluginConfiguration config;
+    config.descr_ = std::make_unique<plugins::PluginDescriptor> ();
+    config.descr_->name_ = u8"Pass-through";
+    plugin->set_configuration (config);
+    for (const auto flow : { dsp::PortFlow::Input, dsp::PortFlow::Output })
+      {
+        auto port_ref = utils::create_object<dsp::AudioPort> (
+          project_->get_registry (), u8"Audio", flow,
+          dsp::AudioPort::BusLayout::Stereo, 2);
+        if (flow == dsp::PortFlow::Input)
+          plugin->add_input_port (port_ref);
+        else
+          plugin->add_output_port (port_ref);
+      }
+    track_->channel ()->inserts ()->append_plugin (*plugin_ref_);
+  }
+
+  void TearDown () override
+  {
+    freezer_.reset ();
+    undo_stack.reset ();
+    plugin_ref_.reset ();
+    project_.reset ();
+    ProjectSerializationTest::TearDown ();
+  }
+
+  bool graph_has_node_for (const dsp::graph::IProcessable &processable)
+  {
+    structure::project::ProjectGraphBuilder builder (
+      *project_, project_->metronome (), project_->monitor_fader ());
+    dsp::graph::Graph graph;
+    builder.build_graph (graph);
+    return graph.get_nodes ().find_node_for_processable (processable)
+           != nullptr;
+  }
+
+  utils::audio::AudioBuffer render_pre_fader ()
+  {
+    auto future = TrackFreezer::render_pre_fader (*project_, *track_);
+    EXPECT_TRUE (test_helpers::waitForFutureWithEvents (future));
+    return future.result ();
+  }
+
+  std::unique_ptr<structure::project::Project> project_;
+  std::unique_ptr<TrackFreezer>                freezer_;
+  structure::tracks::AudioTrack *              track_{};
+  std::optional<plugins::PluginUuidReference>  plugin_ref_;
+};
+
+TEST_F (TrackFreezerTest, FreezeBypassesPluginsAndPlaysFrozenAudio)
+{
+  ASSERT_TRUE (graph_has_node_for (*plugin_ref_->get ()));
+  const auto live_audio = render_pre_fader ();
+
+  auto future = freezer_->freeze (*track_);
+  ASSERT_TRUE (test_helpers::waitForFutureWithEvents (future));
+  ASSERT_TRUE (track_->frozen ());
+  EXPECT_EQ (undo_stack->count (), 1);
+
+  // The processing chain is replaced by the frozen audio
+  EXPECT_FALSE (graph_has_node_for (*plugin_ref_->get ()));
+  EXPECT_FALSE (graph_has_node_for (*track_->get_track_processor ()));
+  EXPECT_TRUE (graph_has_node_for (*track_->frozen_audio_player ()));
+
+  const auto &frozen_samples = track_->frozen_audio ()
+                                 ->get_object_as<dsp::FileAudioSource> ()
+                                 ->get_samples ();
+  ASSERT_EQ (frozen_samples.getNumSamples (), live_audio.getNumSamples ());
+
+  // Playing back the frozen audio sounds like the live chain did
+  const auto frozen_audio = render_pre_fader ();
+  ASSERT_EQ (frozen_audio.getNumChannels (), live_audio.getNumChannels ());
+  ASSERT_EQ (frozen_audio.getNumSamples (), live_audio.getNumSamples ());
+  for (int ch = 0; ch < live_audio.getNumChannels (); ++ch)
+    {
+      for (int i = 0; i < live_audio.getNumSamples (); ++i)
+        {
+          ASSERT_FLOAT_EQ (
+            frozen_audio.getSample (ch, i), live_audio.getSample (ch, i))
+            << "channel " << ch << ", frame " << i;
+        }
+    }
+
+  // Unfreezing restores the chain and can be undone
+  freezer_->unfreezeTrack (track_);
+  EXPECT_FALSE (track_->frozen ());
+  EXPECT_TRUE (graph_has_node_for (*plugin_ref_->get ()));
+  EXPECT_EQ (undo_stack->count (), 2);
+
+  undo_stack->undo ();
+  EXPECT_TRUE (track_->frozen ());
+  undo_stack->undo ();
+  EXPECT_FALSE (track_->frozen ());
+}
+
+TEST_F (TrackFreezerTest, FrozenTrackCannotBeFrozenAgain)
+{
+  auto future = freezer_->freeze (*track_);
+  ASSERT_TRUE (test_helpers::waitForFutureWithEvents (future));
+  ASSERT_TRUE (track_->frozen ());
+  EXPECT_THROW ((void) freezer_->freeze (*track_), ZrythmException);
+}
+
+} // namespace zrythm::controllers
@@ -5,6 +5,7 @@
 
 #include "dsp/audio_pool.h"
 #include "dsp/file_audio_source.h"
+#include "utils/exceptions.h"
 #include "utils/io_utils.h"
 #include "utils/object_registry.h"
 #include "utils/registry_utils.h"
@@ -110,6 +111,34 @@ TEST_F (AudioPoolTest, WriteClip)
   EXPECT_TRUE (utils::io::path_exists (path));
 }
 
+// Loudness of written clips is keyed on their pool file until they are edited
+TEST_F (AudioPoolTest, AnalyzeLoudnessMeasuresEditsAfterWrite)
+{
+  auto * clip = &utils::get_typed<FileAudioSource> (registry, clip_id);
+
+  utils::audio::AudioBuffer frames (2, 100);
+  frames.clear ();
+  clip->replace_frames (frames, units::samples (0));
+  audio_pool->write_clip (clip, false, false);
+
+  auto future = audio_pool->analyze_loudness (clip_id);
+  future.waitForFinished ();
+  EXPECT_FLOAT_EQ (future.result ().sample_peak, 0.f);
+
+  // Repeated requests are answered from the cache right away
+  EXPECT_TRUE (audio_pool->analyze_loudness (clip_id).isFinished ());
+
+  for (int ch = 0; ch < frames.getNumChannels (); ++ch)
+    {
+      for (int i = 0; i < frames.getNumSamples (); ++i)
+        frames.setSample (ch, i, 0.5f);
+    }
+  clip->replace_frames (frames, units::samples (0));
+  future = audio_pool->analyze_loudness (clip_id);
+  future.waitForFinished ();
+  EXPECT_FLOAT_EQ (future.result ().sample_peak, 0.5f);
+}
+
 // Test removing unused clips
 TEST_F (AudioPoolTest, RemoveUnused)
 {
@@ -155,6 +184,47 @@ TEST_F (AudioPoolTest, ReloadClipFrameBufs)
   EXPECT_GT (clip->get_num_frames (), 0);
 }
 
+// Test decoding clips on worker threads
+TEST_F (AudioPoolTest, InitLoadedAsyncUpdatesClipsOnFinish)
+{
+  auto * clip = &utils::get_typed<FileAudioSource> (registry, clip_id);
+  auto   other_ref = utils::create_object<FileAudioSource> (
+    registry, utils::audio::AudioBuffer (2, 50),
+    FileAudioSource::BitDepth::BIT_DEPTH_32, units::sample_rate (44100),
+    units::bpm (120.0), u8"other_clip", nullptr);
+  auto * other = other_ref.get_object_as<FileAudioSource> ();
+  audio_pool->write_clip (clip, false, false);
+  audio_pool->write_clip (other, false, false);
+  clip->clear_frames ();
+  other->clear_frames ();
+
+  auto future = audio_pool->init_loaded_async ();
+  future.waitForFinished ();
+
+  // Nothing changes until the decoded files are applied
+  EXPECT_EQ (clip->get_num_frames (), 0);
+
+  ASSERT_NO_THROW (audio_pool->finish_init_loaded ());
+  EXPECT_EQ (clip->get_num_frames (), 100);
+  EXPECT_EQ (other->get_num_frames (), 50);
+  EXPECT_EQ (clip->get_name (), u8"test_clip");
+}
+
+// A missing file fails the load without affecting the other clips
+TEST_F (AudioPoolTest, InitLoadedReportsMissingFiles)
+{
+  auto * clip = &utils::get_typed<FileAudioSource> (registry, clip_id);
+  auto   missing_ref = utils::create_object<FileAudioSource> (
+    registry, utils::audio::AudioBuffer (2, 50),
+    FileAudioSource::BitDepth::BIT_DEPTH_32, units::sample_rate (44100),
+    units::bpm (120.0), u8"missing_clip", nullptr);
+  audio_pool->write_clip (clip, false, false);
+  clip->clear_frames ();
+
+  EXPECT_THROW (audio_pool->init_loaded (), ZrythmException);
+  EXPECT_EQ (clip->get_num_frames (), 100);
+}
+
 // Test writing all clips to disk
 TEST_F (AudioPoolTest, WriteToDisk)
 {
@@ -104,6 +104,81 @@ TEST (CurveTest, LogarithmicCurve)
   EXPECT_NEAR (opts.get_normalized_y (1.0, false), 1.0, epsilon);
 }
 
+TEST (CurveTest, NormalizedYRangeMatchesScalar)
+{
+  constexpr size_t num_points = 257;
+  const double     step = 1.0 / (num_points - 1);
+
+  for (
+    const auto algo :
+    { CurveOptions::Algorithm::Exponent, CurveOptions::Algorithm::SuperEllipse,
+      CurveOptions::Algorithm::Vital, CurveOptions::Algorithm::Pulse,
+      CurveOptions::Algorithm::Logarithmic })
+    {
+      for (const double curviness : { -1.0, -0.7, -0.2, 0.0, 0.3, 0.8, 1.0 })
+        {
+          for (const bool start_higher : { false, true })
+            {
+              const CurveOptions opts (curviness, algo);
+              std::vector<float> out (num_points);
+              opts.get_normalized_y_range (0.0, step, start_higher, out);
+
+              for (size_t i = 0; i < num_points; ++i)
+                {
+                  const double x = static_cast<double> (i) * step;
+                  // Pulse jumps at a threshold so float rounding of x may
+                  // land on the other side of it
+                  if (
+                    algo == CurveOptions::Algorithm::Pulse
+                    && std::abs (x - ((1.0 + curviness) / 2.0)) < 1e-6)
+                    continue;
+                  EXPECT_NEAR (
+                    out[i], opts.get_normalized_y (x, start_higher), 1e-4)
+                    << "algo " << static_cast<int> (algo) << " curviness "
+                    << curviness << " start_higher " << start_higher << " x "
+                    << x;
+                }
+            }
+        }
+    }
+}
+
+TEST (CurveTest, NormalizedYRangeClampsOutOfRangeX)
+{
+  const CurveOptions opts (0.5, CurveOptions::Algorithm::Exponent);
+  std::vector<float> out (3);
+  opts.get_normalized_y_range (-0.5, 0.75, false, out);
+
+  EXPECT_NEAR (out[0], opts.get_normalized_y (0.0, false), 1e-5);
+  EXPECT_NEAR (out[1], opts.get_normalized_y (0.25, false), 1e-5);
+  EXPECT_NEAR (out[2], opts.get_normalized_y (1.0, false), 1e-5);
+}
+
+TEST (CurveTest, EvaluateCurveRangeMatchesScalar)
+{
+  std::vector<float> out (64);
+
+  // Rising, falling and flat segments over a sub-range of the curve
+  for (
+    const auto &[value_a, value_b] :
+    { std::pair{ 0.2f, 0.9f }, std::pair{ 0.9f, 0.1f },
+      std::pair{ 0.5f, 0.5f } })
+    {
+      evaluate_curve_range (
+        value_a, value_b, CurveOptions::Algorithm::Vital, 0.4f, 0.25, 0.01,
+        out);
+      for (size_t i = 0; i < out.size (); ++i)
+        {
+          EXPECT_NEAR (
+            out[i],
+            evaluate_curve (
+              value_a, value_b, CurveOptions::Algorithm::Vital, 0.4f,
+              0.25 + static_cast<double> (i) * 0.01),
+            1e-5);
+        }
+    }
+}
+
 TEST (CurveTest, Serialization)
 {
   // Create curve options with specific values
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <cmath>
+#include <filesystem>
+#include <numbers>
+
+#include "dsp/export_pipeline.h"
+#include "utils/io_utils.h"
+#include "utils/utf8_string.h"
+
+#include <juce_audio_formats/juce_audio_formats.h>
+
+#include <gtest/gtest.h>
+
+namespace zrythm::dsp
+{
+
+class ExportPipelineTest : public ::testing::Test
+{
+protected:
+  static constexpr auto SAMPLE_RATE = units::sample_rate (48000);
+  static constexpr int  BLOCK_LENGTH = 512;
+
+  void SetUp () override
+  {
+    temp_dir_ = utils::io::make_tmp_dir ();
+    temp_dir_path_ =
+      utils::Utf8String::from_qstring (temp_dir_->path ()).to_path ();
+  }
+
+  /** Pushes @p num_blocks blocks of a stereo 440 Hz sine. */
+  static bool push_sine (ExportPipeline &pipeline, int num_blocks)
+  {
+    juce::AudioSampleBuffer block (2, BLOCK_LENGTH);
+    for (int b = 0; b < num_blocks; ++b)
+      {
+        for (int ch = 0; ch < 2; ++ch)
+          {
+            for (int i = 0; i < BLOCK_LENGTH; ++i)
+              {
+                const auto frame = b * BLOCK_LENGTH + i;
+                block.setSample (
+                  ch, i,
+                  0.5f
+                    * std::sin (
+                      2.f * std::numbers::pi_v<float> * 440.f
+                      * static_cast<float> (frame) / 48000.f));
+              }
+          }
+        if (!pipeline.push (block, BLOCK_LENGTH))
+          return false;
+      }
+    return true;
+  }
+
+  static std::unique_ptr<juce::AudioFormatReader>
+  open_reader (const std::filesystem::path &path)
+  {
+    juce::AudioFormatManager format_manager;
+    format_manager.registerBasicFormats ();
+    return std::unique_ptr<juce::AudioFormatReader> (
+      format_manager.createReaderFor (
+        utils::Utf8String::from_path (path).to_juce_file ()));
+  }
+
+  std::unique_ptr<QTemporaryDir> temp_dir_;
+  std::filesystem::path          temp_dir_path_;
+};
+
+TEST_F (ExportPipelineTest, WritesMultipleFormatsFromOneRender)
+{
+  const auto wav_path = temp_dir_path_ / "out.wav";
+  const auto flac_path = temp_dir_path_ / "out.flac";
+  {
+    ExportPipeline pipeline (
+      SAMPLE_RATE, 2,
+      { { .path_ = wav_path }, { .path_ = flac_path, .dither_ = false } });
+    ASSERT_TRUE (push_sine (pipeline, 100));
+    pipeline.finish ();
+  }
+
+  for (const auto &path : { wav_path, flac_path })
+    {
+      auto reader = open_reader (path);
+      ASSERT_NE (reader, nullptr) << path;
+      EXPECT_EQ (reader->lengthInSamples, 100 * BLOCK_LENGTH);
+      EXPECT_EQ (reader->numChannels, 2u);
+      EXPECT_EQ (reader->bitsPerSample, 16u);
+      EXPECT_DOUBLE_EQ (reader->sampleRate, 48000.0);
+    }
+}
+
+TEST_F (ExportPipelineTest, ResamplesToOutputRate)
+{
+  const auto path = temp_dir_path_ / "resampled.wav";
+  {
+    ExportPipeline pipeline (
+      SAMPLE_RATE, 2,
+      { { .path_ = path,
+          .sample_rate_ = units::sample_rate (44100),
+          .bit_depth_ = utils::audio::BitDepth::BIT_DEPTH_24 } });
+    ASSERT_TRUE (push_sine (pipeline, 375)); // 4 seconds
+    pipeline.finish ();
+  }
+
+  auto reader = open_reader (path);
+  ASSERT_NE (reader, nullptr);
+  EXPECT_DOUBLE_EQ (reader->sampleRate, 44100.0);
+  EXPECT_EQ (reader->bitsPerSample, 24u);
+  EXPECT_NEAR (static_cast<double> (reader->lengthInSamples), 44100.0 * 4, 2.0);
+
+  // The signal level survives resampling
+  juce::AudioSampleBuffer buf (2, 44100);
+  reader->read (&buf, 0, 44100, 44100, true, true);
+  EXPECT_NEAR (buf.getMagnitude (0, 0, 44100), 0.5f, 0.01f);
+}
+
+TEST_F (ExportPipelineTest, UnsupportedFormatThrowsOnConstruction)
+{
+  EXPECT_ANY_THROW (
+    ExportPipeline (
+      SAMPLE_RATE, 2, { { .path_ = temp_dir_path_ / "out.unsupported" } }));
+}
+
+TEST_F (ExportPipelineTest, CancelStopsPushing)
+{
+  ExportPipeline pipeline (
+    SAMPLE_RATE, 2, { { .path_ = temp_dir_path_ / "cancelled.wav" } });
+  ASSERT_TRUE (push_sine (pipeline, 4));
+  pipeline.cancel ();
+  EXPECT_FALSE (push_sine (pipeline, 1));
+
+  // Cancelling is not an error
+  EXPECT_EQ (pipeline.error (), nullptr);
+}
+
+} // namespace zrythm::dsp
@@ -6,6 +6,7 @@
 #include "dsp/file_audio_source.h"
 #include "dsp/panning.h"
 #include "utils/audio.h"
+#include "utils/decoded_audio_cache.h"
 #include "utils/exceptions.h"
 #include "utils/io_utils.h"
 #include "utils/serialization.h"
@@ -322,4 +323,39 @@ TEST_F (FileAudioSourceTest, InitFromFileEmitsSamplesChanged)
   EXPECT_GT (spy.count (), 0);
 }
 
+// Loading the same file again maps the frames decoded the first time
+TEST_F (FileAudioSourceTest, InitFromFileUsesDecodedAudioCache)
+{
+  auto cache_dir = zrythm::utils::io::make_tmp_dir ();
+  utils::audio::DecodedAudioCache cache (
+    utils::Utf8String::from_qstring (cache_dir->path ()).to_path (),
+    utils::audio::DecodedAudioCache::DEFAULT_MAX_SIZE_BYTES);
+
+  FileAudioSource decoded (nullptr);
+  decoded.init_from_file (
+    test_mono_wav, project_sample_rate, std::nullopt, &cache);
+  EXPECT_GT (cache.size_bytes (), 0u);
+
+  FileAudioSource mapped (nullptr);
+  mapped.init_from_file (
+    test_mono_wav, project_sample_rate, std::nullopt, &cache);
+  ASSERT_EQ (mapped.get_num_channels (), 2);
+  ASSERT_EQ (mapped.get_num_frames (), decoded.get_num_frames ());
+  for (int ch = 0; ch < 2; ++ch)
+    {
+      for (int i = 0; i < mapped.get_num_frames (); ++i)
+        {
+          ASSERT_FLOAT_EQ (
+            mapped.get_samples ().getSample (ch, i),
+            decoded.get_samples ().getSample (ch, i));
+        }
+    }
+
+  // The mapped frames can still be edited and grown
+  utils::audio::AudioBuffer extra (2, 100);
+  extra.clear ();
+  mapped.expand_with_frames (extra);
+  EXPECT_EQ (mapped.get_num_frames (), decoded.get_num_frames () + 100);
+}
+
 } // namespace zrythm::dsp
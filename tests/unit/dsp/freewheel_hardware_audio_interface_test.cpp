@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <numeric>
+#include <thread>
+
+#include "dsp/audio_callback.h"
+#include "dsp/freewheel_hardware_audio_interface.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+namespace zrythm::dsp
+{
+
+class FreewheelHardwareAudioInterfaceTest : public ::testing::Test
+{
+protected:
+  using ClockMode = FreewheelHardwareAudioInterface::ClockMode;
+
+  static FreewheelHardwareAudioInterface::Options
+  make_options (ClockMode mode, int block_length)
+  {
+    FreewheelHardwareAudioInterface::Options options;
+    options.device_info.block_length = units::samples (block_length);
+    options.clock_mode = mode;
+    return options;
+  }
+
+  /**
+   * @brief Creates a callback that sleeps for @p process_time on each block.
+   */
+  std::unique_ptr<AudioCallback>
+  create_callback (std::chrono::microseconds process_time = {})
+  {
+    return std::make_unique<AudioCallback> (
+      [this, process_time] (
+        std::span<const float * const> inputs,
+        std::span<float * const>       outputs,
+        units::sample_u32_t            nframes) {
+        num_inputs_ = inputs.size ();
+        num_outputs_ = outputs.size ();
+        nframes_ = nframes.in (units::samples);
+        if (!inputs.empty ())
+          input_sample_ = inputs[0][0];
+        if (process_time > 0us)
+          std::this_thread::sleep_for (process_time);
+        ++process_count_;
+      },
+      [this] () { ++about_to_start_count_; },
+      [this] () { ++stopped_count_; });
+  }
+
+  static bool wait_for_callbacks (
+    const FreewheelHardwareAudioInterface &iface,
+    size_t                                 count)
+  {
+    const auto deadline = std::chrono::steady_clock::now () + 10s;
+    while (iface.statistics ().callback_count < count)
+      {
+        if (std::chrono::steady_clock::now () > deadline)
+          return false;
+        std::this_thread::sleep_for (1ms);
+      }
+    return true;
+  }
+
+  std::atomic<size_t> process_count_{};
+  std::atomic<size_t> about_to_start_count_{};
+  std::atomic<size_t> stopped_count_{};
+  std::atomic<size_t> num_inputs_{};
+  std::atomic<size_t> num_outputs_{};
+  std::atomic<int>    nframes_{};
+  std::atomic<float>  input_sample_{ 1.f };
+};
+
+TEST_F (FreewheelHardwareAudioInterfaceTest, ReportsConfiguredDeviceInfo)
+{
+  FreewheelHardwareAudioInterface iface (
+    make_options (ClockMode::FreeRun, 128));
+  const auto info = iface.get_device_info ();
+  EXPECT_EQ (info.block_length, units::samples (128));
+  EXPECT_EQ (info.sample_rate, units::sample_rate (48000));
+  EXPECT_EQ (iface.block_period (), 128 * 1'000'000'000ns / 48000);
+}
+
+TEST_F (FreewheelHardwareAudioInterfaceTest, FreeRunDrivesCallback)
+{
+  FreewheelHardwareAudioInterface iface (
+    make_options (ClockMode::FreeRun, 256));
+  auto callback = create_callback ();
+
+  iface.add_audio_callback (callback.get ());
+  EXPECT_EQ (about_to_start_count_, 1);
+  ASSERT_TRUE (wait_for_callbacks (iface, 100));
+
+  iface.remove_audio_callback (callback.get ());
+  EXPECT_EQ (stopped_count_, 1);
+  EXPECT_EQ (num_inputs_, 2);
+  EXPECT_EQ (num_outputs_, 2);
+  EXPECT_EQ (nframes_, 256);
+  EXPECT_FLOAT_EQ (input_sample_, 0.f);
+
+  // No more processing after removal
+  const auto count = process_count_.load ();
+  std::this_thread::sleep_for (20ms);
+  EXPECT_EQ (process_count_, count);
+  EXPECT_EQ (iface.statistics ().callback_count, count);
+}
+
+TEST_F (FreewheelHardwareAudioInterfaceTest, RealtimeClockPacesCallbacks)
+{
+  // 10 ms blocks
+  FreewheelHardwareAudioInterface iface (
+    make_options (ClockMode::Realtime, 480));
+  auto callback = create_callback ();
+
+  iface.add_audio_callback (callback.get ());
+  std::this_thread::sleep_for (200ms);
+  iface.remove_audio_callback (callback.get ());
+
+  // Free-running would have produced thousands of callbacks
+  const auto stats = iface.statistics ();
+  EXPECT_GT (stats.callback_count, 5);
+  EXPECT_LT (stats.callback_count, 40);
+}
+
+TEST_F (FreewheelHardwareAudioInterfaceTest, SlowCallbacksCountAsXruns)
+{
+  for (const auto mode : { ClockMode::FreeRun, ClockMode::Realtime })
+    {
+      // 1 ms blocks processed in 3 ms
+      FreewheelHardwareAudioInterface iface (make_options (mode, 48));
+      auto callback = create_callback (3ms);
+
+      iface.add_audio_callback (callback.get ());
+      ASSERT_TRUE (wait_for_callbacks (iface, 5));
+      iface.remove_audio_callback (callback.get ());
+
+      const auto stats = iface.statistics ();
+      EXPECT_EQ (stats.xrun_count, stats.callback_count);
+      EXPECT_GE (stats.min_duration, 3ms);
+      EXPECT_GT (stats.mean_load (iface.block_period ()), 2.0);
+
+      // Loads above the histogram range go to the last bin
+      EXPECT_EQ (stats.histogram.back (), stats.callback_count);
+    }
+}
+
+TEST_F (FreewheelHardwareAudioInterfaceTest, FastCallbacksFillLowBins)
+{
+  // 10 ms blocks processed in 1 ms
+  FreewheelHardwareAudioInterface iface (
+    make_options (ClockMode::Realtime, 480));
+  auto callback = create_callback (1ms);
+
+  iface.add_audio_callback (callback.get ());
+  ASSERT_TRUE (wait_for_callbacks (iface, 10));
+  iface.remove_audio_callback (callback.get ());
+
+  const auto stats = iface.statistics ();
+  EXPECT_EQ (
+    std::accumulate (stats.histogram.begin (), stats.histogram.end (), 0uz),
+    stats.callback_count);
+  EXPECT_LE (stats.min_duration, stats.max_duration);
+  EXPECT_GE (stats.total_duration, stats.max_duration);
+
+  // Sleeps can overrun by a lot on loaded machines, so only the fastest
+  // callback is expected to stay below a full block period
+  constexpr auto full_load_bin = static_cast<size_t> (
+    FreewheelHardwareAudioInterface::kHistogramBins
+    / FreewheelHardwareAudioInterface::kHistogramMaxLoad);
+  EXPECT_LT (stats.min_duration, iface.block_period ());
+  EXPECT_GT (
+    std::accumulate (
+      stats.histogram.begin (), stats.histogram.begin () + full_load_bin, 0uz),
+    0);
+}
+
+TEST_F (FreewheelHardwareAudioInterfaceTest, ResetStatistics)
+{
+  FreewheelHardwareAudioInterface iface (
+    make_options (ClockMode::FreeRun, 256));
+  auto callback = create_callback ();
+
+  iface.add_audio_callback (callback.get ());
+  ASSERT_TRUE (wait_for_callbacks (iface, 10));
+  iface.remove_audio_callback (callback.get ());
+
+  iface.reset_statistics ();
+  const auto stats = iface.statistics ();
+  EXPECT_EQ (stats.callback_count, 0);
+  EXPECT_EQ (stats.xrun_count, 0);
+  EXPECT_EQ (stats.total_duration, 0ns);
+  EXPECT_THAT (stats.histogram, Each (0));
+}
+
+TEST_F (FreewheelHardwareAudioInterfaceTest, DestructorStopsCallbacks)
+{
+  auto callback = create_callback ();
+  {
+    FreewheelHardwareAudioInterface iface (
+      make_options (ClockMode::FreeRun, 256));
+    iface.add_audio_callback (callback.get ());
+    ASSERT_TRUE (wait_for_callbacks (iface, 1));
+  }
+  EXPECT_EQ (stopped_count_, 1);
+}
+
+} // namespace zrythm::dsp
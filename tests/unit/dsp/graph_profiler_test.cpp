@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <thread>
+
+#include "dsp/graph_profiler.h"
+#include "utils/utf8_string.h"
+
+#include "./graph_helpers.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+namespace zrythm::dsp::graph
+{
+class GraphProfilerTest : public ::testing::Test
+{
+protected:
+  using MockProcessable = NiceMock<zrythm::dsp::graph_test::MockProcessable>;
+
+  void SetUp () override
+  {
+    // Diamond: a -> (b, c) -> d
+    for (const auto * name : { "a", "b", "c", "d" })
+      {
+        auto processable = std::make_unique<MockProcessable> ();
+        ON_CALL (*processable, get_node_name ())
+          .WillByDefault (
+            Return (utils::Utf8String::from_utf8_encoded_string (name)));
+        collection_.graph_nodes_.push_back (
+          std::make_unique<GraphNode> (
+            static_cast<GraphNode::NodeId> (processables_.size ()),
+            *processable));
+        processables_.push_back (std::move (processable));
+      }
+    node (0).connect_to (node (1));
+    node (0).connect_to (node (2));
+    node (1).connect_to (node (3));
+    node (2).connect_to (node (3));
+    collection_.finalize_nodes ();
+
+    profiler_.set_num_threads (2);
+    profiler_.set_nodes (collection_);
+  }
+
+  GraphNode &node (size_t index) { return *collection_.graph_nodes_[index]; }
+
+  std::vector<std::unique_ptr<MockProcessable>> processables_;
+  GraphNodeCollection                           collection_;
+  GraphProfiler                                 profiler_;
+};
+
+TEST_F (GraphProfilerTest, DisabledByDefault)
+{
+  EXPECT_FALSE (profiler_.enabled ());
+  profiler_.set_enabled (true);
+  EXPECT_TRUE (profiler_.enabled ());
+}
+
+TEST_F (GraphProfilerTest, EmptySnapshot)
+{
+  const auto stats = profiler_.snapshot ();
+  ASSERT_EQ (stats.size (), 4);
+  EXPECT_EQ (stats[0].name, u8"a");
+  EXPECT_EQ (stats[0].num_runs, 0);
+  EXPECT_DOUBLE_EQ (stats[0].mean_us, 0.0);
+
+  // No critical path without timings
+  EXPECT_THAT (
+    stats, Each (Field (&GraphProfiler::NodeStats::on_critical_path, false)));
+}
+
+TEST_F (GraphProfilerTest, ComputesTimings)
+{
+  for (int i = 1; i <= 100; ++i)
+    {
+      profiler_.record (0, node (1), std::chrono::microseconds (i));
+    }
+  const auto stats = profiler_.snapshot ();
+  EXPECT_EQ (stats[1].num_runs, 100);
+  EXPECT_DOUBLE_EQ (stats[1].mean_us, 50.5);
+  EXPECT_DOUBLE_EQ (stats[1].p99_us, 100.0);
+  EXPECT_DOUBLE_EQ (stats[1].max_us, 100.0);
+}
+
+TEST_F (GraphProfilerTest, KeepsRecentTimingsOnly)
+{
+  for (size_t i = 0; i < GraphProfiler::kWindowSize; ++i)
+    {
+      profiler_.record (0, node (0), 1000us);
+    }
+  profiler_.drain ();
+  for (size_t i = 0; i < GraphProfiler::kWindowSize; ++i)
+    {
+      profiler_.record (0, node (0), 10us);
+    }
+  const auto stats = profiler_.snapshot ();
+  EXPECT_EQ (stats[0].num_runs, GraphProfiler::kWindowSize);
+  EXPECT_DOUBLE_EQ (stats[0].max_us, 10.0);
+}
+
+TEST_F (GraphProfilerTest, TracksThreadAffinity)
+{
+  // Main graph thread
+  profiler_.record (-1, node (0), 10us);
+  for (int i = 0; i < 3; ++i)
+    {
+      profiler_.record (1, node (0), 10us);
+    }
+  const auto stats = profiler_.snapshot ();
+  EXPECT_EQ (stats[0].thread_id, 1);
+  EXPECT_DOUBLE_EQ (stats[0].thread_share, 0.75);
+
+  // Threads outside the profiler are ignored
+  profiler_.record (5, node (0), 10us);
+  EXPECT_EQ (profiler_.snapshot ()[0].num_runs, 4);
+}
+
+TEST_F (GraphProfilerTest, FindsCriticalPath)
+{
+  profiler_.record (0, node (0), 10us);
+  profiler_.record (0, node (1), 20us);
+  profiler_.record (1, node (2), 100us);
+  profiler_.record (0, node (3), 5us);
+  const auto stats = profiler_.snapshot ();
+  EXPECT_TRUE (stats[0].on_critical_path);
+  EXPECT_FALSE (stats[1].on_critical_path);
+  EXPECT_TRUE (stats[2].on_critical_path);
+  EXPECT_TRUE (stats[3].on_critical_path);
+}
+
+TEST_F (GraphProfilerTest, CountsDroppedTimings)
+{
+  for (size_t i = 0; i < GraphProfiler::kThreadRingSize + 10; ++i)
+    {
+      profiler_.record (0, node (0), 1us);
+    }
+  EXPECT_GT (profiler_.dropped_count (), 0);
+
+  profiler_.reset ();
+  EXPECT_EQ (profiler_.dropped_count (), 0);
+  EXPECT_EQ (profiler_.snapshot ()[0].num_runs, 0);
+}
+
+TEST_F (GraphProfilerTest, ResetWhileRecording)
+{
+  std::atomic<bool> stop{ false };
+  std::thread       graph_thread ([&] () {
+    while (!stop.load ())
+      {
+        profiler_.record (0, node (0), 10us);
+      }
+  });
+  for (int i = 0; i < 1000; ++i)
+    {
+      profiler_.reset ();
+    }
+  stop.store (true);
+  graph_thread.join ();
+
+  // Timings recorded after the last reset are still collected
+  profiler_.reset ();
+  profiler_.record (0, node (0), 10us);
+  EXPECT_EQ (profiler_.snapshot ()[0].num_runs, 1);
+}
+
+TEST_F (GraphProfilerTest, NewNodesDropPendingTimings)
+{
+  profiler_.record (0, node (0), 10us);
+  profiler_.set_nodes (collection_);
+  EXPECT_EQ (profiler_.snapshot ()[0].num_runs, 0);
+
+  profiler_.set_nodes (GraphNodeCollection{});
+  EXPECT_THAT (profiler_.snapshot (), IsEmpty ());
+}
+
+TEST_F (GraphProfilerTest, SerializesToJson)
+{
+  profiler_.record (0, node (2), 10us);
+  const auto     stats = profiler_.snapshot ();
+  nlohmann::json j = stats[2];
+  EXPECT_EQ (j["name"], "c");
+  EXPECT_EQ (j["nodeId"], 2);
+  EXPECT_EQ (j["numRuns"], 1);
+  EXPECT_DOUBLE_EQ (j["meanUs"].get<double> (), 10.0);
+  EXPECT_EQ (j["threadId"], 0);
+  EXPECT_TRUE (j["onCriticalPath"].get<bool> ());
+}
+
+} // namespace zrythm::dsp::graph
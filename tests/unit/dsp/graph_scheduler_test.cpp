@@ -4,6 +4,7 @@
 #include <atomic>
 #include <chrono>
 #include <mutex>
+#include <ranges>
 #include <thread>
 
 #include "dsp/graph_scheduler.h"
@@ -120,6 +121,48 @@ TEST_F (GraphSchedulerTest, MultiThreadedProcessing)
   scheduler_->terminate_threads ();
 }
 
+TEST_F (GraphSchedulerTest, ProfilerRecordsNodeTimings)
+{
+  auto collection = create_test_collection ();
+  ON_CALL (*processable_, process_block (_, _, _))
+    .WillByDefault ([&] (auto, auto &, auto &) {
+      std::this_thread::sleep_for (1ms);
+    });
+
+  scheduler_->rechain_from_node_collection (
+    std::move (collection), sample_rate_, block_length_);
+  scheduler_->start_threads (2);
+
+  auto time_info = dsp::graph::ProcessBlockInfo::from_position_and_nframes (
+    units::samples (0), units::samples (256u));
+
+  // Nothing is recorded while disabled
+  scheduler_->run_cycle (
+    time_info, units::samples (0), *transport_, *tempo_map_);
+  EXPECT_THAT (
+    scheduler_->profiler ().snapshot (),
+    Each (Field (&GraphProfiler::NodeStats::num_runs, 0)));
+
+  scheduler_->profiler ().set_enabled (true);
+  scheduler_->run_cycle (
+    time_info, units::samples (0), *transport_, *tempo_map_);
+  scheduler_->run_cycle (
+    time_info, units::samples (0), *transport_, *tempo_map_);
+  scheduler_->terminate_threads ();
+
+  const auto stats = scheduler_->profiler ().snapshot ();
+  ASSERT_EQ (stats.size (), 3);
+  for (const auto &node_stats : stats)
+    {
+      EXPECT_EQ (node_stats.name, u8"test_node");
+      EXPECT_EQ (node_stats.num_runs, 2);
+      EXPECT_GE (node_stats.mean_us, 1000.0);
+
+      // The nodes form a chain
+      EXPECT_TRUE (node_stats.on_critical_path);
+    }
+}
+
 TEST_F (GraphSchedulerTest, NodeTriggeringOrder)
 {
   auto collection = create_test_collection ();
@@ -145,6 +188,170 @@ TEST_F (GraphSchedulerTest, NodeTriggeringOrder)
   scheduler_->terminate_threads ();
 }
 
+// root -> leaf, root -> chain1 -> chain2 -> chain3
+class GraphSchedulerCriticalPathTest : public GraphSchedulerTest
+{
+protected:
+  using SchedulingMode = GraphScheduler::SchedulingMode;
+
+  void SetUp () override
+  {
+    GraphSchedulerTest::SetUp ();
+
+    GraphNodeCollection collection;
+    for (const auto i : std::views::iota (0, 5))
+      {
+        auto processable = std::make_unique<NiceMock<MockProcessable>> ();
+        ON_CALL (*processable, get_single_playback_latency ())
+          .WillByDefault (Return (units::samples (0)));
+        collection.graph_nodes_.push_back (
+          std::make_unique<GraphNode> (i, *processable));
+        processables_.push_back (std::move (processable));
+      }
+    auto &nodes = collection.graph_nodes_;
+    nodes[0]->connect_to (*nodes[1]);
+    nodes[0]->connect_to (*nodes[2]);
+    nodes[2]->connect_to (*nodes[3]);
+    nodes[3]->connect_to (*nodes[4]);
+    collection.finalize_nodes ();
+
+    scheduler_->rechain_from_node_collection (
+      std::move (collection), sample_rate_, block_length_);
+  }
+
+  void TearDown () override
+  {
+    scheduler_.reset ();
+    processables_.clear ();
+  }
+
+  void run_cycles (int count)
+  {
+    const auto time_info =
+      dsp::graph::ProcessBlockInfo::from_position_and_nframes (
+        units::samples (0), block_length_);
+    for (int i = 0; i < count; ++i)
+      {
+        scheduler_->run_cycle (
+          time_info, units::samples (0), *transport_, *tempo_map_);
+      }
+  }
+
+  const GraphNode &node (size_t index)
+  {
+    return *scheduler_->get_nodes ().graph_nodes_[index];
+  }
+
+  std::vector<std::unique_ptr<NiceMock<MockProcessable>>> processables_;
+};
+
+TEST_F (GraphSchedulerCriticalPathTest, FifoModeUsesSinglePriority)
+{
+  scheduler_->start_threads (2);
+  run_cycles (1);
+  scheduler_->terminate_threads ();
+
+  for (const auto &graph_node : scheduler_->get_nodes ().graph_nodes_)
+    {
+      EXPECT_EQ (graph_node->schedule_priority_, 0);
+    }
+}
+
+TEST_F (GraphSchedulerCriticalPathTest, PrioritizesLongerBranches)
+{
+  scheduler_->set_scheduling_mode (SchedulingMode::CriticalPath);
+  scheduler_->start_threads (2);
+  run_cycles (1);
+  scheduler_->terminate_threads ();
+
+  // Priorities are based on the topology before any timings are measured
+  EXPECT_EQ (
+    node (0).schedule_priority_, GraphScheduler::kNumPriorityLevels - 1);
+  EXPECT_GT (node (2).schedule_priority_, node (1).schedule_priority_);
+  EXPECT_GT (node (3).schedule_priority_, node (4).schedule_priority_);
+}
+
+TEST_F (GraphSchedulerCriticalPathTest, PrioritizesExpensiveNodes)
+{
+  ON_CALL (*processables_[1], process_block (_, _, _))
+    .WillByDefault ([] (auto, auto &, auto &) {
+      std::this_thread::sleep_for (2ms);
+    });
+
+  scheduler_->set_scheduling_mode (SchedulingMode::CriticalPath);
+  scheduler_->start_threads (2);
+  run_cycles (GraphScheduler::kPriorityUpdateInterval * 4 + 1);
+  scheduler_->terminate_threads ();
+
+  EXPECT_GT (node (1).avg_process_time_us_, node (2).avg_process_time_us_);
+  EXPECT_GT (node (1).schedule_priority_, node (2).schedule_priority_);
+}
+
+TEST_F (GraphSchedulerCriticalPathTest, SwitchingBackToFifoResetsPriorities)
+{
+  scheduler_->set_scheduling_mode (SchedulingMode::CriticalPath);
+  scheduler_->start_threads (2);
+  run_cycles (1);
+  EXPECT_GT (node (0).schedule_priority_, 0);
+
+  scheduler_->set_scheduling_mode (SchedulingMode::Fifo);
+  run_cycles (1);
+  scheduler_->terminate_threads ();
+  EXPECT_EQ (node (0).schedule_priority_, 0);
+}
+
+TEST_F (GraphSchedulerCriticalPathTest, GraphWidth)
+{
+  EXPECT_EQ (scheduler_->graph_width (), 2);
+}
+
+TEST_F (GraphSchedulerCriticalPathTest, AdaptiveThreadCountParksExcessThreads)
+{
+  std::atomic<int> process_count{ 0 };
+  for (auto &processable : processables_)
+    {
+      ON_CALL (*processable, process_block (_, _, _))
+        .WillByDefault ([&] (auto, auto &, auto &) { process_count++; });
+    }
+
+  scheduler_->start_threads (4);
+  EXPECT_EQ (scheduler_->active_thread_count (), 5);
+
+  // The nodes are too cheap to be worth more than one thread
+  scheduler_->set_adaptive_thread_count (true);
+  constexpr int num_cycles = GraphScheduler::kThreadCountUpdateInterval * 6;
+  run_cycles (num_cycles);
+  EXPECT_EQ (scheduler_->active_thread_count (), 1);
+  EXPECT_EQ (process_count, num_cycles * 5);
+
+  scheduler_->set_adaptive_thread_count (false);
+  run_cycles (1);
+  EXPECT_EQ (scheduler_->active_thread_count (), 5);
+  EXPECT_EQ (process_count, (num_cycles + 1) * 5);
+
+  scheduler_->terminate_threads ();
+  EXPECT_EQ (scheduler_->active_thread_count (), 1);
+}
+
+TEST_F (GraphSchedulerCriticalPathTest, AdaptiveThreadCountIsLimitedByWidth)
+{
+  for (auto &processable : processables_)
+    {
+      ON_CALL (*processable, process_block (_, _, _))
+        .WillByDefault ([] (auto, auto &, auto &) {
+          std::this_thread::sleep_for (200us);
+        });
+    }
+
+  scheduler_->set_adaptive_thread_count (true);
+  scheduler_->start_threads (4);
+  run_cycles (GraphScheduler::kThreadCountUpdateInterval * 6);
+
+  // Plenty of work, but at most 2 nodes can run in parallel
+  EXPECT_EQ (scheduler_->active_thread_count (), 2);
+  scheduler_->terminate_threads ();
+}
+
 TEST_F (GraphSchedulerTest, ResourceManagement)
 {
   auto collection = create_test_collection ();
@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <thread>
+
+#include "dsp/lookahead_processor.h"
+#include "dsp/lookahead_renderer.h"
+#include "utils/object_registry.h"
+
+#include "unit/dsp/graph_helpers.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+namespace zrythm::dsp
+{
+
+class LookaheadRendererTest : public ::testing::Test
+{
+protected:
+  static constexpr auto SAMPLE_RATE = units::sample_rate (48000);
+  static constexpr auto BLOCK_LENGTH = units::samples (64u);
+
+  void SetUp () override
+  {
+    registry_ = std::make_unique<utils::ObjectRegistry> ();
+    processor_ = std::make_unique<LookaheadProcessor> (*registry_);
+    processor_->prepare_for_processing (nullptr, SAMPLE_RATE, BLOCK_LENGTH);
+    tempo_map_ = std::make_unique<dsp::TempoMap> (SAMPLE_RATE);
+
+    // Source of the "chain" rendered ahead of time: outputs a signal depending
+    // on the timeline position
+    source_port_ = std::make_unique<AudioPort> (
+      u8"Source Out", PortFlow::Output, AudioPort::BusLayout::Stereo, 2);
+    ON_CALL (source_, get_node_name ()).WillByDefault (Return (u8"source"));
+    ON_CALL (source_, get_single_playback_latency ())
+      .WillByDefault (Return (units::samples (0)));
+    ON_CALL (source_, process_block (_, _, _))
+      .WillByDefault ([this] (auto time_nfo, const auto &, const auto &) {
+        auto      &buf = *source_port_->buffers ();
+        const auto offset =
+          time_nfo.buffer_offset_.template in<int> (units::samples);
+        const auto pos =
+          time_nfo.transport_position_.template in<int64_t> (units::samples);
+        const auto nframes =
+          time_nfo.nframes_.template in<int> (units::samples);
+        for (int i = 0; i < nframes; ++i)
+          {
+            for (int ch = 0; ch < buf.getNumChannels (); ++ch)
+              {
+                buf.setSample (ch, offset + i, expected_sample (pos + i));
+              }
+          }
+      });
+
+    ON_CALL (transport_, get_play_state ())
+      .WillByDefault (Return (ITransport::PlayState::Rolling));
+    ON_CALL (transport_, loop_enabled ()).WillByDefault (Return (false));
+    ON_CALL (transport_, get_loop_range_positions ())
+      .WillByDefault (
+        Return (std::make_pair (units::samples (0), units::samples (0))));
+  }
+
+  void TearDown () override
+  {
+    renderer_.clear_graph ();
+    processor_->release_resources ();
+  }
+
+  static float expected_sample (int64_t position)
+  {
+    return static_cast<float> (position % 1000) / 1000.f;
+  }
+
+  void set_graph ()
+  {
+    graph::GraphNodeCollection collection;
+    auto source_node = std::make_unique<graph::GraphNode> (1, source_);
+    auto source_port_node =
+      std::make_unique<graph::GraphNode> (2, *source_port_);
+    auto capture_node =
+      std::make_unique<graph::GraphNode> (3, processor_->get_capture_port ());
+    source_node->connect_to (*source_port_node);
+    source_port_node->connect_to (*capture_node);
+    collection.graph_nodes_.push_back (std::move (source_node));
+    collection.graph_nodes_.push_back (std::move (source_port_node));
+    collection.graph_nodes_.push_back (std::move (capture_node));
+    collection.finalize_nodes ();
+
+    renderer_.set_graph (
+      std::move (collection), { processor_.get () }, SAMPLE_RATE);
+  }
+
+  /**
+   * @brief Processes a block at @p position and returns whether the output
+   * was not silent.
+   */
+  bool process_block_at (units::sample_u64_t position)
+  {
+    processor_->process_block (
+      graph::ProcessBlockInfo::from_position_and_nframes (
+        position, BLOCK_LENGTH),
+      transport_, *tempo_map_);
+    return processor_->get_stereo_out_port ().buffers ()->getMagnitude (
+             0, 0, BLOCK_LENGTH.in<int> (units::samples))
+           > 0.f;
+  }
+
+  std::unique_ptr<utils::ObjectRegistry> registry_;
+  std::unique_ptr<LookaheadProcessor>    processor_;
+  std::unique_ptr<dsp::TempoMap>         tempo_map_;
+  std::unique_ptr<AudioPort>             source_port_;
+  NiceMock<graph_test::MockProcessable>  source_;
+  NiceMock<graph_test::MockTransport>    transport_;
+  LookaheadRenderer renderer_{ [] (std::function<void ()> func) { func (); } };
+};
+
+TEST_F (LookaheadRendererTest, OutputsSilenceWhenNotRendering)
+{
+  EXPECT_FALSE (process_block_at (units::samples (640u)));
+
+  set_graph ();
+  EXPECT_TRUE (renderer_.has_graph ());
+  EXPECT_FALSE (renderer_.running ());
+  EXPECT_FALSE (process_block_at (units::samples (640u)));
+  EXPECT_EQ (renderer_.generation (), 0u);
+}
+
+TEST_F (LookaheadRendererTest, PlaysRenderedFramesWhileRolling)
+{
+  set_graph ();
+  renderer_.start ();
+  ASSERT_TRUE (renderer_.running ());
+
+  // Follow the playhead until the rendered frames catch up with it
+  auto position = units::samples (640u);
+  bool caught_up = false;
+  for (int i = 0; i < 5000 && !caught_up; ++i)
+    {
+      caught_up = process_block_at (position);
+      if (!caught_up)
+        {
+          position += BLOCK_LENGTH;
+          std::this_thread::sleep_for (1ms);
+        }
+    }
+  ASSERT_TRUE (caught_up);
+
+  // The output must now follow the playhead exactly
+  for (int block = 0; block < 4; ++block)
+    {
+      if (block > 0)
+        {
+          position += BLOCK_LENGTH;
+          // Leave time for the renderer in case it fell behind
+          std::this_thread::sleep_for (5ms);
+          process_block_at (position);
+        }
+      const auto &out = *processor_->get_stereo_out_port ().buffers ();
+      for (int ch = 0; ch < out.getNumChannels (); ++ch)
+        {
+          for (int i = 0; i < BLOCK_LENGTH.in<int> (units::samples); ++i)
+            {
+              EXPECT_FLOAT_EQ (
+                out.getSample (ch, i),
+                expected_sample (position.in<int64_t> (units::samples) + i));
+            }
+        }
+    }
+
+  // No output after stopping
+  renderer_.stop ();
+  EXPECT_FALSE (renderer_.running ());
+  EXPECT_FALSE (process_block_at (position + BLOCK_LENGTH));
+}
+
+TEST_F (LookaheadRendererTest, CoalescesRestartRequestsOfTheSameGeneration)
+{
+  set_graph ();
+  renderer_.start ();
+
+  // e.g. several processors noticing a seek in the same cycle
+  renderer_.request_restart (0, units::samples (64), transport_, *tempo_map_);
+  renderer_.request_restart (0, units::samples (64), transport_, *tempo_map_);
+  EXPECT_EQ (renderer_.generation (), 1u);
+
+  renderer_.request_restart (1, units::samples (128), transport_, *tempo_map_);
+  renderer_.request_restart (1, units::samples (128), transport_, *tempo_map_);
+  EXPECT_EQ (renderer_.generation (), 2u);
+}
+
+TEST_F (LookaheadRendererTest, ContainsOnlyLookaheadGraphProcessables)
+{
+  EXPECT_FALSE (renderer_.contains (source_));
+  set_graph ();
+  EXPECT_TRUE (renderer_.contains (source_));
+  EXPECT_TRUE (renderer_.contains (processor_->get_capture_port ()));
+  EXPECT_FALSE (renderer_.contains (*processor_));
+  renderer_.clear_graph ();
+  EXPECT_FALSE (renderer_.contains (source_));
+}
+
+} // namespace zrythm::dsp
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include "dsp/loudness_analysis_service.h"
+#include "dsp/loudness_analyzer.h"
+
+#include <gtest/gtest.h>
+
+namespace zrythm::dsp
+{
+
+class LoudnessAnalyzerTest : public ::testing::Test
+{
+protected:
+  static constexpr auto SAMPLE_RATE = units::sample_rate (48000);
+
+  static juce::AudioSampleBuffer
+  make_sine (int num_channels, double seconds, float amplitude, double freq)
+  {
+    const auto sr = SAMPLE_RATE.in<double> (units::sample_rate);
+    const auto num_frames = static_cast<int> (sr * seconds);
+    juce::AudioSampleBuffer buf (num_channels, num_frames);
+    for (int ch = 0; ch < num_channels; ++ch)
+      {
+        auto * samples = buf.getWritePointer (ch);
+        for (int i = 0; i < num_frames; ++i)
+          {
+            samples[i] =
+              amplitude
+              * static_cast<float> (std::sin (
+                2.0 * std::numbers::pi * freq * static_cast<double> (i) / sr));
+          }
+      }
+    return buf;
+  }
+
+  static LoudnessMeasurement measure (const juce::AudioSampleBuffer &buf)
+  {
+    LoudnessAnalyzer analyzer (SAMPLE_RATE, buf.getNumChannels ());
+    analyzer.process (buf, 0, buf.getNumSamples ());
+    return analyzer.finish ();
+  }
+};
+
+TEST_F (LoudnessAnalyzerTest, StereoSineAtMinus20dBFS)
+{
+  // EBU Tech 3341 reference: a 1 kHz stereo sine at -20 dBFS reads -20 LUFS
+  const auto buf = make_sine (2, 5.0, 0.1f, 1000.0);
+  const auto m = measure (buf);
+
+  EXPECT_NEAR (m.integrated_lufs, -20.0, 0.2);
+  EXPECT_NEAR (m.max_momentary_lufs, -20.0, 0.2);
+  EXPECT_NEAR (m.max_short_term_lufs, -20.0, 0.2);
+  EXPECT_NEAR (m.loudness_range_lu, 0.0, 0.1);
+  EXPECT_NEAR (m.sample_peak, 0.1f, 1e-3f);
+  EXPECT_NEAR (m.true_peak, 0.1f, 5e-3f);
+  EXPECT_GE (m.true_peak, m.sample_peak);
+}
+
+TEST_F (LoudnessAnalyzerTest, MonoFullScaleSine)
+{
+  const auto buf = make_sine (1, 5.0, 1.f, 1000.0);
+  const auto m = measure (buf);
+
+  EXPECT_NEAR (m.integrated_lufs, -3.01, 0.2);
+  EXPECT_NEAR (m.true_peak_dbtp (), 0.0, 0.1);
+}
+
+TEST_F (LoudnessAnalyzerTest, SilenceIsNegativeInfinity)
+{
+  juce::AudioSampleBuffer buf (2, 48000 * 2);
+  buf.clear ();
+  const auto m = measure (buf);
+
+  EXPECT_EQ (m.integrated_lufs, LoudnessMeasurement::kSilence);
+  EXPECT_EQ (m.max_momentary_lufs, LoudnessMeasurement::kSilence);
+  EXPECT_FLOAT_EQ (m.sample_peak, 0.f);
+  EXPECT_FLOAT_EQ (m.true_peak, 0.f);
+}
+
+TEST_F (LoudnessAnalyzerTest, IncrementalProcessingMatchesSinglePass)
+{
+  const auto buf = make_sine (2, 3.0, 0.5f, 440.0);
+  const auto expected = measure (buf);
+
+  // Odd-sized slices that don't line up with 100 ms blocks
+  LoudnessAnalyzer analyzer (SAMPLE_RATE, 2);
+  for (int start = 0; start < buf.getNumSamples (); start += 1013)
+    {
+      analyzer.process (
+        buf, start, std::min (1013, buf.getNumSamples () - start));
+    }
+  const auto actual = analyzer.finish ();
+
+  EXPECT_DOUBLE_EQ (actual.integrated_lufs, expected.integrated_lufs);
+  EXPECT_FLOAT_EQ (actual.sample_peak, expected.sample_peak);
+}
+
+TEST_F (LoudnessAnalyzerTest, ChunkedAnalysisMatchesSinglePass)
+{
+  // Long enough to be split into several chunks, with varying loudness so
+  // that gating and loudness range are exercised
+  auto buf = make_sine (2, 45.0, 0.3f, 997.0);
+  std::mt19937                          rng (7);
+  std::uniform_real_distribution<float> noise (-0.2f, 0.2f);
+  for (int ch = 0; ch < buf.getNumChannels (); ++ch)
+    {
+      auto * samples = buf.getWritePointer (ch);
+      for (int i = 0; i < buf.getNumSamples (); ++i)
+        {
+          const float envelope = (i / 48000) % 7 == 0 ? 0.05f : 1.f;
+          samples[i] = (samples[i] + noise (rng)) * envelope;
+        }
+    }
+
+  const auto expected = measure (buf);
+  const auto actual =
+    LoudnessAnalysisService::analyze_blocking (buf, SAMPLE_RATE);
+
+  EXPECT_NEAR (actual.integrated_lufs, expected.integrated_lufs, 0.01);
+  EXPECT_NEAR (actual.loudness_range_lu, expected.loudness_range_lu, 0.01);
+  EXPECT_NEAR (actual.max_short_term_lufs, expected.max_short_term_lufs, 0.01);
+  EXPECT_FLOAT_EQ (actual.sample_peak, expected.sample_peak);
+  EXPECT_NEAR (actual.true_peak, expected.true_peak, 1e-4f);
+}
+
+TEST_F (LoudnessAnalyzerTest, ContentHashDependsOnSamplesAndRate)
+{
+  const auto a = make_sine (2, 1.0, 0.1f, 1000.0);
+  auto       b = a;
+  b.setSample (1, 100, 0.f);
+
+  const auto hash_a = LoudnessAnalysisService::content_hash (a, SAMPLE_RATE);
+  EXPECT_EQ (hash_a, LoudnessAnalysisService::content_hash (a, SAMPLE_RATE));
+  EXPECT_NE (hash_a, LoudnessAnalysisService::content_hash (b, SAMPLE_RATE));
+  EXPECT_NE (
+    hash_a,
+    LoudnessAnalysisService::content_hash (a, units::sample_rate (44100)));
+}
+
+} // namespace zrythm::dsp
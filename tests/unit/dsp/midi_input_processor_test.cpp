@@ -168,6 +168,31 @@ TEST_F (MidiInputProcessorTest, ProcessBlockOutputIsClearedEachCycle)
   EXPECT_EQ (port.buffer_.size (), 1);
 }
 
+TEST_F (MidiInputProcessorTest, ReceivedEventsAccumulateUntilCleared)
+{
+  create_processor ();
+
+  auto time_nfo = dsp::graph::ProcessBlockInfo::from_position_and_nframes (
+    units::samples (0), max_block_length_);
+
+  auto msg1 = juce::MidiMessage::controllerEvent (1, 7, 10);
+  msg1.setTimeStamp (1.0);
+  push_event (msg1);
+  processor_->process_block (time_nfo, *mock_transport_, *tempo_map_);
+
+  auto msg2 = juce::MidiMessage::controllerEvent (1, 7, 20);
+  msg2.setTimeStamp (2.0);
+  push_event (msg2);
+  processor_->process_block (time_nfo, *mock_transport_, *tempo_map_);
+
+  // Unlike the output port, events of all blocks are kept
+  ASSERT_EQ (processor_->received_events ().size (), 2);
+  EXPECT_EQ (processor_->received_events ().front ().data ()[2], 10);
+
+  processor_->clear_received_events ();
+  EXPECT_TRUE (processor_->received_events ().empty ());
+}
+
 // ========================================================================
 // get_output_port
 // ========================================================================
@@ -383,6 +383,79 @@ TEST_F (PortObservationManagerTest, MultipleTokensForSamePortGetIndependentCache
   EXPECT_FALSE (token2.cache ().audio[0].empty ());
 }
 
+// Requesters reading at different rates see the same data in order, even
+// though drained chunks are shared between their caches.
+TEST_F (PortObservationManagerTest, SharedChunksReachRequestersReadingLater)
+{
+  auto port_ref = utils::create_object<AudioPort> (
+    registry_, u8"Test", PortFlow::Output, AudioPort::BusLayout::Mono, 1);
+  auto * port = port_ref.get_object_as<AudioPort> ();
+  port->prepare_for_processing (nullptr, sample_rate_, block_length_);
+
+  ObservationToken token1 (manager_, *port);
+  ObservationToken token2 (manager_, *port);
+
+  auto * observer = manager_.get_observer (*port);
+  ASSERT_NE (observer, nullptr);
+  observer->prepare_for_processing (nullptr, sample_rate_, block_length_);
+
+  const auto time_nfo = default_time_nfo ();
+  const auto block_size = time_nfo.nframes_.in<size_t> (units::samples);
+
+  port->buffers ()->clear ();
+  port->buffers ()->getWritePointer (0)[0] = 0.1f;
+  observer->process_block (time_nfo, mock_transport_, tempo_map_);
+  manager_.drain_all ();
+
+  // Only token1 reads in between
+  ASSERT_EQ (token1.cache ().audio[0].size (), block_size);
+  token1.cache ().clear ();
+
+  port->buffers ()->getWritePointer (0)[0] = 0.2f;
+  observer->process_block (time_nfo, mock_transport_, tempo_map_);
+  manager_.drain_all ();
+
+  const auto &audio1 = token1.cache ().audio[0];
+  ASSERT_EQ (audio1.size (), block_size);
+  EXPECT_FLOAT_EQ (audio1.front (), 0.2f);
+
+  const auto &audio2 = token2.cache ().audio[0];
+  ASSERT_EQ (audio2.size (), 2 * block_size);
+  EXPECT_FLOAT_EQ (audio2.front (), 0.1f);
+  EXPECT_FLOAT_EQ (audio2[block_size], 0.2f);
+}
+
+// Drains beyond the pending chunk limit don't lose data of unread caches.
+TEST_F (PortObservationManagerTest, UnreadCacheKeepsDataBeyondPendingLimit)
+{
+  auto port_ref = utils::create_object<AudioPort> (
+    registry_, u8"Test", PortFlow::Output, AudioPort::BusLayout::Mono, 1);
+  auto * port = port_ref.get_object_as<AudioPort> ();
+  port->prepare_for_processing (nullptr, sample_rate_, block_length_);
+
+  ObservationToken token (manager_, *port);
+  auto *           observer = manager_.get_observer (*port);
+  ASSERT_NE (observer, nullptr);
+  observer->prepare_for_processing (nullptr, sample_rate_, block_length_);
+
+  const auto   time_nfo = default_time_nfo ();
+  const auto   block_size = time_nfo.nframes_.in<size_t> (units::samples);
+  const size_t num_drains = PortObservationCache::kMaxPendingChunks + 2;
+  port->buffers ()->clear ();
+  for (size_t i = 0; i < num_drains; ++i)
+    {
+      port->buffers ()->getWritePointer (0)[0] = static_cast<float> (i);
+      observer->process_block (time_nfo, mock_transport_, tempo_map_);
+      manager_.drain_all ();
+    }
+
+  const auto &audio = token.cache ().audio[0];
+  ASSERT_EQ (audio.size (), num_drains * block_size);
+  EXPECT_FLOAT_EQ (audio.front (), 0.f);
+  EXPECT_FLOAT_EQ (
+    audio[(num_drains - 1) * block_size], static_cast<float> (num_drains - 1));
+}
+
 TEST_F (PortObservationManagerTest, TokenMoveTransfersOwnership)
 {
   auto port_ref = utils::create_object<AudioPort> (
@@ -482,4 +555,71 @@ TEST_F (PortObservationManagerTest, MultiCycleDrainAccumulatesData)
   EXPECT_FLOAT_EQ (token.cache ().audio[0].front (), 0.2f);
 }
 
+TEST_F (PortObservationManagerTest, ObserverCapturesAllRequestedKinds)
+{
+  auto port_ref = utils::create_object<AudioPort> (
+    registry_, u8"Test", PortFlow::Output, AudioPort::BusLayout::Mono, 1);
+  auto * port = port_ref.get_object_as<AudioPort> ();
+
+  auto meter_token = std::make_unique<ObservationToken> (
+    manager_, *port, ObservationKinds::DigitalPeak);
+  EXPECT_EQ (recalc_count_, 1);
+  auto * observer = manager_.get_observer (*port);
+  ASSERT_NE (observer, nullptr);
+  EXPECT_EQ (observer->kinds (), ObservationKinds::DigitalPeak);
+
+  // Same kinds: no rebuild needed
+  auto meter_token2 = std::make_unique<ObservationToken> (
+    manager_, *port, ObservationKinds::DigitalPeak);
+  EXPECT_EQ (recalc_count_, 1);
+
+  // More kinds: the observer is re-prepared via a rebuild
+  auto samples_token = std::make_unique<ObservationToken> (
+    manager_, *port, ObservationKinds::Samples);
+  EXPECT_EQ (recalc_count_, 2);
+  EXPECT_EQ (manager_.get_observer (*port), observer);
+  EXPECT_EQ (
+    observer->kinds (),
+    ObservationKinds::DigitalPeak | ObservationKinds::Samples);
+
+  samples_token.reset ();
+  EXPECT_EQ (recalc_count_, 3);
+  EXPECT_EQ (observer->kinds (), ObservationKinds::DigitalPeak);
+
+  meter_token2.reset ();
+  EXPECT_EQ (recalc_count_, 3);
+  meter_token.reset ();
+  EXPECT_EQ (recalc_count_, 4);
+  EXPECT_TRUE (manager_.observers ().empty ());
+}
+
+TEST_F (PortObservationManagerTest, DrainCopiesMeterRecordsToCache)
+{
+  auto port_ref = utils::create_object<AudioPort> (
+    registry_, u8"Test", PortFlow::Output, AudioPort::BusLayout::Stereo, 2);
+  auto * port = port_ref.get_object_as<AudioPort> ();
+  port->prepare_for_processing (nullptr, sample_rate_, block_length_);
+
+  ObservationToken token (manager_, *port, ObservationKinds::DigitalPeak);
+  auto *           observer = manager_.get_observer (*port);
+  ASSERT_NE (observer, nullptr);
+  observer->prepare_for_processing (nullptr, sample_rate_, block_length_);
+
+  port->buffers ()->clear ();
+  port->buffers ()->getWritePointer (1)[0] = 0.3f;
+  for (int i = 0; i < 3; ++i)
+    observer->process_block (default_time_nfo (), mock_transport_, tempo_map_);
+  manager_.drain_all ();
+
+  auto &cache = token.cache ();
+  EXPECT_TRUE (cache.audio.empty ());
+  ASSERT_EQ (cache.meters.size (), 2u);
+  ASSERT_EQ (cache.meters[1].size (), 3u);
+  EXPECT_FLOAT_EQ (cache.meters[1].front ().digital_value, 0.3f);
+  EXPECT_FLOAT_EQ (cache.meters[0].front ().digital_value, 0.f);
+
+  cache.clear_meters ();
+  EXPECT_TRUE (cache.meters[1].empty ());
+}
+
 }
@@ -239,4 +239,80 @@ TEST_F (PortObserverTest, ReleaseResourcesClearsRings)
   EXPECT_FALSE (observer->has_audio_rings ());
 }
 
+TEST_F (PortObserverTest, MeterRecordsPerBlock)
+{
+  auto port_ref = utils::create_object<AudioPort> (
+    registry_, u8"Stereo", PortFlow::Output, AudioPort::BusLayout::Stereo, 2);
+  auto * port = port_ref.get_object_as<AudioPort> ();
+  port->prepare_for_processing (nullptr, sample_rate_, block_length_);
+
+  auto observer = std::make_unique<PortObserver> (
+    registry_, *port,
+    ObservationKinds::DigitalPeak | ObservationKinds::TruePeak
+      | ObservationKinds::KMeter);
+  observer->prepare_for_processing (nullptr, sample_rate_, block_length_);
+  EXPECT_FALSE (observer->has_audio_rings ());
+  ASSERT_TRUE (observer->has_meter_rings ());
+  EXPECT_EQ (observer->num_channels (), 2);
+
+  port->buffers ()->clear ();
+  port->buffers ()->getWritePointer (0)[10] = 0.5f;
+  port->buffers ()->getWritePointer (1)[20] = -0.8f;
+
+  observer->process_block (default_time_nfo (), mock_transport_, tempo_map_);
+  observer->process_block (default_time_nfo (), mock_transport_, tempo_map_);
+
+  // One record per block
+  ASSERT_EQ (observer->meter_ring (0).read_space (), 2u);
+  ASSERT_EQ (observer->meter_ring (1).read_space (), 2u);
+
+  MeterRecord record;
+  observer->meter_ring (0).read (record);
+  EXPECT_EQ (record.num_frames, block_length_.in<uint32_t> (units::samples));
+  EXPECT_FLOAT_EQ (record.digital_value, 0.5f);
+  EXPECT_FLOAT_EQ (record.digital_peak, 0.5f);
+  EXPECT_GT (record.rms, 0.f);
+  EXPECT_LT (record.rms, 0.5f);
+  EXPECT_GT (record.true_peak, 0.f);
+  EXPECT_GT (record.k_peak, 0.f);
+
+  observer->meter_ring (1).read (record);
+  EXPECT_FLOAT_EQ (record.digital_value, 0.8f);
+}
+
+TEST_F (PortObserverTest, MeterOnlyForRequestedKinds)
+{
+  auto port_ref =
+    utils::create_object<CVPort> (registry_, u8"Test CV", PortFlow::Output);
+  auto * port = port_ref.get_object_as<CVPort> ();
+  port->prepare_for_processing (nullptr, sample_rate_, block_length_);
+
+  auto observer = std::make_unique<PortObserver> (
+    registry_, *port,
+    ObservationKinds::Samples | ObservationKinds::DigitalPeak);
+  observer->prepare_for_processing (nullptr, sample_rate_, block_length_);
+  EXPECT_TRUE (observer->has_audio_rings ());
+  EXPECT_TRUE (observer->has_meter_rings ());
+
+  port->buf_.resize (256);
+  port->buf_[0] = 0.5f;
+  observer->process_block (default_time_nfo (), mock_transport_, tempo_map_);
+
+  EXPECT_EQ (
+    observer->audio_ring (0).read_space (),
+    block_length_.in<size_t> (units::samples));
+  MeterRecord record;
+  ASSERT_TRUE (observer->meter_ring (0).read (record));
+  EXPECT_FLOAT_EQ (record.digital_value, 0.5f);
+  EXPECT_FLOAT_EQ (record.true_peak, 0.f);
+  EXPECT_FLOAT_EQ (record.k_rms, 0.f);
+
+  // Changing the kinds takes effect when prepared again
+  observer->set_kinds (ObservationKinds::KMeter);
+  EXPECT_TRUE (observer->has_audio_rings ());
+  observer->prepare_for_processing (nullptr, sample_rate_, block_length_);
+  EXPECT_FALSE (observer->has_audio_rings ());
+  EXPECT_TRUE (observer->has_meter_rings ());
+}
+
 }
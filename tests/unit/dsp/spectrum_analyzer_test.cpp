@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <thread>
+#include <vector>
+
+#include "dsp/spectrum_analyzer.h"
+
+#include <gtest/gtest.h>
+
+namespace zrythm::dsp
+{
+
+namespace
+{
+std::vector<float>
+make_sine (float frequency, float sample_rate, size_t num_samples)
+{
+  std::vector<float> out (num_samples);
+  for (size_t i = 0; i < num_samples; ++i)
+    {
+      out[i] = std::sin (
+        2.f * std::numbers::pi_v<float> * frequency * static_cast<float> (i)
+        / sample_rate);
+    }
+  return out;
+}
+}
+
+TEST (SpectrumFrameAnalyzerTest, SinePeaksInNearestBand)
+{
+  SpectrumAnalyzerConfig config;
+  config.fft_size = 8192;
+  config.num_bands = 128;
+  SpectrumFrameAnalyzer analyzer (config);
+
+  const auto         input = make_sine (1000.f, config.sample_rate, 8192);
+  std::vector<float> bands (config.num_bands);
+  analyzer.analyze (input, bands);
+
+  const auto peak_band = static_cast<size_t> (
+    std::ranges::max_element (bands) - bands.begin ());
+  const float peak_freq = analyzer.band_center_frequency (peak_band);
+  EXPECT_NEAR (peak_freq, 1000.f, 1000.f * 0.05f);
+
+  // Full-scale sine reads close to 0 dBFS
+  EXPECT_GT (bands[peak_band], 0.95f);
+
+  // Energy far from the tone is well below the peak
+  EXPECT_LT (bands.front (), 0.5f);
+  EXPECT_LT (bands.back (), 0.5f);
+}
+
+TEST (SpectrumFrameAnalyzerTest, SilenceProducesZeroLevels)
+{
+  SpectrumAnalyzerConfig config;
+  config.fft_size = 1024;
+  SpectrumFrameAnalyzer analyzer (config);
+
+  std::vector<float> input (config.fft_size, 0.f);
+  std::vector<float> bands (config.num_bands, 1.f);
+  analyzer.analyze (input, bands);
+  for (const auto level : bands)
+    EXPECT_FLOAT_EQ (level, 0.f);
+}
+
+TEST (SpectrumFrameAnalyzerTest, BandCentersAreIncreasing)
+{
+  SpectrumAnalyzerConfig config;
+  SpectrumFrameAnalyzer  analyzer (config);
+  for (size_t k = 1; k < config.num_bands; ++k)
+    {
+      EXPECT_GT (
+        analyzer.band_center_frequency (k),
+        analyzer.band_center_frequency (k - 1));
+    }
+  EXPECT_GE (analyzer.band_center_frequency (0), config.min_frequency);
+  EXPECT_LE (
+    analyzer.band_center_frequency (config.num_bands - 1),
+    config.sample_rate / 2.f);
+}
+
+TEST (SpectrumFrameAnalyzerTest, RejectsInvalidFftSize)
+{
+  EXPECT_FALSE (SpectrumFrameAnalyzer::is_valid_fft_size (1000));
+  EXPECT_FALSE (SpectrumFrameAnalyzer::is_valid_fft_size (128));
+  EXPECT_FALSE (SpectrumFrameAnalyzer::is_valid_fft_size (65536));
+  EXPECT_TRUE (SpectrumFrameAnalyzer::is_valid_fft_size (16384));
+
+  SpectrumAnalyzerConfig config;
+  config.fft_size = 1000;
+  EXPECT_THROW (SpectrumFrameAnalyzer{ config }, std::invalid_argument);
+}
+
+TEST (SpectrumAnalyzerTest, PublishesFramesFromWorkerThread)
+{
+  SpectrumAnalyzerConfig config;
+  config.fft_size = 2048;
+  config.num_bands = 64;
+  SpectrumAnalyzer analyzer (config);
+
+  std::vector<float> frame;
+  uint64_t           generation = 0;
+  EXPECT_FALSE (analyzer.fetch_latest_frame (frame, generation));
+
+  const auto sine = make_sine (1000.f, config.sample_rate, config.fft_size);
+  analyzer.push_samples (sine, sine);
+
+  const auto deadline =
+    std::chrono::steady_clock::now () + std::chrono::seconds (5);
+  while (
+    !analyzer.fetch_latest_frame (frame, generation)
+    && std::chrono::steady_clock::now () < deadline)
+    {
+      std::this_thread::sleep_for (std::chrono::milliseconds (1));
+    }
+
+  ASSERT_GT (generation, 0u);
+  ASSERT_EQ (frame.size (), config.num_bands);
+  const auto peak_band =
+    static_cast<size_t> (std::ranges::max_element (frame) - frame.begin ());
+  EXPECT_NEAR (analyzer.band_center_frequency (peak_band), 1000.f, 100.f);
+
+  // Nothing new to fetch without further input
+  const auto prev_generation = generation;
+  EXPECT_FALSE (analyzer.fetch_latest_frame (frame, generation));
+  EXPECT_EQ (generation, prev_generation);
+}
+
+TEST (SpectrumAnalyzerTest, DestroysCleanlyWhileIdle)
+{
+  SpectrumAnalyzerConfig config;
+  config.fft_size = 256;
+  auto analyzer = std::make_unique<SpectrumAnalyzer> (config);
+  analyzer.reset ();
+}
+
+} // namespace zrythm::dsp
@@ -1081,4 +1081,77 @@ TEST_F (TempoMapTest, RemoveEventRestoresBaseGovernance)
       EXPECT_EQ (map->time_signature_at_tick (units::ticks (t)).denominator, 4);
     }
 }
+
+// A cursor gives the same results as per-call conversions, for ascending
+// positions that cross constant and linear segments as well as for jumps
+// backwards.
+TEST_F (TempoMapTest, CursorMatchesPerCallConversion)
+{
+  const int64_t ppq = TempoMap::get_ppq ().in (units::ticks);
+  map->add_tempo_event (
+    units::ticks (4 * ppq), units::bpm (140.0), TempoMap::CurveType::Linear);
+  map->add_tempo_event (
+    units::ticks (8 * ppq), units::bpm (90.0), TempoMap::CurveType::Constant);
+  map->add_tempo_event (
+    units::ticks (12 * ppq), units::bpm (180.0), TempoMap::CurveType::Constant);
+
+  std::vector<double> positions;
+  for (int64_t t = 0; t <= 16 * ppq; t += ppq / 3)
+    positions.push_back (static_cast<double> (t));
+  // Jumps back and forward over several segments
+  positions.insert (
+    positions.end (),
+    { 5.0 * static_cast<double> (ppq), 0.0, 13.5 * static_cast<double> (ppq),
+      static_cast<double> (8 * ppq) });
+
+  TempoMap::Cursor tick_cursor (*map);
+  TempoMap::Cursor sample_cursor (*map);
+  for (const auto pos : positions)
+    {
+      SCOPED_TRACE (pos);
+      const auto tick = TimelineTick{ units::ticks (pos) };
+      const auto samples = map->tick_to_samples (tick);
+      EXPECT_DOUBLE_EQ (
+        tick_cursor.tick_to_samples (tick).in (units::samples),
+        samples.in (units::samples));
+      EXPECT_EQ (
+        tick_cursor.tick_to_samples_rounded (tick).in (units::samples),
+        map->tick_to_samples_rounded (tick).in (units::samples));
+      EXPECT_DOUBLE_EQ (
+        sample_cursor.samples_to_tick (samples).asDouble (),
+        map->samples_to_tick (samples).asDouble ());
+    }
+}
+
+TEST_F (TempoMapTest, BatchConversionMatchesPerCallConversion)
+{
+  const int64_t ppq = TempoMap::get_ppq ().in (units::ticks);
+  const auto    check = [&] {
+    std::vector<TimelineTick> ticks;
+    for (int64_t t = 0; t <= 16 * ppq; t += ppq / 4)
+      ticks.emplace_back (units::ticks (static_cast<double> (t)));
+
+    std::vector<units::precise_sample_t> samples (ticks.size ());
+    map->ticks_to_samples (ticks, samples);
+    std::vector<TimelineTick> round_trip (ticks.size ());
+    map->samples_to_ticks (samples, round_trip);
+    for (size_t i = 0; i < ticks.size (); ++i)
+      {
+        SCOPED_TRACE (i);
+        EXPECT_DOUBLE_EQ (
+          samples[i].in (units::samples),
+          map->tick_to_samples (ticks[i]).in (units::samples));
+        EXPECT_NEAR (round_trip[i].asDouble (), ticks[i].asDouble (), 1e-6);
+      }
+  };
+
+  // Constant tempo
+  check ();
+
+  map->add_tempo_event (
+    units::ticks (2 * ppq), units::bpm (100.0), TempoMap::CurveType::Linear);
+  map->add_tempo_event (
+    units::ticks (10 * ppq), units::bpm (160.0), TempoMap::CurveType::Constant);
+  check ();
+}
 }
@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include "engine/session/midi_mapping.h"
+#include "utils/object_registry.h"
+#include "utils/registry_utils.h"
+
+#include <gtest/gtest.h>
+
+namespace zrythm::engine::session
+{
+
+class MidiMappingsTest : public ::testing::Test
+{
+protected:
+  static constexpr std::array<midi_byte_t, 3> kVolumeCc = { 0xB0, 0x07, 0 };
+  static constexpr std::array<midi_byte_t, 3> kPanCc = { 0xB0, 0x0A, 0 };
+
+  void SetUp () override
+  {
+    mappings_ = std::make_unique<MidiMappings> (registry_);
+    volume_ref_ = create_parameter (
+      u8"Volume",
+      dsp::ParameterRange (dsp::ParameterRange::Type::Linear, 0.f, 1.f));
+    mute_ref_ =
+      create_parameter (u8"Mute", dsp::ParameterRange::make_toggle (false));
+    volume_ = volume_ref_->get_object_as<dsp::ProcessorParameter> ();
+    mute_ = mute_ref_->get_object_as<dsp::ProcessorParameter> ();
+  }
+
+  dsp::ProcessorParameterUuidReference
+  create_parameter (const char8_t * label, dsp::ParameterRange range)
+  {
+    return utils::create_object<dsp::ProcessorParameter> (
+      registry_, registry_,
+      dsp::ProcessorParameter::UniqueId (utils::Utf8String (label)), range,
+      utils::Utf8String (label));
+  }
+
+  void push_cc (
+    std::array<midi_byte_t, 3> cc,
+    midi_byte_t                value,
+    uint32_t                   time = 0)
+  {
+    cc[2] = value;
+    events_.push_back (units::samples (time), cc);
+  }
+
+  /**
+   * Dispatches the pushed events as the engine would, then applies them as
+   * the main thread would.
+   */
+  void apply (const utils::Utf8String * device_id = nullptr)
+  {
+    dispatch (device_id);
+    mappings_->flush_pending ();
+  }
+
+  void dispatch (const utils::Utf8String * device_id = nullptr)
+  {
+    mappings_->apply_from_cc_events (events_, device_id);
+    events_.clear ();
+  }
+
+  utils::ObjectRegistry                               registry_;
+  std::unique_ptr<MidiMappings>                       mappings_;
+  std::optional<dsp::ProcessorParameterUuidReference> volume_ref_;
+  std::optional<dsp::ProcessorParameterUuidReference> mute_ref_;
+  dsp::ProcessorParameter *                           volume_{};
+  dsp::ProcessorParameter *                           mute_{};
+  dsp::MidiEventBuffer events_ = dsp::MidiEventBuffer::make_reserved ();
+};
+
+TEST_F (MidiMappingsTest, AppliesLastValuePerDestination)
+{
+  mappings_->bind_device (kVolumeCc, std::nullopt, *volume_ref_, false);
+
+  push_cc (kVolumeCc, 10, 0);
+  push_cc (kVolumeCc, 64, 10);
+  push_cc (kVolumeCc, 127, 20);
+  apply ();
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 1.f);
+
+  push_cc (kVolumeCc, 0);
+  apply ();
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 0.f);
+}
+
+TEST_F (MidiMappingsTest, AppliesOnlyOnFlush)
+{
+  mappings_->bind_device (kVolumeCc, std::nullopt, *volume_ref_, false);
+  mappings_->bind_device (kPanCc, std::nullopt, *mute_ref_, false);
+
+  // Values received over several cycles are coalesced until flushed
+  push_cc (kVolumeCc, 64);
+  push_cc (kPanCc, 127);
+  dispatch ();
+  push_cc (kVolumeCc, 127);
+  push_cc (kPanCc, 127);
+  push_cc (kPanCc, 127);
+  dispatch ();
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 0.f);
+  EXPECT_FALSE (mute_->range ().isToggled (mute_->baseValue ()));
+
+  mappings_->flush_pending ();
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 1.f);
+  EXPECT_TRUE (mute_->range ().isToggled (mute_->baseValue ()));
+
+  // Nothing left to apply
+  volume_->setBaseValue (0.5f);
+  mappings_->flush_pending ();
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 0.5f);
+  EXPECT_TRUE (mute_->range ().isToggled (mute_->baseValue ()));
+}
+
+TEST_F (MidiMappingsTest, IgnoresUnmappedAndNonCcEvents)
+{
+  mappings_->bind_device (kVolumeCc, std::nullopt, *volume_ref_, false);
+  volume_->setBaseValue (0.5f);
+
+  push_cc (kPanCc, 127);
+  events_.push_back (
+    units::samples (0), std::array<midi_byte_t, 3>{ 0x90, 0x07, 127 });
+  apply ();
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 0.5f);
+}
+
+TEST_F (MidiMappingsTest, TogglesOncePerOddEventCount)
+{
+  mappings_->bind_device (kPanCc, std::nullopt, *mute_ref_, false);
+
+  push_cc (kPanCc, 127);
+  apply ();
+  EXPECT_TRUE (mute_->range ().isToggled (mute_->baseValue ()));
+
+  push_cc (kPanCc, 127);
+  push_cc (kPanCc, 127);
+  apply ();
+  EXPECT_TRUE (mute_->range ().isToggled (mute_->baseValue ()));
+
+  push_cc (kPanCc, 127);
+  apply ();
+  EXPECT_FALSE (mute_->range ().isToggled (mute_->baseValue ()));
+}
+
+TEST_F (MidiMappingsTest, FiltersByDevice)
+{
+  const utils::Utf8String keyboard{ u8"Keyboard" };
+  const utils::Utf8String controller{ u8"Controller" };
+  mappings_->bind_device (kVolumeCc, keyboard, *volume_ref_, false);
+
+  push_cc (kVolumeCc, 127);
+  apply (&controller);
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 0.f);
+
+  push_cc (kVolumeCc, 127);
+  apply (&keyboard);
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 1.f);
+
+  // Events of unknown origin match all bindings
+  push_cc (kVolumeCc, 0);
+  apply ();
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 0.f);
+}
+
+TEST_F (MidiMappingsTest, EditsTakeEffectAfterRebuild)
+{
+  mappings_->bind_device (kVolumeCc, std::nullopt, *volume_ref_, false);
+  push_cc (kVolumeCc, 127);
+  apply ();
+  ASSERT_FLOAT_EQ (volume_->baseValue (), 1.f);
+
+  // A new binding is picked up
+  mappings_->bind_device (kPanCc, std::nullopt, *mute_ref_, false);
+  push_cc (kPanCc, 127);
+  apply ();
+  EXPECT_TRUE (mute_->range ().isToggled (mute_->baseValue ()));
+
+  // An unbound one is dropped
+  mappings_->unbind (0, false);
+  ASSERT_EQ (mappings_->mappings_.size (), 1);
+  push_cc (kVolumeCc, 0);
+  apply ();
+  EXPECT_FLOAT_EQ (volume_->baseValue (), 1.f);
+
+  // Disabling does not need a rebuild
+  mappings_->mappings_.front ()->set_enabled (false);
+  push_cc (kPanCc, 127);
+  apply ();
+  EXPECT_TRUE (mute_->range ().isToggled (mute_->baseValue ()));
+}
+
+} // namespace zrythm::engine::session
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include "gui/qquick/dsp_profiler_model.h"
+#include "utils/io_utils.h"
+#include "utils/utf8_string.h"
+
+#include <QSignalSpy>
+#include <QTemporaryDir>
+
+#include "helpers/scoped_qcoreapplication.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace std::chrono_literals;
+
+namespace zrythm::gui::qquick
+{
+
+class DspProfilerModelTest : public ::testing::Test
+{
+protected:
+  class NamedProcessable : public dsp::graph::IProcessable
+  {
+  public:
+    explicit NamedProcessable (utils::Utf8String name)
+        : name_ (std::move (name))
+    {
+    }
+    utils::Utf8String get_node_name () const override { return name_; }
+
+  private:
+    utils::Utf8String name_;
+  };
+
+  void SetUp () override
+  {
+    app_ = std::make_unique<test_helpers::ScopedQCoreApplication> ();
+
+    // Chain: fast -> slow
+    processables_.push_back (std::make_unique<NamedProcessable> (u8"fast"));
+    processables_.push_back (std::make_unique<NamedProcessable> (u8"slow"));
+    for (const auto &processable : processables_)
+      {
+        collection_.graph_nodes_.push_back (
+          std::make_unique<dsp::graph::GraphNode> (
+            static_cast<int> (collection_.graph_nodes_.size ()),
+            *processable));
+      }
+    collection_.graph_nodes_[0]->connect_to (*collection_.graph_nodes_[1]);
+    collection_.finalize_nodes ();
+
+    profiler_.set_num_threads (1);
+    profiler_.set_nodes (collection_);
+
+    model_ = std::make_unique<DspProfilerModel> ();
+    model_->set_profiler_provider ([this] () { return &profiler_; });
+  }
+
+  void record_timings ()
+  {
+    profiler_.record (0, *collection_.graph_nodes_[0], 10us);
+    profiler_.record (-1, *collection_.graph_nodes_[1], 200us);
+  }
+
+  QString name_at (int row) const
+  {
+    return model_->data (model_->index (row), DspProfilerModel::NodeNameRole)
+      .toString ();
+  }
+
+  std::unique_ptr<test_helpers::ScopedQCoreApplication> app_;
+  std::vector<std::unique_ptr<NamedProcessable>>        processables_;
+  dsp::graph::GraphNodeCollection                       collection_;
+  dsp::graph::GraphProfiler                             profiler_;
+  std::unique_ptr<DspProfilerModel>                     model_;
+};
+
+TEST_F (DspProfilerModelTest, ActiveEnablesProfiler)
+{
+  QSignalSpy spy (model_.get (), &DspProfilerModel::activeChanged);
+  EXPECT_FALSE (profiler_.enabled ());
+
+  model_->setActive (true);
+  EXPECT_TRUE (profiler_.enabled ());
+  EXPECT_EQ (spy.count (), 1);
+
+  model_->setActive (false);
+  EXPECT_FALSE (profiler_.enabled ());
+  EXPECT_EQ (spy.count (), 2);
+}
+
+TEST_F (DspProfilerModelTest, RefreshListsNodesByMeanTime)
+{
+  EXPECT_EQ (model_->rowCount (), 0);
+
+  record_timings ();
+  model_->refresh ();
+  ASSERT_EQ (model_->rowCount (), 2);
+  EXPECT_EQ (name_at (0), u"slow");
+  EXPECT_EQ (name_at (1), u"fast");
+
+  const auto slow_idx = model_->index (0);
+  EXPECT_DOUBLE_EQ (
+    slow_idx.data (DspProfilerModel::MeanUsRole).toDouble (), 200.0);
+  EXPECT_EQ (slow_idx.data (DspProfilerModel::ThreadIdRole).toInt (), -1);
+  EXPECT_TRUE (slow_idx.data (DspProfilerModel::CriticalPathRole).toBool ());
+}
+
+TEST_F (DspProfilerModelTest, SortByName)
+{
+  record_timings ();
+  model_->refresh ();
+
+  QSignalSpy spy (model_.get (), &QAbstractItemModel::dataChanged);
+  model_->setSortRole (DspProfilerModel::NodeNameRole);
+  EXPECT_EQ (spy.count (), 1);
+  EXPECT_EQ (name_at (0), u"fast");
+  EXPECT_EQ (name_at (1), u"slow");
+}
+
+TEST_F (DspProfilerModelTest, ResetClearsTimings)
+{
+  record_timings ();
+  model_->refresh ();
+  model_->reset ();
+  ASSERT_EQ (model_->rowCount (), 2);
+  EXPECT_EQ (
+    model_->index (0).data (DspProfilerModel::NumRunsRole).toInt (), 0);
+}
+
+TEST_F (DspProfilerModelTest, SaveJson)
+{
+  record_timings ();
+  model_->refresh ();
+
+  QTemporaryDir dir;
+  ASSERT_TRUE (dir.isValid ());
+  const auto url =
+    QUrl::fromLocalFile (dir.filePath (QStringLiteral ("profile.json")));
+  ASSERT_TRUE (model_->saveJson (url));
+
+  const auto j = nlohmann::json::parse (
+    utils::io::read_file_contents (
+      utils::Utf8String::from_qurl (url).to_path ())
+      .toStdString ());
+  EXPECT_EQ (j["droppedCount"], 0);
+  ASSERT_EQ (j["nodes"].size (), 2);
+  EXPECT_EQ (j["nodes"][0]["name"], "slow");
+  EXPECT_EQ (j["nodes"][1]["name"], "fast");
+}
+
+} // namespace zrythm::gui::qquick
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <filesystem>
+#include <fstream>
+
+#include "gui/backend/file_system_model.h"
+#include "utils/io_utils.h"
+#include "utils/utf8_string.h"
+
+#include <QSignalSpy>
+
+#include <gtest/gtest.h>
+
+namespace zrythm::gui
+{
+
+class FileSystemModelTest : public ::testing::Test
+{
+protected:
+  void SetUp () override
+  {
+    temp_dir_ = utils::io::make_tmp_dir ();
+    const auto dir =
+      utils::Utf8String::from_qstring (temp_dir_->path ()).to_path ();
+    std::filesystem::create_directory (dir / "browsed");
+    std::filesystem::copy_file (
+      TEST_WAV_FILE_PATH, dir / "browsed" / "sample.wav");
+    std::ofstream (dir / "browsed" / "notes.txt") << "not audio";
+    browsed_dir_ = temp_dir_->path () + u"/browsed";
+
+    model_ = std::make_unique<FileSystemModel> (
+      std::make_shared<utils::audio::WaveformThumbnailCache> (
+        dir / "cache",
+        utils::audio::WaveformThumbnailCache::DEFAULT_MAX_SIZE_BYTES));
+  }
+
+  void TearDown () override { model_.reset (); }
+
+  /** Waits until the waveform of the file at @p path is known. */
+  bool wait_for_waveform (const QString &path)
+  {
+    QSignalSpy spy (model_.get (), &QAbstractItemModel::dataChanged);
+    while (!model_->index (path).data (FileSystemModel::WaveformPeaksRole)
+              .isValid ())
+      {
+        if (!spy.wait (10000))
+          return false;
+      }
+    return true;
+  }
+
+  std::unique_ptr<QTemporaryDir>   temp_dir_;
+  QString                          browsed_dir_;
+  std::unique_ptr<FileSystemModel> model_;
+};
+
+TEST_F (FileSystemModelTest, RoleNames)
+{
+  const auto roles = model_->roleNames ();
+  EXPECT_EQ (roles.value (FileSystemModel::WaveformPeaksRole), "waveformPeaks");
+  EXPECT_EQ (roles.value (FileSystemModel::DurationRole), "duration");
+}
+
+TEST_F (FileSystemModelTest, AudioFilesOfBrowsedDirectoryGetWaveforms)
+{
+  const auto sample_path = browsed_dir_ + u"/sample.wav";
+  const auto text_path = browsed_dir_ + u"/notes.txt";
+  model_->setRootPath (browsed_dir_);
+
+  ASSERT_TRUE (wait_for_waveform (sample_path));
+  const auto expected =
+    utils::audio::WaveformThumbnail::from_file (TEST_WAV_FILE_PATH);
+  const auto sample_index = model_->index (sample_path);
+
+  const auto peaks = sample_index.data (FileSystemModel::WaveformPeaksRole)
+                       .value<QList<float>> ();
+  const auto expected_peaks = expected.mixed_peaks ();
+  EXPECT_EQ (
+    std::vector<float> (peaks.begin (), peaks.end ()), expected_peaks);
+  EXPECT_DOUBLE_EQ (
+    sample_index.data (FileSystemModel::DurationRole).toDouble (),
+    expected.duration_seconds ());
+
+  // Other files have no waveform
+  const auto text_index = model_->index (text_path);
+  EXPECT_FALSE (
+    text_index.data (FileSystemModel::WaveformPeaksRole).isValid ());
+  EXPECT_DOUBLE_EQ (
+    text_index.data (FileSystemModel::DurationRole).toDouble (), -1.0);
+}
+
+TEST_F (FileSystemModelTest, ChangingRootIndexScansNewDirectory)
+{
+  const auto sample_path = browsed_dir_ + u"/sample.wav";
+  model_->setRootPath (temp_dir_->path ());
+  model_->setRootIndex (model_->index (browsed_dir_));
+  EXPECT_TRUE (wait_for_waveform (sample_path));
+}
+
+} // namespace zrythm::gui
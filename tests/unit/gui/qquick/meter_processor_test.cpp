@@ -42,18 +42,20 @@ protected:
     return meter;
   }
 
-  // Pushes @p value-filled samples into the observer ring for channel 0 and
-  // drains them into all requester caches (mono data only).
+  // Pushes a meter record for a @p value-filled block into the observer ring
+  // for channel 0 and drains it into all requester caches (mono data only).
   void push_mono_audio (dsp::Port * port, float value)
   {
     auto * observer = manager_.get_observer (*port);
     ASSERT_NE (observer, nullptr);
     observer->prepare_for_processing (nullptr, sample_rate_, block_length_);
 
-    std::array<float, block_length_.in<size_t> (units::samples)> samples{};
-    samples.fill (value);
-    observer->audio_ring (0).force_write_multiple (
-      samples.data (), samples.size ());
+    observer->meter_ring (0).force_write (
+      dsp::MeterRecord{
+        .num_frames = block_length_.in<uint32_t> (units::samples),
+        .digital_value = value,
+        .digital_peak = value,
+        .rms = value });
     manager_.drain_all ();
   }
 
@@ -105,4 +107,22 @@ TEST_F (MeterProcessorTest, ValidChannelReadsData)
   EXPECT_GT (meter->currentAmplitude (), 0.5f);
 }
 
+// Meters only request meter readings, so no raw samples are captured.
+TEST_F (MeterProcessorTest, ObserverCapturesOnlyMeterReadings)
+{
+  auto * port = make_mono_port ();
+  auto   meter = make_meter (port, 0);
+
+  auto * observer = manager_.get_observer (*port);
+  ASSERT_NE (observer, nullptr);
+  observer->prepare_for_processing (nullptr, sample_rate_, block_length_);
+  EXPECT_FALSE (observer->has_audio_rings ());
+  EXPECT_TRUE (observer->has_meter_rings ());
+
+  meter->setAlgorithm (MeterProcessor::MeterAlgorithm::K);
+  EXPECT_EQ (manager_.observers ().size (), 1u);
+  EXPECT_EQ (manager_.get_observer (*port), observer);
+  EXPECT_EQ (observer->kinds (), dsp::ObservationKinds::KMeter);
+}
+
 }
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "gui/backend/waveform_thumbnail_scanner.h"
+#include "utils/io_utils.h"
+#include "utils/utf8_string.h"
+
+#include <QSignalSpy>
+
+#include <gtest/gtest.h>
+
+namespace zrythm::gui
+{
+
+class WaveformThumbnailScannerTest : public ::testing::Test
+{
+protected:
+  void SetUp () override
+  {
+    temp_dir_ = utils::io::make_tmp_dir ();
+    dir_ = utils::Utf8String::from_qstring (temp_dir_->path ()).to_path ();
+    scanner_ = std::make_unique<WaveformThumbnailScanner> (
+      std::make_shared<utils::audio::WaveformThumbnailCache> (
+        dir_ / "cache",
+        utils::audio::WaveformThumbnailCache::DEFAULT_MAX_SIZE_BYTES));
+  }
+
+  void TearDown () override { scanner_.reset (); }
+
+  /** Copies the test WAV file into the temporary directory. */
+  QString copy_wav (std::string_view name) const
+  {
+    const auto path = dir_ / name;
+    std::filesystem::copy_file (TEST_WAV_FILE_PATH, path);
+    return utils::Utf8String::from_path (path).to_qstring ();
+  }
+
+  /** Waits until the thumbnail of @p path is ready. */
+  bool wait_for_thumbnail (QSignalSpy &spy, const QString &path) const
+  {
+    while (scanner_->thumbnail (path) == nullptr)
+      {
+        if (!spy.wait (10000))
+          return false;
+      }
+    return true;
+  }
+
+  std::unique_ptr<QTemporaryDir>            temp_dir_;
+  std::filesystem::path                     dir_;
+  std::unique_ptr<WaveformThumbnailScanner> scanner_;
+};
+
+TEST_F (WaveformThumbnailScannerTest, ComputesThumbnailsInBackground)
+{
+  const auto path = copy_wav ("a.wav");
+  EXPECT_EQ (scanner_->thumbnail (path), nullptr);
+
+  QSignalSpy spy (scanner_.get (), &WaveformThumbnailScanner::thumbnailReady);
+  scanner_->scan_files ({ path });
+  ASSERT_TRUE (wait_for_thumbnail (spy, path));
+  EXPECT_EQ (spy.first ().first ().toString (), path);
+
+  const auto expected =
+    utils::audio::WaveformThumbnail::from_file (TEST_WAV_FILE_PATH);
+  const auto * thumbnail = scanner_->thumbnail (path);
+  EXPECT_EQ (thumbnail->num_frames, expected.num_frames);
+  EXPECT_EQ (thumbnail->peaks, expected.peaks);
+
+  // Already computed files are not queued again
+  spy.clear ();
+  scanner_->scan_files ({ path });
+  EXPECT_FALSE (spy.wait (200));
+}
+
+TEST_F (WaveformThumbnailScannerTest, UndecodableFilesAreSkipped)
+{
+  const auto bad_path = dir_ / "bad.wav";
+  std::ofstream (bad_path) << "not audio";
+  const auto bad = utils::Utf8String::from_path (bad_path).to_qstring ();
+  const auto good = copy_wav ("good.wav");
+
+  // Files are processed in order, so the bad one is done once the good one
+  // is ready
+  QSignalSpy spy (scanner_.get (), &WaveformThumbnailScanner::thumbnailReady);
+  scanner_->scan_files ({ bad, good });
+  ASSERT_TRUE (wait_for_thumbnail (spy, good));
+  EXPECT_EQ (scanner_->thumbnail (bad), nullptr);
+  EXPECT_EQ (spy.count (), 1);
+}
+
+TEST_F (WaveformThumbnailScannerTest, CancelPendingDropsQueuedFiles)
+{
+  QStringList queued;
+  for (int i = 0; i < 20; ++i)
+    queued.append (copy_wav (fmt::format ("queued{}.wav", i)));
+  const auto later = copy_wav ("later.wav");
+
+  QSignalSpy spy (scanner_.get (), &WaveformThumbnailScanner::thumbnailReady);
+  scanner_->scan_files (queued);
+  scanner_->cancel_pending ();
+  scanner_->scan_files ({ later });
+  ASSERT_TRUE (wait_for_thumbnail (spy, later));
+
+  // At most the file that was already being processed got computed
+  const auto computed = std::ranges::count_if (queued, [&] (const auto &path) {
+    return scanner_->thumbnail (path) != nullptr;
+  });
+  EXPECT_LE (computed, 1);
+
+  // Cancelled files can be queued again
+  spy.clear ();
+  scanner_->scan_files ({ queued.back () });
+  EXPECT_TRUE (wait_for_thumbnail (spy, queued.back ()));
+}
+
+} // namespace zrythm::gui
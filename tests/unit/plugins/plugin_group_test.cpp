@@ -319,6 +319,50 @@ TEST_F (DeviceGroupTest, EmptyJsonSerialization)
   EXPECT_EQ (deserialized_list.rowCount (), 0);
 }
 
+TEST_F (DeviceGroupTest, NestedGroupsJsonRoundtrip)
+{
+  auto * serial_layer = device_group_->insert_group (
+    utils::make_qobject_unique<PluginGroup> (
+      *registry_, PluginGroup::DeviceGroupType::Audio,
+      PluginGroup::ProcessingTypeHint::Serial));
+  auto * midi_rack = serial_layer->insert_group (
+    utils::make_qobject_unique<PluginGroup> (
+      *registry_, PluginGroup::DeviceGroupType::MIDI,
+      PluginGroup::ProcessingTypeHint::Parallel));
+  auto plugin_ref = utils::create_object<FaustPlugin> (*registry_, *registry_);
+  midi_rack->append_plugin (plugin_ref);
+
+  nlohmann::json j = *device_group_;
+  PluginGroup    deserialized_list (
+    *registry_, PluginGroup::DeviceGroupType::Audio,
+    PluginGroup::ProcessingTypeHint::Parallel);
+  from_json (j, deserialized_list);
+
+  // The kind of each nested group is preserved
+  const auto elements = deserialized_list.elements ();
+  ASSERT_EQ (elements.size (), 1);
+  ASSERT_TRUE (std::holds_alternative<PluginGroup *> (elements[0]));
+  const auto * layer = std::get<PluginGroup *> (elements[0]);
+  EXPECT_EQ (layer->type (), PluginGroup::DeviceGroupType::Audio);
+  EXPECT_EQ (
+    layer->processing_type (), PluginGroup::ProcessingTypeHint::Serial);
+
+  const auto layer_elements = layer->elements ();
+  ASSERT_EQ (layer_elements.size (), 1);
+  ASSERT_TRUE (std::holds_alternative<PluginGroup *> (layer_elements[0]));
+  const auto * rack = std::get<PluginGroup *> (layer_elements[0]);
+  EXPECT_EQ (rack->type (), PluginGroup::DeviceGroupType::MIDI);
+  EXPECT_EQ (
+    rack->processing_type (), PluginGroup::ProcessingTypeHint::Parallel);
+  EXPECT_TRUE (rack->fader ().is_midi ());
+
+  const auto rack_elements = rack->elements ();
+  ASSERT_EQ (rack_elements.size (), 1);
+  ASSERT_TRUE (std::holds_alternative<PluginUuidReference> (rack_elements[0]));
+  EXPECT_EQ (
+    std::get<PluginUuidReference> (rack_elements[0]).id (), plugin_ref.id ());
+}
+
 TEST_F (DeviceGroupTest, ModelSignals)
 {
   // Create test plugins
@@ -401,4 +445,30 @@ TEST_F (DeviceGroupTest, MultipleOperations)
     plugins[3].get_object_as<FaustPlugin> ()->get_uuid ());
 }
 
+TEST_F (DeviceGroupTest, InsertGroupAndListElements)
+{
+  auto plugin_ref = utils::create_object<FaustPlugin> (*registry_, *registry_);
+  device_group_->append_plugin (plugin_ref);
+
+  QSignalSpy spy (device_group_.get (), &QAbstractItemModel::rowsInserted);
+  auto *     layer = device_group_->insert_group (
+    utils::make_qobject_unique<PluginGroup> (
+      *registry_, PluginGroup::DeviceGroupType::Audio,
+      PluginGroup::ProcessingTypeHint::Serial),
+    0);
+
+  EXPECT_EQ (spy.count (), 1);
+  EXPECT_EQ (device_group_->rowCount (), 2);
+  EXPECT_EQ (
+    layer->processing_type (), PluginGroup::ProcessingTypeHint::Serial);
+
+  const auto elements = device_group_->elements ();
+  ASSERT_EQ (elements.size (), 2);
+  ASSERT_TRUE (std::holds_alternative<PluginGroup *> (elements[0]));
+  EXPECT_EQ (std::get<PluginGroup *> (elements[0]), layer);
+  ASSERT_TRUE (std::holds_alternative<PluginUuidReference> (elements[1]));
+  EXPECT_EQ (
+    std::get<PluginUuidReference> (elements[1]).id (), plugin_ref.id ());
+}
+
 } // namespace zrythm::plugins
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: © 2025 Alexandros Theodotou <alex@zrythm.org>
 // SPDX-License-Identifier: LicenseRef-ZrythmLicense
 
+#include <limits>
+
 #include "plugins/plugin.h"
 #include "utils/object_registry.h"
 #include "utils/registry_utils.h"
@@ -52,18 +54,48 @@ public:
   void process_impl (dsp::graph::ProcessBlockInfo time_info) noexcept override
   {
     process_called_ = true;
+    ++process_count_;
     last_time_info_ = time_info;
+    transport_positions_.push_back (time_info.transport_position_);
+    if (!audio_in_ports_.empty ())
+      {
+        last_input_peak_ = audio_in_ports_.front ()->buffers ()->getMagnitude (
+          0, time_info.buffer_offset_.in<int> (units::samples),
+          time_info.nframes_.in<int> (units::samples));
+        input_peaks_.push_back (last_input_peak_);
+      }
+    for (auto * port : audio_out_ports_)
+      {
+        auto &buf = *port->buffers ();
+        for (int ch = 0; ch < buf.getNumChannels (); ++ch)
+          {
+            std::fill_n (
+              buf.getWritePointer (
+                ch, time_info.buffer_offset_.in<int> (units::samples)),
+              time_info.nframes_.in<int> (units::samples), output_level_);
+          }
+      }
   }
 
+  double get_tail_length_seconds () const override { return tail_seconds_; }
+
   std::string save_state_impl () const override { return {}; }
   void        load_state_impl (const std::string &) override { }
 
   bool                         prepare_called_ = false;
   bool                         process_called_ = false;
+  int                          process_count_ = 0;
+  float                        last_input_peak_ = 0.f;
+  std::vector<float>           input_peaks_;
+  double                       tail_seconds_ = 0.0;
+  float                        output_level_ = 0.f;
   units::sample_rate_t         last_sample_rate_;
   units::sample_u32_t          last_max_block_length_;
   dsp::graph::ProcessBlockInfo last_time_info_ = dsp::graph::ProcessBlockInfo::
     from_position_and_nframes (units::samples (0), units::samples (0));
+
+  /** Transport position of each process_impl() call. */
+  std::vector<units::sample_u64_t> transport_positions_;
 };
 
 class PluginTest : public ::testing::Test
@@ -327,6 +359,7 @@ TEST_F (PluginTest, JsonSerializationRoundtrip)
   // Set some state
   plugin_->setProgramIndex (3);
   plugin_->setUiVisible (true);
+  plugin_->setAutoSuspend (true);
 
   // Serialize
   nlohmann::json j = *plugin_;
@@ -338,6 +371,7 @@ TEST_F (PluginTest, JsonSerializationRoundtrip)
   // Verify state
   EXPECT_EQ (deserialized.programIndex (), 3);
   EXPECT_TRUE (deserialized.uiVisible ());
+  EXPECT_TRUE (deserialized.autoSuspend ());
   EXPECT_EQ (deserialized.get_name (), u8"Test Plugin");
   EXPECT_EQ (deserialized.get_protocol (), Protocol::ProtocolType::Internal);
   EXPECT_EQ (
@@ -391,6 +425,141 @@ TEST_F (PluginTest, ProcessPassthroughImpl)
     }
 }
 
+class PluginAutoSuspendTest : public PluginTest
+{
+protected:
+  void SetUp () override
+  {
+    PluginTest::SetUp ();
+
+    auto descriptor = std::make_unique<PluginDescriptor> ();
+    descriptor->name_ = u8"Test Plugin";
+    PluginConfiguration config;
+    config.descr_ = std::move (descriptor);
+    plugin_->set_configuration (config);
+
+    auto audio_in = utils::create_object<dsp::AudioPort> (
+      *registry_, u8"Audio In", dsp::PortFlow::Input,
+      dsp::AudioPort::BusLayout::Mono, 1);
+    auto audio_out = utils::create_object<dsp::AudioPort> (
+      *registry_, u8"Audio Out", dsp::PortFlow::Output,
+      dsp::AudioPort::BusLayout::Mono, 1);
+    plugin_->add_input_port (audio_in);
+    plugin_->add_output_port (audio_out);
+    in_port_ = audio_in.get_object_as<dsp::AudioPort> ();
+  }
+
+  void prepare ()
+  {
+    plugin_->prepare_for_processing (nullptr, sample_rate_, max_block_length_);
+  }
+
+  void process_blocks (int count, float input_level)
+  {
+    for (int i = 0; i < count; ++i)
+      {
+        const auto time_nfo =
+          dsp::graph::ProcessBlockInfo::from_position_and_nframes (
+            position_, units::samples (kBlockLength));
+        for (int j = 0; j < kBlockLength; ++j)
+          in_port_->buffers ()->setSample (0, j, input_level);
+        plugin_->process_block (time_nfo, *mock_transport_, *tempo_map_);
+        position_ = time_nfo.end_position ();
+      }
+  }
+
+  static constexpr int kBlockLength = 512;
+
+  dsp::AudioPort *    in_port_{};
+  units::sample_u64_t position_{ units::samples (0) };
+};
+
+TEST_F (PluginAutoSuspendTest, DisabledByDefault)
+{
+  prepare ();
+  EXPECT_FALSE (plugin_->autoSuspend ());
+
+  process_blocks (100, 0.f);
+  EXPECT_EQ (plugin_->process_count_, 100);
+  EXPECT_FALSE (plugin_->auto_suspended ());
+}
+
+TEST_F (PluginAutoSuspendTest, SuspendsAfterSilenceAndResumes)
+{
+  QSignalSpy spy (plugin_.get (), &Plugin::autoSuspendChanged);
+  plugin_->setAutoSuspend (true);
+  EXPECT_EQ (spy.count (), 1);
+  prepare ();
+
+  // 100 blocks of 512 samples is ~1 second at 48 kHz, well past the hold time
+  process_blocks (100, 0.f);
+  EXPECT_TRUE (plugin_->auto_suspended ());
+
+  // No further processing while the input stays silent
+  const auto count = plugin_->process_count_;
+  process_blocks (10, 0.f);
+  EXPECT_EQ (plugin_->process_count_, count);
+
+  // Signal returns: a silent pre-roll pass over the preceding span, followed
+  // by the real block
+  const auto block_position = position_;
+  process_blocks (1, 0.5f);
+  EXPECT_FALSE (plugin_->auto_suspended ());
+  ASSERT_EQ (plugin_->process_count_, count + 2);
+  const auto n = plugin_->input_peaks_.size ();
+  EXPECT_FLOAT_EQ (plugin_->input_peaks_[n - 2], 0.f);
+  EXPECT_FLOAT_EQ (plugin_->input_peaks_[n - 1], 0.5f);
+  EXPECT_EQ (
+    plugin_->transport_positions_[n - 2],
+    block_position - units::samples (static_cast<uint64_t> (kBlockLength)));
+  EXPECT_EQ (plugin_->transport_positions_[n - 1], block_position);
+}
+
+TEST_F (PluginAutoSuspendTest, WaitsForReportedTail)
+{
+  plugin_->tail_seconds_ = 2.0;
+  plugin_->setAutoSuspend (true);
+  prepare ();
+
+  // ~1 second of silence: still within the tail
+  process_blocks (100, 0.f);
+  EXPECT_FALSE (plugin_->auto_suspended ());
+
+  // ~2.5 seconds total: past the tail and the hold time
+  process_blocks (150, 0.f);
+  EXPECT_TRUE (plugin_->auto_suspended ());
+}
+
+TEST_F (PluginAutoSuspendTest, NeverSuspendsWhileOutputIsAudible)
+{
+  // e.g. a tail longer than reported
+  plugin_->output_level_ = 0.1f;
+  plugin_->setAutoSuspend (true);
+  prepare ();
+
+  process_blocks (500, 0.f);
+  EXPECT_FALSE (plugin_->auto_suspended ());
+  EXPECT_EQ (plugin_->process_count_, 500);
+
+  // Once the output decays, the silence is counted from there
+  plugin_->output_level_ = 0.f;
+  process_blocks (10, 0.f);
+  EXPECT_FALSE (plugin_->auto_suspended ());
+  process_blocks (20, 0.f);
+  EXPECT_TRUE (plugin_->auto_suspended ());
+}
+
+TEST_F (PluginAutoSuspendTest, NeverSuspendsWithInfiniteTail)
+{
+  plugin_->tail_seconds_ = std::numeric_limits<double>::infinity ();
+  plugin_->setAutoSuspend (true);
+  prepare ();
+
+  process_blocks (500, 0.f);
+  EXPECT_FALSE (plugin_->auto_suspended ());
+  EXPECT_EQ (plugin_->process_count_, 500);
+}
+
 TEST_F (PluginTest, InstantiationStatusTransitions)
 {
   QSignalSpy spy (plugin_.get (), &Plugin::instantiationStatusChanged);
@@ -418,6 +587,71 @@ TEST_F (PluginTest, InstantiationStatusTransitions)
   EXPECT_EQ (spy.count (), 3);
 }
 
+TEST_F (PluginTest, DeferredInstantiationPassesThroughUntilPrepared)
+{
+  auto descriptor = std::make_unique<PluginDescriptor> ();
+  descriptor->name_ = u8"Test Plugin";
+  PluginConfiguration config;
+  config.descr_ = std::move (descriptor);
+  plugin_->set_configuration (config);
+  nlohmann::json j = *plugin_;
+
+  TestPlugin deferred (*registry_);
+  deferred.set_defer_instantiation (true);
+  QSignalSpy config_spy (&deferred, &Plugin::configurationChanged);
+  from_json (j, deferred);
+  EXPECT_EQ (
+    deferred.instantiationStatus (), Plugin::InstantiationStatus::Deferred);
+  EXPECT_EQ (deferred.get_name (), u8"Test Plugin");
+  EXPECT_EQ (config_spy.count (), 0);
+
+  const auto time_nfo =
+    dsp::graph::ProcessBlockInfo::from_position_and_nframes (
+      units::samples (0), units::samples (512));
+  deferred.prepare_for_processing (nullptr, sample_rate_, max_block_length_);
+  deferred.process_block (time_nfo, *mock_transport_, *tempo_map_);
+  EXPECT_FALSE (deferred.process_called_);
+
+  deferred.instantiate_deferred ();
+  EXPECT_EQ (
+    deferred.instantiationStatus (), Plugin::InstantiationStatus::Pending);
+  EXPECT_EQ (config_spy.count (), 1);
+
+  // Only the first call has an effect
+  deferred.instantiate_deferred ();
+  EXPECT_EQ (config_spy.count (), 1);
+
+  // Still passed through until prepared with the instance
+  deferred.trigger_instantiation_finished (true);
+  deferred.process_block (time_nfo, *mock_transport_, *tempo_map_);
+  EXPECT_FALSE (deferred.process_called_);
+
+  deferred.prepare_for_processing (nullptr, sample_rate_, max_block_length_);
+  deferred.process_block (time_nfo, *mock_transport_, *tempo_map_);
+  EXPECT_TRUE (deferred.process_called_);
+  deferred.release_resources ();
+}
+
+TEST_F (PluginTest, ShowingUiInstantiatesDeferredPlugin)
+{
+  auto descriptor = std::make_unique<PluginDescriptor> ();
+  descriptor->name_ = u8"Test Plugin";
+  PluginConfiguration config;
+  config.descr_ = std::move (descriptor);
+  plugin_->set_configuration (config);
+  nlohmann::json j = *plugin_;
+
+  TestPlugin deferred (*registry_);
+  deferred.set_defer_instantiation (true);
+  from_json (j, deferred);
+  ASSERT_EQ (
+    deferred.instantiationStatus (), Plugin::InstantiationStatus::Deferred);
+
+  deferred.setUiVisible (true);
+  EXPECT_EQ (
+    deferred.instantiationStatus (), Plugin::InstantiationStatus::Pending);
+}
+
 // ============================================================================
 // Tests for configurationChanged signal contract
 // ============================================================================
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <limits>
+#include <random>
+
+#include "dsp/tempo_map.h"
+#include "dsp/tempo_map_qml_adapter.h"
+#include "structure/arrangement/arranger_object_spatial_index.h"
+#include "structure/arrangement/midi_note.h"
+
+#include "helpers/mock_qobject.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+namespace zrythm::structure::arrangement
+{
+class ArrangerObjectSpatialIndexTest : public ::testing::Test
+{
+protected:
+  using Entry = ArrangerObjectSpatialIndex::Entry;
+
+  void SetUp () override
+  {
+    tempo_map = std::make_unique<dsp::TempoMap> (units::sample_rate (44100.0));
+    tempo_map_wrapper = std::make_unique<dsp::TempoMapWrapper> (*tempo_map);
+    parent = std::make_unique<MockQObject> ();
+  }
+
+  /**
+   * @brief Creates an object to refer to from entries.
+   */
+  const ArrangerObject * create_object ()
+  {
+    objects_.push_back (
+      std::make_unique<MidiNote> (*tempo_map_wrapper, parent.get ()));
+    return objects_.back ().get ();
+  }
+
+  std::vector<const ArrangerObject *>
+  query (double start, double end, double min_key, double max_key) const
+  {
+    std::vector<const ArrangerObject *> ret;
+    index_.query (start, end, min_key, max_key, ret);
+    return ret;
+  }
+
+  std::unique_ptr<dsp::TempoMap>         tempo_map;
+  std::unique_ptr<dsp::TempoMapWrapper>  tempo_map_wrapper;
+  std::unique_ptr<MockQObject>           parent;
+  std::vector<std::unique_ptr<MidiNote>> objects_;
+  ArrangerObjectSpatialIndex             index_;
+};
+
+TEST_F (ArrangerObjectSpatialIndexTest, EmptyIndex)
+{
+  EXPECT_EQ (index_.size (), 0);
+  EXPECT_THAT (query (0, 1000, 0, 127), IsEmpty ());
+}
+
+TEST_F (ArrangerObjectSpatialIndexTest, QueryByTimeAndKey)
+{
+  const auto * a = create_object ();
+  const auto * b = create_object ();
+  const auto * c = create_object ();
+  const auto * d = create_object ();
+  index_.rebuild ({
+    { 0, 100, 60, 60, a },
+    { 50, 150, 64, 64, b },
+    { 200, 300, 60, 60, c },
+    // Long object starting before the others
+    { -100, 1000, 72, 72, d },
+  });
+  EXPECT_EQ (index_.size (), 4);
+
+  EXPECT_THAT (query (0, 1000, 0, 127), UnorderedElementsAre (a, b, c, d));
+  EXPECT_THAT (query (120, 180, 0, 127), UnorderedElementsAre (b, d));
+  EXPECT_THAT (query (120, 180, 0, 70), UnorderedElementsAre (b));
+  EXPECT_THAT (query (400, 500, 0, 127), UnorderedElementsAre (d));
+  EXPECT_THAT (query (2000, 3000, 0, 127), IsEmpty ());
+
+  // Edges are inclusive
+  EXPECT_THAT (query (300, 300, 60, 60), UnorderedElementsAre (c));
+  EXPECT_THAT (query (-200, -100, 0, 127), UnorderedElementsAre (d));
+}
+
+TEST_F (ArrangerObjectSpatialIndexTest, UnboundedKeys)
+{
+  const auto * clip = create_object ();
+  index_.rebuild ({
+    { 0, 100, std::numeric_limits<double>::lowest (),
+      std::numeric_limits<double>::max (), clip },
+  });
+  EXPECT_THAT (query (50, 60, 10, 20), UnorderedElementsAre (clip));
+}
+
+TEST_F (ArrangerObjectSpatialIndexTest, RebuildReplacesEntries)
+{
+  const auto * a = create_object ();
+  const auto * b = create_object ();
+  index_.rebuild ({ { 0, 100, 60, 60, a } });
+  index_.rebuild ({ { 500, 600, 60, 60, b } });
+  EXPECT_EQ (index_.size (), 1);
+  EXPECT_THAT (query (0, 100, 0, 127), IsEmpty ());
+  EXPECT_THAT (query (0, 1000, 0, 127), UnorderedElementsAre (b));
+
+  index_.clear ();
+  EXPECT_EQ (index_.size (), 0);
+  EXPECT_THAT (query (0, 1000, 0, 127), IsEmpty ());
+}
+
+TEST_F (ArrangerObjectSpatialIndexTest, MatchesLinearScan)
+{
+  std::mt19937                           rng (1234);
+  std::uniform_real_distribution<double> start_dist (0, 100000);
+  std::uniform_real_distribution<double> length_dist (1, 2000);
+  std::uniform_int_distribution<int>     key_dist (0, 127);
+
+  std::vector<Entry> entries;
+  for (int i = 0; i < 2000; ++i)
+    {
+      const auto   start = start_dist (rng);
+      const double key = key_dist (rng);
+      entries.push_back (
+        { start, start + length_dist (rng), key, key, create_object () });
+    }
+  index_.rebuild (entries);
+
+  for (int i = 0; i < 100; ++i)
+    {
+      const auto   start = start_dist (rng);
+      const auto   end = start + (length_dist (rng) * 4);
+      const double min_key = key_dist (rng);
+      const double max_key = min_key + 24;
+
+      std::vector<const ArrangerObject *> expected;
+      for (const auto &entry : entries)
+        {
+          if (
+            entry.start_ticks <= end && entry.end_ticks >= start
+            && entry.max_key >= min_key && entry.min_key <= max_key)
+            {
+              expected.push_back (entry.object);
+            }
+        }
+      EXPECT_THAT (
+        query (start, end, min_key, max_key),
+        UnorderedElementsAreArray (expected));
+    }
+}
+
+} // namespace zrythm::structure::arrangement
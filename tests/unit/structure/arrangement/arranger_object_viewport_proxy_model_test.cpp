@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <memory>
+
+#include "dsp/tempo_map.h"
+#include "dsp/tempo_map_qml_adapter.h"
+#include "structure/arrangement/arranger_object_list_model.h"
+#include "structure/arrangement/arranger_object_viewport_proxy_model.h"
+#include "structure/arrangement/midi_note.h"
+#include "utils/object_registry.h"
+#include "utils/registry_utils.h"
+
+#include "helpers/mock_qobject.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+namespace zrythm::structure::arrangement
+{
+class ArrangerObjectViewportProxyModelTest : public ::testing::Test
+{
+protected:
+  void SetUp () override
+  {
+    tempo_map = std::make_unique<dsp::TempoMap> (units::sample_rate (44100.0));
+    tempo_map_wrapper = std::make_unique<dsp::TempoMapWrapper> (*tempo_map);
+    parent = std::make_unique<MockQObject> ();
+
+    // One note per 100 ticks, with pitches 60-69
+    for (int i = 0; i < 10; i++)
+      {
+        objects_.get<random_access_index> ().emplace_back (
+          create_note (i * 100.0, 60 + i));
+      }
+    model_ = std::make_unique<ArrangerObjectListModel> (objects_, parent.get ());
+    proxy_ = std::make_unique<ArrangerObjectViewportProxyModel> ();
+    proxy_->setSourceModel (model_.get ());
+  }
+
+  ArrangerObjectUuidReference create_note (double ticks, int pitch)
+  {
+    auto note_ref = utils::create_object<MidiNote> (
+      registry_, *tempo_map_wrapper, parent.get ());
+    auto * note = note_ref.get_object_as<MidiNote> ();
+    note->position ()->setTicks (ticks);
+    note->length ()->setTicks (50.0);
+    note->setPitch (pitch);
+    return note_ref;
+  }
+
+  void set_viewport (double start, double end, double min_key, double max_key)
+  {
+    proxy_->setViewportStartTicks (start);
+    proxy_->setViewportEndTicks (end);
+    proxy_->setViewportMinKey (min_key);
+    proxy_->setViewportMaxKey (max_key);
+  }
+
+  /**
+   * @brief Returns the pitches of the exposed notes.
+   */
+  std::vector<int> exposed_pitches () const
+  {
+    std::vector<int> ret;
+    for (int i = 0; i < proxy_->rowCount (); ++i)
+      {
+        ret.push_back (
+          proxy_->index (i, 0)
+            .data (ArrangerObjectListModel::ArrangerObjectPtrRole)
+            .value<MidiNote *> ()
+            ->pitch ());
+      }
+    return ret;
+  }
+
+  std::unique_ptr<dsp::TempoMap>                    tempo_map;
+  std::unique_ptr<dsp::TempoMapWrapper>             tempo_map_wrapper;
+  std::unique_ptr<MockQObject>                      parent;
+  utils::ObjectRegistry                             registry_;
+  ArrangerObjectRefMultiIndexContainer              objects_;
+  std::unique_ptr<ArrangerObjectListModel>          model_;
+  std::unique_ptr<ArrangerObjectViewportProxyModel> proxy_;
+};
+
+TEST_F (ArrangerObjectViewportProxyModelTest, ExposesAllObjectsByDefault)
+{
+  EXPECT_EQ (proxy_->rowCount (), 10);
+}
+
+TEST_F (ArrangerObjectViewportProxyModelTest, FiltersByTimeAndPitch)
+{
+  set_viewport (120, 420, 0, 127);
+  EXPECT_THAT (exposed_pitches (), ElementsAre (61, 62, 63, 64));
+
+  set_viewport (120, 420, 63, 70);
+  EXPECT_THAT (exposed_pitches (), ElementsAre (63, 64));
+
+  set_viewport (2000, 3000, 0, 127);
+  EXPECT_EQ (proxy_->rowCount (), 0);
+}
+
+TEST_F (ArrangerObjectViewportProxyModelTest, MapsToSourceRows)
+{
+  set_viewport (500, 600, 0, 127);
+  ASSERT_EQ (proxy_->rowCount (), 2);
+  EXPECT_EQ (proxy_->mapToSource (proxy_->index (0, 0)).row (), 5);
+  EXPECT_EQ (proxy_->mapToSource (proxy_->index (1, 0)).row (), 6);
+}
+
+TEST_F (ArrangerObjectViewportProxyModelTest, FiltersInsertedObjects)
+{
+  set_viewport (0, 250, 0, 127);
+  ASSERT_EQ (proxy_->rowCount (), 3);
+
+  model_->insertObject (create_note (220.0, 80), 0);
+  model_->insertObject (create_note (5000.0, 81), 0);
+  EXPECT_THAT (exposed_pitches (), UnorderedElementsAre (60, 61, 62, 80));
+
+  model_->removeRows (1, 1);
+  EXPECT_THAT (exposed_pitches (), UnorderedElementsAre (60, 61, 62));
+}
+
+TEST_F (ArrangerObjectViewportProxyModelTest, TracksMovedObjects)
+{
+  set_viewport (0, 250, 0, 127);
+  ASSERT_EQ (proxy_->rowCount (), 3);
+
+  // Move the last note into the viewport and the first note out of it
+  objects_.get<random_access_index> ()[9].get ()->position ()->setTicks (10.0);
+  objects_.get<random_access_index> ()[0].get ()->position ()->setTicks (
+    2000.0);
+
+  // Re-filtering is deferred, so the viewport change picks up the moves
+  set_viewport (0, 260, 0, 127);
+  EXPECT_THAT (exposed_pitches (), UnorderedElementsAre (61, 62, 69));
+}
+
+TEST_F (ArrangerObjectViewportProxyModelTest, KeepAcceptedObjects)
+{
+  set_viewport (0, 150, 0, 127);
+  EXPECT_THAT (exposed_pitches (), ElementsAre (60, 61));
+
+  proxy_->setKeepAcceptedObjects (true);
+  set_viewport (300, 450, 0, 127);
+  EXPECT_THAT (exposed_pitches (), ElementsAre (60, 61, 63, 64));
+
+  proxy_->setKeepAcceptedObjects (false);
+  EXPECT_THAT (exposed_pitches (), ElementsAre (63, 64));
+}
+
+} // namespace zrythm::structure::arrangement
@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <cmath>
+#include <numbers>
+
+#include "structure/arrangement/audio_function.h"
+#include "utils/exceptions.h"
+
+#include <gtest/gtest.h>
+
+namespace zrythm::structure::arrangement
+{
+
+class AudioFunctionTest : public ::testing::Test
+{
+protected:
+  static constexpr auto SAMPLE_RATE = units::sample_rate (48000);
+  static constexpr int  NUM_FRAMES = 4800;
+
+  /** Stereo ramp from 0 to 1 (left) and from 0 to -1 (right). */
+  static utils::audio::AudioBuffer make_ramp ()
+  {
+    utils::audio::AudioBuffer buf (2, NUM_FRAMES);
+    for (int i = 0; i < NUM_FRAMES; ++i)
+      {
+        const auto val = static_cast<float> (i) / NUM_FRAMES;
+        buf.setSample (0, i, val);
+        buf.setSample (1, i, -val);
+      }
+    return buf;
+  }
+
+  static utils::audio::AudioBuffer make_sine (float amplitude)
+  {
+    utils::audio::AudioBuffer buf (2, NUM_FRAMES * 10);
+    for (int ch = 0; ch < 2; ++ch)
+      {
+        for (int i = 0; i < buf.getNumSamples (); ++i)
+          {
+            buf.setSample (
+              ch, i,
+              amplitude
+                * std::sin (
+                  2.f * std::numbers::pi_v<float> * 1000.f
+                  * static_cast<float> (i) / 48000.f));
+          }
+      }
+    return buf;
+  }
+
+  static void apply (
+    AudioFunctionType          type,
+    utils::audio::AudioBuffer &buf,
+    double                     amount = 0)
+  {
+    audio_function_process (
+      type, AudioFunctionOpts{ .amount_ = amount }, buf, SAMPLE_RATE);
+  }
+};
+
+TEST_F (AudioFunctionTest, InvertAndReverse)
+{
+  auto buf = make_ramp ();
+  apply (AudioFunctionType::Invert, buf);
+  EXPECT_FLOAT_EQ (buf.getSample (0, 100), -100.f / NUM_FRAMES);
+  EXPECT_FLOAT_EQ (buf.getSample (1, 100), 100.f / NUM_FRAMES);
+
+  apply (AudioFunctionType::Reverse, buf);
+  EXPECT_FLOAT_EQ (buf.getSample (0, NUM_FRAMES - 1), 0.f);
+  EXPECT_FLOAT_EQ (buf.getSample (0, 0), -(NUM_FRAMES - 1.f) / NUM_FRAMES);
+}
+
+TEST_F (AudioFunctionTest, NormalizePeak)
+{
+  auto buf = make_ramp ();
+  buf.applyGain (0.25f);
+  apply (AudioFunctionType::NormalizePeak, buf);
+  EXPECT_NEAR (buf.getMagnitude (0, 0, NUM_FRAMES), 1.f, 1e-3f);
+}
+
+TEST_F (AudioFunctionTest, NormalizeRMS)
+{
+  // A sine's RMS is its amplitude / sqrt(2)
+  auto buf = make_sine (0.5f);
+  apply (AudioFunctionType::NormalizeRMS, buf, -20.0);
+  const auto rms = buf.getRMSLevel (0, 0, buf.getNumSamples ());
+  EXPECT_NEAR (20.f * std::log10 (rms), -20.f, 0.01f);
+}
+
+TEST_F (AudioFunctionTest, NormalizeLUFS)
+{
+  // A stereo 1 kHz sine at -20 dBFS reads -20 LUFS
+  auto buf = make_sine (0.5f);
+  apply (AudioFunctionType::NormalizeLUFS, buf, -20.0);
+  EXPECT_NEAR (buf.getMagnitude (0, 0, buf.getNumSamples ()), 0.1f, 3e-3f);
+}
+
+TEST_F (AudioFunctionTest, Fades)
+{
+  auto buf = make_ramp ();
+  apply (AudioFunctionType::LinearFadeOut, buf);
+  EXPECT_NEAR (buf.getSample (0, NUM_FRAMES - 1), 0.f, 1e-3f);
+  EXPECT_NEAR (buf.getSample (0, NUM_FRAMES / 2), 0.25f, 1e-3f);
+
+  buf = make_ramp ();
+  apply (AudioFunctionType::LinearFadeIn, buf);
+  EXPECT_FLOAT_EQ (buf.getSample (0, 0), 0.f);
+  EXPECT_NEAR (buf.getSample (0, NUM_FRAMES - 1), 1.f, 1e-3f);
+}
+
+TEST_F (AudioFunctionTest, Nudge)
+{
+  auto buf = make_ramp ();
+  apply (AudioFunctionType::NudgeRight, buf, 10);
+  EXPECT_EQ (buf.getNumSamples (), NUM_FRAMES);
+  EXPECT_FLOAT_EQ (buf.getSample (0, 9), 0.f);
+  EXPECT_FLOAT_EQ (buf.getSample (0, 20), 10.f / NUM_FRAMES);
+
+  apply (AudioFunctionType::NudgeLeft, buf, 10);
+  EXPECT_FLOAT_EQ (buf.getSample (0, 10), 10.f / NUM_FRAMES);
+  EXPECT_FLOAT_EQ (buf.getSample (0, NUM_FRAMES - 1), 0.f);
+
+  EXPECT_THROW (
+    apply (AudioFunctionType::NudgeLeft, buf, NUM_FRAMES), ZrythmException);
+}
+
+TEST_F (AudioFunctionTest, CopyLtoR)
+{
+  auto buf = make_ramp ();
+  apply (AudioFunctionType::CopyLtoR, buf);
+  EXPECT_FLOAT_EQ (buf.getSample (1, 100), buf.getSample (0, 100));
+
+  utils::audio::AudioBuffer mono (1, 16);
+  EXPECT_THROW (apply (AudioFunctionType::CopyLtoR, mono), ZrythmException);
+}
+
+TEST_F (AudioFunctionTest, PitchShiftKeepsLength)
+{
+  auto buf = make_sine (0.5f);
+  const auto num_frames = buf.getNumSamples ();
+  apply (AudioFunctionType::PitchShift, buf, 2.0);
+  EXPECT_EQ (buf.getNumSamples (), num_frames);
+  EXPECT_EQ (buf.getNumChannels (), 2);
+  EXPECT_GT (buf.getRMSLevel (0, num_frames / 4, num_frames / 2), 0.1f);
+
+  EXPECT_THROW (
+    apply (AudioFunctionType::PitchShift, buf, 0.0), ZrythmException);
+}
+
+TEST_F (AudioFunctionTest, NonBatchableTypesThrow)
+{
+  EXPECT_FALSE (audio_function_is_batchable (AudioFunctionType::CustomPlugin));
+  EXPECT_TRUE (audio_function_is_batchable (AudioFunctionType::Reverse));
+
+  auto buf = make_ramp ();
+  EXPECT_THROW (
+    apply (AudioFunctionType::ExternalProgram, buf), ZrythmException);
+}
+
+} // namespace zrythm::structure::arrangement
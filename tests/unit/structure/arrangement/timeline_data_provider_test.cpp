@@ -14,6 +14,10 @@
 #include "utils/registry_utils.h"
 #include "utils/types.h"
 
+#include <QSignalSpy>
+
+#include "helpers/scoped_qcoreapplication.h"
+
 #include "gtest/gtest.h"
 #include <juce_audio_formats/juce_audio_formats.h>
 
@@ -1030,6 +1034,48 @@ TEST_F (TimelineDataProviderTest, MultipleAudioClipsInSequence)
   EXPECT_TRUE (has_audio);
 }
 
+TEST_F (TimelineDataProviderTest, GenerateAudioEventsAsyncMatchesSync)
+{
+  test_helpers::ScopedQCoreApplication app;
+
+  auto clip1 = create_audio_clip (0.0, 100.0, 0.5f);
+  auto clip2 = create_audio_clip (50.0, 150.0, 0.7f);
+
+  std::vector<const AudioClip *> clips;
+  clips.push_back (clip1);
+  clips.push_back (clip2);
+
+  utils::ExpandableTickRange range (std::pair (0.0, 960.0));
+  audio_provider_->generate_audio_events (*tempo_map_, clips, range);
+
+  AudioTimelineDataProvider async_provider;
+  QSignalSpy                generated_spy (
+    &async_provider, &AudioTimelineDataProvider::audioEventsGenerated);
+  async_provider.generate_audio_events_async (*tempo_map_, clips, range);
+
+  // Nothing is published until the background render completes
+  EXPECT_TRUE (async_provider.has_pending_renders ());
+  EXPECT_TRUE (async_provider.audio_clips ().empty ());
+
+  ASSERT_TRUE (generated_spy.wait (5000));
+  EXPECT_FALSE (async_provider.has_pending_renders ());
+
+  const auto expected = audio_provider_->audio_clips ();
+  const auto actual = async_provider.audio_clips ();
+  ASSERT_EQ (actual.size (), expected.size ());
+  for (size_t i = 0; i < expected.size (); ++i)
+    {
+      EXPECT_EQ (actual[i].start_sample, expected[i].start_sample);
+      EXPECT_EQ (actual[i].end_sample, expected[i].end_sample);
+      const auto &a = actual[i].audio_buffer;
+      const auto &e = expected[i].audio_buffer;
+      ASSERT_EQ (a.getNumSamples (), e.getNumSamples ());
+      for (int ch = 0; ch < e.getNumChannels (); ++ch)
+        for (int j = 0; j < e.getNumSamples (); ++j)
+          EXPECT_FLOAT_EQ (a.getSample (ch, j), e.getSample (ch, j));
+    }
+}
+
 TEST_F (TimelineDataProviderTest, GenerateAudioCacheWithAffectedRange)
 {
   // Create an audio clip at tick 0
@@ -1482,6 +1528,46 @@ TEST_F (
   EXPECT_TRUE (has_automation);
 }
 
+// process_automation_events renders runs of samples in batch; its output must
+// match per-sample evaluation, including across clip boundaries, gaps and
+// latched hold regions.
+TEST_F (TimelineDataProviderTest, AutomationProviderBlockMatchesPerSampleValues)
+{
+  auto * clip1 = create_automation_clip (0.0, 200.0, 0.0f, 1.0f);
+  clip1->get_children_view ()[0]->curveOpts ()->setCurviness (0.6);
+  auto * clip2 = create_automation_clip (400.0, 700.0, 1.0f, 0.2f);
+  clip2->get_children_view ()[0]->curveOpts ()->setAlgorithm (
+    dsp::CurveOptions::Algorithm::SuperEllipse);
+  clip2->get_children_view ()[0]->curveOpts ()->setCurviness (-0.4);
+
+  std::vector<const AutomationClip *> clips{ clip1, clip2 };
+  utils::ExpandableTickRange          range (std::pair (0.0, 1920.0));
+  automation_provider_->generate_automation_events (*tempo_map_, clips, range);
+
+  const auto end_sample = tempo_map_->tick_to_samples_rounded (
+    dsp::TimelineTick{ units::ticks (960.0) });
+  const auto total = static_cast<size_t> (end_sample.in (units::samples));
+  constexpr size_t block_size = 256;
+
+  std::vector<float> block (block_size);
+  for (size_t start = 0; start < total; start += block_size)
+    {
+      auto time_info = dsp::graph::ProcessBlockInfo::from_position_and_nframes (
+        units::samples (static_cast<int64_t> (start)),
+        units::samples (static_cast<int64_t> (block_size)));
+      automation_provider_->process_automation_events (
+        time_info, dsp::ITransport::PlayState::Rolling, block);
+
+      for (size_t i = 0; i < block_size; ++i)
+        {
+          const auto expected = automation_provider_->get_automation_value_rt (
+            units::samples (static_cast<int64_t> (start + i)));
+          EXPECT_NEAR (block[i], expected.value_or (-1.f), 1e-4f)
+            << "at sample " << (start + i);
+        }
+    }
+}
+
 TEST_F (TimelineDataProviderTest, AutomationProviderGetValueAtSpecificPosition)
 {
   // Create an automation clip with linear ramp from 0.0 to 1.0
@@ -20,6 +20,7 @@
 #include "../../dsp/graph_helpers.h"
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
 
 namespace zrythm::structure::tracks
 {
@@ -523,6 +524,143 @@ TEST_F (ChannelSubgraphBuilderTest, AddConnectionsWithAudioPlugins)
     audio_channel_->get_fader (), audio_channel_->get_audio_post_fader ());
 }
 
+TEST_F (ChannelSubgraphBuilderTest, AddConnectionsWithParallelGroup)
+{
+  audio_channel_ = createAudioChannel ();
+  ASSERT_NE (audio_channel_, nullptr);
+
+  // [pre] -> ([layer1] | [layer2]) -> [post]
+  auto pre = createMockPlugin (dsp::PortType::Audio, dsp::PortType::Audio);
+  auto layer1 = createMockPlugin (dsp::PortType::Audio, dsp::PortType::Audio);
+  auto layer2 = createMockPlugin (dsp::PortType::Audio, dsp::PortType::Audio);
+  auto post = createMockPlugin (dsp::PortType::Audio, dsp::PortType::Audio);
+  audio_channel_->inserts ()->append_plugin (pre);
+  auto * rack = audio_channel_->inserts ()->insert_group (
+    utils::make_qobject_unique<plugins::PluginGroup> (
+      *registry_, plugins::PluginGroup::DeviceGroupType::Audio,
+      plugins::PluginGroup::ProcessingTypeHint::Parallel));
+  rack->append_plugin (layer1);
+  rack->append_plugin (layer2);
+  audio_channel_->inserts ()->append_plugin (post);
+
+  ChannelSubgraphBuilder::add_nodes (graph_, *audio_channel_);
+  EXPECT_NE (findNodeForProcessable (rack->fader ()), nullptr);
+
+  auto track_processor = createMockTrackProcessor (dsp::PortType::Audio, 2);
+  auto track_output = getProcessorOutputPort (*track_processor);
+  addTrackProcessorToGraph (*track_processor);
+
+  EXPECT_NO_THROW ({
+    ChannelSubgraphBuilder::add_connections (
+      graph_, *audio_channel_, track_output);
+  });
+
+  // Each layer is fed by the previous plugin and summed into the rack's fader
+  verifyProcessorsConnected (*track_processor, *pre.get ());
+  verifyProcessorsConnected (*pre.get (), *layer1.get ());
+  verifyProcessorsConnected (*pre.get (), *layer2.get ());
+  verifyProcessorsConnected (*layer1.get (), rack->fader ());
+  verifyProcessorsConnected (*layer2.get (), rack->fader ());
+  verifyProcessorsConnected (rack->fader (), *post.get ());
+  verifyProcessorsConnected (
+    *post.get (), audio_channel_->get_audio_pre_fader ());
+
+  // The layers don't depend on each other
+  for (const auto &out_ref : layer1.get ()->get_output_ports ())
+    {
+      for (const auto &in_ref : layer2.get ()->get_input_ports ())
+        {
+          EXPECT_FALSE (hasConnection (*out_ref.get (), *in_ref.get ()));
+        }
+    }
+  for (const auto &out_ref : layer2.get ()->get_output_ports ())
+    {
+      for (const auto &in_ref : layer1.get ()->get_input_ports ())
+        {
+          EXPECT_FALSE (hasConnection (*out_ref.get (), *in_ref.get ()));
+        }
+    }
+}
+
+TEST_F (ChannelSubgraphBuilderTest, NestedGroupTopologySurvivesJsonRoundtrip)
+{
+  // [pre] -> ([layer1] -> [layer2]) -> [post]
+  auto original = createAudioChannel ();
+  auto pre = createMockPlugin (dsp::PortType::Audio, dsp::PortType::Audio);
+  auto layer1 = createMockPlugin (dsp::PortType::Audio, dsp::PortType::Audio);
+  auto layer2 = createMockPlugin (dsp::PortType::Audio, dsp::PortType::Audio);
+  auto post = createMockPlugin (dsp::PortType::Audio, dsp::PortType::Audio);
+  original->inserts ()->append_plugin (pre);
+  auto * serial_layer = original->inserts ()->insert_group (
+    utils::make_qobject_unique<plugins::PluginGroup> (
+      *registry_, plugins::PluginGroup::DeviceGroupType::Audio,
+      plugins::PluginGroup::ProcessingTypeHint::Serial));
+  serial_layer->append_plugin (layer1);
+  serial_layer->append_plugin (layer2);
+  original->inserts ()->append_plugin (post);
+
+  nlohmann::json j = *original->inserts ();
+  audio_channel_ = createAudioChannel ();
+  from_json (j, *audio_channel_->inserts ());
+  original.reset ();
+
+  const auto elements = audio_channel_->inserts ()->elements ();
+  ASSERT_EQ (elements.size (), 3);
+  ASSERT_TRUE (std::holds_alternative<plugins::PluginGroup *> (elements[1]));
+  auto * layer = std::get<plugins::PluginGroup *> (elements[1]);
+
+  ChannelSubgraphBuilder::add_nodes (graph_, *audio_channel_);
+  auto track_processor = createMockTrackProcessor (dsp::PortType::Audio, 2);
+  auto track_output = getProcessorOutputPort (*track_processor);
+  addTrackProcessorToGraph (*track_processor);
+  ChannelSubgraphBuilder::add_connections (
+    graph_, *audio_channel_, track_output);
+
+  // Still a chain: no summing fader and no parallel branches
+  EXPECT_EQ (findNodeForProcessable (layer->fader ()), nullptr);
+  verifyProcessorsConnected (*track_processor, *pre.get ());
+  verifyProcessorsConnected (*pre.get (), *layer1.get ());
+  verifyProcessorsConnected (*layer1.get (), *layer2.get ());
+  verifyProcessorsConnected (*layer2.get (), *post.get ());
+  verifyProcessorsConnected (
+    *post.get (), audio_channel_->get_audio_pre_fader ());
+  for (const auto &out_ref : pre.get ()->get_output_ports ())
+    {
+      for (const auto &in_ref : layer2.get ()->get_input_ports ())
+        {
+          EXPECT_FALSE (hasConnection (*out_ref.get (), *in_ref.get ()));
+        }
+    }
+}
+
+TEST_F (ChannelSubgraphBuilderTest, AddConnectionsWithoutPlugins)
+{
+  audio_channel_ = createAudioChannel ();
+  ASSERT_NE (audio_channel_, nullptr);
+
+  // Plugins are left out (e.g., for frozen tracks)
+  auto plugin_ref =
+    createMockPlugin (dsp::PortType::Audio, dsp::PortType::Audio, 2, 2);
+  audio_channel_->inserts ()->append_plugin (plugin_ref);
+  ChannelSubgraphBuilder::add_nodes (graph_, *audio_channel_, false);
+  EXPECT_EQ (findNodeForProcessable (*plugin_ref.get ()), nullptr);
+
+  auto track_processor = createMockTrackProcessor (dsp::PortType::Audio, 2);
+  addTrackProcessorToGraph (*track_processor);
+
+  EXPECT_NO_THROW ({
+    ChannelSubgraphBuilder::add_connections (
+      graph_, *audio_channel_, getProcessorOutputPort (*track_processor),
+      false);
+  });
+
+  // The output goes straight to the pre-fader
+  verifyProcessorsConnected (
+    *track_processor, audio_channel_->get_audio_pre_fader ());
+  verifyProcessorsConnected (
+    audio_channel_->get_audio_pre_fader (), audio_channel_->get_fader ());
+}
+
 TEST_F (ChannelSubgraphBuilderTest, AddConnectionsWithMidiPlugins)
 {
   midi_channel_ = createMidiChannel ();
@@ -98,6 +98,22 @@ TEST_F (PlaybackCacheActivityTrackerTest, PendingFollowsScheduler)
   EXPECT_GE (pending_spy.count (), 2);
 }
 
+TEST_F (PlaybackCacheActivityTrackerTest, StaysPendingWhileRendering)
+{
+  auto tracker = make_tracker ();
+
+  scheduler_->queueCacheRequestForRange (10.0, 20.0);
+  tracker.setRenderPending (true);
+
+  // Scheduler fires, but the background render is still running
+  QTest::qWait (kWaitTime);
+  EXPECT_FALSE (scheduler_->isPending ());
+  EXPECT_TRUE (tracker.isPending ());
+
+  tracker.setRenderPending (false);
+  EXPECT_FALSE (tracker.isPending ());
+}
+
 // ========================================================================
 // Entry creation
 // ========================================================================
@@ -3,6 +3,7 @@
 
 #include "dsp/timebase.h"
 #include "structure/tracks/track.h"
+#include "utils/registry_utils.h"
 
 #include <QSignalSpy>
 
@@ -394,4 +395,37 @@ TEST_F (TrackTest, TimebaseProviderEmitsOnSet)
     track->timebaseProvider ()->effectiveTimebase (), dsp::Timebase::Absolute);
 }
 
+TEST_F (TrackTest, SetFrozenAudio)
+{
+  auto track = createMockTrack (Track::Type::Audio);
+  ASSERT_TRUE (track->can_freeze ());
+  EXPECT_FALSE (track->frozen ());
+  EXPECT_EQ (track->frozen_audio_player (), nullptr);
+
+  utils::audio::AudioBuffer buf (2, 256);
+  buf.clear ();
+  auto source = utils::create_object<dsp::FileAudioSource> (
+    *mock_track_factory_.registry_, buf, utils::audio::BitDepth::BIT_DEPTH_32,
+    units::sample_rate (48000), units::bpm (120.0), u8"Frozen");
+
+  QSignalSpy spy (track.get (), &Track::frozenChanged);
+  track->set_frozen_audio (source);
+  EXPECT_TRUE (track->frozen ());
+  EXPECT_NE (track->frozen_audio_player (), nullptr);
+  ASSERT_EQ (spy.count (), 1);
+  EXPECT_TRUE (spy.takeFirst ().front ().toBool ());
+
+  track->set_frozen_audio (std::nullopt);
+  EXPECT_FALSE (track->frozen ());
+  EXPECT_EQ (track->frozen_audio_player (), nullptr);
+  ASSERT_EQ (spy.count (), 1);
+  EXPECT_FALSE (spy.takeFirst ().front ().toBool ());
+
+  // MIDI channels have no audio to freeze
+  auto midi_track = createMockTrack (
+    Track::Type::Midi, dsp::PortType::Midi, dsp::PortType::Midi);
+  EXPECT_FALSE (midi_track->can_freeze ());
+  EXPECT_THROW (midi_track->set_frozen_audio (source), ZrythmException);
+}
+
 } // namespace zrythm::structure::tracks
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <array>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "utils/bounded_mpmc_queue.h"
+
+#include <gtest/gtest.h>
+
+namespace zrythm::utils
+{
+
+TEST (BoundedMPMCQueueTest, BasicOperations)
+{
+  BoundedMPMCQueue<int> queue (8);
+
+  int value{};
+  EXPECT_FALSE (queue.pop_front (value));
+  EXPECT_TRUE (queue.push_back (42));
+  EXPECT_TRUE (queue.push_back (43));
+  EXPECT_EQ (queue.size_approx (), 2);
+  EXPECT_TRUE (queue.pop_front (value));
+  EXPECT_EQ (value, 42);
+  EXPECT_TRUE (queue.pop_front (value));
+  EXPECT_EQ (value, 43);
+  EXPECT_FALSE (queue.pop_front (value));
+}
+
+TEST (BoundedMPMCQueueTest, CapacityIsRoundedToPowerOfTwo)
+{
+  BoundedMPMCQueue<int> queue (5);
+  EXPECT_EQ (queue.capacity (), 8);
+
+  for (int i = 0; i < 8; i++)
+    {
+      EXPECT_TRUE (queue.push_back (i));
+    }
+  EXPECT_FALSE (queue.push_back (42));
+
+  // Shrinking is a no-op
+  queue.reserve (2);
+  EXPECT_EQ (queue.capacity (), 8);
+  EXPECT_EQ (queue.size_approx (), 8);
+
+  queue.reserve (16);
+  EXPECT_EQ (queue.capacity (), 16);
+  EXPECT_EQ (queue.size_approx (), 0);
+}
+
+TEST (BoundedMPMCQueueTest, WrapsAround)
+{
+  BoundedMPMCQueue<int> queue (4);
+  for (int i = 0; i < 100; i++)
+    {
+      ASSERT_TRUE (queue.push_back (i));
+      int value{};
+      ASSERT_TRUE (queue.pop_front (value));
+      EXPECT_EQ (value, i);
+    }
+}
+
+TEST (BoundedMPMCQueueTest, BulkOperations)
+{
+  BoundedMPMCQueue<int> queue (8);
+
+  std::array<int, 6> values{};
+  std::iota (values.begin (), values.end (), 0);
+  EXPECT_EQ (queue.push_back_bulk (values), 6);
+
+  // Only 2 slots left
+  EXPECT_EQ (queue.push_back_bulk (values), 2);
+  EXPECT_EQ (queue.push_back_bulk (values), 0);
+
+  std::array<int, 5> out{};
+  EXPECT_EQ (queue.pop_front_bulk (out), 5);
+  EXPECT_EQ (out, (std::array{ 0, 1, 2, 3, 4 }));
+  EXPECT_EQ (queue.pop_front_bulk (out), 3);
+  EXPECT_EQ (out[0], 5);
+  EXPECT_EQ (out[1], 0);
+  EXPECT_EQ (out[2], 1);
+  EXPECT_EQ (queue.pop_front_bulk (out), 0);
+}
+
+TEST (BoundedMPMCQueueTest, Clear)
+{
+  BoundedMPMCQueue<int> queue (8);
+  for (int i = 0; i < 4; i++)
+    {
+      queue.push_back (i);
+    }
+
+  queue.clear ();
+
+  int value{};
+  EXPECT_FALSE (queue.pop_front (value));
+  EXPECT_EQ (queue.size_approx (), 0);
+}
+
+TEST (BoundedMPMCQueueTest, MultiThreaded)
+{
+  BoundedMPMCQueue<int> queue (64);
+  constexpr int         num_producers = 4;
+  constexpr int         num_consumers = 4;
+  constexpr int         items_per_producer = 10000;
+  constexpr int         batch_size = 4;
+
+  std::atomic<int64_t> sum{ 0 };
+  std::atomic<int>     count{ 0 };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_producers; i++)
+    {
+      threads.emplace_back ([&queue, i] () {
+        std::array<int, batch_size> batch{};
+        for (int j = 0; j < items_per_producer; j += batch_size)
+          {
+            for (int k = 0; k < batch_size; ++k)
+              {
+                batch[k] = (i * items_per_producer) + j + k;
+              }
+            std::span<const int> remaining (batch);
+            while (!remaining.empty ())
+              {
+                remaining =
+                  remaining.subspan (queue.push_back_bulk (remaining));
+                std::this_thread::yield ();
+              }
+          }
+      });
+    }
+  for (int i = 0; i < num_consumers; i++)
+    {
+      threads.emplace_back ([&] () {
+        std::array<int, batch_size> batch{};
+        while (count < num_producers * items_per_producer)
+          {
+            const auto num_popped = queue.pop_front_bulk (batch);
+            for (size_t k = 0; k < num_popped; ++k)
+              {
+                sum += batch[k];
+              }
+            count += static_cast<int> (num_popped);
+            if (num_popped == 0)
+              std::this_thread::yield ();
+          }
+      });
+    }
+
+  for (auto &thread : threads)
+    {
+      thread.join ();
+    }
+
+  constexpr int64_t total = num_producers * items_per_producer;
+  EXPECT_EQ (count, total);
+  EXPECT_EQ (sum, total * (total - 1) / 2);
+}
+
+} // namespace zrythm::utils
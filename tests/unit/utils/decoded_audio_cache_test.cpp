@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include "utils/decoded_audio_cache.h"
+#include "utils/io_utils.h"
+#include "utils/utf8_string.h"
+
+#include <gtest/gtest.h>
+
+namespace zrythm::utils::audio
+{
+
+class DecodedAudioCacheTest : public ::testing::Test
+{
+protected:
+  static constexpr int  NUM_FRAMES = 1000;
+  static constexpr auto MAX_SIZE = DecodedAudioCache::DEFAULT_MAX_SIZE_BYTES;
+
+  void SetUp () override
+  {
+    temp_dir_ = utils::io::make_tmp_dir ();
+    cache_dir_ = Utf8String::from_qstring (temp_dir_->path ()).to_path ();
+    key_ = DecodedAudioCache (cache_dir_, MAX_SIZE)
+             .key_for (TEST_WAV_FILE_PATH, units::sample_rate (48000));
+  }
+
+  static AudioBuffer make_buffer (float offset)
+  {
+    AudioBuffer buf (2, NUM_FRAMES);
+    for (int ch = 0; ch < 2; ++ch)
+      {
+        for (int i = 0; i < NUM_FRAMES; ++i)
+          {
+            buf.setSample (
+              ch, i, offset + (static_cast<float> (ch * i) * 1e-4f));
+          }
+      }
+    return buf;
+  }
+
+  std::vector<std::filesystem::path> entries () const
+  {
+    std::vector<std::filesystem::path> ret;
+    for (const auto &file : std::filesystem::directory_iterator (cache_dir_))
+      {
+        if (file.path ().extension () == ".pcm")
+          ret.push_back (file.path ());
+      }
+    return ret;
+  }
+
+  std::unique_ptr<QTemporaryDir> temp_dir_;
+  std::filesystem::path          cache_dir_;
+  DecodedAudioCache::Key         key_;
+};
+
+TEST_F (DecodedAudioCacheTest, StoredFramesCanBeMapped)
+{
+  DecodedAudioCache cache (cache_dir_, MAX_SIZE);
+  EXPECT_EQ (cache.map (key_), nullptr);
+
+  const auto frames = make_buffer (0.1f);
+  cache.store (key_, frames);
+
+  const auto entry = cache.map (key_);
+  ASSERT_NE (entry, nullptr);
+  EXPECT_EQ (entry->num_channels (), 2);
+  EXPECT_EQ (entry->num_frames (), NUM_FRAMES);
+
+  AudioBuffer mapped;
+  entry->refer_to (mapped);
+  for (int ch = 0; ch < 2; ++ch)
+    {
+      for (int i = 0; i < NUM_FRAMES; ++i)
+        ASSERT_FLOAT_EQ (mapped.getSample (ch, i), frames.getSample (ch, i));
+    }
+}
+
+TEST_F (DecodedAudioCacheTest, EditsToMappedFramesStayPrivate)
+{
+  DecodedAudioCache cache (cache_dir_, MAX_SIZE);
+  cache.store (key_, make_buffer (0.1f));
+
+  {
+    const auto  entry = cache.map (key_);
+    AudioBuffer mapped;
+    entry->refer_to (mapped);
+    mapped.applyGain (0.f);
+    EXPECT_FLOAT_EQ (mapped.getSample (1, 10), 0.f);
+  }
+
+  const auto  entry = cache.map (key_);
+  AudioBuffer mapped;
+  entry->refer_to (mapped);
+  EXPECT_FLOAT_EQ (mapped.getSample (1, 10), 0.101f);
+}
+
+TEST_F (DecodedAudioCacheTest, SampleRateIsPartOfTheKey)
+{
+  DecodedAudioCache cache (cache_dir_, MAX_SIZE);
+  cache.store (key_, make_buffer (0.1f));
+
+  auto other_key = key_;
+  other_key.sample_rate = units::sample_rate (44100);
+  EXPECT_EQ (cache.map (other_key), nullptr);
+  EXPECT_NE (cache.map (key_), nullptr);
+}
+
+TEST_F (DecodedAudioCacheTest, CorruptEntryIsRemoved)
+{
+  DecodedAudioCache cache (cache_dir_, MAX_SIZE);
+  cache.store (key_, make_buffer (0.1f));
+  ASSERT_EQ (entries ().size (), 1u);
+
+  // Truncate the frames
+  std::filesystem::resize_file (entries ().front (), 100);
+
+  EXPECT_EQ (cache.map (key_), nullptr);
+  EXPECT_TRUE (entries ().empty ());
+}
+
+TEST_F (DecodedAudioCacheTest, EvictsLeastRecentlyUsedEntries)
+{
+  // Room for 2 entries
+  constexpr auto entry_size = 64 + (2 * NUM_FRAMES * sizeof (float));
+  DecodedAudioCache cache (cache_dir_, entry_size * 2);
+
+  auto key_for_rate = [this] (int rate) {
+    auto key = key_;
+    key.sample_rate = units::sample_rate (rate);
+    return key;
+  };
+  const auto first = key_for_rate (44100);
+  const auto second = key_for_rate (48000);
+  const auto third = key_for_rate (96000);
+
+  cache.store (first, make_buffer (0.1f));
+  cache.store (second, make_buffer (0.2f));
+
+  // Make the second entry the least recently used one
+  for (const auto &path : entries ())
+    {
+      if (path.filename ().string ().ends_with ("-48000.pcm"))
+        {
+          std::filesystem::last_write_time (
+            path, std::filesystem::file_time_type::clock::now ()
+                    - std::chrono::hours (1));
+        }
+    }
+
+  cache.store (third, make_buffer (0.3f));
+  EXPECT_LE (cache.size_bytes (), entry_size * 2);
+  EXPECT_NE (cache.map (first), nullptr);
+  EXPECT_EQ (cache.map (second), nullptr);
+  EXPECT_NE (cache.map (third), nullptr);
+}
+
+TEST_F (DecodedAudioCacheTest, KeyDoesNotRequireReadingUnchangedFiles)
+{
+  DecodedAudioCache cache (cache_dir_, MAX_SIZE);
+  const auto        source = cache_dir_ / "source.wav";
+  std::filesystem::copy_file (TEST_WAV_FILE_PATH, source);
+  const auto rate = units::sample_rate (48000);
+  const auto key = cache.key_for (source, rate);
+  EXPECT_EQ (key.file_hash, key_.file_hash);
+
+  // Overwrite a byte without changing the size or modification time: the
+  // known hash is used
+  const auto mtime = std::filesystem::last_write_time (source);
+  {
+    std::fstream file (source, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg (-1, std::ios::end);
+    const auto last = static_cast<char> (file.get ());
+    file.seekp (-1, std::ios::end);
+    file.put (static_cast<char> (~last));
+  }
+  std::filesystem::last_write_time (source, mtime);
+  EXPECT_EQ (cache.key_for (source, rate).file_hash, key.file_hash);
+
+  // Modified files are hashed again
+  std::filesystem::last_write_time (source, mtime + std::chrono::seconds (1));
+  const auto modified_key = cache.key_for (source, rate);
+  EXPECT_EQ (modified_key.file_hash, hash::get_file_hash (source));
+  EXPECT_NE (modified_key.file_hash, key.file_hash);
+}
+
+} // namespace zrythm::utils::audio
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include "utils/exceptions.h"
+#include "utils/file_hash_index.h"
+#include "utils/io_utils.h"
+#include "utils/utf8_string.h"
+
+#include <gtest/gtest.h>
+
+namespace zrythm::utils::hash
+{
+
+class FileHashIndexTest : public ::testing::Test
+{
+protected:
+  void SetUp () override
+  {
+    temp_dir_ = utils::io::make_tmp_dir ();
+    dir_ = Utf8String::from_qstring (temp_dir_->path ()).to_path ();
+    index_file_ = dir_ / "index" / "hashes";
+    file_ = dir_ / "file.bin";
+    write_file ("first");
+  }
+
+  void write_file (std::string_view contents)
+  {
+    std::ofstream (file_, std::ios::binary | std::ios::trunc) << contents;
+  }
+
+  std::unique_ptr<QTemporaryDir> temp_dir_;
+  std::filesystem::path          dir_;
+  std::filesystem::path          index_file_;
+  std::filesystem::path          file_;
+};
+
+TEST_F (FileHashIndexTest, ReturnsContentHash)
+{
+  FileHashIndex index (index_file_);
+  EXPECT_EQ (index.get_file_hash (file_), get_file_hash (file_));
+  EXPECT_EQ (index.get_file_hash (file_), get_file_hash (file_));
+  EXPECT_EQ (index.size (), 1u);
+  EXPECT_TRUE (std::filesystem::exists (index_file_));
+}
+
+TEST_F (FileHashIndexTest, UnchangedFilesAreNotReadAgain)
+{
+  FileHashIndex index (index_file_);
+  const auto    first_hash = index.get_file_hash (file_);
+  const auto    mtime = std::filesystem::last_write_time (file_);
+
+  // Same size and modification time: the recorded hash is trusted
+  write_file ("other");
+  std::filesystem::last_write_time (file_, mtime);
+  EXPECT_EQ (index.get_file_hash (file_), first_hash);
+
+  // Once the modification time changes the file is hashed again
+  std::filesystem::last_write_time (file_, mtime + std::chrono::seconds (1));
+  EXPECT_EQ (index.get_file_hash (file_), get_file_hash (file_));
+  EXPECT_NE (index.get_file_hash (file_), first_hash);
+}
+
+TEST_F (FileHashIndexTest, RecordsArePersisted)
+{
+  HashT hash{};
+  {
+    FileHashIndex index (index_file_);
+    hash = index.get_file_hash (file_);
+  }
+
+  // The reloaded index trusts the record without reading the file
+  const auto mtime = std::filesystem::last_write_time (file_);
+  write_file ("other");
+  std::filesystem::last_write_time (file_, mtime);
+
+  FileHashIndex reloaded (index_file_);
+  EXPECT_EQ (reloaded.size (), 1u);
+  EXPECT_EQ (reloaded.get_file_hash (file_), hash);
+}
+
+TEST_F (FileHashIndexTest, MissingFileThrows)
+{
+  FileHashIndex index (index_file_);
+  EXPECT_THROW (
+    index.get_file_hash (dir_ / "missing.bin"),
+    utils::exceptions::ZrythmException);
+  EXPECT_EQ (index.size (), 0u);
+}
+
+} // namespace zrythm::utils::hash
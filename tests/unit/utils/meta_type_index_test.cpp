@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include "utils/meta_type_index.h"
+#include "utils/object_registry.h"
+#include "utils/qt.h"
+
+#include "./test_uuid_identifiable_qobjects.h"
+#include <gtest/gtest.h>
+
+namespace zrythm::utils
+{
+
+TEST (MetaTypeIndexTest, EmptyIndexVisitsNothing)
+{
+  MetaTypeIndex index;
+  int           visits = 0;
+  index.for_each_matching (BaseTestObject::staticMetaObject, [&] (auto &) {
+    ++visits;
+  });
+  EXPECT_EQ (visits, 0);
+  EXPECT_EQ (index.count_matching (BaseTestObject::staticMetaObject), 0u);
+}
+
+TEST (MetaTypeIndexTest, MatchesExactAndDerivedTypes)
+{
+  BaseTestObject    base1;
+  BaseTestObject    base2;
+  DerivedTestObject derived (TestUuid{ QUuid::createUuid () }, "derived");
+
+  MetaTypeIndex index;
+  index.insert (base1);
+  index.insert (base2);
+  index.insert (derived);
+
+  EXPECT_EQ (index.count_matching (BaseTestObject::staticMetaObject), 3u);
+  EXPECT_EQ (index.count_matching (DerivedTestObject::staticMetaObject), 1u);
+  EXPECT_EQ (
+    index.count_matching (UuidIdentifiableBase::staticMetaObject), 3u);
+
+  std::vector<UuidIdentifiableBase *> visited;
+  index.for_each_matching (
+    DerivedTestObject::staticMetaObject,
+    [&] (UuidIdentifiableBase &obj) { visited.push_back (&obj); });
+  ASSERT_EQ (visited.size (), 1u);
+  EXPECT_EQ (visited.front (), &derived);
+}
+
+TEST (MetaTypeIndexTest, EraseRemovesFromBucket)
+{
+  BaseTestObject    base;
+  DerivedTestObject derived (TestUuid{ QUuid::createUuid () }, "derived");
+
+  MetaTypeIndex index;
+  index.insert (base);
+  index.insert (derived);
+  index.erase (derived);
+
+  EXPECT_EQ (index.count_matching (BaseTestObject::staticMetaObject), 1u);
+  EXPECT_EQ (index.count_matching (DerivedTestObject::staticMetaObject), 0u);
+
+  // Erasing an object that was never inserted is a no-op
+  index.erase (derived);
+  EXPECT_EQ (index.count_matching (BaseTestObject::staticMetaObject), 1u);
+}
+
+TEST (MetaTypeIndexTest, ClearRemovesEverything)
+{
+  BaseTestObject base;
+  MetaTypeIndex  index;
+  index.insert (base);
+  index.clear ();
+  EXPECT_EQ (index.count_matching (BaseTestObject::staticMetaObject), 0u);
+}
+
+TEST (MetaTypeIndexTest, ObjectRegistryKeepsIndexInSync)
+{
+  ObjectRegistry registry;
+
+  auto base = make_qobject_unique<BaseTestObject> ();
+  auto derived = make_qobject_unique<DerivedTestObject> (
+    TestUuid{ QUuid::createUuid () }, "derived");
+  const auto derived_id = derived->raw_uuid ();
+  registry.register_object (*base);
+  registry.register_object (*derived);
+  base.release ();
+  derived.release ();
+
+  EXPECT_EQ (registry.count_matching<BaseTestObject> (), 2u);
+  EXPECT_EQ (registry.count_matching<DerivedTestObject> (), 1u);
+
+  registry.acquire_reference (derived_id);
+  registry.release_reference (derived_id);
+
+  EXPECT_FALSE (registry.contains (derived_id));
+  EXPECT_EQ (registry.count_matching<BaseTestObject> (), 1u);
+  EXPECT_EQ (registry.count_matching<DerivedTestObject> (), 0u);
+}
+
+} // namespace zrythm::utils
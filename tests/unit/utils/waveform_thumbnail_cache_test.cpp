@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: © 2026 Alexandros Theodotou <alex@zrythm.org>
+// SPDX-License-Identifier: LicenseRef-ZrythmLicense
+
+#include <filesystem>
+
+#include "utils/audio_file.h"
+#include "utils/io_utils.h"
+#include "utils/utf8_string.h"
+#include "utils/waveform_thumbnail_cache.h"
+
+#include <gtest/gtest.h>
+
+namespace zrythm::utils::audio
+{
+
+class WaveformThumbnailCacheTest : public ::testing::Test
+{
+protected:
+  static constexpr auto MAX_SIZE =
+    WaveformThumbnailCache::DEFAULT_MAX_SIZE_BYTES;
+
+  void SetUp () override
+  {
+    temp_dir_ = utils::io::make_tmp_dir ();
+    cache_dir_ = Utf8String::from_qstring (temp_dir_->path ()).to_path ();
+  }
+
+  std::vector<std::filesystem::path> entries () const
+  {
+    std::vector<std::filesystem::path> ret;
+    for (const auto &file : std::filesystem::directory_iterator (cache_dir_))
+      {
+        if (file.path ().extension () == ".peaks")
+          ret.push_back (file.path ());
+      }
+    return ret;
+  }
+
+  std::unique_ptr<QTemporaryDir> temp_dir_;
+  std::filesystem::path          cache_dir_;
+};
+
+TEST_F (WaveformThumbnailCacheTest, PeaksAreMaximumAbsoluteValuePerBucket)
+{
+  AudioBuffer frames (2, 8);
+  frames.clear ();
+  frames.setSample (0, 1, -0.5f);
+  frames.setSample (0, 6, 0.25f);
+  frames.setSample (1, 3, 0.75f);
+
+  const auto thumbnail = WaveformThumbnail::from_frames (frames, 48000, 4);
+  EXPECT_EQ (thumbnail.num_channels (), 2);
+  EXPECT_EQ (thumbnail.num_frames, 8);
+  EXPECT_DOUBLE_EQ (thumbnail.duration_seconds (), 8.0 / 48000.0);
+  EXPECT_EQ (
+    thumbnail.peaks[0], (std::vector<float>{ 0.5f, 0.f, 0.f, 0.25f }));
+  EXPECT_EQ (
+    thumbnail.peaks[1], (std::vector<float>{ 0.f, 0.75f, 0.f, 0.f }));
+  EXPECT_EQ (
+    thumbnail.mixed_peaks (), (std::vector<float>{ 0.5f, 0.75f, 0.f, 0.25f }));
+}
+
+TEST_F (WaveformThumbnailCacheTest, ShortBuffersHaveOnePeakPerFrame)
+{
+  AudioBuffer frames (1, 3);
+  frames.clear ();
+  const auto thumbnail = WaveformThumbnail::from_frames (frames, 48000, 256);
+  EXPECT_EQ (thumbnail.peaks[0].size (), 3u);
+}
+
+TEST_F (WaveformThumbnailCacheTest, FileThumbnailMatchesDecodedFrames)
+{
+  AudioFile   file (TEST_WAV_FILE_PATH);
+  AudioBuffer frames;
+  file.read_full (frames, std::nullopt);
+  const auto metadata = file.read_metadata ();
+
+  const auto expected =
+    WaveformThumbnail::from_frames (frames, metadata.samplerate);
+  const auto thumbnail = WaveformThumbnail::from_file (TEST_WAV_FILE_PATH);
+  EXPECT_EQ (thumbnail.sample_rate, expected.sample_rate);
+  EXPECT_EQ (thumbnail.num_frames, expected.num_frames);
+  ASSERT_EQ (thumbnail.num_channels (), expected.num_channels ());
+  for (int ch = 0; ch < thumbnail.num_channels (); ++ch)
+    {
+      const auto &peaks = thumbnail.peaks[ch];
+      ASSERT_EQ (peaks.size (), expected.peaks[ch].size ());
+      for (size_t i = 0; i < peaks.size (); ++i)
+        EXPECT_NEAR (peaks[i], expected.peaks[ch][i], 1e-6f);
+    }
+}
+
+TEST_F (WaveformThumbnailCacheTest, StoredThumbnailCanBeLoaded)
+{
+  WaveformThumbnailCache cache (cache_dir_, MAX_SIZE);
+  constexpr hash::HashT  file_hash = 1234;
+  EXPECT_FALSE (cache.load (file_hash).has_value ());
+
+  const WaveformThumbnail thumbnail{
+    .sample_rate = 44100,
+    .num_frames = 1000,
+    .peaks = { { 0.1f, 0.2f, 0.3f }, { 0.4f, 0.5f, 0.6f } },
+  };
+  cache.store (file_hash, thumbnail);
+
+  const auto loaded = cache.load (file_hash);
+  ASSERT_TRUE (loaded.has_value ());
+  EXPECT_EQ (loaded->sample_rate, thumbnail.sample_rate);
+  EXPECT_EQ (loaded->num_frames, thumbnail.num_frames);
+  EXPECT_EQ (loaded->peaks, thumbnail.peaks);
+}
+
+TEST_F (WaveformThumbnailCacheTest, GetOrCreateStoresEntry)
+{
+  WaveformThumbnailCache cache (cache_dir_, MAX_SIZE);
+  const auto thumbnail = cache.get_or_create (TEST_WAV_FILE_PATH);
+  EXPECT_GT (thumbnail.num_frames, 0);
+  ASSERT_EQ (entries ().size (), 1u);
+
+  const auto loaded = cache.load (hash::get_file_hash (TEST_WAV_FILE_PATH));
+  ASSERT_TRUE (loaded.has_value ());
+  EXPECT_EQ (loaded->peaks, thumbnail.peaks);
+
+  // Looking the file up again doesn't add another entry
+  EXPECT_EQ (cache.get_or_create (TEST_WAV_FILE_PATH).peaks, thumbnail.peaks);
+  EXPECT_EQ (entries ().size (), 1u);
+}
+
+TEST_F (WaveformThumbnailCacheTest, CorruptEntryIsRemoved)
+{
+  WaveformThumbnailCache cache (cache_dir_, MAX_SIZE);
+  constexpr hash::HashT  file_hash = 1234;
+  cache.store (
+    file_hash,
+    { .sample_rate = 44100, .num_frames = 10, .peaks = { { 0.1f, 0.2f } } });
+  ASSERT_EQ (entries ().size (), 1u);
+
+  // Truncate the peaks
+  std::filesystem::resize_file (entries ().front (), 66);
+
+  EXPECT_FALSE (cache.load (file_hash).has_value ());
+  EXPECT_TRUE (entries ().empty ());
+}
+
+TEST_F (WaveformThumbnailCacheTest, LeastRecentlyUsedEntriesAreEvicted)
+{
+  const WaveformThumbnail thumbnail{
+    .sample_rate = 44100, .num_frames = 10, .peaks = { { 0.1f, 0.2f } }
+  };
+  constexpr std::uintmax_t entry_size = 64 + (2 * sizeof (float));
+
+  WaveformThumbnailCache cache (cache_dir_, 2 * entry_size);
+  cache.store (1, thumbnail);
+  cache.store (2, thumbnail);
+  EXPECT_EQ (cache.size_bytes (), 2 * entry_size);
+
+  // Replacing an entry doesn't grow the cache
+  cache.store (2, thumbnail);
+  EXPECT_EQ (cache.size_bytes (), 2 * entry_size);
+  ASSERT_EQ (entries ().size (), 2u);
+
+  // Make entry 1 the least recently used
+  const auto now = std::filesystem::file_time_type::clock::now ();
+  for (const auto &entry : entries ())
+    {
+      const bool is_first = entry.stem ().string () == hash::to_string (1);
+      std::filesystem::last_write_time (
+        entry, now - std::chrono::hours (is_first ? 2 : 1));
+    }
+
+  cache.store (3, thumbnail);
+  EXPECT_EQ (cache.size_bytes (), 2 * entry_size);
+  EXPECT_FALSE (cache.load (1).has_value ());
+  EXPECT_TRUE (cache.load (2).has_value ());
+  EXPECT_TRUE (cache.load (3).has_value ());
+
+  // The total is picked up from the directory
+  WaveformThumbnailCache reopened (cache_dir_, 2 * entry_size);
+  EXPECT_EQ (reopened.size_bytes (), 2 * entry_size);
+}
+
+} // namespace zrythm::utils::audio